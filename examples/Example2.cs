@@ -5,7 +5,11 @@ using System;
 using System.Collections.Generic;
 using System.Linq;
 using System.Text;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
 using COIN;
+#endif
 using Sonnet;
 
 namespace SonnetExamples
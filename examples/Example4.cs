@@ -6,7 +6,11 @@ using System.Collections.Generic;
 using System.Linq;
 using System.Text;
 
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
 using COIN;
+#endif
 using Sonnet;
 using System.IO;
 using System.Runtime.Serialization;
@@ -6,7 +6,11 @@ using System.Collections.Generic;
 using System.Runtime.Serialization;
 using System.Text;
 using System.Xml;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
 using COIN;
+#endif
 using Sonnet;
 
 namespace SonnetExamples.Example5
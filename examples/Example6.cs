@@ -6,6 +6,11 @@ using System.Collections.Generic;
 using System.Linq;
 using System.Text;
 using Sonnet;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
+using COIN;
+#endif
 
 namespace SonnetExamples.Example6
 {
@@ -122,7 +127,7 @@ namespace SonnetExamples.Example6
 
             m.Objective = obj;
             m.ObjectiveSense = ObjectiveSense.Minimise;
-            Solver s = new Solver(m, typeof(COIN.OsiCbcSolverInterface));
+            Solver s = new Solver(m, typeof(OsiCbcSolverInterface));
             s.Solve();
 
             Console.WriteLine(s.ToSolutionString());
@@ -10,6 +10,7 @@ using System.Runtime.InteropServices;
 // assembly are visible to a specified assembly.
 [assembly: InternalsVisibleTo("SonnetTest")]
 [assembly: InternalsVisibleTo("SonnetTestNET4")]
+[assembly: InternalsVisibleTo("SonnetBenchmark")]
 
 // General Information about an assembly is controlled through the following 
 // set of attributes. Change these attribute values to modify the information
@@ -0,0 +1,59 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.IO;
+using System.IO.Compression;
+using System.Text;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// Helpers to read gzip-compressed model files, like model.mps.gz, directly, without an uncompressed copy on disk.
+    /// </summary>
+    internal static class CompressedFile
+    {
+        private const string GzipExtension = ".gz";
+        private const int BufferSize = 1 << 16;
+
+        /// <summary>
+        /// Returns true if the given file exists and starts with the gzip magic number.
+        /// </summary>
+        /// <param name="fileName">The name of the file.</param>
+        /// <returns>True if the given file is gzip-compressed.</returns>
+        public static bool IsCompressed(string fileName)
+        {
+            if (!File.Exists(fileName)) return false;
+
+            using (FileStream stream = File.OpenRead(fileName))
+            {
+                return stream.ReadByte() == 0x1f && stream.ReadByte() == 0x8b;
+            }
+        }
+
+        /// <summary>
+        /// Returns the given file name without the .gz extension, if any. For example, model.mps.gz becomes model.mps.
+        /// </summary>
+        /// <param name="fileName">The name of the file.</param>
+        /// <returns>The file name without compression extension.</returns>
+        public static string TrimExtension(string fileName)
+        {
+            if (fileName.EndsWith(GzipExtension, StringComparison.OrdinalIgnoreCase)) return fileName.Substring(0, fileName.Length - GzipExtension.Length);
+            return fileName;
+        }
+
+        /// <summary>
+        /// Opens the given file for reading text. A gzip-compressed file is decompressed on a background thread,
+        /// overlapping with reading the text.
+        /// </summary>
+        /// <param name="fileName">The name of the file.</param>
+        /// <returns>The reader of the (uncompressed) text.</returns>
+        public static TextReader OpenText(string fileName)
+        {
+            Stream stream = new FileStream(fileName, FileMode.Open, FileAccess.Read, FileShare.Read, BufferSize);
+            if (IsCompressed(fileName)) stream = new PipelinedStream(new GZipStream(stream, CompressionMode.Decompress));
+
+            return new StreamReader(stream, Encoding.ASCII, false, BufferSize);
+        }
+    }
+}
@@ -227,7 +227,7 @@ namespace Sonnet
             get { return base.Name; }
             set
             {
-                if (!Name.Equals(value))
+                if (HasLazyName || !Name.Equals(value))
                 {
                     base.Name = value;
                     foreach (Solver solver in solvers) solver.SetConstraintName(this, Name);
@@ -240,7 +240,11 @@ namespace Sonnet
         /// </summary>
         public double Price
         {
-            get { return price; }
+            get
+            {
+                AssignLazySolution();
+                return price;
+            }
         }
 
         /// <summary>
@@ -248,7 +252,11 @@ namespace Sonnet
         /// </summary>
         public double Value
         {
-            get { return value; }
+            get
+            {
+                AssignLazySolution();
+                return value;
+            }
         }
 
         /// <summary>
@@ -355,6 +363,7 @@ namespace Sonnet
         internal CoefVector Coefficients { get { return expr.Coefficients; } }
         internal CoefVector RhsCoefficients { get { return rhs.Coefficients; } }
         internal double RhsConstant { get { return rhs.Constant; } }
+        internal double LhsConstant { get { return expr.Constant; } }
 
         internal virtual void Assemble()
         {
@@ -370,11 +379,69 @@ namespace Sonnet
             expr.Assemble();
         }
 
+        /// <summary>
+        /// Replaces the expression and bounds of this (assembled) constraint by the given row, without updating the solvers.
+        /// Used to update the model to a solver that was changed directly (see Solver.ApplyPatch).
+        /// </summary>
+        /// <param name="expr">The new (assembled) expression, without constant, which is copied.</param>
+        /// <param name="lower">The new lower bound.</param>
+        /// <param name="upper">The new upper bound.</param>
+        /// <returns>False, without changes, if the bounds cannot be represented by a constraint of this class, like ranged or free rows.</returns>
+        internal virtual bool Reset(Expression expr, double lower, double upper)
+        {
+            switch (Model.GetRowSense(lower, upper))
+            {
+                case 'L':
+                    type = ConstraintType.LE;
+                    rhs = new Expression(upper);
+                    break;
+                case 'E':
+                    type = ConstraintType.EQ;
+                    rhs = new Expression(upper);
+                    break;
+                case 'G':
+                    type = ConstraintType.GE;
+                    rhs = new Expression(lower);
+                    break;
+                default:
+                    return false;
+            }
+
+            this.expr = new Expression(expr);
+            return true;
+        }
+
         internal void Assign(Solver solver, int offset, double price, double value)
         {
             base.Assign(solver, offset);
             this.price = price;
             this.value = value;
+            this.solutionVersion = solver.SolutionVersion;
+        }
+
+        /// <summary>
+        /// If the assigned solver has a newer solution than the one of this constraint, 
+        /// then get the price and value from the solution snapshot of the solver (see Solver.LazySolutionAssignment).
+        /// </summary>
+        private void AssignLazySolution()
+        {
+            Solver solver = AssignedSolver;
+            if (solver is null) return;
+
+            int version = solver.SolutionVersion;
+            if (version == solutionVersion) return;
+
+            solver.GetConstraintSolution(Offset, out price, out value);
+            solutionVersion = version;
+        }
+
+        /// <summary>
+        /// Keep the current solution when this constraint is no longer assigned to its solver.
+        /// </summary>
+        protected override void Unassign()
+        {
+            AssignLazySolution();
+            base.Unassign();
         }
 
         private void GutsOfConstructor(string name, Expression expr, ConstraintType type, Expression rhs)
@@ -390,16 +457,16 @@ namespace Sonnet
             this.enabled = true;
 
             if (name != null) Name = name;
-            else Name = string.Format("Con_{0}", id);
+            else SetDefaultName("Con_", id);
         }
 
         /// <summary>
-        /// Used for assigning this.id as numberOf++
+        /// Used for assigning this.id as numberOf++, atomically since constraints can be created on multiple threads.
         /// </summary>
         /// <returns>numberOf++</returns>
         private static int NextId()
         {
-            return numberOfConstraints++;
+            return System.Threading.Interlocked.Increment(ref numberOfConstraints) - 1;
         }
         
         /// <summary>
@@ -410,6 +477,7 @@ namespace Sonnet
         private ConstraintType type;
         private double price;
         private double value;
+        private int solutionVersion;
         private bool enabled;
 
         /// <summary>
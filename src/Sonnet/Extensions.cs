@@ -6,6 +6,12 @@ using System.Collections.Generic;
 using System.Linq;
 using System.Text;
 
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
+using COIN;
+#endif
+
 namespace Sonnet
 {
     /// <summary>
@@ -338,7 +344,7 @@ namespace Sonnet
         /// </summary>
         /// <param name="solver">The solver. Only available for OsiCbc.</param>
         /// <returns>The current bound</returns>
-        internal static double Bound(this COIN.OsiSolverInterface solver)
+        internal static double Bound(this OsiSolverInterface solver)
         {
             Ensure.NotNull(solver, "solver");
 
@@ -348,7 +354,7 @@ namespace Sonnet
             }
 
             // not optimal, so depends per solver
-            if (solver is COIN.OsiCbcSolverInterface osiCbc)
+            if (solver is OsiCbcSolverInterface osiCbc)
             {
                 return osiCbc.Model.getBestPossibleObjValue();
             }
@@ -2,17 +2,44 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 using System;
+using System.Collections.Concurrent;
 using System.Collections.Generic;
 using System.Text;
+using System.Threading;
+
+#if (SONNET_NATIVE)
+using COIN.Native;
+using ClpModel = COIN.Native.ClpSimplex;
+#else
+using COIN;
+#endif
 
 namespace Sonnet
 {
-    internal class MessageHandler : COIN.CoinMessageHandler
+    internal class MessageHandler : CoinMessageHandler
     {
         public MessageHandler()
         {
         }
 
+        /// <summary>
+        /// Create a handler that writes its messages with the Writer of the given handler, for example for another thread.
+        /// </summary>
+        public MessageHandler(MessageHandler writerSource)
+        {
+            this.writerSource = writerSource;
+        }
+
+        /// <summary>
+        /// Gets or sets the writer that writes the messages to the Console on a background thread, or null to write them directly.
+        /// A handler with a writer source always uses the Writer of its source.
+        /// </summary>
+        public QueuedConsoleWriter Writer
+        {
+            get { return (writerSource != null) ? writerSource.Writer : writer; }
+            set { writer = value; }
+        }
+
         public override void setLogLevel(int value)
         {
             base.setLogLevel(value);
@@ -21,10 +48,198 @@ namespace Sonnet
         public override int print()
         {
             string message = messageBuffer();
-            Console.WriteLine(message);
+            QueuedConsoleWriter writer = Writer;
+            if (writer != null) writer.WriteLine(message);
+            else Console.WriteLine(message);
 
             return 0;
         }
+
+        private readonly MessageHandler writerSource;
+        private volatile QueuedConsoleWriter writer;
+    }
+
+    /// <summary>
+    /// Base class of the writers that write messages to the Console in batches, on a background thread,
+    /// such that the threads that log (like solvers) never wait for the Console.
+    /// </summary>
+    internal abstract class BackgroundConsoleWriter : IDisposable
+    {
+        private const int BatchSize = 1024;
+        private const int IntervalMilliseconds = 50;
+
+        /// <summary>
+        /// Starts the background thread. Call this at the end of the constructor of the derived class.
+        /// </summary>
+        protected void Start()
+        {
+            AppDomain.CurrentDomain.ProcessExit += OnProcessExit;
+
+            thread = new Thread(Run);
+            thread.IsBackground = true;
+            thread.Name = "SonnetLog";
+            thread.Start();
+        }
+
+        /// <summary>
+        /// Appends at most maximum messages to the given text, one line per message, and returns the number of messages appended.
+        /// </summary>
+        protected abstract int Take(StringBuilder text, int maximum);
+
+        /// <summary>
+        /// Appends a line with the number of messages dropped since the previous report, if any, and returns the number of lines appended.
+        /// Only to be called by Take.
+        /// </summary>
+        protected int AppendDropped(StringBuilder text, long numberDropped)
+        {
+            long newlyDropped = numberDropped - reportedDropped;
+            if (newlyDropped <= 0) return 0;
+
+            text.AppendLine("SonnetLog: " + newlyDropped + " messages dropped because the buffer was full.");
+            reportedDropped = numberDropped;
+            return 1;
+        }
+
+        /// <summary>
+        /// Wakes up the background thread, instead of waiting for the interval to pass.
+        /// </summary>
+        protected void Wake()
+        {
+            wake.Set();
+        }
+
+        /// <summary>
+        /// Writes all messages currently waiting to the Console.
+        /// </summary>
+        public void Flush()
+        {
+            lock (text)
+            {
+                while (Take(text, BatchSize) > 0)
+                {
+                    Console.Out.Write(text.ToString());
+                    text.Clear();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Stops the background thread, after writing the remaining messages.
+        /// </summary>
+        public void Dispose()
+        {
+            AppDomain.CurrentDomain.ProcessExit -= OnProcessExit;
+            stop = true;
+            wake.Set();
+            thread.Join();
+        }
+
+        private void Run()
+        {
+            while (!stop)
+            {
+                wake.WaitOne(IntervalMilliseconds);
+                Flush();
+            }
+            Flush();
+        }
+
+        private void OnProcessExit(object sender, EventArgs e)
+        {
+            Flush();
+        }
+
+        private Thread thread;
+        private long reportedDropped = 0; // only used by Take, within the lock of Flush
+        private volatile bool stop = false;
+        private readonly AutoResetEvent wake = new AutoResetEvent(false);
+        private readonly StringBuilder text = new StringBuilder();
+    }
+
+#if (!SONNET_NATIVE)
+    /// <summary>
+    /// Writes the messages of a native COIN.BufferedMessageHandler to the Console in batches, on a background thread.
+    /// The solvers only append their messages to the native buffer, so they never wait for the Console, nor call managed code.
+    /// The number of messages dropped by the native buffer is written with the next batch.
+    /// </summary>
+    internal class BufferedMessageWriter : BackgroundConsoleWriter
+    {
+        public BufferedMessageWriter(BufferedMessageHandler handler)
+        {
+            this.handler = handler;
+            Start();
+        }
+
+        protected override int Take(StringBuilder text, int maximum)
+        {
+            int n = handler.take(text, maximum);
+            return n + AppendDropped(text, handler.getNumberDropped());
+        }
+
+        private readonly BufferedMessageHandler handler;
+    }
+#endif
+
+    /// <summary>
+    /// Writes lines to the Console in batches, on a background thread, from a bounded queue.
+    /// WriteLine never blocks: if the queue is full, the line is dropped and counted, and the number of dropped lines
+    /// is written with the next batch.
+    /// </summary>
+    internal class QueuedConsoleWriter : BackgroundConsoleWriter
+    {
+        public const int DefaultCapacity = 8192;
+
+        public QueuedConsoleWriter(int capacity)
+        {
+            Ensure.IsTrue(capacity > 0, "The capacity must be positive.");
+
+            this.capacity = capacity;
+            Start();
+        }
+
+        /// <summary>
+        /// Queues the line to be written to the Console, or drops it if the queue is full.
+        /// </summary>
+        public void WriteLine(string line)
+        {
+            int count = Interlocked.Increment(ref this.count);
+            if (count > capacity)
+            {
+                Interlocked.Decrement(ref this.count);
+                Interlocked.Increment(ref dropped);
+                return;
+            }
+
+            queue.Enqueue(line);
+            if (count == capacity / 2) Wake();
+        }
+
+        /// <summary>
+        /// Gets the number of lines dropped because the queue was full.
+        /// </summary>
+        public long NumberDropped
+        {
+            get { return Interlocked.Read(ref dropped); }
+        }
+
+        protected override int Take(StringBuilder text, int maximum)
+        {
+            int n = 0;
+            string line;
+            while (n < maximum && queue.TryDequeue(out line))
+            {
+                Interlocked.Decrement(ref count);
+                text.AppendLine(line);
+                n++;
+            }
+
+            return n + AppendDropped(text, NumberDropped);
+        }
+
+        private readonly int capacity;
+        private readonly ConcurrentQueue<string> queue = new ConcurrentQueue<string>();
+        private int count = 0;
+        private long dropped = 0;
     }
 
     /// <summary>
@@ -33,27 +248,61 @@ namespace Sonnet
     /// Debug (0), Information (1000), Warning (3000) and Error (6000).
     /// The Source is hardcoded to 'SNNT'.
     /// </summary>
-    internal class SonnetMessages : COIN.CoinMessages
+#if (SONNET_NATIVE)
+    internal class SonnetMessages
+#else
+    internal class SonnetMessages : CoinMessages
+#endif
     {
         public const int Debug = 0;
         public const int Information = 1;
         public const int Warning = 2;
         public const int Error = 3;
 
+        // The detail levels: a message is written if its detail level is at most the log level
+        public const int DebugDetail = 3;
+        public const int InformationDetail = 2;
+        public const int WarningDetail = 1;
+        public const int ErrorDetail = 1;
+
+#if (SONNET_NATIVE)
+        // The COIN message numbers and detail levels per message type, passed with every message
+        private static readonly int[] externalNumbers = { 0, 1000, 3000, 6000 };
+        private static readonly int[] details = { DebugDetail, InformationDetail, WarningDetail, ErrorDetail };
+#else
         public SonnetMessages()
             : base(4)
         {
             source = "SNNT";
-            addMessage(Debug, new COIN.CoinOneMessage(0, 3, "%s"));
-            addMessage(Information, new COIN.CoinOneMessage(1000, 2, "%s"));
-            addMessage(Warning, new COIN.CoinOneMessage(3000, 1, "%s"));
-            addMessage(Error, new COIN.CoinOneMessage(6000, 1, "%s"));
+            addMessage(Debug, new CoinOneMessage(0, DebugDetail, "%s"));
+            addMessage(Information, new CoinOneMessage(1000, InformationDetail, "%s"));
+            addMessage(Warning, new CoinOneMessage(3000, WarningDetail, "%s"));
+            addMessage(Error, new CoinOneMessage(6000, ErrorDetail, "%s"));
+        }
+#endif
+
+        /// <summary>
+        /// Passes the message of the given type to the handler, which prints it now if its detail level is enabled.
+        /// </summary>
+        public void Write(CoinMessageHandler handler, int messageType, string message)
+        {
+#if (SONNET_NATIVE)
+            handler.message(externalNumbers[messageType], details[messageType], "SNNT", message);
+#else
+            handler.message(messageType, this, message).finish();
+#endif
         }
     }
 
     /// <summary>
     /// Singleton with standard MessaHandler (write to Console) and use the defined SonnetMessages types
     /// Debug, Information, Warning and Error.
+    /// The level is checked before a message is passed to the message handler. The Format methods always format the message, since they return it,
+    /// so check IsDebugEnabled or IsInfoEnabled before logging a message that is expensive to build.
+    /// By default, the messages are written to the Console by the thread that logs. To never wait for the Console, write them
+    /// by a background thread (see Asynchronous), or buffer them natively (see Buffered).
+    /// A message handler builds one message at a time, so each thread that logs writes through its own copy of the message handler,
+    /// without locking. The log level is always that of the message handler, also if a solver changed it.
     /// </summary>
     public class SonnetLog
     {
@@ -62,22 +311,18 @@ namespace Sonnet
         /// </summary>
         protected SonnetLog()
         {
-            messageHandler = new MessageHandler();
+            consoleHandler = new MessageHandler();
+            messageHandler = consoleHandler;
             messages = new SonnetMessages();
         }
 
-        private static SonnetLog _default = null;
+        private static readonly Lazy<SonnetLog> _default = new Lazy<SonnetLog>(() => new SonnetLog());
         /// <summary>
-        /// Returns the singleton SonnetLog
+        /// Returns the singleton SonnetLog. Thread-safe: the first use on multiple threads creates a single instance.
         /// </summary>
         public static SonnetLog Default
         {
-            get 
-            {
-                if (_default == null) _default = new SonnetLog();
-
-                return _default;
-            }
+            get { return _default.Value; }
         }
 
         /// <summary>
@@ -85,7 +330,7 @@ namespace Sonnet
         /// Warning: The solver will use the handler for all components. This likely has unintended consequences.
         /// </summary>
         /// <param name="solver">The solver to pass this message handler to.</param>
-        public void PassToSolver(COIN.OsiSolverInterface solver)
+        public void PassToSolver(OsiSolverInterface solver)
         {
             solver.passInMessageHandler(messageHandler);
         }
@@ -95,7 +340,7 @@ namespace Sonnet
         /// Warning: The ClpModel will use the handler for all components. This likely has unintended consequences.
         /// </summary>
         /// <param name="clpModel"></param>
-        public void PassToClpModel(COIN.ClpModel clpModel)
+        public void PassToClpModel(ClpModel clpModel)
         {
             clpModel.passInMessageHandler(messageHandler);
         }
@@ -104,7 +349,7 @@ namespace Sonnet
         /// Pass this message handler to the given CoinMpsIO instance.
         /// </summary>
         /// <param name="obj">The CoinMpsIO instance to pass this message handler to.</param>
-        public void PassToCoinMpsIO(COIN.CoinMpsIO obj)
+        public void PassToCoinMpsIO(CoinMpsIO obj)
         {
             obj.passInMessageHandler(messageHandler);
         }
@@ -113,13 +358,122 @@ namespace Sonnet
         /// Pass this message handler to the given CoinLpIO instance.
         /// </summary>
         /// <param name="obj">The CoinLpIO instance to pass this message handler to.</param>
-        public void PassToCoinLpIO(COIN.CoinLpIO obj)
+        public void PassToCoinLpIO(CoinLpIO obj)
         {
             obj.passInMessageHandler(messageHandler);
         }
 
+        /// <summary>
+        /// Gets or sets whether the messages are buffered natively, instead of written to the Console one by one.
+        /// If buffered, the message handler is a native COIN.BufferedMessageHandler (see BufferedHandler) that appends the messages
+        /// to a lock-free ring buffer, which is written to the Console in batches by a background thread.
+        /// Pass the handler to solvers (PassToSolver, etc.) after setting this property.
+        /// Not supported on SonnetNative (SonnetBackend=Native), which has no BufferedMessageHandler.
+        /// </summary>
+        public bool Buffered
+        {
+#if (SONNET_NATIVE)
+            get { return false; }
+            set { Ensure.Supported(!value, "Buffered messages require the BufferedMessageHandler of SonnetWrapper."); }
+#else
+            get { return bufferedWriter != null; }
+            set
+            {
+                if (value == Buffered) return;
+
+                lock (handlerLock)
+                {
+                    int logLevel = messageHandler.logLevel();
+                    if (value)
+                    {
+                        // The buffered handler is kept, also when switched off, since solvers may still use it
+                        if (bufferedHandler == null) bufferedHandler = new COIN.BufferedMessageHandler();
+                        bufferedWriter = new BufferedMessageWriter(bufferedHandler);
+                        bufferedHandler.setLogLevel(logLevel);
+                        messageHandler = bufferedHandler.Handler;
+                    }
+                    else
+                    {
+                        bufferedWriter.Dispose();
+                        bufferedWriter = null;
+                        consoleHandler.setLogLevel(logLevel);
+                        messageHandler = consoleHandler;
+                    }
+                }
+            }
+#endif
+        }
+
+#if (!SONNET_NATIVE)
+        /// <summary>
+        /// Gets the native buffered message handler, for example to filter messages by number or detail level, or null if never Buffered.
+        /// </summary>
+        public BufferedMessageHandler BufferedHandler
+        {
+            get { return bufferedHandler; }
+        }
+#endif
+
+        /// <summary>
+        /// Gets or sets whether the messages of the (not Buffered) message handler are written to the Console by a background thread,
+        /// instead of by the thread that logs (= Default). The messages wait in a bounded queue: if it is full, messages are dropped
+        /// instead of blocking the thread that logs. The dropped messages are counted (see NumberDropped), and their number is written
+        /// with the next batch. Use Flush to write the waiting messages now.
+        /// </summary>
+        public bool Asynchronous
+        {
+            get { return consoleHandler.Writer != null; }
+            set
+            {
+                if (value == Asynchronous) return;
+
+                if (value)
+                {
+                    consoleHandler.Writer = new QueuedConsoleWriter(QueuedConsoleWriter.DefaultCapacity);
+                }
+                else
+                {
+                    QueuedConsoleWriter writer = consoleHandler.Writer;
+                    consoleHandler.Writer = null;
+                    writer.Dispose();
+                    Interlocked.Add(ref numberDropped, writer.NumberDropped);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of messages dropped because the queue (see Asynchronous) or the native buffer (see Buffered) was full.
+        /// </summary>
+        public long NumberDropped
+        {
+            get
+            {
+                long dropped = Interlocked.Read(ref numberDropped);
+                QueuedConsoleWriter writer = consoleHandler.Writer;
+                if (writer != null) dropped += writer.NumberDropped;
+#if (!SONNET_NATIVE)
+                if (bufferedHandler != null) dropped += bufferedHandler.getNumberDropped();
+#endif
+                return dropped;
+            }
+        }
+
+        /// <summary>
+        /// Writes all waiting messages (see Asynchronous and Buffered) to the Console now.
+        /// </summary>
+        public void Flush()
+        {
+            QueuedConsoleWriter writer = consoleHandler.Writer;
+            if (writer != null) writer.Flush();
+#if (!SONNET_NATIVE)
+            if (bufferedWriter != null) bufferedWriter.Flush();
+#endif
+        }
+
         /// <summary>
         /// Gets or sets the logLevel of this message handler. See COIN documentation.
+        /// Debug messages are written at log level 3 and higher, Information messages at 2 and higher, 
+        /// and Warning and Error messages at 1 and higher.
         /// </summary>
         public int LogLevel
         {
@@ -127,6 +481,22 @@ namespace Sonnet
             set { messageHandler.setLogLevel(value); }
         }
 
+        /// <summary>
+        /// Returns true iff Debug messages are written at the current LogLevel.
+        /// </summary>
+        public bool IsDebugEnabled
+        {
+            get { return IsEnabled(SonnetMessages.DebugDetail); }
+        }
+
+        /// <summary>
+        /// Returns true iff Information messages are written at the current LogLevel.
+        /// </summary>
+        public bool IsInfoEnabled
+        {
+            get { return IsEnabled(SonnetMessages.InformationDetail); }
+        }
+
         /// <summary>
         /// Write a Debug message (log level 0) to this message handler.
         /// </summary>
@@ -134,8 +504,7 @@ namespace Sonnet
         /// <returns>The logged message.</returns>
         public string Debug(string message)
         {
-            messageHandler.message(SonnetMessages.Debug, messages, message);
-            return message;
+            return Log(SonnetMessages.Debug, SonnetMessages.DebugDetail, message);
         }
 
         /// <summary>
@@ -143,6 +512,7 @@ namespace Sonnet
         /// See string.Format(..) : 
         /// Replaces the format item in a specified string with the string representation
         ///  of a corresponding object in a specified array.
+        /// Check IsDebugEnabled first to avoid formatting a message that is not written.
         /// </summary>
         /// <param name="format">A composite format string.</param>
         /// <param name="args">An object array that contains zero or more objects to format.</param>
@@ -152,6 +522,36 @@ namespace Sonnet
             return Debug(string.Format(format, args));
         }
 
+        /// <summary>
+        /// Write a formatted Debug message (written at log level 3 and higher) to this message handler,
+        /// as DebugFormat(string, params object[]), but without allocating the array of arguments.
+        /// </summary>
+        /// <returns>The logged message.</returns>
+        public string DebugFormat<T0>(string format, T0 arg0)
+        {
+            return Debug(string.Format(format, arg0));
+        }
+
+        /// <summary>
+        /// Write a formatted Debug message (written at log level 3 and higher) to this message handler,
+        /// as DebugFormat(string, params object[]), but without allocating the array of arguments.
+        /// </summary>
+        /// <returns>The logged message.</returns>
+        public string DebugFormat<T0, T1>(string format, T0 arg0, T1 arg1)
+        {
+            return Debug(string.Format(format, arg0, arg1));
+        }
+
+        /// <summary>
+        /// Write a formatted Debug message (written at log level 3 and higher) to this message handler,
+        /// as DebugFormat(string, params object[]), but without allocating the array of arguments.
+        /// </summary>
+        /// <returns>The logged message.</returns>
+        public string DebugFormat<T0, T1, T2>(string format, T0 arg0, T1 arg1, T2 arg2)
+        {
+            return Debug(string.Format(format, arg0, arg1, arg2));
+        }
+
         /// <summary>
         /// Write an Information message (log level 1000) to this message handler.
         /// </summary>
@@ -159,8 +559,7 @@ namespace Sonnet
         /// <returns>The logged message.</returns>
         public string Info(string message)
         {
-            messageHandler.message(SonnetMessages.Information, messages, message);
-            return message;
+            return Log(SonnetMessages.Information, SonnetMessages.InformationDetail, message);
         }
 
         /// <summary>
@@ -168,6 +567,7 @@ namespace Sonnet
         /// See string.Format(..) : 
         /// Replaces the format item in a specified string with the string representation
         ///  of a corresponding object in a specified array.
+        /// Check IsInfoEnabled first to avoid formatting a message that is not written.
         /// </summary>
         /// <param name="format">A composite format string.</param>
         /// <param name="args">An object array that contains zero or more objects to format.</param>
@@ -177,6 +577,36 @@ namespace Sonnet
             return Info(string.Format(format, args));
         }
 
+        /// <summary>
+        /// Write a formatted Information message (written at log level 2 and higher) to this message handler,
+        /// as InfoFormat(string, params object[]), but without allocating the array of arguments.
+        /// </summary>
+        /// <returns>The logged message.</returns>
+        public string InfoFormat<T0>(string format, T0 arg0)
+        {
+            return Info(string.Format(format, arg0));
+        }
+
+        /// <summary>
+        /// Write a formatted Information message (written at log level 2 and higher) to this message handler,
+        /// as InfoFormat(string, params object[]), but without allocating the array of arguments.
+        /// </summary>
+        /// <returns>The logged message.</returns>
+        public string InfoFormat<T0, T1>(string format, T0 arg0, T1 arg1)
+        {
+            return Info(string.Format(format, arg0, arg1));
+        }
+
+        /// <summary>
+        /// Write a formatted Information message (written at log level 2 and higher) to this message handler,
+        /// as InfoFormat(string, params object[]), but without allocating the array of arguments.
+        /// </summary>
+        /// <returns>The logged message.</returns>
+        public string InfoFormat<T0, T1, T2>(string format, T0 arg0, T1 arg1, T2 arg2)
+        {
+            return Info(string.Format(format, arg0, arg1, arg2));
+        }
+
         /// <summary>
         /// Write a Warning message (log level 3000) to this message handler.
         /// </summary>
@@ -184,8 +614,7 @@ namespace Sonnet
         /// <returns>The logged message.</returns>
         public string Warn(string message)
         {
-            messageHandler.message(SonnetMessages.Warning, messages, message);
-            return message;
+            return Log(SonnetMessages.Warning, SonnetMessages.WarningDetail, message);
         }
 
         /// <summary>
@@ -209,8 +638,7 @@ namespace Sonnet
         /// <returns>The logged message.</returns>
         public string Error(string message)
         {
-            messageHandler.message(SonnetMessages.Error, messages, message);
-            return message;
+            return Log(SonnetMessages.Error, SonnetMessages.ErrorDetail, message);
         }
 
         /// <summary>
@@ -218,6 +646,7 @@ namespace Sonnet
         /// See string.Format(..) : 
         /// Replaces the format item in a specified string with the string representation
         ///  of a corresponding object in a specified array.
+        /// The message is always formatted, since it is typically also used for an exception.
         /// </summary>
         /// <param name="format">A composite format string.</param>
         /// <param name="args">An object array that contains zero or more objects to format.</param>
@@ -227,7 +656,69 @@ namespace Sonnet
             return Error(string.Format(format, args));
         }
 
-        private COIN.CoinMessageHandler messageHandler;
-        private COIN.CoinMessages messages;
+        private bool IsEnabled(int detail)
+        {
+            return detail <= messageHandler.logLevel();
+        }
+
+        /// <summary>
+        /// Passes the message to the handler of this thread if its detail level is enabled, and finishes it such that it is printed now.
+        /// </summary>
+        private string Log(int messageType, int detail, string message)
+        {
+            CoinMessageHandler handler = messageHandler;
+            if (detail > handler.logLevel()) return message;
+
+            messages.Write(GetThreadHandler(handler), messageType, message);
+            return message;
+        }
+
+        /// <summary>
+        /// Returns the handler of the current thread that writes to the same Console writer or native buffer as the given handler.
+        /// The level was already checked, so the thread handlers write all messages passed to them.
+        /// </summary>
+        private CoinMessageHandler GetThreadHandler(CoinMessageHandler handler)
+        {
+            ThreadHandler threadHandler = threadHandlers.Value;
+            if (threadHandler.Source == handler) return threadHandler.Handler;
+
+#if (!SONNET_NATIVE)
+            if (handler != consoleHandler)
+            {
+                BufferedMessageHandler clone = bufferedHandler.clone();
+                threadHandler.Owner = clone;
+                threadHandler.Handler = clone.Handler;
+            }
+            else
+#endif
+            {
+                threadHandler.Owner = null;
+                threadHandler.Handler = new MessageHandler(consoleHandler);
+            }
+            threadHandler.Handler.setLogLevel(SonnetMessages.DebugDetail);
+            threadHandler.Source = handler;
+            return threadHandler.Handler;
+        }
+
+        /// <summary>
+        /// The message handler of a thread that logs, for the (shared) message handler it was created for.
+        /// </summary>
+        private sealed class ThreadHandler
+        {
+            public CoinMessageHandler Source;
+            public CoinMessageHandler Handler;
+            public object Owner; // the native clone of the Handler, if any
+        }
+
+        private long numberDropped = 0; // by the queues of previous Asynchronous writers
+        private volatile CoinMessageHandler messageHandler;
+        private readonly MessageHandler consoleHandler;
+        private readonly ThreadLocal<ThreadHandler> threadHandlers = new ThreadLocal<ThreadHandler>(() => new ThreadHandler());
+        private readonly object handlerLock = new object(); // only for switching the message handler
+#if (!SONNET_NATIVE)
+        private BufferedMessageHandler bufferedHandler;
+        private BufferedMessageWriter bufferedWriter;
+#endif
+        private readonly SonnetMessages messages;
     }
 }
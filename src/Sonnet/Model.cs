@@ -10,7 +10,11 @@ using System.Diagnostics;
 using System.IO;
 using System.Reflection;
 
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
 using COIN;
+#endif
 
 namespace Sonnet
 {
@@ -262,7 +266,7 @@ namespace Sonnet
 
         /// <summary>
         /// Creates a new model from the given file, assuming the file is of fileType mps, or lp.
-        /// The filename will be the model name.
+        /// The filename will be the model name. Gzip-compressed files are decompressed while reading.
         /// </summary>
         /// <param name="fileName">The mps or lp file to be imported</param>
         /// <param name="fileType">File type, like mps, .mps, lp or .lp.</param>
@@ -278,15 +282,16 @@ namespace Sonnet
 
         /// <summary>
         /// Creates a new model from the given file. The filename will be the model name.
-        /// The filename must have a valid extension.
+        /// The filename must have a valid extension. Gzip-compressed files, like model.mps.gz, are decompressed while reading.
+        /// Binary snapshots, as exported by Solver.Export to a .snapshot file, are loaded as well.
         /// </summary>
-        /// <param name="fileName">The name of the file with extension mps or lp imported.</param>
+        /// <param name="fileName">The name of the file with extension mps, lp or snapshot imported.</param>
         /// <param name="variables">The full array of variables created for this new model.</param>
         /// <returns>The new model, or an exception if an error occurred.</returns>
         public static Model New(string fileName, out Variable[] variables)
         {
             Ensure.NotNullOrWhiteSpace(fileName, "fileName cannot be empty");
-            string extension = Path.GetExtension(fileName).ToLower();
+            string extension = Path.GetExtension(CompressedFile.TrimExtension(fileName)).ToLower();
 
             return Model.New(fileName, extension, out variables);
         }
@@ -296,15 +301,29 @@ namespace Sonnet
         /// The filename will be the model name.
         /// </summary>
         /// <param name="fileName">The mps or lp file to be imported</param>
-        /// <param name="fileType">File type, like mps, .mps, lp or .lp.</param>
+        /// <param name="fileType">File type, like mps, .mps, lp, .lp or .snapshot.</param>
         /// <param name="variables">The full array of variables created for this new model.</param>
         /// <returns>The new model, or an exception if an error occurred.</returns>
         public static Model New(string fileName, string fileType, out Variable[] variables)
+        {
+            return Model.New(fileName, fileType, out variables, DefaultParallelMpsReaderThreshold);
+        }
+
+        /// <summary>
+        /// Creates a new model from the given file, assuming the file is of fileType mps, or lp.
+        /// Mps files of at least the given size are imported by the native multithreaded reader.
+        /// </summary>
+        /// <param name="fileName">The mps or lp file to be imported</param>
+        /// <param name="fileType">File type, like mps, .mps, lp, .lp or .snapshot.</param>
+        /// <param name="variables">The full array of variables created for this new model.</param>
+        /// <param name="parallelMpsReaderThreshold">The size in bytes from which mps files are read by the native multithreaded reader.</param>
+        /// <returns>The new model, or an exception if an error occurred.</returns>
+        internal static Model New(string fileName, string fileType, out Variable[] variables, long parallelMpsReaderThreshold)
         {
             Ensure.NotNullOrWhiteSpace(fileName, "fileName cannot be empty");
             Ensure.NotNullOrWhiteSpace(fileType, "fileType cannot be empty");
 
-            string fileNameWithoutExtension = Path.GetFileNameWithoutExtension(fileName);
+            string fileNameWithoutExtension = Path.GetFileNameWithoutExtension(CompressedFile.TrimExtension(fileName));
             string extension = "." + fileType.TrimStart('.').ToLower();
 
             Model model = null;
@@ -312,11 +331,41 @@ namespace Sonnet
             if (extension.Equals(".mps"))
             {
                 #region New Model from .mps file
+                // First try to read the file in a single pass straight into the model, or, for very large files,
+                // with the native multithreaded reader.
+                // Only if it contains anything not supported by these readers, fall back to reading via Clp.
+                // Clp also handles file names without extension, or compressed files.
+                if (File.Exists(fileName))
+                {
+                    try
+                    {
+#if (SONNET_NATIVE)
+                        // SonnetNative has no multithreaded reader
+                        model = MpsModelReader.Read(fileName, out variables);
+#else
+                        // The native reader memory-maps the file, so it cannot read compressed files
+                        if (new FileInfo(fileName).Length >= parallelMpsReaderThreshold && !CompressedFile.IsCompressed(fileName)) model = NewFromMpsParallelReader(fileName, out variables);
+                        else model = MpsModelReader.Read(fileName, out variables);
+#endif
+
+                        model.Name = fileNameWithoutExtension;
+                        return model;
+                    }
+                    catch (Exception e) when (e is FormatException || e is CoinError)
+                    {
+                        log.InfoFormat("Reading the mps file '{0}' via Clp: {1}", fileName, e.Message);
+                    }
+                }
+
                 string directoryName = Path.GetDirectoryName(fileName);
                 if (directoryName.Length == 0) directoryName = ".";
 
                 string fullPathWithoutExtension = Path.Combine(directoryName, fileNameWithoutExtension);
 
+#if (SONNET_NATIVE)
+                // SonnetNative has no ClpSimplex.readMps with quadratic objectives, so read via OsiClp, which ignores these
+                model = NewFromOsiMps(fileName, out variables);
+#else
                 // Previously, CoinMpsIO was used but that doesnt read quad info.
                 // To read MPS with QUAD info use ClpModel or CoinModel readMps. 
                 // CoinModel we havent Wrapped yet at all, so more work.
@@ -353,13 +402,14 @@ namespace Sonnet
                     quadraticObjective = clpQuadraticObjective.quadraticObjective();
                 }
 
-                model = NewHelper(out variables, m.isInteger, m.columnName, m.rowName,
+                model = NewHelper(out variables, m.isInteger, m.columnNames(), m.rowNames(),
                     m.getColLower(), m.getColUpper(), "OBJROW", m.getObjCoefficients(),
                     m.getNumCols(), m.getNumRows(), osiClp.getRowSense(), osiClp.getMatrixByRow(), m.getRowLower(), m.getRowUpper(), fullQuadraticMatrix, quadraticObjective);
 
                 // Ensure osiClp is not disposed right after a shallow copy of getMatrixByRow was taken for NewHelper call.
                 GC.KeepAlive(osiClp);
                 GC.KeepAlive(m);
+#endif
 
                 model.Name = fileNameWithoutExtension;
                 #endregion
@@ -367,6 +417,26 @@ namespace Sonnet
             else if (extension.Equals(".lp"))
             {
                 #region New Model from .lp file
+                // First try the native single-pass reader. Only if the file contains anything not supported by that reader,
+                // or is compressed, fall back to CoinLpIO.
+#if (SONNET_NATIVE)
+                // SonnetNative has no single-pass reader
+                model = NewFromCoinLpIO(fileName, out variables);
+#else
+                if (File.Exists(fileName) && !CompressedFile.IsCompressed(fileName))
+                {
+                    try
+                    {
+                        model = NewFromLpReader(fileName, out variables);
+                        model.Name = fileNameWithoutExtension;
+                        return model;
+                    }
+                    catch (CoinError e)
+                    {
+                        log.InfoFormat("Reading the lp file '{0}' via CoinLpIO: {1}", fileName, e.Message);
+                    }
+                }
+
                 CoinLpIO m = new CoinLpIO();
                 log.PassToCoinLpIO(m);
 
@@ -376,15 +446,50 @@ namespace Sonnet
                 // flipped to get a minimization problem.  
                 m.readLp(fileName);
 
-                model = NewHelper(out variables, m.isInteger, m.columnName, m.rowName,
+                model = NewHelper(out variables, m.isInteger, m.getColNames(), m.getRowNames(),
                     m.getColLower(), m.getColUpper(), m.getObjName(), m.getObjCoefficients(),
                     m.getNumCols(), m.getNumRows(), m.getRowSense(), m.getMatrixByRow(), m.getRowLower(), m.getRowUpper(), false, null);
 
                 GC.KeepAlive(m);
+#endif
 
                 model.Name = fileNameWithoutExtension;
                 #endregion
             }
+            else if (extension.Equals(".snapshot"))
+            {
+                #region New Model from .snapshot file
+#if (SONNET_NATIVE)
+                throw new NotSupportedException("Snapshots require the ProblemSnapshot of SonnetWrapper.");
+#else
+                // A binary snapshot, as exported by Solver.Export, is loaded straight into Clp
+                ClpSimplex m = new ClpSimplex();
+                OsiClpSolverInterface osiClp = new OsiClpSolverInterface(m);
+                log.PassToClpModel(m);
+
+                // Keep the names of the snapshot, if any
+                osiClp.setIntParam(OsiIntParam.OsiNameDiscipline, 1);
+                ProblemSnapshot.load(fileName, osiClp);
+
+                bool fullQuadraticMatrix = false;
+                CoinPackedMatrix quadraticObjective = null;
+                if (m.objectiveAsObject() is ClpQuadraticObjective clpQuadraticObjective)
+                {
+                    fullQuadraticMatrix = clpQuadraticObjective.fullMatrix();
+                    quadraticObjective = clpQuadraticObjective.quadraticObjective();
+                }
+
+                model = NewHelper(out variables, m.isInteger, m.columnNames(), m.rowNames(),
+                    m.getColLower(), m.getColUpper(), osiClp.getObjName(), m.getObjCoefficients(),
+                    m.getNumCols(), m.getNumRows(), osiClp.getRowSense(), osiClp.getMatrixByRow(), m.getRowLower(), m.getRowUpper(), fullQuadraticMatrix, quadraticObjective);
+
+                GC.KeepAlive(osiClp);
+                GC.KeepAlive(m);
+
+                model.Name = fileNameWithoutExtension;
+#endif
+                #endregion
+            }
             else
             {
                 string message = string.Format("Cannot import file {0} : unknown extension '{1}'.", fileName, extension);
@@ -407,8 +512,8 @@ namespace Sonnet
         /// </summary>
         /// <param name="variables"></param>
         /// <param name="isIntegerFunc"></param>
-        /// <param name="columnNameFunc"></param>
-        /// <param name="rowNameFunc"></param>
+        /// <param name="columnNames">The names of the variables. Variables with an empty name get a default name VAR{i}, created only when used.</param>
+        /// <param name="rowNames">The names of the constraints. Constraints with an empty name get a default name CON{j}, created only when used.</param>
         /// <param name="colLower"></param>
         /// <param name="colUpper"></param>
         /// <param name="objName"></param>
@@ -423,8 +528,117 @@ namespace Sonnet
         /// <param name="quadraticObjective">Quadratic objective. Can be null.</param>
         /// <returns></returns>
         [System.Diagnostics.CodeAnalysis.SuppressMessage("Major Code Smell", "S107:Methods should not have too many parameters", Justification = "Private member and by design")]
-        private static Model NewHelper(out Variable[] variables, Func<int, bool> isIntegerFunc, Func<int, string> columnNameFunc, Func<int, string> rowNameFunc,
+        private static Model NewHelper(out Variable[] variables, Func<int, bool> isIntegerFunc, string[] columnNames, string[] rowNames,
             double[] colLower, double[] colUpper, string objName, double[] objCoefs, int numberVariables, int numberConstraints, char[] rowSenses, CoinPackedMatrix rowMatrix, double[] rowLowers, double[] rowUppers, bool fullQuadraticMatrix, CoinPackedMatrix quadraticObjective)
+        {
+            // Take the arrays of the matrix at once, instead of a vector per row
+            return NewHelper(out variables, isIntegerFunc, columnNames, rowNames, colLower, colUpper, objName, objCoefs, numberVariables, numberConstraints,
+                rowSenses, rowMatrix.getVectorStarts(), rowMatrix.getVectorLengths(), rowMatrix.getIndices(), rowMatrix.getElements(), rowLowers, rowUppers, fullQuadraticMatrix, quadraticObjective);
+        }
+
+        /// <summary>
+        /// Create new model from given arrays, with the constraints given row by row.
+        /// </summary>
+        /// <param name="variables">The new variables, in the order of the columns.</param>
+        /// <param name="isIntegerFunc">Whether or not the column of the given index is integer.</param>
+        /// <param name="columnNames">The names of the variables. Variables with an empty name get a default name VAR{i}, created only when used.</param>
+        /// <param name="rowNames">The names of the constraints. Constraints with an empty name get a default name CON{j}, created only when used.</param>
+        /// <param name="colLower">The lower bounds of the variables.</param>
+        /// <param name="colUpper">The upper bounds of the variables.</param>
+        /// <param name="objName">The name of the objective.</param>
+        /// <param name="objCoefs">The objective coefficients of the variables.</param>
+        /// <param name="numberVariables">The number of variables (columns).</param>
+        /// <param name="numberConstraints">The number of constraints (rows).</param>
+        /// <param name="rowSenses">The sense of each row: 'L', 'G', 'E', 'R' or 'N'.</param>
+        /// <param name="rowStarts">The start of each row in rowIndices and rowElements.</param>
+        /// <param name="rowLengths">The number of elements of each row, or null if each row ends at the start of the next row.</param>
+        /// <param name="rowIndices">The column indices of the elements, row by row.</param>
+        /// <param name="rowElements">The elements, row by row.</param>
+        /// <param name="rowLowers">The lower bounds of the rows.</param>
+        /// <param name="rowUppers">The upper bounds of the rows.</param>
+        /// <param name="fullQuadraticMatrix">Whether or not the given quadratic objective matrix is full (true) or only half (false).</param>
+        /// <param name="quadraticObjective">Quadratic objective. Can be null.</param>
+        /// <returns>The new model.</returns>
+        [System.Diagnostics.CodeAnalysis.SuppressMessage("Major Code Smell", "S107:Methods should not have too many parameters", Justification = "Private member and by design")]
+        private static Model NewHelper(out Variable[] variables, Func<int, bool> isIntegerFunc, string[] columnNames, string[] rowNames,
+            double[] colLower, double[] colUpper, string objName, double[] objCoefs, int numberVariables, int numberConstraints, char[] rowSenses,
+            int[] rowStarts, int[] rowLengths, int[] rowIndices, double[] rowElements, double[] rowLowers, double[] rowUppers, bool fullQuadraticMatrix, CoinPackedMatrix quadraticObjective)
+        {
+            Model model = NewHelper(out variables, isIntegerFunc, columnNames, colLower, colUpper, objName, objCoefs, numberVariables, fullQuadraticMatrix, quadraticObjective);
+
+            for (int j = 0; j < numberConstraints; j++)
+            {
+                Expression expr = new Expression();
+                int start = rowStarts[j];
+                int end = (rowLengths != null) ? start + rowLengths[j] : rowStarts[j + 1];
+
+                for (int e = start; e < end; e++)
+                {
+                    expr.Add(rowElements[e], variables[rowIndices[e]]);
+                }
+
+                AddConstraint(model, j, rowNames[j], expr, rowSenses[j], rowLowers[j], rowUppers[j]);
+            }
+            return model;
+        }
+
+        /// <summary>
+        /// Create new model from given arrays, with the constraints given column by column.
+        /// The expressions of all constraints are built first, and each is released once its constraint was added.
+        /// </summary>
+        /// <param name="variables">The new variables, in the order of the columns.</param>
+        /// <param name="isIntegerFunc">Whether or not the column of the given index is integer.</param>
+        /// <param name="columnNames">The names of the variables. Variables with an empty name get a default name VAR{i}, created only when used.</param>
+        /// <param name="rowNames">The names of the constraints. Constraints with an empty name get a default name CON{j}, created only when used.</param>
+        /// <param name="colLower">The lower bounds of the variables.</param>
+        /// <param name="colUpper">The upper bounds of the variables.</param>
+        /// <param name="objName">The name of the objective.</param>
+        /// <param name="objCoefs">The objective coefficients of the variables.</param>
+        /// <param name="numberVariables">The number of variables (columns).</param>
+        /// <param name="numberConstraints">The number of constraints (rows).</param>
+        /// <param name="rowSenses">The sense of each row: 'L', 'G', 'E', 'R' or 'N'.</param>
+        /// <param name="colStarts">The start of each column in colIndices and colElements, and the number of elements at the end.</param>
+        /// <param name="colIndices">The row indices of the elements, column by column.</param>
+        /// <param name="colElements">The elements, column by column.</param>
+        /// <param name="rowLowers">The lower bounds of the rows.</param>
+        /// <param name="rowUppers">The upper bounds of the rows.</param>
+        /// <returns>The new model.</returns>
+        [System.Diagnostics.CodeAnalysis.SuppressMessage("Major Code Smell", "S107:Methods should not have too many parameters", Justification = "Private member and by design")]
+        private static Model NewHelperByColumn(out Variable[] variables, Func<int, bool> isIntegerFunc, string[] columnNames, string[] rowNames,
+            double[] colLower, double[] colUpper, string objName, double[] objCoefs, int numberVariables, int numberConstraints, char[] rowSenses,
+            int[] colStarts, int[] colIndices, double[] colElements, double[] rowLowers, double[] rowUppers)
+        {
+            Model model = NewHelper(out variables, isIntegerFunc, columnNames, colLower, colUpper, objName, objCoefs, numberVariables, false, null);
+
+            Expression[] exprs = new Expression[numberConstraints];
+            for (int j = 0; j < numberConstraints; j++) exprs[j] = new Expression();
+
+            for (int i = 0; i < numberVariables; i++)
+            {
+                Variable var = variables[i];
+                int end = colStarts[i + 1];
+                for (int e = colStarts[i]; e < end; e++)
+                {
+                    exprs[colIndices[e]].Add(colElements[e], var);
+                }
+            }
+
+            for (int j = 0; j < numberConstraints; j++)
+            {
+                // The expression is copied by the constraint
+                AddConstraint(model, j, rowNames[j], exprs[j], rowSenses[j], rowLowers[j], rowUppers[j]);
+                exprs[j] = null;
+            }
+            return model;
+        }
+
+        /// <summary>
+        /// Create new model with the variables and objective from the given arrays, but without constraints.
+        /// </summary>
+        /// <remarks>See the parameters at NewHelper with a CoinPackedMatrix.</remarks>
+        [System.Diagnostics.CodeAnalysis.SuppressMessage("Major Code Smell", "S107:Methods should not have too many parameters", Justification = "Private member and by design")]
+        private static Model NewHelper(out Variable[] variables, Func<int, bool> isIntegerFunc, string[] columnNames,
+            double[] colLower, double[] colUpper, string objName, double[] objCoefs, int numberVariables, bool fullQuadraticMatrix, CoinPackedMatrix quadraticObjective)
         {
             Model model = new Model();
             variables = new Variable[numberVariables];
@@ -440,9 +654,9 @@ namespace Sonnet
                 double upper = colUpper[i];
                 bool isInteger = isIntegerFunc.Invoke(i);
 
-                string name = columnNameFunc.Invoke(i);
+                string name = columnNames[i];
                 if (!string.IsNullOrEmpty(name)) var.Name = name;
-                else var.Name = string.Concat("VAR", i);
+                else var.SetDefaultName("VAR", i);
 
                 var.Lower = lower;
                 var.Upper = upper;
@@ -456,13 +670,13 @@ namespace Sonnet
                 // Read the elements of CoinPackedMatrix of quadraticObjective
                 // and add these to the objExpr in quadratic form
                 // Check if the quadratic elements are given in full matrix or not--to prevent double counting.
+                int[] starts = quadraticObjective.getVectorStarts();
+                int[] lengths = quadraticObjective.getVectorLengths();
+                int[] indices = quadraticObjective.getIndices(); // the column indices
+                double[] elements = quadraticObjective.getElements();
                 for (int i = 0; i < numberVariables; i++)
                 {
-                    var vector = quadraticObjective.getVector(i);
-                    int nElements = vector.getNumElements();
-                    var indices = vector.getIndices(); // returns the column index
-                    var elements = vector.getElements();
-                    for (int e = 0; e < nElements; e++)
+                    for (int e = starts[i]; e < starts[i] + lengths[i]; e++)
                     {
                         int j = indices[e];
 
@@ -484,96 +698,262 @@ namespace Sonnet
             // NOTE: MPS DOESNT STORE MAXIMIZATION OR MINIMIZATION!
             // bUT LP always returns Minimization (and transforms objective accordingly if original is max)
 
-            for (int j = 0; j < numberConstraints; j++)
+            return model;
+        }
+
+        /// <summary>
+        /// Adds the new constraint of the given row to the given model. A row without a name gets the default name CON{row}.
+        /// </summary>
+        private static void AddConstraint(Model model, int row, string name, Expression expr, char rowSense, double lower, double upper)
+        {
+            Constraint con = AddConstraint(model, string.IsNullOrEmpty(name) ? null : name, expr, rowSense, lower, upper);
+            if (con != null && string.IsNullOrEmpty(name)) con.SetDefaultName("CON", row);
+        }
+
+#if (SONNET_NATIVE)
+        /// <summary>
+        /// Creates a new model from the given mps file, read by OsiClp of SonnetNative. Quadratic objectives are not read.
+        /// </summary>
+        /// <param name="fileName">The mps file to be imported.</param>
+        /// <param name="variables">The full array of variables created for the new model.</param>
+        /// <returns>The new model.</returns>
+        private static Model NewFromOsiMps(string fileName, out Variable[] variables)
+        {
+            using (OsiClpSolverInterface osiClp = new OsiClpSolverInterface())
             {
-                Expression expr = new Expression();
-                CoinShallowPackedVector vector = rowMatrix.getVector(j); // I guess..
-                int nElements = vector.getNumElements();
-                int[] indices = vector.getIndices();
-                double[] elements = vector.getElements();
+                log.PassToSolver(osiClp);
 
-                for (int e = 0; e < nElements; e++)
+                // Keep the names of the file
+                osiClp.setIntParam(OsiIntParam.OsiNameDiscipline, 1);
+                int numberErrors = osiClp.readMps(fileName);
+                if (numberErrors != 0)
                 {
-                    int index = indices[e];
-                    Variable var = variables[index];
-                    double coef = elements[e];
-
-                    expr.Add(coef, var);
+                    string message = string.Format("Errors occurred when reading the mps file '{0}'.", fileName);
+                    SonnetLog.Default.Error(message);
+                    throw new SonnetException(message);
                 }
 
-                double lower = rowLowers[j];
-                double upper = rowUppers[j];
+                return NewHelper(out variables, osiClp.isInteger, osiClp.getColNames(), osiClp.getRowNames(),
+                    osiClp.getColLower(), osiClp.getColUpper(), "OBJROW", osiClp.getObjCoefficients(),
+                    osiClp.getNumCols(), osiClp.getNumRows(), osiClp.getRowSense(), osiClp.getMatrixByRow(), osiClp.getRowLower(), osiClp.getRowUpper(), false, null);
+            }
+        }
 
-                string name = rowNameFunc.Invoke(j);
-                string conName;
-                if (!string.IsNullOrEmpty(name)) conName = name;
-                else conName = string.Concat("CON", j);
+        /// <summary>
+        /// Creates a new model from the given lp file, read by CoinLpIO of SonnetNative.
+        /// </summary>
+        /// <param name="fileName">The lp file to be imported.</param>
+        /// <param name="variables">The full array of variables created for the new model.</param>
+        /// <returns>The new model.</returns>
+        private static Model NewFromCoinLpIO(string fileName, out Variable[] variables)
+        {
+            using (CoinLpIO m = new CoinLpIO())
+            {
+                log.PassToCoinLpIO(m);
 
-                switch (rowSenses[j])
-                {
-                    case 'L': //<= constraint and rhs()[i] == rowupper()[i]
-                        {
-                            ConstraintType type = ConstraintType.LE;
-                            Expression upperExpr = new Expression(upper);
-                            Constraint con = new Constraint(conName, expr, type, upperExpr);
-                            upperExpr.Clear();
-                            model.Add(con);
-                            break;
-                        }
-                    case 'E': //=  constraint
-                        {
-                            ConstraintType type = ConstraintType.EQ;
-                            Expression upperExpr = new Expression(upper);
-                            Constraint con = new Constraint(conName, expr, type, upperExpr);
-                            upperExpr.Clear();
-                            model.Add(con);
-                            break;
-                        }
-                    case 'G': //>= constraint and rhs()[i] == rowlower()[i]
-                        {
-                            ConstraintType type = ConstraintType.GE;
-                            Expression lowerExpr = new Expression(lower);
-                            Constraint con = new Constraint(conName, expr, type, lowerExpr);
-                            lowerExpr.Clear();
-                            model.Add(con);
-                            break;
-                        }
-                    case 'R': //ranged constraint
-                        {
-                            RangeConstraint con = new RangeConstraint(conName, lower, expr, upper);
-                            model.Add(con);
-                            break;
-                        }
-                    case 'N': //free constraint
-                        {
-                            RangeConstraint con = new RangeConstraint(conName, lower, expr, upper);
-                            con.Enabled = false;
-                            model.Add(con);
-                            break;
-                        }
-                    default:
-                        break;
-                }
+                // As in SonnetWrapper, the objective of a maximization problem is negated to get a minimization problem.
+                m.readLp(fileName);
+
+                int numberRows = m.getNumRows();
+                double[] rowLower = m.getRowLower();
+                double[] rowUpper = m.getRowUpper();
+                char[] rowSenses = new char[numberRows];
+                for (int j = 0; j < numberRows; j++) rowSenses[j] = GetRowSense(rowLower[j], rowUpper[j]);
+
+                bool[] isInteger = m.getIntegerColumns();
+                m.getMatrixByCol(out int[] colStarts, out int[] colIndices, out double[] colElements);
+
+                return NewHelperByColumn(out variables, i => isInteger[i], m.getColNames(), m.getRowNames(),
+                    m.getColLower(), m.getColUpper(), m.getObjName(), m.getObjCoefficients(), m.getNumCols(), numberRows, rowSenses,
+                    colStarts, colIndices, colElements, rowLower, rowUpper);
             }
+        }
+#else
+        /// <summary>
+        /// Creates a new model from the given mps file, read by the native multithreaded MpsParallelReader.
+        /// Throws a CoinError if the file contains anything not supported by that reader.
+        /// </summary>
+        /// <param name="fileName">The mps file to be imported.</param>
+        /// <param name="variables">The full array of variables created for the new model.</param>
+        /// <returns>The new model.</returns>
+        private static Model NewFromMpsParallelReader(string fileName, out Variable[] variables)
+        {
+            // Copy the column-wise problem out of the reader, and release the native problem before the model is created.
+            // This way, the large matrix is never held twice in native memory, nor transposed.
+            int numberColumns, numberRows;
+            string[] columnNames, rowNames;
+            double[] colLower, colUpper, objCoefs, rowLower, rowUpper;
+            bool[] isInteger;
+            string objName;
+            char[] rowSenses;
+            int[] colStarts, colIndices;
+            double[] colElements;
+            using (MpsParallelReader m = new MpsParallelReader())
+            {
+                m.setInfinity(MathUtils.Infinity);
+                m.readMps(fileName);
+
+                // Like the other mps imports, the objective constant is ignored
+                if (m.objectiveOffset() != 0.0) log.InfoFormat("Ignoring the right-hand side {0} of objective row {1}", m.objectiveOffset(), m.getObjectiveName());
+
+                numberColumns = m.getNumCols();
+                numberRows = m.getNumRows();
+                columnNames = m.columnNames();
+                rowNames = m.rowNames();
+                colLower = m.getColLower();
+                colUpper = m.getColUpper();
+                objName = m.getObjectiveName();
+                objCoefs = m.getObjCoefficients();
+                isInteger = new bool[numberColumns];
+                for (int i = 0; i < numberColumns; i++) isInteger[i] = m.isInteger(i);
+                rowSenses = m.getRowSense();
+                rowLower = m.getRowLower();
+                rowUpper = m.getRowUpper();
+                colStarts = m.getVectorStarts();
+                colIndices = m.getIndices();
+                colElements = m.getElements();
+            }
+
+            return NewHelperByColumn(out variables, i => isInteger[i], columnNames, rowNames,
+                colLower, colUpper, objName, objCoefs, numberColumns, numberRows, rowSenses,
+                colStarts, colIndices, colElements, rowLower, rowUpper);
+        }
+
+        /// <summary>
+        /// Creates a new model from the given lp file, read by the native single-pass LpReader.
+        /// Throws a CoinError if the file contains anything not supported by that reader.
+        /// </summary>
+        /// <param name="fileName">The lp file to be imported.</param>
+        /// <param name="variables">The full array of variables created for the new model.</param>
+        /// <returns>The new model.</returns>
+        private static Model NewFromLpReader(string fileName, out Variable[] variables)
+        {
+            LpReader m = new LpReader();
+            m.setInfinity(MathUtils.Infinity);
+            // As CoinLpIO, the objective of a maximization problem is negated to get a minimization problem.
+            m.readLp(fileName);
+
+            // Like the other imports, the objective constant is ignored
+            if (m.objectiveOffset() != 0.0) log.InfoFormat("Ignoring the constant {0} of objective {1}", m.objectiveOffset(), m.getObjName());
+
+            Model model = NewHelper(out variables, m.isInteger, m.columnNames(), m.rowNames(),
+                m.getColLower(), m.getColUpper(), m.getObjName(), m.getObjCoefficients(),
+                m.getNumCols(), m.getNumRows(), m.getRowSense(), m.getRowStarts(), null, m.getRowIndices(), m.getRowElements(), m.getRowLower(), m.getRowUpper(), false, null);
+
+            GC.KeepAlive(m);
             return model;
         }
+#endif
+
+        /// <summary>
+        /// Adds a new constraint of the given row sense to the given model.
+        /// </summary>
+        /// <param name="model">The model to add the new constraint to.</param>
+        /// <param name="name">The name of the new constraint.</param>
+        /// <param name="expr">The expression of the new constraint, which is copied.</param>
+        /// <param name="rowSense">The row sense as in Osi: L, E, G, R(ange) or N(one, free).</param>
+        /// <param name="lower">The lower bound of the row.</param>
+        /// <param name="upper">The upper bound of the row.</param>
+        /// <returns>The new constraint, or null if the row sense is unknown.</returns>
+        internal static Constraint AddConstraint(Model model, string name, Expression expr, char rowSense, double lower, double upper)
+        {
+            Constraint con = NewConstraint(name, expr, rowSense, lower, upper);
+            if (con is null) return null;
+
+            return model.Add(con);
+        }
+
+        /// <summary>
+        /// Creates a new constraint of the given row sense, without adding it to a model.
+        /// </summary>
+        /// <param name="name">The name of the new constraint.</param>
+        /// <param name="expr">The expression of the new constraint, which is copied.</param>
+        /// <param name="rowSense">The row sense as in Osi: L, E, G, R(ange) or N(one, free).</param>
+        /// <param name="lower">The lower bound of the row.</param>
+        /// <param name="upper">The upper bound of the row.</param>
+        /// <returns>The new constraint, or null if the row sense is unknown.</returns>
+        internal static Constraint NewConstraint(string name, Expression expr, char rowSense, double lower, double upper)
+        {
+            switch (rowSense)
+            {
+                case 'L': //<= constraint and rhs()[i] == rowupper()[i]
+                    {
+                        ConstraintType type = ConstraintType.LE;
+                        Expression upperExpr = new Expression(upper);
+                        Constraint con = new Constraint(name, expr, type, upperExpr);
+                        upperExpr.Clear();
+                        return con;
+                    }
+                case 'E': //=  constraint
+                    {
+                        ConstraintType type = ConstraintType.EQ;
+                        Expression upperExpr = new Expression(upper);
+                        Constraint con = new Constraint(name, expr, type, upperExpr);
+                        upperExpr.Clear();
+                        return con;
+                    }
+                case 'G': //>= constraint and rhs()[i] == rowlower()[i]
+                    {
+                        ConstraintType type = ConstraintType.GE;
+                        Expression lowerExpr = new Expression(lower);
+                        Constraint con = new Constraint(name, expr, type, lowerExpr);
+                        lowerExpr.Clear();
+                        return con;
+                    }
+                case 'R': //ranged constraint
+                    {
+                        return new RangeConstraint(name, lower, expr, upper);
+                    }
+                case 'N': //free constraint
+                    {
+                        RangeConstraint con = new RangeConstraint(name, lower, expr, upper);
+                        con.Enabled = false;
+                        return con;
+                    }
+                default:
+                    return null;
+            }
+        }
+
+        /// <summary>
+        /// Returns the row sense as in Osi (L, E, G, R or N) for a row with the given lower and upper bound.
+        /// </summary>
+        /// <param name="lower">The lower bound of the row.</param>
+        /// <param name="upper">The upper bound of the row.</param>
+        /// <returns>The row sense.</returns>
+        internal static char GetRowSense(double lower, double upper)
+        {
+            bool hasLower = lower > -MathUtils.Infinity;
+            bool hasUpper = upper < MathUtils.Infinity;
+            if (hasLower && hasUpper) return (lower == upper) ? 'E' : 'R';
+            if (hasLower) return 'G';
+            if (hasUpper) return 'L';
+            return 'N';
+        }
 
         /// <summary>
         /// Exports this model to file.
-        /// Support file extensions: .sonnet only.
-        /// This method simply calls Model.ToString() and writes the output to file.
-        /// To export to different formats, use the Solver.
+        /// Support file extensions: .mps, .lp and .sonnet.
+        /// MPS and LP files are written directly from the constraints and objective, without generating a solver, and
+        /// gzip-compressed if the filename ends with .gz, like model.mps.gz. Quadratic objectives are not supported; use the Solver.
+        /// For a .sonnet file, this method simply calls Model.ToString() and writes the output to file.
         /// </summary>
-        /// <param name="filename">The sonnet file to be exported to.</param>
+        /// <param name="filename">The file to be exported to.</param>
         public void Export(string filename)
         {
-            string directoryName = System.IO.Path.GetDirectoryName(filename);
-            if (directoryName.Length == 0) directoryName = ".";
+            Ensure.NotNull(filename, "filename");
 
-            string fullPathWithoutExtension = string.Concat(directoryName, System.IO.Path.DirectorySeparatorChar, System.IO.Path.GetFileNameWithoutExtension(filename));
-            string extension = System.IO.Path.GetExtension(filename);
+            string extension = System.IO.Path.GetExtension(CompressedFile.TrimExtension(filename));
 
-            if (extension.Equals(".sonnet"))
+            if (extension.Equals(".mps"))
+            {
+                ModelExporter.WriteMps(this, filename);
+            }
+            else if (extension.Equals(".lp"))
+            {
+                ModelExporter.WriteLp(this, filename);
+            }
+            else if (System.IO.Path.GetExtension(filename).Equals(".sonnet"))
             {
                 System.IO.StreamWriter sw = new System.IO.StreamWriter(filename);
                 sw.WriteLine(ToString());
@@ -597,6 +977,42 @@ namespace Sonnet
             solvers.Remove(solver);
         }
 
+        /// <summary>
+        /// Gets the number of solvers of this model.
+        /// </summary>
+        internal int NumberOfSolvers
+        {
+            get { return solvers.Count; }
+        }
+
+        /// <summary>
+        /// Adds the given constraint, which is already generated by the only solver of this model, without updating the solvers (see Solver.ApplyPatch).
+        /// </summary>
+        /// <param name="con">The generated constraint.</param>
+        internal void AddGenerated(Constraint con)
+        {
+            constraints.Add(con);
+        }
+
+        /// <summary>
+        /// Removes the given constraints, which are already removed from the only solver of this model, without updating the solvers (see Solver.ApplyPatch).
+        /// </summary>
+        /// <param name="removed">The constraints to remove.</param>
+        internal void RemoveGenerated(ICollection<Constraint> removed)
+        {
+            if (removed.Count > 0) constraints.RemoveAll(con => removed.Contains(con));
+        }
+
+        /// <summary>
+        /// Replaces the given constraint by the given replacement, which is already generated by the only solver of this model, without updating the solvers (see Solver.ApplyPatch).
+        /// </summary>
+        /// <param name="con">The constraint to replace.</param>
+        /// <param name="replacement">The generated replacement.</param>
+        internal void ReplaceGenerated(Constraint con, Constraint replacement)
+        {
+            constraints[constraints.IndexOf(con)] = replacement;
+        }
+
         //bool Contains(Variable v);		// IsRegistered OR in the (to-be) added list -> NOT do this, since we'd have to check all the new constraints 
 
         /// <summary>
@@ -624,7 +1040,7 @@ namespace Sonnet
         [System.Diagnostics.CodeAnalysis.SuppressMessage("Critical Code Smell", "S2696:Instance members should not write to \"static\" fields", Justification = "This is a constructor, and by design.")]
         private void GutsOfConstructor(string name)
         {
-            id = numberOfModels++;
+            id = System.Threading.Interlocked.Increment(ref numberOfModels) - 1;
 
             objective = new Objective("obj");
             objectiveSense = ObjectiveSense.Minimise;
@@ -636,6 +1052,11 @@ namespace Sonnet
         #endregion
 
         private static SonnetLog log = SonnetLog.Default;
+
+        /// <summary>
+        /// By default, mps files of at least this size (in bytes) are imported by the native multithreaded reader.
+        /// </summary>
+        internal const long DefaultParallelMpsReaderThreshold = 64L << 20;
         private static int numberOfModels = 0;
 
         private Objective objective;
@@ -33,6 +33,8 @@ namespace Sonnet
         {
             get
             {
+                // A default name is only created when first needed
+                if (name == null) name = string.Concat(defaultNamePrefix, defaultNameIndex);
                 return name;
             }
             set
@@ -42,6 +44,28 @@ namespace Sonnet
             }
         }
 
+        /// <summary>
+        /// Sets the name of this object to the given prefix followed by the given index, like VAR12.
+        /// The string is only created when the name is first used, which saves time and memory for
+        /// the many default names of large imported models.
+        /// </summary>
+        /// <param name="prefix">The prefix of the default name.</param>
+        /// <param name="index">The index following the prefix.</param>
+        internal void SetDefaultName(string prefix, int index)
+        {
+            name = null;
+            defaultNamePrefix = prefix;
+            defaultNameIndex = index;
+        }
+
+        /// <summary>
+        /// Returns true iff the name of this object is a default name that is not created yet.
+        /// </summary>
+        protected bool HasLazyName
+        {
+            get { return name == null; }
+        }
+
         /// <summary>
         /// Returns the ID of this object.
         /// </summary>
@@ -96,6 +120,8 @@ namespace Sonnet
         //if we also implement the operators ==, !=, <, etc then those get called for Solver etc. while this not necessary
 
         private string name = string.Empty;
+        private string defaultNamePrefix;
+        private int defaultNameIndex;
         internal int id;
     }
 
@@ -191,7 +217,10 @@ namespace Sonnet
             this.offset = offset;
         }
 
-        private void Unassign()
+        /// <summary>
+        /// Unassign this entity from its assigned solver.
+        /// </summary>
+        protected virtual void Unassign()
         {
             solver = null;
             offset = -1;
@@ -0,0 +1,650 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.IO.Compression;
+using System.Text;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// Writes a Sonnet Model in MPS or LP format directly from its constraints and objective, without generating a solver.
+    /// The constraints are assembled one at a time (like Solver.Generate, but without changing them), and written through a buffered writer.
+    /// The LP format is written row by row. For MPS, the COLUMNS section is written from a temporary column-wise index of row numbers and values,
+    /// built in two passes over the constraints. This index takes one int and one double per coefficient, so the extra memory grows with
+    /// the size of the matrix; only the text itself is never held in memory.
+    /// The output follows COIN.ModelWriter (and OsiSolverInterface.writeMps): the columns are in the order of the Solver (first the variables of the objective,
+    /// then those of the constraints), a maximisation problem is written as the minimisation of the negated objective, and disabled constraints are free rows.
+    /// As CoinLpIO, default names (obj, R0000000, C0000000) are used if any name is empty or contains whitespace.
+    /// The files are ASCII, so a name with other characters that would be written gives a SonnetException before the file is created.
+    /// Quadratic objectives are not supported.
+    /// </summary>
+    internal class ModelExporter
+    {
+        private static readonly SonnetLog log = SonnetLog.Default;
+
+        private static readonly Encoding Ascii = Encoding.GetEncoding("us-ascii", EncoderFallback.ExceptionFallback, DecoderFallback.ExceptionFallback);
+
+        private const double MpsInfinity = 1.0e30;
+        private const int BufferSize = 1 << 16;
+        private const int LpTermsPerLine = 10;
+        private const string IntegerStartMarker = "    MARKER                 'MARKER'                 'INTORG'";
+        private const string IntegerEndMarker = "    MARKER                 'MARKER'                 'INTEND'";
+
+        private readonly Model model;
+        private readonly List<Constraint> constraints;
+        private readonly List<Variable> variables = new List<Variable>();
+        private readonly Dictionary<int, int> columns = new Dictionary<int, int>(); // from variable id to column index
+        private readonly List<int> columnCounts = new List<int>(); // the number of (unassembled) coefficients per column
+
+        private readonly double[] objective;
+        private readonly double objectiveOffset;
+
+        private string objectiveName;
+        private string[] rowNames;
+        private string[] columnNames;
+
+        // Scatter arrays to assemble one row at a time
+        private readonly double[] rowValues;
+        private readonly int[] rowMarks;
+        private readonly List<int> rowColumns = new List<int>();
+        private int rowNumber = -1;
+
+        private ModelExporter(Model model)
+        {
+            Ensure.NotNull(model.Objective, "objective");
+            if (model.Objective.IsQuadratic) throw new NotSupportedException("Exporting a model with a quadratic objective is not supported. Use Solver.Export instead.");
+
+            this.model = model;
+            constraints = new List<Constraint>(model.Constraints);
+
+            // The columns in the order of Solver.Generate: first the variables of the objective, then those of the constraints
+            foreach (Coef coef in model.Objective.Coefficients) AddColumn(coef.var);
+
+            foreach (Constraint con in constraints)
+            {
+                foreach (Coef coef in con.Coefficients) columnCounts[AddColumn(coef.var)]++;
+                foreach (Coef coef in con.RhsCoefficients) columnCounts[AddColumn(coef.var)]++;
+            }
+
+            // As OsiSolverInterface.writeMps, a maximisation problem is written as the minimisation of the negated objective
+            double sense = (model.ObjectiveSense == ObjectiveSense.Maximise) ? -1.0 : 1.0;
+            objective = new double[variables.Count];
+            foreach (Coef coef in model.Objective.Coefficients) objective[columns[coef.var.id]] += sense * coef.coef;
+            objectiveOffset = sense * model.Objective.Constant;
+
+            rowValues = new double[variables.Count];
+            rowMarks = new int[variables.Count];
+            for (int j = 0; j < rowMarks.Length; j++) rowMarks[j] = -1;
+        }
+
+        /// <summary>
+        /// Writes the given model in MPS format (free format) to the given file, gzip-compressed if the file name ends with .gz.
+        /// </summary>
+        /// <param name="model">The model to write.</param>
+        /// <param name="fileName">The name of the file.</param>
+        public static void WriteMps(Model model, string fileName)
+        {
+            ModelExporter exporter = new ModelExporter(model);
+            exporter.SetNames(IsValidMpsName);
+            using (TextWriter writer = CreateText(fileName))
+            {
+                exporter.WriteMps(writer);
+            }
+        }
+
+        /// <summary>
+        /// Writes the given model in LP format to the given file, gzip-compressed if the file name ends with .gz.
+        /// </summary>
+        /// <param name="model">The model to write.</param>
+        /// <param name="fileName">The name of the file.</param>
+        public static void WriteLp(Model model, string fileName)
+        {
+            ModelExporter exporter = new ModelExporter(model);
+            exporter.SetNames(IsValidLpName);
+            using (TextWriter writer = CreateText(fileName))
+            {
+                exporter.WriteLp(writer);
+            }
+        }
+
+        private static TextWriter CreateText(string fileName)
+        {
+            Stream stream = new FileStream(fileName, FileMode.Create, FileAccess.Write, FileShare.None, BufferSize);
+            if (!fileName.Equals(CompressedFile.TrimExtension(fileName))) stream = new GZipStream(stream, CompressionLevel.Fastest);
+
+            TextWriter writer = new StreamWriter(stream, Ascii, BufferSize);
+            writer.NewLine = "\n";
+            return writer;
+        }
+
+        private int AddColumn(Variable var)
+        {
+            int column;
+            if (!columns.TryGetValue(var.id, out column))
+            {
+                column = variables.Count;
+                columns.Add(var.id, column);
+                variables.Add(var);
+                columnCounts.Add(0);
+            }
+            return column;
+        }
+
+        #region Rows
+        /// <summary>
+        /// Assembles the coefficients of the given row into rowColumns and rowValues, like Constraint.Assemble, but without changing the constraint.
+        /// </summary>
+        private void AssembleRow(int row)
+        {
+            Constraint con = constraints[row];
+            rowNumber = row;
+            rowColumns.Clear();
+
+            foreach (Coef coef in con.Coefficients) AddToRow(columns[coef.var.id], coef.coef);
+            foreach (Coef coef in con.RhsCoefficients) AddToRow(columns[coef.var.id], -coef.coef);
+        }
+
+        private void AddToRow(int column, double value)
+        {
+            if (rowMarks[column] != rowNumber)
+            {
+                rowMarks[column] = rowNumber;
+                rowValues[column] = 0.0;
+                rowColumns.Add(column);
+            }
+            rowValues[column] += value;
+        }
+
+        /// <summary>
+        /// Gets the bounds of the given row, as Solver.Generate after Constraint.Assemble: the constant of the expression is moved to the right-hand side.
+        /// Disabled constraints are free rows.
+        /// </summary>
+        private void GetRowBounds(int row, out double lower, out double upper)
+        {
+            Constraint con = constraints[row];
+            lower = double.MinValue;
+            upper = double.MaxValue;
+            if (!con.Enabled) return;
+
+            double rhs = con.RhsConstant - con.LhsConstant;
+            if (con is RangeConstraint)
+            {
+                // As RangeConstraint.Assemble, the constant is subtracted from both finite bounds
+                lower = (con.Lower > -MathUtils.Infinity) ? con.Lower - con.LhsConstant : con.Lower;
+                upper = (con.RhsConstant < MathUtils.Infinity) ? rhs : con.RhsConstant;
+                return;
+            }
+
+            switch (con.Type)
+            {
+                case ConstraintType.LE:
+                    upper = rhs;
+                    break;
+                case ConstraintType.GE:
+                    lower = rhs;
+                    break;
+                default:
+                    lower = rhs;
+                    upper = rhs;
+                    break;
+            }
+        }
+
+        private static bool IsInfinite(double value)
+        {
+            return Math.Abs(value) >= MpsInfinity;
+        }
+
+        /// <summary>
+        /// The right-hand side of a row, as written in the MPS RHS section or at the end of an LP constraint
+        /// </summary>
+        private static double Rhs(double lower, double upper)
+        {
+            if (!IsInfinite(lower)) return lower;
+            if (!IsInfinite(upper)) return upper;
+            return 0.0;
+        }
+        #endregion
+
+        #region Names
+        /// <summary>
+        /// Sets the names of the objective, rows and columns. As CoinLpIO, default names are used if any name is invalid.
+        /// Throws if a name that would be written (also of the model) is not ASCII, instead of writing a '?' for each other character.
+        /// </summary>
+        private void SetNames(Func<string, bool> isValid)
+        {
+            EnsureAscii(model.Name, "model");
+
+            objectiveName = model.Objective.Name;
+            rowNames = new string[constraints.Count];
+            columnNames = new string[variables.Count];
+
+            bool valid = isValid(objectiveName);
+            for (int i = 0; i < rowNames.Length; i++)
+            {
+                rowNames[i] = constraints[i].Name;
+                valid = valid && isValid(rowNames[i]);
+            }
+            for (int j = 0; j < columnNames.Length; j++)
+            {
+                columnNames[j] = variables[j].Name;
+                valid = valid && isValid(columnNames[j]);
+            }
+
+            if (valid)
+            {
+                EnsureAscii(objectiveName, "objective");
+                foreach (string name in rowNames) EnsureAscii(name, "constraint");
+                foreach (string name in columnNames) EnsureAscii(name, "variable");
+                return;
+            }
+
+            log.InfoFormat("Using default names to export model {0}, since not all names are valid.", model.Name);
+            objectiveName = "obj";
+            for (int i = 0; i < rowNames.Length; i++) rowNames[i] = string.Format(CultureInfo.InvariantCulture, "R{0:D7}", i);
+            for (int j = 0; j < columnNames.Length; j++) columnNames[j] = string.Format(CultureInfo.InvariantCulture, "C{0:D7}", j);
+        }
+
+        private void EnsureAscii(string name, string kind)
+        {
+            if (name == null) return;
+            foreach (char c in name)
+            {
+                if (c > '\u007f') throw new SonnetException(string.Format("Cannot export model {0}: the name {1} of a {2} is not ASCII.", model.Name, name, kind));
+            }
+        }
+
+        private static bool IsValidMpsName(string name)
+        {
+            if (string.IsNullOrEmpty(name)) return false;
+            foreach (char c in name)
+            {
+                if (char.IsWhiteSpace(c)) return false;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Returns true if the name is valid in an LP file, following CoinLpIO
+        /// </summary>
+        private static bool IsValidLpName(string name)
+        {
+            const string ValidCharacters = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ\"!#$%&(),.;?@_'`{}~";
+            const int MaxLpNameLength = 100;
+
+            if (string.IsNullOrEmpty(name) || name.Length > MaxLpNameLength) return false;
+            if (char.IsDigit(name[0]) || name[0] == '.') return false;
+            foreach (char c in name)
+            {
+                if (ValidCharacters.IndexOf(c) < 0) return false;
+            }
+            return true;
+        }
+
+        private static string Format(double value)
+        {
+            return value.ToString("R", CultureInfo.InvariantCulture);
+        }
+        #endregion
+
+        #region MPS
+        private void WriteMps(TextWriter writer)
+        {
+            int m = constraints.Count;
+            int n = variables.Count;
+            double[] rowLower = new double[m];
+            double[] rowUpper = new double[m];
+
+            writer.Write("NAME          ");
+            writer.Write(string.IsNullOrEmpty(model.Name) ? "BLANK" : model.Name.Replace(' ', '_'));
+            writer.WriteLine("  FREE");
+            writer.WriteLine("ROWS");
+            writer.Write(" N  ");
+            writer.WriteLine(objectiveName);
+
+            bool hasRangedRows = false;
+            for (int i = 0; i < m; i++)
+            {
+                GetRowBounds(i, out rowLower[i], out rowUpper[i]);
+                double lower = rowLower[i];
+                double upper = rowUpper[i];
+
+                // Ranged rows are written as G rows with a range
+                string type = "N";
+                if (lower == upper) type = "E";
+                else if (!IsInfinite(lower)) type = "G";
+                else if (!IsInfinite(upper)) type = "L";
+                hasRangedRows |= IsRanged(lower, upper);
+
+                writer.Write(' ');
+                writer.Write(type);
+                writer.Write("  ");
+                writer.WriteLine(rowNames[i]);
+            }
+
+            // The temporary column-wise index of the matrix, with room for the unassembled number of coefficients per column
+            int[] starts = new int[n + 1];
+            for (int j = 0; j < n; j++) starts[j + 1] = starts[j] + columnCounts[j];
+            int[] lengths = new int[n];
+            int[] indices = new int[starts[n]];
+            double[] elements = new double[starts[n]];
+
+            for (int i = 0; i < m; i++)
+            {
+                AssembleRow(i);
+                foreach (int j in rowColumns)
+                {
+                    int k = starts[j] + lengths[j]++;
+                    indices[k] = i;
+                    elements[k] = rowValues[j];
+                }
+            }
+
+            writer.WriteLine("COLUMNS");
+            for (int j = 0; j < n; j++)
+            {
+                bool integer = IsInteger(j);
+                bool previousInteger = j > 0 && IsInteger(j - 1);
+                if (integer && !previousInteger) writer.WriteLine(IntegerStartMarker);
+                if (!integer && previousInteger) writer.WriteLine(IntegerEndMarker);
+
+                // The objective coefficient is written even if zero for a column without elements, such that the column exists
+                bool second = false;
+                if (objective[j] != 0.0 || lengths[j] == 0) WriteMpsPair(writer, columnNames[j], objectiveName, objective[j], ref second);
+                for (int k = starts[j]; k < starts[j] + lengths[j]; k++) WriteMpsPair(writer, columnNames[j], rowNames[indices[k]], elements[k], ref second);
+                if (second) writer.WriteLine();
+            }
+            if (n > 0 && IsInteger(n - 1)) writer.WriteLine(IntegerEndMarker);
+
+            // The column-wise index is no longer needed
+            indices = null;
+            elements = null;
+
+            writer.WriteLine("RHS");
+            if (objectiveOffset != 0.0)
+            {
+                // As OsiSolverInterface, the right-hand side of the objective row is minus the objective constant
+                WriteMpsLine(writer, "", "RHS", objectiveName, -objectiveOffset);
+            }
+
+            bool secondRhs = false;
+            for (int i = 0; i < m; i++)
+            {
+                double value = Rhs(rowLower[i], rowUpper[i]);
+                if (value != 0.0) WriteMpsPair(writer, "RHS", rowNames[i], value, ref secondRhs);
+            }
+            if (secondRhs) writer.WriteLine();
+
+            if (hasRangedRows)
+            {
+                writer.WriteLine("RANGES");
+                for (int i = 0; i < m; i++)
+                {
+                    if (IsRanged(rowLower[i], rowUpper[i])) WriteMpsLine(writer, "", "RANGE", rowNames[i], rowUpper[i] - rowLower[i]);
+                }
+            }
+
+            writer.WriteLine("BOUNDS");
+            for (int j = 0; j < n; j++)
+            {
+                string name = columnNames[j];
+                double lower = variables[j].Lower;
+                double upper = variables[j].Upper;
+                bool infiniteLower = IsInfinite(lower);
+                bool infiniteUpper = IsInfinite(upper);
+
+                if (lower == upper)
+                {
+                    WriteMpsLine(writer, "FX", "BOUND", name, lower);
+                    continue;
+                }
+                if (infiniteLower && infiniteUpper)
+                {
+                    WriteMpsStart(writer, "FR", "BOUND");
+                    writer.Write("  ");
+                    writer.WriteLine(name);
+                    continue;
+                }
+
+                // The upper bound first: a negative upper bound may set a zero lower bound to minus infinity
+                if (!infiniteUpper) WriteMpsLine(writer, "UP", "BOUND", name, upper);
+                if (infiniteLower)
+                {
+                    WriteMpsStart(writer, "MI", "BOUND");
+                    writer.Write("  ");
+                    writer.WriteLine(name);
+                }
+                else if (lower != 0.0 || upper < 0.0)
+                {
+                    WriteMpsLine(writer, "LO", "BOUND", name, lower);
+                }
+
+                // Without any bound, integer columns would get upper bound 1
+                if (infiniteUpper && IsInteger(j))
+                {
+                    WriteMpsStart(writer, "PL", "BOUND");
+                    writer.Write("  ");
+                    writer.WriteLine(name);
+                }
+            }
+
+            writer.WriteLine("ENDATA");
+        }
+
+        private bool IsInteger(int column)
+        {
+            return variables[column].Type == VariableType.Integer;
+        }
+
+        private static bool IsRanged(double lower, double upper)
+        {
+            return lower != upper && !IsInfinite(lower) && !IsInfinite(upper);
+        }
+
+        /// <summary>
+        /// Writes the start of a data line: the code (like UP, or empty) and the first name
+        /// </summary>
+        private static void WriteMpsStart(TextWriter writer, string code, string name)
+        {
+            writer.Write(' ');
+            writer.Write(code.PadRight(2));
+            writer.Write(' ');
+            writer.Write(name);
+        }
+
+        /// <summary>
+        /// Writes a name and value pair; second is true for the second pair on the line
+        /// </summary>
+        private static void WriteMpsValue(TextWriter writer, string name, double value, bool second)
+        {
+            writer.Write(second ? "   " : "  ");
+            writer.Write(name);
+            writer.Write("  ");
+            writer.Write(Format(value));
+        }
+
+        /// <summary>
+        /// Writes a name and value pair of a data line with two pairs per line, starting a new line with the given first name if needed
+        /// </summary>
+        private static void WriteMpsPair(TextWriter writer, string name1, string name2, double value, ref bool second)
+        {
+            if (!second) WriteMpsStart(writer, "", name1);
+            WriteMpsValue(writer, name2, value, second);
+            if (second) writer.WriteLine();
+            second = !second;
+        }
+
+        /// <summary>
+        /// Writes a line with one value, like a bound
+        /// </summary>
+        private static void WriteMpsLine(TextWriter writer, string code, string name1, string name2, double value)
+        {
+            WriteMpsStart(writer, code, name1);
+            WriteMpsValue(writer, name2, value, false);
+            writer.WriteLine();
+        }
+        #endregion
+
+        #region LP
+        private void WriteLp(TextWriter writer)
+        {
+            int m = constraints.Count;
+            int n = variables.Count;
+            if (n == 0) throw new SonnetException(string.Format("Cannot export model {0} without variables in LP format.", model.Name));
+
+            writer.Write("\\Problem name: ");
+            writer.WriteLine(model.Name);
+            writer.WriteLine();
+            writer.WriteLine("Minimize");
+            writer.Write(objectiveName);
+            writer.Write(':');
+
+            int numberOnLine = 0;
+            bool hasObjective = false;
+            for (int j = 0; j < n; j++)
+            {
+                if (objective[j] == 0.0) continue;
+
+                hasObjective = true;
+                WriteLpTerm(writer, objective[j], columnNames[j]);
+                if (++numberOnLine == LpTermsPerLine)
+                {
+                    writer.WriteLine();
+                    numberOnLine = 0;
+                }
+            }
+            if (!hasObjective)
+            {
+                writer.Write(" 0 ");
+                writer.Write(columnNames[0]);
+            }
+
+            // The objective constant is written as a constant term, which is read by LpReader
+            if (objectiveOffset != 0.0)
+            {
+                writer.Write(objectiveOffset < 0.0 ? " - " : " + ");
+                writer.Write(Format(Math.Abs(objectiveOffset)));
+            }
+            writer.WriteLine();
+
+            writer.WriteLine("Subject To");
+            for (int i = 0; i < m; i++)
+            {
+                AssembleRow(i);
+                double lower, upper;
+                GetRowBounds(i, out lower, out upper);
+
+                writer.Write(rowNames[i]);
+                writer.Write(':');
+                if (rowColumns.Count == 0)
+                {
+                    writer.Write(" 0 ");
+                    writer.Write(columnNames[0]);
+                }
+                for (int k = 0; k < rowColumns.Count; k++)
+                {
+                    int j = rowColumns[k];
+                    WriteLpTerm(writer, rowValues[j], columnNames[j]);
+                    if ((k + 1) % LpTermsPerLine == 0 && k + 1 < rowColumns.Count) writer.WriteLine();
+                }
+
+                if (lower == upper) writer.Write(" = ");
+                else if (!IsInfinite(lower)) writer.Write(" >= ");
+                else if (!IsInfinite(upper)) writer.Write(" <= ");
+                else writer.Write(" >= -inf");
+
+                if (!IsInfinite(lower) || !IsInfinite(upper)) writer.Write(Format(Rhs(lower, upper)));
+                writer.WriteLine();
+
+                // As CoinLpIO, the upper bound of a ranged row is a second line with the same name
+                if (IsRanged(lower, upper))
+                {
+                    writer.Write(rowNames[i]);
+                    writer.Write(": <= ");
+                    writer.WriteLine(Format(upper));
+                }
+            }
+
+            // The default bounds in LP format are 0 and infinity
+            writer.WriteLine("Bounds");
+            for (int j = 0; j < n; j++)
+            {
+                string name = columnNames[j];
+                double lower = variables[j].Lower;
+                double upper = variables[j].Upper;
+                bool infiniteLower = IsInfinite(lower);
+                bool infiniteUpper = IsInfinite(upper);
+
+                if (lower == 0.0 && infiniteUpper) continue;
+
+                writer.Write(' ');
+                if (lower == upper)
+                {
+                    writer.Write(name);
+                    writer.Write(" = ");
+                    writer.Write(Format(lower));
+                }
+                else if (infiniteLower && infiniteUpper)
+                {
+                    writer.Write(name);
+                    writer.Write(" free");
+                }
+                else if (infiniteUpper)
+                {
+                    writer.Write(name);
+                    writer.Write(" >= ");
+                    writer.Write(Format(lower));
+                }
+                else
+                {
+                    writer.Write(infiniteLower ? "-inf" : Format(lower));
+                    writer.Write(" <= ");
+                    writer.Write(name);
+                    writer.Write(" <= ");
+                    writer.Write(Format(upper));
+                }
+                writer.WriteLine();
+            }
+
+            if (variables.Exists(var => var.Type == VariableType.Integer))
+            {
+                writer.WriteLine("Integers");
+                numberOnLine = 0;
+                for (int j = 0; j < n; j++)
+                {
+                    if (!IsInteger(j)) continue;
+
+                    writer.Write(' ');
+                    writer.Write(columnNames[j]);
+                    if (++numberOnLine == LpTermsPerLine)
+                    {
+                        writer.WriteLine();
+                        numberOnLine = 0;
+                    }
+                }
+                if (numberOnLine > 0) writer.WriteLine();
+            }
+
+            writer.WriteLine("End");
+        }
+
+        /// <summary>
+        /// Writes a term like " + 2 x" or " - x" of an LP expression
+        /// </summary>
+        private static void WriteLpTerm(TextWriter writer, double value, string name)
+        {
+            writer.Write(value < 0.0 ? " - " : " + ");
+            if (Math.Abs(value) != 1.0)
+            {
+                writer.Write(Format(Math.Abs(value)));
+                writer.Write(' ');
+            }
+            writer.Write(name);
+        }
+        #endregion
+    }
+}
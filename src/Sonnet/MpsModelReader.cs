@@ -0,0 +1,407 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// Reads an MPS file in a single pass directly into a new Sonnet Model, without an intermediate native copy of the problem.
+    /// The variables are created while reading the COLUMNS section, and their coefficients are added straight
+    /// to the expressions of the rows. Hence the peak memory use is about one copy of the model.
+    /// Supported are the NAME, ROWS, COLUMNS (including integer markers), RHS, RANGES and BOUNDS sections in free format,
+    /// and fixed format without spaces in the names.
+    /// For anything else, such as quadratic sections or OBJSENSE, a FormatException is thrown, and the caller can fall back
+    /// to reading the file with Clp.
+    /// Like the Clp import, the objective sense is Minimise, and a right-hand side of the objective row (the objective constant) is ignored.
+    /// Like CoinMpsIO, integer variables without any bound in the BOUNDS section get upper bound 1.
+    /// </summary>
+    internal class MpsModelReader
+    {
+        private static readonly SonnetLog log = SonnetLog.Default;
+
+        private const int MaxTokens = 8;
+        private const double MpsInfinity = 1.0e30;
+
+        private enum Section { None, Rows, Columns, Rhs, Ranges, Bounds, EndData }
+
+        private MpsModelReader()
+        {
+        }
+
+        /// <summary>
+        /// Reads the given MPS file into a new model. A gzip-compressed file is decompressed while reading.
+        /// </summary>
+        /// <param name="fileName">The name of the MPS file.</param>
+        /// <param name="variables">The full array of variables created for the new model.</param>
+        /// <returns>The new model.</returns>
+        public static Model Read(string fileName, out Variable[] variables)
+        {
+            using (TextReader reader = CompressedFile.OpenText(fileName))
+            {
+                return Read(reader, out variables);
+            }
+        }
+
+        /// <summary>
+        /// Reads the MPS data of the given reader into a new model.
+        /// </summary>
+        /// <param name="reader">The reader of the MPS data.</param>
+        /// <param name="variables">The full array of variables created for the new model.</param>
+        /// <returns>The new model.</returns>
+        public static Model Read(TextReader reader, out Variable[] variables)
+        {
+            MpsModelReader mpsReader = new MpsModelReader();
+            mpsReader.ReadSections(reader);
+            return mpsReader.CreateModel(out variables);
+        }
+
+        private void ReadSections(TextReader reader)
+        {
+            string[] tokens = new string[MaxTokens];
+            Section section = Section.None;
+            string line;
+
+            while (section != Section.EndData && (line = reader.ReadLine()) != null)
+            {
+                lineNumber++;
+                if (line.Length == 0 || line[0] == '*') continue;
+
+                int n = Tokenize(line, tokens);
+                if (n == 0) continue;
+
+                if (!char.IsWhiteSpace(line[0]))
+                {
+                    section = StartSection(tokens, n);
+                    continue;
+                }
+
+                switch (section)
+                {
+                    case Section.Rows:
+                        ReadRow(tokens, n);
+                        break;
+                    case Section.Columns:
+                        ReadColumn(tokens, n);
+                        break;
+                    case Section.Rhs:
+                        ReadRhsOrRange(tokens, n, rowRhs);
+                        break;
+                    case Section.Ranges:
+                        ReadRhsOrRange(tokens, n, rowRange);
+                        break;
+                    case Section.Bounds:
+                        ReadBound(tokens, n);
+                        break;
+                    default:
+                        throw Error("data outside of any section");
+                }
+            }
+        }
+
+        private Section StartSection(string[] tokens, int n)
+        {
+            switch (tokens[0])
+            {
+                case "NAME":
+                    return Section.None;
+                case "ROWS":
+                    return Section.Rows;
+                case "COLUMNS":
+                    rowRhs = new double[rowNames.Count];
+                    rowRange = new double[rowNames.Count];
+                    for (int j = 0; j < rowRange.Length; j++) rowRange[j] = double.NaN;
+                    return Section.Columns;
+                case "RHS":
+                    return Section.Rhs;
+                case "RANGES":
+                    return Section.Ranges;
+                case "BOUNDS":
+                    return Section.Bounds;
+                case "ENDATA":
+                    return Section.EndData;
+                default:
+                    throw Error(string.Format("section {0} is not supported", tokens[0]));
+            }
+        }
+
+        private void ReadRow(string[] tokens, int n)
+        {
+            if (n < 2) throw Error("row type and name expected");
+
+            char type = char.ToUpperInvariant(tokens[0][0]);
+            string name = tokens[1];
+            if (tokens[0].Length != 1 || "NLGE".IndexOf(type) < 0) throw Error(string.Format("unknown row type {0}", tokens[0]));
+            if (rows.ContainsKey(name)) throw Error(string.Format("duplicate row {0}", name));
+
+            // The first free row is the objective
+            if (type == 'N' && objectiveRow < 0) objectiveRow = rowNames.Count;
+
+            rows.Add(name, rowNames.Count);
+            rowNames.Add(name);
+            rowTypes.Add(type);
+            rowExpressions.Add(new Expression());
+        }
+
+        private void ReadColumn(string[] tokens, int n)
+        {
+            if (n >= 3 && tokens[1] == "'MARKER'")
+            {
+                if (tokens[2] == "'INTORG'") integerSection = true;
+                else if (tokens[2] == "'INTEND'") integerSection = false;
+                else throw Error(string.Format("unknown marker {0}", tokens[2]));
+                return;
+            }
+
+            if (n < 3 || n % 2 == 0) throw Error("column name and pairs of row name and value expected");
+
+            string name = tokens[0];
+            if (!object.ReferenceEquals(currentVariable, null) && currentVariable.Name == name)
+            {
+                // Same column as on the previous line
+            }
+            else
+            {
+                if (columns.ContainsKey(name)) throw Error(string.Format("column {0} is not contiguous", name));
+
+                currentVariable = new Variable(name, 0.0, MathUtils.Infinity, integerSection ? VariableType.Integer : VariableType.Continuous);
+                columns.Add(name, variables.Count);
+                variables.Add(currentVariable);
+                hasBounds.Add(false);
+            }
+
+            for (int t = 1; t < n; t += 2)
+            {
+                int row = GetRow(tokens[t]);
+                double value = ParseValue(tokens[t + 1]);
+                rowExpressions[row].Add(value, currentVariable);
+            }
+        }
+
+        private void ReadRhsOrRange(string[] tokens, int n, double[] values)
+        {
+            if (values == null) throw Error("RHS or RANGES before COLUMNS");
+
+            // The name of the rhs or range vector is optional
+            int t = (n % 2 == 1) ? 1 : 0;
+            if (n - t < 2) throw Error("pairs of row name and value expected");
+
+            for (; t < n; t += 2)
+            {
+                int row = GetRow(tokens[t]);
+                values[row] = ParseValue(tokens[t + 1]);
+            }
+        }
+
+        private void ReadBound(string[] tokens, int n)
+        {
+            string type = tokens[0].ToUpperInvariant();
+            bool needsValue = type != "FR" && type != "MI" && type != "PL" && type != "BV";
+
+            // The name of the bound vector is optional: find the column and the value
+            int col;
+            double value = 0.0;
+            if (needsValue)
+            {
+                if (n != 3 && n != 4) throw Error("bound type, column name and value expected");
+                col = GetColumn(tokens[n - 2]);
+                value = ParseValue(tokens[n - 1]);
+            }
+            else if (n == 2 || (n == 3 && !columns.ContainsKey(tokens[1])))
+            {
+                col = GetColumn(tokens[n - 1]);
+            }
+            else if (n == 3 || n == 4)
+            {
+                // BV with value, or with bound vector name
+                col = columns.ContainsKey(tokens[n - 1]) ? GetColumn(tokens[n - 1]) : GetColumn(tokens[n - 2]);
+            }
+            else
+            {
+                throw Error("bound type and column name expected");
+            }
+
+            Variable var = variables[col];
+            hasBounds[col] = true;
+            switch (type)
+            {
+                case "UP":
+                    // As CoinMpsIO: a negative upper bound with a default lower bound makes the lower bound minus infinity
+                    if (value < 0.0 && var.Lower == 0.0) var.Lower = -MathUtils.Infinity;
+                    var.Upper = value;
+                    break;
+                case "LO":
+                    var.Lower = value;
+                    break;
+                case "FX":
+                    var.Lower = value;
+                    var.Upper = value;
+                    break;
+                case "FR":
+                    var.Lower = -MathUtils.Infinity;
+                    var.Upper = MathUtils.Infinity;
+                    break;
+                case "MI":
+                    var.Lower = -MathUtils.Infinity;
+                    break;
+                case "PL":
+                    var.Upper = MathUtils.Infinity;
+                    break;
+                case "BV":
+                    var.Type = VariableType.Integer;
+                    var.Lower = 0.0;
+                    var.Upper = 1.0;
+                    break;
+                case "UI":
+                    var.Type = VariableType.Integer;
+                    if (value < 0.0 && var.Lower == 0.0) var.Lower = -MathUtils.Infinity;
+                    var.Upper = value;
+                    break;
+                case "LI":
+                    var.Type = VariableType.Integer;
+                    var.Lower = value;
+                    break;
+                default:
+                    throw Error(string.Format("bound type {0} is not supported", tokens[0]));
+            }
+        }
+
+        private Model CreateModel(out Variable[] variablesArray)
+        {
+            if (rowRhs == null) throw Error("no COLUMNS section");
+
+            for (int col = 0; col < variables.Count; col++)
+            {
+                if (variables[col].Type == VariableType.Integer && !hasBounds[col]) variables[col].Upper = 1.0;
+            }
+
+            Model model = new Model();
+            variablesArray = variables.ToArray();
+
+            string objName = (objectiveRow >= 0) ? rowNames[objectiveRow] : "OBJROW";
+            Expression objExpr = (objectiveRow >= 0) ? rowExpressions[objectiveRow] : new Expression();
+            if (objectiveRow >= 0 && rowRhs[objectiveRow] != 0.0)
+            {
+                log.InfoFormat("Ignoring the right-hand side {0} of objective row {1}", rowRhs[objectiveRow], objName);
+            }
+
+            model.Objective = new Objective(objName, objExpr);
+            model.ObjectiveSense = ObjectiveSense.Minimise;
+
+            for (int j = 0; j < rowNames.Count; j++)
+            {
+                if (j == objectiveRow) continue;
+
+                double lower, upper;
+                GetRowBounds(j, out lower, out upper);
+                Model.AddConstraint(model, rowNames[j], rowExpressions[j], Model.GetRowSense(lower, upper), lower, upper);
+
+                // The constraint has its own copy of the expression
+                rowExpressions[j] = null;
+            }
+
+            return model;
+        }
+
+        private void GetRowBounds(int row, out double lower, out double upper)
+        {
+            double rhs = rowRhs[row];
+            double range = rowRange[row];
+
+            switch (rowTypes[row])
+            {
+                case 'L':
+                    upper = rhs;
+                    lower = double.IsNaN(range) ? -MathUtils.Infinity : rhs - Math.Abs(range);
+                    break;
+                case 'G':
+                    lower = rhs;
+                    upper = double.IsNaN(range) ? MathUtils.Infinity : rhs + Math.Abs(range);
+                    break;
+                case 'E':
+                    lower = rhs;
+                    upper = rhs;
+                    if (range > 0.0) upper = rhs + range;
+                    else if (range < 0.0) lower = rhs + range;
+                    break;
+                default:
+                    lower = -MathUtils.Infinity;
+                    upper = MathUtils.Infinity;
+                    break;
+            }
+        }
+
+        private int GetRow(string name)
+        {
+            int row;
+            if (!rows.TryGetValue(name, out row)) throw Error(string.Format("unknown row {0}", name));
+            return row;
+        }
+
+        private int GetColumn(string name)
+        {
+            int col;
+            if (!columns.TryGetValue(name, out col)) throw Error(string.Format("unknown column {0}", name));
+            return col;
+        }
+
+        private double ParseValue(string token)
+        {
+            double value;
+            if (!double.TryParse(token, NumberStyles.Float, CultureInfo.InvariantCulture, out value)) throw Error(string.Format("invalid number {0}", token));
+
+            if (value >= MpsInfinity) return MathUtils.Infinity;
+            if (value <= -MpsInfinity) return -MathUtils.Infinity;
+            return value;
+        }
+
+        private FormatException Error(string message)
+        {
+            return new FormatException(string.Format("MPS line {0}: {1}.", lineNumber, message));
+        }
+
+        /// <summary>
+        /// Splits the given line into whitespace-separated tokens.
+        /// </summary>
+        /// <param name="line">The line to split.</param>
+        /// <param name="tokens">The array to store the tokens in.</param>
+        /// <returns>The number of tokens.</returns>
+        private int Tokenize(string line, string[] tokens)
+        {
+            int n = 0;
+            int i = 0;
+            int length = line.Length;
+            while (i < length)
+            {
+                while (i < length && char.IsWhiteSpace(line[i])) i++;
+                if (i == length) break;
+
+                int start = i;
+                while (i < length && !char.IsWhiteSpace(line[i])) i++;
+
+                // Anything after a '$' at the start of a field is a comment
+                if (line[start] == '$') break;
+                if (n == MaxTokens) throw Error("too many fields");
+                tokens[n++] = line.Substring(start, i - start);
+            }
+            return n;
+        }
+
+        private readonly Dictionary<string, int> rows = new Dictionary<string, int>();
+        private readonly List<string> rowNames = new List<string>();
+        private readonly List<char> rowTypes = new List<char>();
+        private readonly List<Expression> rowExpressions = new List<Expression>();
+        private readonly Dictionary<string, int> columns = new Dictionary<string, int>();
+        private readonly List<Variable> variables = new List<Variable>();
+        private readonly List<bool> hasBounds = new List<bool>();
+        private double[] rowRhs;
+        private double[] rowRange;
+        private int objectiveRow = -1;
+        private bool integerSection = false;
+        private Variable currentVariable;
+        private int lineNumber = 0;
+    }
+}
@@ -227,6 +227,16 @@ namespace Sonnet
             this.bound = bound;
         }
 
+        /// <summary>
+        /// Replaces the expression of this objective by a copy of the given (assembled) expression, without updating the solvers.
+        /// Used to update the model to a solver that was changed directly (see Solver.ApplyPatch).
+        /// </summary>
+        /// <param name="expr">The new expression.</param>
+        internal void Reset(Expression expr)
+        {
+            expression = new Expression(expr);
+        }
+
         /// <summary>
         /// Returns the coefficients of (the expression of) this objective.
         /// </summary>
@@ -276,12 +286,12 @@ namespace Sonnet
         }
 
         /// <summary>
-        /// Used for assigning this.id as numberOf++
+        /// Used for assigning this.id as numberOf++, atomically since objectives can be created on multiple threads.
         /// </summary>
         /// <returns>numberOf++</returns>
         private static int NextId()
         {
-            return numberOfObjectives++;
+            return System.Threading.Interlocked.Increment(ref numberOfObjectives) - 1;
         }
 
         private static int numberOfObjectives = 0;
@@ -0,0 +1,113 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Text;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// A breakpoint of a parametric solve (see Solver.Parametrics): the value of theta at which the optimal basis changes,
+    /// together with the objective value and the names (at the solver) of the entering and leaving variables or constraints.
+    /// </summary>
+    public class ParametricBreakpoint
+    {
+        internal ParametricBreakpoint(double theta, double objectiveValue, string enteringName, string leavingName)
+        {
+            this.theta = theta;
+            this.objectiveValue = objectiveValue;
+            this.enteringName = enteringName;
+            this.leavingName = leavingName;
+        }
+
+        /// <summary>
+        /// Gets the value of theta at this breakpoint.
+        /// </summary>
+        public double Theta { get { return theta; } }
+
+        /// <summary>
+        /// Gets the objective value (including the constant term) at this breakpoint.
+        /// </summary>
+        public double ObjectiveValue { get { return objectiveValue; } }
+
+        /// <summary>
+        /// Gets the name at the solver of the variable or constraint that enters the basis at this breakpoint, or an empty string if not reported.
+        /// </summary>
+        public string EnteringName { get { return enteringName; } }
+
+        /// <summary>
+        /// Gets the name at the solver of the variable or constraint that leaves the basis at this breakpoint, or an empty string if not reported.
+        /// </summary>
+        public string LeavingName { get { return leavingName; } }
+
+        /// <summary>
+        /// Returns a string that represents the current breakpoint.
+        /// </summary>
+        /// <returns>A string that represents the current breakpoint.</returns>
+        public override string ToString()
+        {
+            if (string.IsNullOrEmpty(enteringName)) return string.Format("Theta {0} - objective {1}", theta, objectiveValue);
+            return string.Format("Theta {0} - objective {1}, {2} in, {3} out", theta, objectiveValue, enteringName, leavingName);
+        }
+
+        private readonly double theta;
+        private readonly double objectiveValue;
+        private readonly string enteringName;
+        private readonly string leavingName;
+    }
+
+    /// <summary>
+    /// The result of a parametric solve (see Solver.Parametrics): the breakpoints, and the maximum theta reached.
+    /// </summary>
+    public class ParametricResult
+    {
+        internal ParametricResult(IList<ParametricBreakpoint> breakpoints, double endingTheta, int status)
+        {
+            this.breakpoints = breakpoints;
+            this.endingTheta = endingTheta;
+            this.status = status;
+        }
+
+        /// <summary>
+        /// Gets the breakpoints, in order of increasing theta.
+        /// </summary>
+        public IList<ParametricBreakpoint> Breakpoints { get { return breakpoints; } }
+
+        /// <summary>
+        /// Gets the maximum theta reached. This can be used as starting theta for a next parametric solve.
+        /// </summary>
+        public double EndingTheta { get { return endingTheta; } }
+
+        /// <summary>
+        /// Is the given ending theta reached?
+        /// </summary>
+        public bool IsEndingThetaReached { get { return status == 0; } }
+
+        /// <summary>
+        /// Was the problem found primal infeasible before reaching the given ending theta?
+        /// </summary>
+        public bool IsProvenPrimalInfeasible { get { return status == 1; } }
+
+        /// <summary>
+        /// Was the problem found unbounded (dual infeasible) before reaching the given ending theta?
+        /// </summary>
+        public bool IsProvenDualInfeasible { get { return status == 2; } }
+
+        /// <summary>
+        /// Returns a string that represents the current result, with one line per breakpoint.
+        /// </summary>
+        /// <returns>A string that represents the current result.</returns>
+        public override string ToString()
+        {
+            StringBuilder s = new StringBuilder();
+            foreach (ParametricBreakpoint breakpoint in breakpoints) s.AppendLine(breakpoint.ToString());
+            s.AppendFormat("Ending theta: {0}", endingTheta);
+            return s.ToString();
+        }
+
+        private readonly IList<ParametricBreakpoint> breakpoints;
+        private readonly double endingTheta;
+        private readonly int status;
+    }
+}
@@ -0,0 +1,176 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Concurrent;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// A read-only stream that reads ahead from a source stream on a background thread, such that reading the source
+    /// (for example decompressing a file) overlaps with processing the data read from this stream.
+    /// The data is passed in a bounded number of blocks, which are reused. Hence, the memory use is fixed,
+    /// and the source is never read completely into memory.
+    /// </summary>
+    internal class PipelinedStream : Stream
+    {
+        private const int DefaultBlockSize = 1 << 16;
+        private const int DefaultNumberOfBlocks = 16;
+
+        /// <summary>
+        /// Constructor of a new pipelined stream that starts reading ahead from the given source. The source is disposed with this stream.
+        /// </summary>
+        /// <param name="source">The stream to read ahead from.</param>
+        public PipelinedStream(Stream source)
+            : this(source, DefaultBlockSize, DefaultNumberOfBlocks)
+        {
+        }
+
+        /// <summary>
+        /// Constructor of a new pipelined stream that starts reading ahead from the given source. The source is disposed with this stream.
+        /// </summary>
+        /// <param name="source">The stream to read ahead from.</param>
+        /// <param name="blockSize">The size of the blocks read from the source.</param>
+        /// <param name="numberOfBlocks">The maximum number of blocks read ahead.</param>
+        public PipelinedStream(Stream source, int blockSize, int numberOfBlocks)
+        {
+            Ensure.NotNull(source, "source");
+            Ensure.IsTrue(blockSize > 0 && numberOfBlocks > 0, "The block size and number of blocks must be positive.");
+
+            this.source = source;
+            full = new BlockingCollection<ArraySegment<byte>>(numberOfBlocks);
+            empty = new BlockingCollection<byte[]>(numberOfBlocks + 1);
+            for (int i = 0; i <= numberOfBlocks; i++) empty.Add(new byte[blockSize]);
+
+            producer = Task.Factory.StartNew(Produce, TaskCreationOptions.LongRunning);
+        }
+
+        private void Produce()
+        {
+            try
+            {
+                while (true)
+                {
+                    byte[] block = empty.Take(cancellation.Token);
+                    int count = source.Read(block, 0, block.Length);
+                    if (count == 0) break;
+
+                    full.Add(new ArraySegment<byte>(block, 0, count), cancellation.Token);
+                }
+            }
+            catch (OperationCanceledException)
+            {
+                // Disposed before the end of the source
+            }
+            catch (Exception e)
+            {
+                error = e;
+            }
+            finally
+            {
+                full.CompleteAdding();
+            }
+        }
+
+        /// <summary>
+        /// Reads data that was read ahead from the source. Blocks until data is available, or the end of the source is reached.
+        /// </summary>
+        public override int Read(byte[] buffer, int offset, int count)
+        {
+            if (count == 0) return 0;
+
+            while (current.Array == null || currentOffset == current.Count)
+            {
+                if (current.Array != null) empty.Add(current.Array);
+                current = default(ArraySegment<byte>);
+
+                ArraySegment<byte> next;
+                if (!full.TryTake(out next, Timeout.Infinite))
+                {
+                    if (error != null) throw new IOException("Error while reading ahead: " + error.Message, error);
+                    return 0;
+                }
+
+                current = next;
+                currentOffset = 0;
+            }
+
+            int n = Math.Min(count, current.Count - currentOffset);
+            Buffer.BlockCopy(current.Array, current.Offset + currentOffset, buffer, offset, n);
+            currentOffset += n;
+            position += n;
+            return n;
+        }
+
+        public override bool CanRead { get { return true; } }
+
+        public override bool CanSeek { get { return false; } }
+
+        public override bool CanWrite { get { return false; } }
+
+        public override long Length { get { throw new NotSupportedException(); } }
+
+        public override long Position
+        {
+            get { return position; }
+            set { throw new NotSupportedException(); }
+        }
+
+        public override void Flush()
+        {
+        }
+
+        public override long Seek(long offset, SeekOrigin origin)
+        {
+            throw new NotSupportedException();
+        }
+
+        public override void SetLength(long value)
+        {
+            throw new NotSupportedException();
+        }
+
+        public override void Write(byte[] buffer, int offset, int count)
+        {
+            throw new NotSupportedException();
+        }
+
+        protected override void Dispose(bool disposing)
+        {
+            if (disposing && !disposed)
+            {
+                disposed = true;
+                cancellation.Cancel();
+                try
+                {
+                    producer.Wait();
+                }
+                catch (AggregateException)
+                {
+                    // The producer does not throw, but report errors via Read
+                }
+
+                source.Dispose();
+                full.Dispose();
+                empty.Dispose();
+                cancellation.Dispose();
+            }
+
+            base.Dispose(disposing);
+        }
+
+        private readonly Stream source;
+        private readonly BlockingCollection<ArraySegment<byte>> full;
+        private readonly BlockingCollection<byte[]> empty;
+        private readonly CancellationTokenSource cancellation = new CancellationTokenSource();
+        private readonly Task producer;
+        private volatile Exception error;
+        private ArraySegment<byte> current;
+        private int currentOffset;
+        private long position;
+        private bool disposed;
+    }
+}
@@ -0,0 +1,165 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Text;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// A temporary change of the bounds of a variable or constraint, used for probing the solver (see Solver.Probe).
+    /// For a constraint, the bounds are the lower and upper bound of the row at the solver,
+    /// i.e., after all variables have been moved to the left-hand side.
+    /// A bound change is applied only to the solver, and never changes the variable or constraint itself.
+    /// </summary>
+    public class BoundChange
+    {
+        /// <summary>
+        /// Constructor of a new bound change for the given variable.
+        /// </summary>
+        /// <param name="variable">The variable of which the bounds will be changed.</param>
+        /// <param name="lower">The new lower bound.</param>
+        /// <param name="upper">The new upper bound.</param>
+        public BoundChange(Variable variable, double lower, double upper)
+        {
+            Ensure.NotNull(variable, "variable");
+
+            this.variable = variable;
+            this.lower = lower;
+            this.upper = upper;
+        }
+
+        /// <summary>
+        /// Constructor of a new bound change for the given constraint.
+        /// </summary>
+        /// <param name="constraint">The constraint of which the bounds will be changed.</param>
+        /// <param name="lower">The new lower bound of the row.</param>
+        /// <param name="upper">The new upper bound of the row.</param>
+        public BoundChange(Constraint constraint, double lower, double upper)
+        {
+            Ensure.NotNull(constraint, "constraint");
+
+            this.constraint = constraint;
+            this.lower = lower;
+            this.upper = upper;
+        }
+
+        /// <summary>
+        /// Returns a new bound change that fixes the given variable at the given value.
+        /// </summary>
+        /// <param name="variable">The variable to be fixed.</param>
+        /// <param name="value">The value to fix the variable at.</param>
+        /// <returns>The new bound change.</returns>
+        public static BoundChange Fix(Variable variable, double value)
+        {
+            return new BoundChange(variable, value, value);
+        }
+
+        /// <summary>
+        /// Gets the variable of this bound change, or null if this bound change is for a constraint.
+        /// </summary>
+        public Variable Variable { get { return variable; } }
+
+        /// <summary>
+        /// Gets the constraint of this bound change, or null if this bound change is for a variable.
+        /// </summary>
+        public Constraint Constraint { get { return constraint; } }
+
+        /// <summary>
+        /// Gets the new lower bound.
+        /// </summary>
+        public double Lower { get { return lower; } }
+
+        /// <summary>
+        /// Gets the new upper bound.
+        /// </summary>
+        public double Upper { get { return upper; } }
+
+        /// <summary>
+        /// Returns a string that represents the current bound change.
+        /// </summary>
+        /// <returns>A string that represents the current bound change.</returns>
+        public override string ToString()
+        {
+            string name = !(variable is null) ? variable.Name : constraint.Name;
+            return string.Format("{0} <= {1} <= {2}", lower, name, upper);
+        }
+
+        private readonly Variable variable;
+        private readonly Constraint constraint;
+        private readonly double lower;
+        private readonly double upper;
+    }
+
+    /// <summary>
+    /// The objective-only result of a single probe (see Solver.Probe).
+    /// The variables and constraints of the model are not changed by probing.
+    /// </summary>
+    public class ProbeResult
+    {
+        internal ProbeResult(double objectiveValue, int iterationCount, bool isAbandoned, bool isProvenOptimal,
+            bool isProvenPrimalInfeasible, bool isIterationLimitReached)
+        {
+            this.objectiveValue = objectiveValue;
+            this.iterationCount = iterationCount;
+            this.isAbandoned = isAbandoned;
+            this.isProvenOptimal = isProvenOptimal;
+            this.isProvenPrimalInfeasible = isProvenPrimalInfeasible;
+            this.isIterationLimitReached = isIterationLimitReached;
+        }
+
+        /// <summary>
+        /// Gets the objective value (including the constant term) at the end of the probe.
+        /// Only a bound on the true value if the probe is not proven optimal, e.g., if the iteration limit was reached.
+        /// </summary>
+        public double ObjectiveValue { get { return objectiveValue; } }
+
+        /// <summary>
+        /// Gets the number of iterations of this probe.
+        /// </summary>
+        public int IterationCount { get { return iterationCount; } }
+
+        /// <summary>
+        /// Were there numerical difficulties?
+        /// </summary>
+        public bool IsAbandoned { get { return isAbandoned; } }
+
+        /// <summary>
+        /// Is optimality proven?
+        /// </summary>
+        public bool IsProvenOptimal { get { return isProvenOptimal; } }
+
+        /// <summary>
+        /// Is primal infeasiblity proven?
+        /// </summary>
+        public bool IsProvenPrimalInfeasible { get { return isProvenPrimalInfeasible; } }
+
+        /// <summary>
+        /// Iteration limit reached?
+        /// </summary>
+        public bool IsIterationLimitReached { get { return isIterationLimitReached; } }
+
+        /// <summary>
+        /// Returns a string that represents the current probe result.
+        /// </summary>
+        /// <returns>A string that represents the current probe result.</returns>
+        public override string ToString()
+        {
+            StringBuilder s = new StringBuilder();
+            s.AppendFormat("Objective value: {0}", objectiveValue);
+            if (isProvenOptimal) s.Append(" (optimal)");
+            if (isProvenPrimalInfeasible) s.Append(" (infeasible)");
+            if (isIterationLimitReached) s.Append(" (iteration limit)");
+            if (isAbandoned) s.Append(" (abandoned)");
+            s.AppendFormat(" after {0} iterations", iterationCount);
+            return s.ToString();
+        }
+
+        private readonly double objectiveValue;
+        private readonly int iterationCount;
+        private readonly bool isAbandoned;
+        private readonly bool isProvenOptimal;
+        private readonly bool isProvenPrimalInfeasible;
+        private readonly bool isIterationLimitReached;
+    }
+}
@@ -168,6 +168,14 @@ namespace Sonnet
             return rhs.Level() - Level();
         }
 
+        internal override bool Reset(Expression expr, double lower, double upper)
+        {
+            this.expr = new Expression(expr);
+            rhs.Assign(upper);
+            this.lower = lower;
+            return true;
+        }
+
         internal override void Assemble()
         {
             // for RangeConstraints, the rhs (upper) and lhs (lower) are always constant.
@@ -0,0 +1,75 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// The result of sensitivity analysis (ranging) of a single objective coefficient or constraint right-hand side
+    /// with respect to the current optimal basis (see Solver.GetObjectiveRanges and Solver.GetRhsRanges).
+    /// Within [Lower, Upper] the current basis remains optimal.
+    /// </summary>
+    public class SensitivityRange
+    {
+        internal SensitivityRange(double value, double decrease, double increase)
+        {
+            this.value = value;
+            this.decrease = decrease;
+            this.increase = increase;
+        }
+
+        /// <summary>
+        /// Gets the current value: the objective coefficient of the variable, or the activity of the constraint
+        /// (which equals the right-hand side for binding constraints).
+        /// </summary>
+        public double Value { get { return value; } }
+
+        /// <summary>
+        /// Gets the maximum decrease (always &gt;= 0) of the value for which the current basis remains optimal.
+        /// </summary>
+        public double Decrease { get { return decrease; } }
+
+        /// <summary>
+        /// Gets the maximum increase (always &gt;= 0) of the value for which the current basis remains optimal.
+        /// </summary>
+        public double Increase { get { return increase; } }
+
+        /// <summary>
+        /// Gets the lower end of the range, that is Value - Decrease.
+        /// </summary>
+        public double Lower
+        {
+            get
+            {
+                if (decrease >= MathUtils.Infinity) return -MathUtils.Infinity;
+                return value - decrease;
+            }
+        }
+
+        /// <summary>
+        /// Gets the upper end of the range, that is Value + Increase.
+        /// </summary>
+        public double Upper
+        {
+            get
+            {
+                if (increase >= MathUtils.Infinity) return MathUtils.Infinity;
+                return value + increase;
+            }
+        }
+
+        /// <summary>
+        /// Returns a string that represents the current range.
+        /// </summary>
+        /// <returns>A string that represents the current range.</returns>
+        public override string ToString()
+        {
+            return string.Format("{0} <= {1} <= {2}", Lower, value, Upper);
+        }
+
+        private readonly double value;
+        private readonly double decrease;
+        private readonly double increase;
+    }
+}
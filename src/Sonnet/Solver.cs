@@ -8,7 +8,11 @@ using System.Runtime.InteropServices;
 using System.Diagnostics;
 using System.Linq;
 
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
 using COIN;
+#endif
 
 namespace Sonnet
 {
@@ -57,7 +61,7 @@ namespace Sonnet
         public Solver(Model model, Type osiSolverInterfaceType, string name = null)
         {
             Ensure.NotNull(model, nameof(model));
-            Ensure.Is<COIN.OsiSolverInterface>(osiSolverInterfaceType, nameof(osiSolverInterfaceType));
+            Ensure.Is<OsiSolverInterface>(osiSolverInterfaceType, nameof(osiSolverInterfaceType));
 
             OsiSolverInterface solver = (OsiSolverInterface)osiSolverInterfaceType.GetConstructor(System.Type.EmptyTypes).Invoke(null);
             GutsOfConstructor(model, solver, name);
@@ -119,6 +123,69 @@ namespace Sonnet
             get { return this.autoResetMIPSolve; }
             set { this.autoResetMIPSolve = value; }
         }
+
+        /// <summary>
+        /// When false, after each solve the solution is assigned to all variables and constraints (= Default).
+        /// When true, after each solve only a snapshot of the solution is stored at the solver, and 
+        /// the values, reduced costs, prices etc. of variables and constraints are read from this snapshot on demand.
+        /// This reduces the time after solving from linear in the size of the model to linear in the number of values read.
+        /// In both cases, the values of variables and constraints are those of the latest solve.
+        /// </summary>
+        public bool LazySolutionAssignment
+        {
+            get { return this.lazySolutionAssignment; }
+            set { this.lazySolutionAssignment = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the pool of worker processes to solve in (default null: solve in this process).
+        /// When set, Solve, Resolve, Maximise and Minimise send the generated problem to a worker process of the pool
+        /// and assign the solution that is sent back. A crash, or exceeding the time or memory limit of the pool, 
+        /// in the worker process results in a SonnetException, but leaves this process and the solver intact.
+        /// Since each solve in a worker starts from scratch, there is no warm start between solves. 
+        /// Quadratic objectives are not supported.
+        /// </summary>
+        public SolverWorkerPool WorkerPool
+        {
+            get { return this.workerPool; }
+            set { this.workerPool = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the number of simplex iterations between progress samples, or 0 for no sampling (= Default).
+        /// When positive, each solve by Clp (also as the LP solver of Cbc) records the iteration count, phase, objective value, 
+        /// infeasibilities and elapsed time every ProgressInterval iterations, natively and without logging. See ProgressSamples.
+        /// Progress is not sampled for other solvers, nor when solving in a WorkerPool.
+        /// </summary>
+        public int ProgressInterval
+        {
+            get { return this.progressInterval; }
+            set
+            {
+                Ensure.IsTrue(value >= 0, "The progress interval cannot be negative.");
+#if (SONNET_NATIVE)
+                Ensure.Supported(value == 0, "Progress sampling requires the ClpProgressSampler of SonnetWrapper.");
+#endif
+                this.progressInterval = value;
+            }
+        }
+
+#if (!SONNET_NATIVE)
+        /// <summary>
+        /// Gets the progress samples of the latest solve (see ProgressInterval), or of the current solve if read from another thread while solving.
+        /// The last sample is of the end of the solve. If a solve takes more samples than fit in the buffer, every other sample 
+        /// is discarded and the interval is doubled, so the samples always cover the whole solve.
+        /// Returns an empty array if no progress was sampled.
+        /// </summary>
+        public ClpProgressSample[] ProgressSamples
+        {
+            get
+            {
+                if (progressSampler == null) return new ClpProgressSample[0];
+                return progressSampler.getSamples();
+            }
+        }
+#endif
         
         #region OsiSolver Properties and Parameters
         /// <summary>
@@ -182,6 +249,47 @@ namespace Sonnet
 
             Ensure.NotSupported($"Not supported for solver type {OsiSolverFullName}");
         }
+
+        /// <summary>
+        /// Sets the solution in the given solution file (see SaveSolution) as starting solution for the solver.
+        /// The variables are matched by name, so the file can be from a slightly different model.
+        /// Default does not check whether the solution is actually feasible.
+        /// </summary>
+        /// <param name="fileName">The solution file.</param>
+        public void SetMIPStart(string fileName)
+        {
+            SetMIPStart(fileName, false);
+        }
+
+        /// <summary>
+        /// Sets the solution in the given solution file (see SaveSolution) as starting solution for the solver.
+        /// Variables that are not in the file get value 0.
+        /// </summary>
+        /// <param name="fileName">The solution file.</param>
+        /// <param name="check">If true, the solver checks whether the solution is actually feasible.</param>
+        public void SetMIPStart(string fileName, bool check)
+        {
+            Ensure.Supported(IsMIP, "Only supported for MIP");
+
+#if (SONNET_NATIVE)
+            throw new NotSupportedException("Solution files require the SolutionFile of SonnetWrapper.");
+#else
+            SolutionFile solutionFile = ReadSolutionFile(fileName);
+            double[] solution = solutionFile.getColSolution();
+            double[] objectiveCoefficients = solver.getObjCoefficients();
+
+            double objectiveValue = objective.Constant;
+            for (int j = 0; j < solution.Length; j++) objectiveValue += objectiveCoefficients[j] * solution[j];
+
+            if (solver is OsiCbcSolverInterface osiCbc)
+            {
+                osiCbc.Model.setBestSolution(solution, solution.Length, objectiveValue, check);
+                return;
+            }
+
+            Ensure.NotSupported($"Not supported for solver type {OsiSolverFullName}");
+#endif
+        }
         /// <summary>
         /// Get the Infinity of the current solver
         /// </summary>
@@ -217,12 +325,12 @@ namespace Sonnet
         /// <returns>An array of Types within the SonnetWrapper that are derived from OsiSolverInterface.</returns>
         public static Type[] GetOsiSolverTypes()
         {
-            Type[] types = System.Reflection.Assembly.GetAssembly(typeof(COIN.OsiSolverInterface)).GetTypes();
+            Type[] types = System.Reflection.Assembly.GetAssembly(typeof(OsiSolverInterface)).GetTypes();
             List<Type> osiTypes = new List<Type>();
             foreach (Type type in types)
             {
                 
-                if (type.IsSubclassOf(typeof(COIN.OsiSolverInterface)) &&
+                if (type.IsSubclassOf(typeof(OsiSolverInterface)) &&
                     !type.IsAbstract)
                 {
                     osiTypes.Add(type);
@@ -379,197 +487,977 @@ namespace Sonnet
 
             try
             {
-                if (forceRelaxation == false && IsMIP)
+                if (workerPool != null)
+                {
+                    Ensure.IsFalse(objective.IsQuadratic, "Solving in a worker process is not supported for quadratic objectives.");
+
+                    bool mipSolve = forceRelaxation == false && IsMIP;
+                    isSolving = true;
+                    SolverWorkerResult result = workerPool.Solve(SolverWorkerRequest.FromSolver(solver, mipSolve));
+                    AssignSolution(result, mipSolve);
+                    isLPSolution = false; // the solver in this process is not solved
+                }
+                else if (forceRelaxation == false && IsMIP)
                 {
                     if (objective.IsQuadratic)
                     {
                         log.Warn("Only experimantal support for MIQP!");
                     }
 
+#if (!SONNET_NATIVE)
+                    StartProgressSampling();
+#endif
+
                     isSolving = true;
                     SaveBeforeMIPSolveInternal(); // save anyway, to allow manual reset
 
-                    if (solver is OsiCbcSolverInterface cbcSolver)
+                    BranchAndBound(solver, objective.IsQuadratic);
+
+                    AssignSolution(true);
+                    isLPSolution = false;
+                    if (AutoResetMIPSolve)
                     {
-                        if (!objective.IsQuadratic && cbcSolver.UseBranchAndBound())
-                        {
-                            cbcSolver.getModelPtr().branchAndBound();
-                            //cbcSolver.branchAndBound(); // this somehow DOESNT work (wrong obj value) if Quadratic
-                        }
-                        else
+                        SonnetLog.Default.Info("Resetting automatically after MIPSolve. Use solver.AutoResetMIPSolver = false if you don't want this.");
+                        ResetAfterMIPSolveInternal(); // mainly to reset bounds etc, but use AssignSolutionStatus because the Reset messes up the IsProvenOptimal etc!
+                    }
+                }
+                else
+                {
+#if (!SONNET_NATIVE)
+                    ClpSimplex progressModel = StartProgressSampling();
+#endif
+
+                    isSolving = true;
+                    if (doResolve) solver.resolve();
+                    else solver.initialSolve();
+
+#if (!SONNET_NATIVE)
+                    if (progressModel != null) progressSampler.sample(progressModel);
+#endif
+                    AssignSolution(false);
+                    isLPSolution = true;
+                }
+            }
+            catch (Exception e)
+            {
+                log.Error(e.ToString());
+                throw;
+            }
+            finally
+            {
+                isSolving = false;
+            }
+
+            log.InfoFormat(" IsAbandoned: {0}", IsAbandoned);
+            log.InfoFormat(" IsProvenOptimal: {0}", IsProvenOptimal);
+            log.InfoFormat(" IsProvenDualInfeasible: {0}", IsProvenDualInfeasible);
+            log.InfoFormat(" IsProvenPrimalInfeasible: {0}", IsProvenPrimalInfeasible);
+            log.InfoFormat(" IsPrimalObjectiveLimitReached: {0}", IsPrimalObjectiveLimitReached);
+            log.InfoFormat(" IsDualObjectiveLimitReached: {0}", IsDualObjectiveLimitReached);
+
+            log.InfoFormat("Done resolving after {0}", (CoinUtils.CoinCpuTime() - genStart));
+        }
+
+#if (!SONNET_NATIVE)
+        /// <summary>
+        /// Installs the progress sampler in the ClpSimplex model of the solver if ProgressInterval is positive, 
+        /// or removes it otherwise, and returns the ClpSimplex model if sampling.
+        /// </summary>
+        /// <returns>The ClpSimplex model of the solver if sampling, or null.</returns>
+        private ClpSimplex StartProgressSampling()
+        {
+            ClpSimplex clpSimplex = GetClpSimplex();
+            if (clpSimplex == null) return null;
+
+            if (progressInterval == 0)
+            {
+                if (progressSampler != null)
+                {
+                    clpSimplex.removeEventHandler();
+                    progressSampler = null;
+                }
+                return null;
+            }
+
+            if (progressSampler == null || progressSampler.getInterval() != progressInterval)
+            {
+                progressSampler = new ClpProgressSampler(progressInterval);
+            }
+
+            progressSampler.reset();
+            clpSimplex.passInEventHandler(progressSampler);
+            return clpSimplex;
+        }
+#endif
+
+        /// <summary>
+        /// Solves the current problem of the given native solver with branch and bound.
+        /// For OsiCbcSolverInterface, this uses CbcMain with the CbcSolverArgs of the solver, if any.
+        /// </summary>
+        /// <param name="solver">The native solver with the problem loaded.</param>
+        /// <param name="isQuadratic">True iff the objective of the problem is quadratic.</param>
+        internal static void BranchAndBound(OsiSolverInterface solver, bool isQuadratic)
+        {
+            if (solver is OsiCbcSolverInterface cbcSolver)
+            {
+                if (!isQuadratic && cbcSolver.UseBranchAndBound())
+                {
+                    cbcSolver.getModelPtr().branchAndBound();
+                    //cbcSolver.branchAndBound(); // this somehow DOESNT work (wrong obj value) if Quadratic
+                }
+                else
+                {
+                    string[] cbcMainArgs = cbcSolver.GetCbcSolverArgs();
+                    var args = new List<string>();
+                    args.Add("Sonnet");
+                    if (cbcSolver.UseBranchAndBound())
+                    {
+                        args.Add("-solve");
+                        //args.Add("-solution");
+                        //args.Add("out.txt");
+                    }
+                    else
+                    {
+                        args.AddRange(cbcMainArgs);
+                        // if threads are supported, and no user override, then set threads equal to processor count
+                        // For servers, this may well be too high, since you might not want all processors to be running for Cbc
+                        // In such cases, it is advised to manually add "-threads" "n" arguments
+                        if (CbcSolver.SupportsThreads)
                         {
-                            string[] cbcMainArgs = cbcSolver.GetCbcSolverArgs();
-                            var args = new List<string>();
-                            args.Add("Sonnet");
-                            if (cbcSolver.UseBranchAndBound())
+                            if (!args.Contains("-threads"))
                             {
-                                args.Add("-solve");
-                                //args.Add("-solution");
-                                //args.Add("out.txt");
+                                args.Add("-threads");
+                                args.Add($"{Environment.ProcessorCount}");
                             }
-                            else
-                            {
-                                args.AddRange(cbcMainArgs);
-                                // if threads are supported, and no user override, then set threads equal to processor count
-                                // For servers, this may well be too high, since you might not want all processors to be running for Cbc
-                                // In such cases, it is advised to manually add "-threads" "n" arguments
-                                if (CbcSolver.SupportsThreads)
-                                {
-                                    if (!args.Contains("-threads"))
-                                    {
-                                        args.Add("-threads");
-                                        args.Add($"{Environment.ProcessorCount}");
-                                    }
-                                }
-                                else 
-                                {
-                                    // If not SupportsThreads, then no -threads argument shall be used!
-                                    Ensure.IsFalse(args.Contains("-threads"), "Cannot use threads since CbcSolver is not built to SupportThreads.");
-                                }
-                                args.Add("-solve");
-                            }
-                            args.Add("-quit");
-
-                            Sonnet.SonnetLog.Default.InfoFormat("Using CbcSolver.CbcMain with args {0}", string.Join(" ", args));
-                            // The default strategy for regular CbcModel is null, but for OsiCbcSolverInterface is the default strategy
-                            // This causes a difference between cbc and here, so if we're asked to solve using the cbcmain, then set strategy to null
-                            if (cbcSolver.getModelPtr().strategy() is COIN.CbcStrategyDefault) cbcSolver.getModelPtr().setStrategy(null);
-                            CbcSolver.CbcMain(args.ToArray(), cbcSolver.getModelPtr());
-                            // Use CbcMain and not CbcMain0/1 because it passes parameters between CbcMain0 and 1
                         }
+                        else 
+                        {
+                            // If not SupportsThreads, then no -threads argument shall be used!
+                            Ensure.IsFalse(args.Contains("-threads"), "Cannot use threads since CbcSolver is not built to SupportThreads.");
+                        }
+                        args.Add("-solve");
                     }
-                    else
+                    args.Add("-quit");
+
+                    Sonnet.SonnetLog.Default.InfoFormat("Using CbcSolver.CbcMain with args {0}", string.Join(" ", args));
+                    // The default strategy for regular CbcModel is null, but for OsiCbcSolverInterface is the default strategy
+                    // This causes a difference between cbc and here, so if we're asked to solve using the cbcmain, then set strategy to null
+#if (SONNET_NATIVE)
+                    cbcSolver.getModelPtr().clearDefaultStrategy();
+#else
+                    if (cbcSolver.getModelPtr().strategy() is COIN.CbcStrategyDefault) cbcSolver.getModelPtr().setStrategy(null);
+#endif
+                    CbcSolver.CbcMain(args.ToArray(), cbcSolver.getModelPtr());
+                    // Use CbcMain and not CbcMain0/1 because it passes parameters between CbcMain0 and 1
+                }
+            }
+            else
+            {
+                solver.branchAndBound();
+            }
+        }
+
+        #endregion
+
+        /// <summary>
+        /// Determine whether the current solution satisfies all constraints and variables bounds and types.
+        /// </summary>
+        /// <returns>True iff the current solution is feasible.</returns>
+        public bool IsFeasible()
+        {
+            Generate();
+
+            bool feasible = true;
+
+            log.Debug("IsFeasible: Determine whether the current solution satisfies all constraints and variables bounds and types.");
+            log.Debug(string.Concat("Claimed Solution status: ", ((IsProvenOptimal) ? ("Optimal") : "not Optimal")));
+
+            log.Debug("Infeasible variables:");
+            bool hasInfeasibleVariables = false;
+            int m = variables.Count;
+            for (int j = 0; j < m; j++)
+            {
+                Variable aVar = variables[j];
+                if (!aVar.IsFeasible())
+                {
+                    if (log.IsDebugEnabled) log.Debug(aVar.ToLevelString());
+                    feasible = false;
+                    hasInfeasibleVariables = true;
+                }
+            }
+
+            if (!hasInfeasibleVariables)
+            {
+                log.Debug("No infeasible variables.");
+            }
+
+            log.Debug("Infeasible constraints:");
+            bool hasInfeasibleConstraints = false;
+            int n = constraints.Count;
+            for (int i = 0; i < n; i++)
+            {
+                Constraint aCon = constraints[i];
+                if (aCon.Enabled)
+                {   // only check Enabled constraints, not disabled ones
+                    if (!aCon.IsFeasible())
+                    {
+                        if (log.IsDebugEnabled) log.Debug(aCon.ToLevelString());
+                        feasible = false;
+                        hasInfeasibleConstraints = true;
+                    }
+                }
+            }
+
+            if (!hasInfeasibleConstraints)
+            {
+                log.Debug("No infeasible constraints.");
+            }
+
+            log.Debug("End IsFeasible");
+            
+            return feasible;
+        }
+
+        #region Get / Set WarmStart methods
+        ///<summary>
+        /// Gets the warm start object for the current problem
+        ///</summary>
+        public WarmStart GetWarmStart()
+        {
+            Generate();
+            return WarmStart.NewWarmStart(solver);
+        }
+
+        ///<summary>
+        /// Gets an empty warm start object for the current problem
+        ///</summary>
+        public WarmStart GetEmptyWarmStart()
+        {
+            Generate();
+            return WarmStart.NewEmptyWarmStart(solver);
+        }
+
+        ///<summary>
+        /// Set (apply) the given warm start object to the current problem
+        ///</summary>
+        public void SetWarmStart(WarmStart warmStart)
+        {
+            Ensure.NotNull(warmStart, "WarmStart");
+
+            Generate();
+            warmStart.ApplyWarmStart(solver);
+        }
+
+        ///<summary>
+        /// Saves the current solution, row prices and basis to the given binary solution file, with the names of the variables and constraints.
+        /// The file can be read by ReadWarmStart and SetMIPStart(fileName), also for a slightly different model.
+        ///</summary>
+        /// <param name="fileName">The solution file.</param>
+        public void SaveSolution(string fileName)
+        {
+#if (SONNET_NATIVE)
+            throw new NotSupportedException("Solution files require the SolutionFile of SonnetWrapper.");
+#else
+            Generate();
+
+            string[] columnNames = variables.Select(v => v.Name).ToArray();
+            string[] rowNames = constraints.Select(c => c.Name).ToArray();
+            SolutionFile.save(solver, fileName, columnNames, rowNames);
+#endif
+        }
+
+        ///<summary>
+        /// Gets the warm start object for the current problem from the given solution file (see SaveSolution).
+        /// The warm start includes the values, the row prices and the basis of the file.
+        /// The variables and constraints are matched by name. Variables that are not in the file start at their lower bound,
+        /// and constraints that are not in the file start with a basic slack and price 0. If then the number of basic
+        /// variables does not match the number of constraints, the basis is repaired as after ApplyPatch.
+        ///</summary>
+        /// <param name="fileName">The solution file.</param>
+        /// <returns>The warm start object, to be applied by SetWarmStart.</returns>
+        public WarmStart ReadWarmStart(string fileName)
+        {
+#if (SONNET_NATIVE)
+            throw new NotSupportedException("Solution files require the SolutionFile of SonnetWrapper.");
+#else
+            SolutionFile solutionFile = ReadSolutionFile(fileName);
+
+            CoinWarmStart coinWarmStart = solutionFile.getBasis() ?? solver.getEmptyWarmStart();
+            return WarmStart.NewWarmStart(coinWarmStart, solutionFile.getColSolution(), solutionFile.getRowPrice());
+#endif
+        }
+
+#if (!SONNET_NATIVE)
+        private SolutionFile ReadSolutionFile(string fileName)
+        {
+            Ensure.NotNull(fileName, "fileName");
+
+            Generate();
+
+            string[] columnNames = variables.Select(v => v.Name).ToArray();
+            string[] rowNames = constraints.Select(c => c.Name).ToArray();
+
+            SolutionFile solutionFile = new SolutionFile();
+            solutionFile.read(fileName, solver, columnNames, rowNames);
+
+            log.InfoFormat("Read solution file {0}: matched {1} of {2} variables and {3} of {4} constraints", fileName,
+                solutionFile.getNumberMatchedColumns(), columnNames.Length, solutionFile.getNumberMatchedRows(), rowNames.Length);
+            return solutionFile;
+        }
+#endif
+
+        ///<summary>
+        /// Saves the changes from the problem of the given previous solver to the problem of this solver as a binary patch file.
+        /// The variables and constraints are matched by name. The patch can be applied by ApplyPatch to a solver with the previous problem,
+        /// for example in another process, which is much faster than exporting and importing the whole problem.
+        /// Quadratic objectives are not supported.
+        ///</summary>
+        /// <param name="previous">The solver with the previous problem.</param>
+        /// <param name="fileName">The patch file.</param>
+        public void ExportPatch(Solver previous, string fileName)
+        {
+#if (SONNET_NATIVE)
+            throw new NotSupportedException("Patches require the ProblemPatch of SonnetWrapper.");
+#else
+            Ensure.NotNull(previous, "previous");
+            Ensure.NotNull(fileName, "fileName");
+
+            previous.Generate();
+            Generate();
+
+            Ensure.Supported(!objective.IsQuadratic && !previous.objective.IsQuadratic, "Patches are not supported for quadratic objectives.");
+
+            ProblemPatch patch = new ProblemPatch();
+            patch.compute(previous.solver, solver,
+                previous.variables.Select(v => v.Name).ToArray(), previous.constraints.Select(c => c.Name).ToArray(),
+                variables.Select(v => v.Name).ToArray(), constraints.Select(c => c.Name).ToArray());
+            patch.save(fileName);
+
+            log.InfoFormat("Exported patch {0}: removed {1} variables and {2} constraints, added {3} variables and {4} constraints, changed {5} variables, {6} constraints and {7} coefficients",
+                fileName, patch.getRemovedColumns().Length, patch.getRemovedRows().Length, patch.getNumberAddedColumns(), patch.getNumberAddedRows(),
+                patch.getNumberChangedColumns(), patch.getNumberChangedRows(), patch.getNumberChangedElements());
+#endif
+        }
+
+        ///<summary>
+        /// Applies the given patch file (see ExportPatch) to the problem of this solver, keeping the basis where possible.
+        /// The model is updated accordingly: removed constraints are removed from the model, new variables and constraints are created
+        /// for the added columns and rows, and the bounds and types of the changed variables, the objective, and the changed constraints
+        /// are updated. Constraints that change from or to a ranged or free row are replaced by new constraints with the same name.
+        /// The solution of the previous solve is kept for the remaining variables and constraints, but the solver must be solved
+        /// again before it has a solution of the patched problem.
+        /// This solver must be the only solver of its model, and quadratic objectives are not supported.
+        ///</summary>
+        /// <param name="fileName">The patch file.</param>
+        public void ApplyPatch(string fileName)
+        {
+#if (SONNET_NATIVE)
+            throw new NotSupportedException("Patches require the ProblemPatch of SonnetWrapper.");
+#else
+            Ensure.NotNull(fileName, "fileName");
+
+            Generate();
+
+            Ensure.Supported(!objective.IsQuadratic, "Patches are not supported for quadratic objectives.");
+            Ensure.Supported(model.NumberOfSolvers == 1, "Patches can only be applied to the only solver of a model.");
+
+            ProblemPatch patch = new ProblemPatch();
+            patch.read(fileName);
+
+            if (patch.getFromNumCols() != variables.Count || patch.getFromNumRows() != constraints.Count)
+            {
+                throw new SonnetException(string.Format("The patch {0} is of a problem with {1} variables and {2} constraints, but the solver has {3} variables and {4} constraints",
+                    fileName, patch.getFromNumCols(), patch.getFromNumRows(), variables.Count, constraints.Count));
+            }
+
+            int[] removedColumns = patch.getRemovedColumns();
+            int[] removedRows = patch.getRemovedRows();
+
+            // The entities to update, taken by offset in the problem before the patch
+            Variable[] changedVariables = patch.getChangedColumns().Select(j => variables[j]).ToArray();
+            HashSet<Constraint> changedConstraints = new HashSet<Constraint>();
+            foreach (int i in patch.getChangedRows()) changedConstraints.Add(constraints[i]);
+            foreach (int i in patch.getElementRows()) changedConstraints.Add(constraints[i]);
+            foreach (int i in patch.getAddedColumnRows()) changedConstraints.Add(constraints[i]);
+            if (removedColumns.Length > 0)
+            {
+                // The coefficients of the removed columns are not part of the patch
+                CoinPackedMatrix matrix = solver.getMatrixByCol();
+                int[] colStarts = matrix.getVectorStarts();
+                int[] colLengths = matrix.getVectorLengths();
+                int[] colIndices = matrix.getIndices();
+                foreach (int j in removedColumns)
+                {
+                    for (int e = colStarts[j]; e < colStarts[j] + colLengths[j]; e++) changedConstraints.Add(constraints[colIndices[e]]);
+                }
+            }
+
+            HashSet<Constraint> removedConstraints = new HashSet<Constraint>(removedRows.Select(i => constraints[i]));
+            changedConstraints.ExceptWith(removedConstraints);
+
+            patch.apply(solver);
+
+            // The solution of the previous solve is kept, but the solver no longer has an LP solution (see Probe etc.)
+            isLPSolution = false;
+
+            RemoveEntities(constraints, removedRows);
+            RemoveEntities(variables, removedColumns);
+            model.RemoveGenerated(removedConstraints);
+
+            double[] colLowers = solver.getColLower();
+            double[] colUppers = solver.getColUpper();
+
+            int numberAddedColumns = patch.getNumberAddedColumns();
+            for (int k = 0; k < numberAddedColumns; k++)
+            {
+                int j = variables.Count;
+                VariableType type = solver.isInteger(j) ? VariableType.Integer : VariableType.Continuous;
+                Variable var = new Variable(colLowers[j], colUppers[j], type);
+
+                string name = patch.addedColumnName(k);
+                if (!string.IsNullOrEmpty(name)) var.Name = name;
+                else var.SetDefaultName("VAR", j);
+
+                var.Register(this);
+                var.Assign(this, j);
+                variables.Add(var);
+            }
+
+            foreach (Variable var in changedVariables)
+            {
+                int j = Offset(var);
+                var.Lower = colLowers[j];
+                var.Upper = colUppers[j];
+                var.Type = solver.isInteger(j) ? VariableType.Integer : VariableType.Continuous;
+            }
+
+            if (removedColumns.Length > 0 || changedVariables.Length > 0 || numberAddedColumns > 0)
+            {
+                double[] objectiveCoefficients = solver.getObjCoefficients();
+                Expression expr = new Expression(objective.Constant);
+                for (int j = 0; j < variables.Count; j++)
+                {
+                    if (objectiveCoefficients[j] != 0.0) expr.Add(objectiveCoefficients[j], variables[j]);
+                }
+
+                objective.Reset(expr);
+                expr.Clear();
+            }
+
+            ObjectiveSense sense = (solver.getObjSense() < 0.0) ? ObjectiveSense.Maximise : ObjectiveSense.Minimise;
+            if (model.ObjectiveSense != sense) model.ObjectiveSense = sense;
+
+            int numberAddedRows = patch.getNumberAddedRows();
+            if (numberAddedRows > 0 || changedConstraints.Count > 0)
+            {
+                CoinPackedMatrix matrix = solver.getMatrixByRow();
+                int[] rowStarts = matrix.getVectorStarts();
+                int[] rowLengths = matrix.getVectorLengths();
+                int[] rowIndices = matrix.getIndices();
+                double[] rowElements = matrix.getElements();
+                char[] rowSenses = solver.getRowSense();
+                double[] rowLowers = solver.getRowLower();
+                double[] rowUppers = solver.getRowUpper();
+
+                foreach (Constraint con in changedConstraints)
+                {
+                    int i = Offset(con);
+                    Expression expr = GetRowExpression(i, rowStarts, rowLengths, rowIndices, rowElements);
+                    if (!con.Reset(expr, rowLowers[i], rowUppers[i]))
                     {
-                        solver.branchAndBound();
+                        Constraint replacement = Model.NewConstraint(con.Name, expr, rowSenses[i], rowLowers[i], rowUppers[i]);
+                        replacement.Assemble();
+
+                        con.Unregister(this);
+                        replacement.Register(this);
+                        ((ModelEntity)replacement).Assign(this, i);
+                        constraints[i] = replacement;
+                        model.ReplaceGenerated(con, replacement);
                     }
+                    expr.Clear();
+                }
+
+                for (int k = 0; k < numberAddedRows; k++)
+                {
+                    int i = constraints.Count;
+                    Expression expr = GetRowExpression(i, rowStarts, rowLengths, rowIndices, rowElements);
+
+                    string name = patch.addedRowName(k);
+                    Constraint con = Model.NewConstraint(string.IsNullOrEmpty(name) ? null : name, expr, rowSenses[i], rowLowers[i], rowUppers[i]);
+                    if (string.IsNullOrEmpty(name)) con.SetDefaultName("CON", i);
+                    expr.Clear();
+
+                    con.Assemble();
+                    con.Register(this);
+                    ((ModelEntity)con).Assign(this, i);
+                    constraints.Add(con);
+                    model.AddGenerated(con);
+                }
+            }
+
+            log.InfoFormat("Applied patch {0}: now {1} variables and {2} constraints", fileName, variables.Count, constraints.Count);
+#endif
+        }
+
+        /// <summary>
+        /// Returns a new expression of the given row of the given row-wise matrix of this solver.
+        /// </summary>
+        /// <param name="row">The offset of the row.</param>
+        /// <param name="rowStarts">The starts of the rows in the matrix.</param>
+        /// <param name="rowLengths">The lengths of the rows in the matrix.</param>
+        /// <param name="rowIndices">The column indices of the elements of the matrix.</param>
+        /// <param name="rowElements">The elements of the matrix.</param>
+        /// <returns>The new expression of the row.</returns>
+        private Expression GetRowExpression(int row, int[] rowStarts, int[] rowLengths, int[] rowIndices, double[] rowElements)
+        {
+            Expression expr = new Expression();
+            for (int e = rowStarts[row]; e < rowStarts[row] + rowLengths[row]; e++)
+            {
+                expr.Add(rowElements[e], variables[rowIndices[e]]);
+            }
+            return expr;
+        }
+
+        /// <summary>
+        /// Removes the entities at the given (increasing) offsets from the given list, and assigns the new offsets to the remaining entities.
+        /// </summary>
+        /// <typeparam name="T">The type of the entities.</typeparam>
+        /// <param name="entities">The list of generated entities of this solver, by offset.</param>
+        /// <param name="offsets">The offsets of the entities to remove, in increasing order.</param>
+        private void RemoveEntities<T>(List<T> entities, int[] offsets) where T : ModelEntity
+        {
+            if (offsets.Length == 0) return;
+
+            foreach (int offset in offsets)
+            {
+                entities[offset].Unregister(this);
+                entities[offset] = null;
+            }
+
+            entities.RemoveAll(entity => entity is null);
+
+            for (int offset = offsets[0]; offset < entities.Count; offset++)
+            {
+                T entity = entities[offset];
+                entity.Unregister(this);
+                entity.Register(this);
+                entity.Assign(this, offset);
+            }
+        }
+        #endregion;
+
+        #region Hot start and Probe methods
+        /// <summary>
+        /// Gets or sets the maximum number of iterations of each hot start solve, and thus of each probe (OsiMaxNumIterationHotStart).
+        /// </summary>
+        public int HotStartIterationLimit
+        {
+            get
+            {
+                solver.getIntParam(OsiIntParam.OsiMaxNumIterationHotStart, out int value);
+                return value;
+            }
+            set { solver.setIntParam(OsiIntParam.OsiMaxNumIterationHotStart, value); }
+        }
+
+        /// <summary>
+        /// Probe the current (optimal) LP solution with the given bound changes. See Probe(IEnumerable of probes).
+        /// </summary>
+        /// <param name="boundChanges">The bound changes of this probe.</param>
+        /// <returns>The objective-only result of the probe.</returns>
+        public ProbeResult Probe(IEnumerable<BoundChange> boundChanges)
+        {
+            return Probe(new IEnumerable<BoundChange>[] { boundChanges })[0];
+        }
+
+        /// <summary>
+        /// Probe the current (optimal) LP solution with the given sets of bound changes.
+        /// Each probe applies its bound changes to the solver only, solves from a hot start of the current solution
+        /// (limited to HotStartIterationLimit iterations), and restores the original bounds.
+        /// This is much cheaper than changing bounds and calling Resolve, since the model is not generated and 
+        /// the solution is not assigned: the values of variables and constraints, and the solution status of this solver, are not changed.
+        /// Afterwards, the original LP solution is restored at the solver, such that ranging etc. start from it.
+        /// The latest solve must have been an LP solve (or a forced relaxation) in this process with a proven optimal solution, 
+        /// and the bound changes can only refer to variables and constraints of this solver.
+        /// </summary>
+        /// <param name="probes">The sets of bound changes, one set per probe.</param>
+        /// <returns>The objective-only results, one per probe.</returns>
+        public ProbeResult[] Probe(IEnumerable<IEnumerable<BoundChange>> probes)
+        {
+            Ensure.NotNull(probes, "probes");
+            EnsureOptimalLPSolution("Probe");
+
+            List<ProbeResult> results = new List<ProbeResult>();
+
+            // the basis of the current optimal solution, to restore the solution at the solver afterwards
+            CoinWarmStart saveWarmStart = solver.getWarmStart();
+
+            solver.markHotStart();
+            try
+            {
+                foreach (IEnumerable<BoundChange> boundChanges in probes)
+                {
+                    Ensure.NotNull(boundChanges, "bound changes");
+
+                    results.Add(ProbeFromHotStart(boundChanges));
+                }
+            }
+            finally
+            {
+                solver.unmarkHotStart();
+
+                // the solver has the solution of the last probe, which can be infeasible
+                RestoreLPSolution(saveWarmStart);
+            }
+
+            log.DebugFormat("Done probing {0} probes", results.Count);
+            return results.ToArray();
+        }
+
+        /// <summary>
+        /// Apply the bound changes to the solver, solve from the (marked) hot start, and restore the original bounds.
+        /// </summary>
+        /// <param name="boundChanges">The bound changes of this probe.</param>
+        /// <returns>The objective-only result of the probe.</returns>
+        private ProbeResult ProbeFromHotStart(IEnumerable<BoundChange> boundChanges)
+        {
+            // Save the original bounds at the solver (not those of the variable or constraint) before changing them, 
+            // since these can differ, e.g., after a MIP solve without AutoResetMIPSolve.
+            List<BoundChange> restoreChanges = new List<BoundChange>();
+            try
+            {
+                unsafe
+                {
+                    foreach (BoundChange boundChange in boundChanges)
+                    {
+                        Ensure.NotNull(boundChange, "bound change");
+
+                        if (!(boundChange.Variable is null))
+                        {
+                            int offset = Offset(boundChange.Variable);
+                            restoreChanges.Add(new BoundChange(boundChange.Variable, solver.getColLowerUnsafe()[offset], solver.getColUpperUnsafe()[offset]));
+                            solver.setColBounds(offset, boundChange.Lower, boundChange.Upper);
+                        }
+                        else
+                        {
+                            int offset = Offset(boundChange.Constraint);
+                            restoreChanges.Add(new BoundChange(boundChange.Constraint, solver.getRowLowerUnsafe()[offset], solver.getRowUpperUnsafe()[offset]));
+                            solver.setRowBounds(offset, boundChange.Lower, boundChange.Upper);
+                        }
+                    }
+                }
+
+                isSolving = true;
+                solver.solveFromHotStart();
+
+                return new ProbeResult(solver.getObjValue() + objective.Constant, solver.getIterationCount(), solver.isAbandoned(),
+                    solver.isProvenOptimal(), solver.isProvenPrimalInfeasible(), solver.isIterationLimitReached());
+            }
+            finally
+            {
+                isSolving = false;
+
+                // restore in reverse order, in case the same variable or constraint was changed more than once
+                for (int i = restoreChanges.Count - 1; i >= 0; i--)
+                {
+                    BoundChange restoreChange = restoreChanges[i];
+                    if (!(restoreChange.Variable is null)) solver.setColBounds(Offset(restoreChange.Variable), restoreChange.Lower, restoreChange.Upper);
+                    else solver.setRowBounds(Offset(restoreChange.Constraint), restoreChange.Lower, restoreChange.Upper);
+                }
+            }
+        }
+        #endregion
+
+        #region Sensitivity analysis (ranging) methods
+        /// <summary>
+        /// Returns the objective coefficient ranges of all variables of this solver, for which the current basis remains optimal.
+        /// Only supported for LP solved to optimality by OsiClp (or OsiCbc with OsiClp as real solver).
+        /// </summary>
+        /// <returns>The objective coefficient range per variable.</returns>
+        public Dictionary<Variable, SensitivityRange> GetObjectiveRanges()
+        {
+            Generate();
+
+            SensitivityRange[] ranges = GetObjectiveRanges(variables);
+            Dictionary<Variable, SensitivityRange> result = new Dictionary<Variable, SensitivityRange>(ranges.Length);
+            for (int i = 0; i < ranges.Length; i++) result.Add(variables[i], ranges[i]);
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the objective coefficient ranges of the given variables, for which the current basis remains optimal.
+        /// All ranges are computed natively in one call.
+        /// Only supported for LP solved to optimality by OsiClp (or OsiCbc with OsiClp as real solver).
+        /// </summary>
+        /// <param name="vars">The variables to get the objective coefficient ranges of.</param>
+        /// <returns>The objective coefficient ranges, in the same order as the given variables.</returns>
+        public SensitivityRange[] GetObjectiveRanges(IList<Variable> vars)
+        {
+            Ensure.NotNull(vars, "variables");
+
+            ClpSimplex clpModel = GetClpSimplexForAnalysis("Ranging");
+
+            int n = vars.Count;
+            int[] which = new int[n];
+            for (int i = 0; i < n; i++) which[i] = Offset(vars[i]);
+
+            double[] costIncrease = new double[n];
+            int[] sequenceIncrease = new int[n];
+            double[] costDecrease = new double[n];
+            int[] sequenceDecrease = new int[n];
+            int status = clpModel.dualRanging(n, which, costIncrease, sequenceIncrease, costDecrease, sequenceDecrease);
+            if (status != 0) throw new SonnetException(string.Format("Dual ranging failed with status {0}", status));
+
+            SensitivityRange[] ranges = new SensitivityRange[n];
+            unsafe
+            {
+                double* objCoefficients = solver.getObjCoefficientsUnsafe();
+                for (int i = 0; i < n; i++)
+                {
+                    ranges[i] = new SensitivityRange(objCoefficients[which[i]], costDecrease[i], costIncrease[i]);
+                }
+            }
+
+            return ranges;
+        }
+
+        /// <summary>
+        /// Returns the right-hand side ranges of all constraints of this solver, for which the current basis remains optimal.
+        /// Only supported for LP solved to optimality by OsiClp (or OsiCbc with OsiClp as real solver).
+        /// </summary>
+        /// <returns>The right-hand side range per constraint.</returns>
+        public Dictionary<Constraint, SensitivityRange> GetRhsRanges()
+        {
+            Generate();
+
+            SensitivityRange[] ranges = GetRhsRanges(constraints);
+            Dictionary<Constraint, SensitivityRange> result = new Dictionary<Constraint, SensitivityRange>(ranges.Length);
+            for (int i = 0; i < ranges.Length; i++) result.Add(constraints[i], ranges[i]);
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the right-hand side ranges of the given constraints, for which the current basis remains optimal.
+        /// The range is around the current activity of the constraint, which for binding constraints equals the right-hand side.
+        /// The ranges are only meaningful for binding constraints.
+        /// All ranges are computed natively in one call.
+        /// Only supported for LP solved to optimality by OsiClp (or OsiCbc with OsiClp as real solver).
+        /// </summary>
+        /// <param name="cons">The constraints to get the right-hand side ranges of.</param>
+        /// <returns>The right-hand side ranges, in the same order as the given constraints.</returns>
+        public SensitivityRange[] GetRhsRanges(IList<Constraint> cons)
+        {
+            Ensure.NotNull(cons, "constraints");
 
+            ClpSimplex clpModel = GetClpSimplexForAnalysis("Ranging");
 
-                    AssignSolution(true);
-                    if (AutoResetMIPSolve)
-                    {
-                        SonnetLog.Default.Info("Resetting automatically after MIPSolve. Use solver.AutoResetMIPSolver = false if you don't want this.");
-                        ResetAfterMIPSolveInternal(); // mainly to reset bounds etc, but use AssignSolutionStatus because the Reset messes up the IsProvenOptimal etc!
-                    }
-                }
-                else
+            // the sequence numbers of the slacks (rows) start at the number of columns
+            int numberColumns = solver.getNumCols();
+            int m = cons.Count;
+            int[] which = new int[m];
+            for (int i = 0; i < m; i++) which[i] = numberColumns + Offset(cons[i]);
+
+            double[] valueIncrease = new double[m];
+            int[] sequenceIncrease = new int[m];
+            double[] valueDecrease = new double[m];
+            int[] sequenceDecrease = new int[m];
+            int status = clpModel.primalRanging(m, which, valueIncrease, sequenceIncrease, valueDecrease, sequenceDecrease);
+            if (status != 0) throw new SonnetException(string.Format("Primal ranging failed with status {0}", status));
+
+            SensitivityRange[] ranges = new SensitivityRange[m];
+            unsafe
+            {
+                double* rowActivity = solver.getRowActivityUnsafe();
+                for (int i = 0; i < m; i++)
                 {
-                    isSolving = true;
-                    if (doResolve) solver.resolve();
-                    else solver.initialSolve();
-                    AssignSolution(false);
+                    ranges[i] = new SensitivityRange(rowActivity[which[i] - numberColumns], valueDecrease[i], valueIncrease[i]);
                 }
             }
-            catch (Exception e)
-            {
-                log.Error(e.ToString());
-                throw;
-            }
-            finally
-            {
-                isSolving = false;
-            }
-
-            log.InfoFormat(" IsAbandoned: {0}", IsAbandoned);
-            log.InfoFormat(" IsProvenOptimal: {0}", IsProvenOptimal);
-            log.InfoFormat(" IsProvenDualInfeasible: {0}", IsProvenDualInfeasible);
-            log.InfoFormat(" IsProvenPrimalInfeasible: {0}", IsProvenPrimalInfeasible);
-            log.InfoFormat(" IsPrimalObjectiveLimitReached: {0}", IsPrimalObjectiveLimitReached);
-            log.InfoFormat(" IsDualObjectiveLimitReached: {0}", IsDualObjectiveLimitReached);
 
-            log.InfoFormat("Done resolving after {0}", (CoinUtils.CoinCpuTime() - genStart));
+            return ranges;
         }
 
-        #endregion
+        /// <summary>
+        /// Throws unless the latest solve was an LP solve (or a forced relaxation) in this process, with a proven optimal solution, 
+        /// as required by the analyses that start from the solution and basis at the solver.
+        /// </summary>
+        /// <param name="analysis">The name of the analysis, used in messages.</param>
+        private void EnsureOptimalLPSolution(string analysis)
+        {
+            if (!IsGenerated || !isLPSolution) throw new SonnetException($"Cannot do {analysis} for a model without an LP solution: solve the model (or its relaxation) in this process first.");
+            if (!IsProvenOptimal) throw new SonnetException($"Cannot do {analysis} for a model without an optimal solution.");
+        }
 
         /// <summary>
-        /// Determine whether the current solution satisfies all constraints and variables bounds and types.
+        /// Returns the ClpSimplex model of the current solver for the given analysis (ranging, parametrics), after checking that it is supported.
         /// </summary>
-        /// <returns>True iff the current solution is feasible.</returns>
-        public bool IsFeasible()
+        /// <param name="analysis">The name of the analysis, used in messages.</param>
+        /// <returns>The ClpSimplex model of the current solver.</returns>
+        private ClpSimplex GetClpSimplexForAnalysis(string analysis)
         {
-            Generate();
+            Ensure.Supported(!objective.IsQuadratic, $"{analysis} is not supported for quadratic objectives.");
+            EnsureOptimalLPSolution(analysis);
 
-            bool feasible = true;
+            ClpSimplex clpSimplex = GetClpSimplex();
+            if (clpSimplex == null) Ensure.NotSupported($"{analysis} is not supported for solver type {OsiSolverFullName}");
+            return clpSimplex;
+        }
 
-            log.Debug("IsFeasible: Determine whether the current solution satisfies all constraints and variables bounds and types.");
-            log.Debug(string.Concat("Claimed Solution status: ", ((IsProvenOptimal) ? ("Optimal") : "not Optimal")));
+        /// <summary>
+        /// Returns the ClpSimplex model of the current solver: of Clp itself, or of Clp as the LP solver of Cbc. 
+        /// </summary>
+        /// <returns>The ClpSimplex model of the current solver, or null if the solver does not use Clp.</returns>
+        private ClpSimplex GetClpSimplex()
+        {
+            if (solver is OsiClpSolverInterface osiClp)
+            {
+                return osiClp.getModelPtr();
+            }
 
-            log.Debug("Infeasible variables:");
-            bool hasInfeasibleVariables = false;
-            int m = variables.Count;
-            for (int j = 0; j < m; j++)
+            if (solver is OsiCbcSolverInterface osiCbc)
             {
-                Variable aVar = variables[j];
-                if (!aVar.IsFeasible())
+                if (osiCbc.getRealSolverPtr() is OsiClpSolverInterface osiClpReal)
                 {
-                    log.Debug(aVar.ToLevelString());
-                    feasible = false;
-                    hasInfeasibleVariables = true;
+                    return osiClpReal.getModelPtr();
                 }
             }
 
-            if (!hasInfeasibleVariables)
+            return null;
+        }
+        #endregion
+
+        #region Parametric methods
+        /// <summary>
+        /// Solve the LP parametrically in theta, from startingTheta to endingTheta, in one pass.
+        /// The right-hand sides (both lower and upper bounds of the rows at the solver) of the given constraints become rhs + theta * change,
+        /// and the objective coefficients of the given variables become coef + theta * change.
+        /// Returns the breakpoints, where the optimal basis changes, with their objective values and basis changes.
+        /// The current (optimal) solution is used as the start for startingTheta.
+        /// Afterwards, the original right-hand sides and objective coefficients are restored at the solver, and the original solution
+        /// is restored by resolving from the saved optimal basis. The values of the variables and constraints are not changed.
+        /// Only supported for LP solved to optimality by OsiClp (or OsiCbc with OsiClp as real solver).
+        /// </summary>
+        /// <param name="startingTheta">The starting value of theta.</param>
+        /// <param name="endingTheta">The ending value of theta.</param>
+        /// <param name="rhsChanges">The change per unit theta of the right-hand side of constraints, or null.</param>
+        /// <param name="objectiveChanges">The change per unit theta of the objective coefficient of variables, or null.</param>
+        /// <param name="reportIncrement">If 0.0, report every breakpoint. Otherwise, report at startingTheta + k * reportIncrement.</param>
+        /// <returns>The breakpoints and the maximum theta reached.</returns>
+        public ParametricResult Parametrics(double startingTheta, double endingTheta, 
+            IDictionary<Constraint, double> rhsChanges, IDictionary<Variable, double> objectiveChanges = null, double reportIncrement = 0.0)
+        {
+            Ensure.IsTrue(startingTheta <= endingTheta, "The starting theta cannot be higher than the ending theta.");
+            Ensure.IsTrue(reportIncrement >= 0.0, "The report increment cannot be negative.");
+            Ensure.IsTrue(rhsChanges != null || objectiveChanges != null, "Parametrics requires rhs changes or objective changes.");
+#if (SONNET_NATIVE)
+            throw new NotSupportedException("Parametrics requires the ClpSimplex of SonnetWrapper.");
+#else
+
+            ClpSimplex clpModel = GetClpSimplexForAnalysis("Parametrics");
+
+            double[] changeLowerRhs = null;
+            double[] changeUpperRhs = null;
+            double[] changeObjective = null;
+            double[] saveRowLower = null;
+            double[] saveRowUpper = null;
+            double[] saveObjective = null;
+
+            if (rhsChanges != null && rhsChanges.Count > 0)
+            {
+                int m = solver.getNumRows();
+                changeLowerRhs = new double[m];
+                changeUpperRhs = new double[m];
+                foreach (KeyValuePair<Constraint, double> rhsChange in rhsChanges)
+                {
+                    int offset = Offset(rhsChange.Key);
+                    changeLowerRhs[offset] = rhsChange.Value;
+                    changeUpperRhs[offset] = rhsChange.Value;
+                }
+
+                saveRowLower = solver.getRowLower();
+                saveRowUpper = solver.getRowUpper();
+            }
+
+            if (objectiveChanges != null && objectiveChanges.Count > 0)
             {
-                log.Debug("No infeasible variables.");
+                changeObjective = new double[solver.getNumCols()];
+                foreach (KeyValuePair<Variable, double> objectiveChange in objectiveChanges)
+                {
+                    changeObjective[Offset(objectiveChange.Key)] = objectiveChange.Value;
+                }
+
+                saveObjective = solver.getObjCoefficients();
             }
 
-            log.Debug("Infeasible constraints:");
-            bool hasInfeasibleConstraints = false;
-            int n = constraints.Count;
-            for (int i = 0; i < n; i++)
+            double genStart = CoinUtils.CoinCpuTime();
+
+            // the basis of the current optimal solution, to restore the solution at the solver afterwards
+            CoinWarmStart saveWarmStart = solver.getWarmStart();
+
+            int status;
+            double reachedTheta = endingTheta;
+            double[] thetas;
+            double[] objectiveValues;
+            string[] enteringNames;
+            string[] leavingNames;
+            try
             {
-                Constraint aCon = constraints[i];
-                if (aCon.Enabled)
-                {   // only check Enabled constraints, not disabled ones
-                    if (!aCon.IsFeasible())
+                isSolving = true;
+                status = clpModel.parametrics(startingTheta, ref reachedTheta, reportIncrement,
+                    null, null, changeLowerRhs, changeUpperRhs, changeObjective,
+                    out thetas, out objectiveValues, out enteringNames, out leavingNames);
+            }
+            finally
+            {
+                isSolving = false;
+
+                // restore only the changed rows and objective
+                if (rhsChanges != null)
+                {
+                    foreach (Constraint con in rhsChanges.Keys)
                     {
-                        log.Debug(aCon.ToLevelString());
-                        feasible = false;
-                        hasInfeasibleConstraints = true;
+                        int offset = Offset(con);
+                        solver.setRowBounds(offset, saveRowLower[offset], saveRowUpper[offset]);
                     }
                 }
-            }
 
-            if (!hasInfeasibleConstraints)
-            {
-                log.Debug("No infeasible constraints.");
+                if (saveObjective != null) solver.setObjective(saveObjective);
+
+                RestoreLPSolution(saveWarmStart);
             }
 
-            log.Debug("End IsFeasible");
-            
-            return feasible;
-        }
+            if (status < 0) throw new SonnetException(string.Format("Parametrics failed with status {0}", status));
 
-        #region Get / Set WarmStart methods
-        ///<summary>
-        /// Gets the warm start object for the current problem
-        ///</summary>
-        public WarmStart GetWarmStart()
-        {
-            Generate();
-            return WarmStart.NewWarmStart(solver);
-        }
+            List<ParametricBreakpoint> breakpoints = new List<ParametricBreakpoint>(thetas.Length);
+            for (int i = 0; i < thetas.Length; i++)
+            {
+                breakpoints.Add(new ParametricBreakpoint(thetas[i], objectiveValues[i] + objective.Constant, enteringNames[i], leavingNames[i]));
+            }
 
-        ///<summary>
-        /// Gets an empty warm start object for the current problem
-        ///</summary>
-        public WarmStart GetEmptyWarmStart()
-        {
-            Generate();
-            return WarmStart.NewEmptyWarmStart(solver);
+            log.InfoFormat("Done parametrics with {0} breakpoints up to theta {1} after {2}", breakpoints.Count, reachedTheta, (CoinUtils.CoinCpuTime() - genStart));
+            return new ParametricResult(breakpoints, reachedTheta, status);
+#endif
         }
 
-        ///<summary>
-        /// Set (apply) the given warm start object to the current problem
-        ///</summary>
-        public void SetWarmStart(WarmStart warmStart)
+        /// <summary>
+        /// Restore the LP solution at the solver, after an analysis that changed the problem temporarily, 
+        /// by resolving the original problem from the given (optimal) basis, which should take no iterations.
+        /// If the solution is not optimal after all, then the solver no longer has an LP solution for further analyses.
+        /// The solution status and the values of the variables and constraints are not changed.
+        /// </summary>
+        /// <param name="warmStart">The basis of the original LP solution.</param>
+        private void RestoreLPSolution(CoinWarmStart warmStart)
         {
-            Ensure.NotNull(warmStart, "WarmStart");
+            solver.setWarmStart(warmStart);
+            solver.resolve();
 
-            Generate();
-            warmStart.ApplyWarmStart(solver);
+            if (!solver.isProvenOptimal())
+            {
+                log.WarnFormat("Restoring the original solution took {0} iterations, but the solution is not optimal", solver.getIterationCount());
+                isLPSolution = false;
+            }
         }
-        #endregion;
+        #endregion
 
         #region Reset / Save for MIP Solver methods
         /// <summary>
@@ -1245,11 +2133,14 @@ namespace Sonnet
                 }
             }
 
-            StringBuilder tmp = new StringBuilder();
-            tmp.AppendLine("Number of variables  : " + this.variables.Count);
-            tmp.AppendLine("Number of constraints: " + this.constraints.Count);
-            tmp.AppendLine("Number of elements   : " + solver.getNumElements());
-            log.Debug(tmp.ToString()); // dont use ToStatisticsString() because that calls Generate..
+            if (log.IsDebugEnabled)
+            {
+                StringBuilder tmp = new StringBuilder();
+                tmp.AppendLine("Number of variables  : " + this.variables.Count);
+                tmp.AppendLine("Number of constraints: " + this.constraints.Count);
+                tmp.AppendLine("Number of elements   : " + solver.getNumElements());
+                log.Debug(tmp.ToString()); // dont use ToStatisticsString() because that calls Generate..
+            }
 
             //static_cast<ModelEntity *>(objective).Unassign();
 
@@ -1275,15 +2166,18 @@ namespace Sonnet
             }
 
             // Dump Hint Settings
-            StringBuilder hintsMessage = new StringBuilder();
-            foreach (OsiHintParam hintParam in Enum.GetValues(typeof(OsiHintParam)))
+            if (log.IsDebugEnabled)
             {
-                if (hintParam == OsiHintParam.OsiLastHintParam) continue;
+                StringBuilder hintsMessage = new StringBuilder();
+                foreach (OsiHintParam hintParam in Enum.GetValues(typeof(OsiHintParam)))
+                {
+                    if (hintParam == OsiHintParam.OsiLastHintParam) continue;
 
-                solver.getHintParam(hintParam, out bool yesNo, out OsiHintStrength hintStrength);
-                hintsMessage.AppendFormat("Hint: {0} : {1} at {2}\n", hintParam, yesNo, hintStrength);
+                    solver.getHintParam(hintParam, out bool yesNo, out OsiHintStrength hintStrength);
+                    hintsMessage.AppendFormat("Hint: {0} : {1} at {2}\n", hintParam, yesNo, hintStrength);
+                }
+                if (hintsMessage.Length > 0) log.Debug(hintsMessage.ToString());
             }
-            if (hintsMessage.Length > 0) log.Debug(hintsMessage.ToString());
 
             System.GC.Collect();
             IsGenerated = true;
@@ -1301,6 +2195,7 @@ namespace Sonnet
             if (IsGenerated)
             {
                 IsGenerated = false;
+                isLPSolution = false;
 
                 if (objective is null) throw new NullReferenceException("Ungenerate: A generated model must have a valid objective function");
                 objective.Unregister(this);
@@ -1326,7 +2221,10 @@ namespace Sonnet
         #endregion
 
         /// <summary>
-        /// Exports the model in either MPS, LP or SONNET format, depending on the extension of the given filename
+        /// Exports the model in either MPS, LP, SONNET or binary SNAPSHOT format, depending on the extension of the given filename
+        /// MPS and LP files are written by the multithreaded COIN.ModelWriter, and gzip-compressed if the filename ends with .gz, like model.mps.gz.
+        /// A .snapshot file contains the generated problem and basis, and loads much faster than an mps file,
+        /// either via Model.New or directly into an OsiSolverInterface via COIN.ProblemSnapshot.load.
         /// Note, after solving a model, the Bounds etc could be left at non-original values!
         /// If you want to export the original bounds etc, then call Generate() before Exporting.
         /// </summary>
@@ -1340,12 +2238,15 @@ namespace Sonnet
             if (directoryName.Length == 0) directoryName = ".";
 
             string fullPathWithoutExtension = string.Concat(directoryName, System.IO.Path.DirectorySeparatorChar, System.IO.Path.GetFileNameWithoutExtension(filename));
-            string extension = System.IO.Path.GetExtension(filename);
+            string extension = System.IO.Path.GetExtension(CompressedFile.TrimExtension(filename));
+            bool compressed = !filename.Equals(CompressedFile.TrimExtension(filename));
 
             if (extension.Equals(".mps"))
             {
                 if (objective.IsQuadratic) // Osi doesnt handle Quadratic obj, so custom export.
                 {
+                    Ensure.IsFalse(compressed, string.Format("Cannot export model with quadratic objective to compressed file {0}", filename));
+
                     bool success = false;
                     if (solver is OsiClpSolverInterface osiClp)
                     {
@@ -1363,11 +2264,33 @@ namespace Sonnet
                     }
                     if (!success) solver.writeMps(fullPathWithoutExtension);
                 }
-                else solver.writeMps(fullPathWithoutExtension);                
+#if (SONNET_NATIVE)
+                else
+                {
+                    Ensure.IsFalse(compressed, string.Format("Cannot export to compressed file {0} without the ModelWriter of SonnetWrapper", filename));
+                    solver.writeMps(fullPathWithoutExtension);
+                }
+#else
+                else new ModelWriter().writeMps(solver, filename);
+#endif
             }
             else if (extension.Equals(".lp"))
             {
+#if (SONNET_NATIVE)
+                Ensure.IsFalse(compressed, string.Format("Cannot export to compressed file {0} without the ModelWriter of SonnetWrapper", filename));
                 solver.writeLp(fullPathWithoutExtension);
+#else
+                new ModelWriter().writeLp(solver, filename);
+#endif
+            }
+            else if (extension.Equals(".snapshot"))
+            {
+#if (SONNET_NATIVE)
+                throw new NotSupportedException("Snapshots require the ProblemSnapshot of SonnetWrapper.");
+#else
+                // Binary snapshot of the generated problem, including the current basis, see ProblemSnapshot
+                ProblemSnapshot.save(solver, filename, true);
+#endif
             }
             else if (extension.Equals(".sonnet"))
             {
@@ -1450,6 +2373,50 @@ namespace Sonnet
 
             return tmp.ToString();
         }
+
+        /// <summary>
+        /// Returns a report of the transitions between managed and native code by SonnetWrapper method, merged over all threads: 
+        /// the number of calls, the bytes marshalled, and the time spent, ordered by time.
+        /// The transitions are only counted if SonnetWrapper is built with SONNET_TRANSITION_COUNTERS defined, see COIN.TransitionCounters.
+        /// </summary>
+        /// <returns>String representation of the transition counters.</returns>
+        public static string ToTransitionReportString()
+        {
+            StringBuilder tmp = new StringBuilder();
+            tmp.AppendLine("Transitions");
+#if (SONNET_NATIVE)
+            tmp.AppendLine(" Not counted: the transitions are only counted by SonnetWrapper.");
+            return tmp.ToString();
+#else
+            if (!TransitionCounters.IsEnabled)
+            {
+                tmp.AppendLine(" Not counted: build SonnetWrapper with SONNET_TRANSITION_COUNTERS defined.");
+                return tmp.ToString();
+            }
+
+            TransitionCounter[] counters = TransitionCounters.getCounters();
+            Array.Sort(counters, (a, b) => b.Seconds.CompareTo(a.Seconds));
+
+            tmp.AppendLine(string.Format(" {0,-60} {1,12} {2,14} {3,12} {4,12}", "Method", "Calls", "Bytes", "Seconds", "us/call"));
+            foreach (TransitionCounter counter in counters)
+            {
+                double microsecondsPerCall = (counter.Calls > 0) ? 1e6 * counter.Seconds / counter.Calls : 0.0;
+                tmp.AppendLine(string.Format(" {0,-60} {1,12} {2,14} {3,12:F6} {4,12:F3}", counter.Name, counter.Calls, counter.Bytes, counter.Seconds, microsecondsPerCall));
+            }
+
+            return tmp.ToString();
+#endif
+        }
+
+        /// <summary>
+        /// Sets all counters of the transitions between managed and native code to zero. See ToTransitionReportString.
+        /// </summary>
+        public static void ResetTransitionCounters()
+        {
+#if (!SONNET_NATIVE)
+            TransitionCounters.reset();
+#endif
+        }
         #endregion
 
         #region IsRegistered/Contains, for Tests
@@ -1744,15 +2711,52 @@ namespace Sonnet
         /// Get and store the solution status (optimal, etc), and the solution values for the variables and constraints from the solver.
         /// These values are subsequently stored at the variables and constraints for later retrieval via variable.Value etc.
         /// Some values, like row prices, are not available for MIP.
+        /// Internal to be measured separately by SonnetBenchmark.
         /// </summary>
         /// <param name="mipSolve">Latest solve was mip solve</param>
-        private void AssignSolution(bool mipSolve)
+        internal void AssignSolution(bool mipSolve)
         {
+            solutionVersion = System.Threading.Interlocked.Increment(ref numberOfSolutions);
+
             AssignSolutionStatus(mipSolve);
             AssignVariableSolution(mipSolve);
             AssignConstraintSolution(mipSolve);
         }
 
+        /// <summary>
+        /// Store the solution status and the solution values of a solve in a worker process.
+        /// The result replaces the current solution snapshot, just like a local solve.
+        /// </summary>
+        /// <param name="result">The result of the solve in the worker process.</param>
+        /// <param name="mipSolve">Latest solve was mip solve</param>
+        private void AssignSolution(SolverWorkerResult result, bool mipSolve)
+        {
+            solutionVersion = System.Threading.Interlocked.Increment(ref numberOfSolutions);
+
+            isAbandoned = result.IsAbandoned;
+            isProvenOptimal = result.IsProvenOptimal;
+            isProvenPrimalInfeasible = result.IsProvenPrimalInfeasible;
+            isProvenDualInfeasible = result.IsProvenDualInfeasible;
+            isPrimalObjectiveLimitReached = result.IsPrimalObjectiveLimitReached;
+            isDualObjectiveLimitReached = result.IsDualObjectiveLimitReached;
+            isIterationLimitReached = result.IsIterationLimitReached;
+            iterationCount = mipSolve ? 0 : result.IterationCount;
+
+            if (result.ColSolution.Length != variables.Count || result.RowActivity.Length != constraints.Count)
+            {
+                throw new SonnetException(string.Format("The solution of the worker process has {0} variables and {1} constraints, but the solver has {2} variables and {3} constraints",
+                    result.ColSolution.Length, result.RowActivity.Length, variables.Count, constraints.Count));
+            }
+
+            colSolution = result.ColSolution;
+            reducedCosts = mipSolve ? null : result.ReducedCost;
+            rowActivity = result.RowActivity;
+            rowPrices = mipSolve ? null : result.RowPrice;
+
+            AssignVariableSnapshot(mipSolve, result.ObjectiveValue, result.Bound);
+            AssignConstraintSnapshot(mipSolve);
+        }
+
         /// <summary>
         /// Get and store the solution status values (isProvenOptimal etc)
         /// Iteration Count is not available for MIP.
@@ -1792,28 +2796,84 @@ namespace Sonnet
                 throw new SonnetException(string.Format("Number of variables in the solution is {0} which is somehow not equal to the number of registered variables {1}", n_variables, n_solver));
             }
 
+            colSolution = null;
+            reducedCosts = null;
             unsafe
             {
                 double* values = solver.getColSolutionUnsafe();
-                double* reducedCost = null;
-                if (!mipSolve) reducedCost = solver.getReducedCostUnsafe();
+                double* costs = mipSolve ? null : solver.getReducedCostUnsafe();
 
-                for (int col = 0; col < variables.Count; col++)
+                if (LazySolutionAssignment)
                 {
-                    Variable var = variables[col];
-
-                    var.Assign(this, col, values[col], mipSolve?0.0:reducedCost[col]);
-                    if (IsProvenOptimal)
+                    // Take the snapshot of the solution, from which the variables can read their values on demand
+                    colSolution = new double[n_variables];
+                    Marshal.Copy(new IntPtr(values), colSolution, 0, n_variables);
+                    if (!mipSolve)
                     {
-                        if (!var.IsFeasible())
-                        {
-                            log.DebugFormat("Solution is optimal, but variable value {0} is outside of bounds [{1},{2}] ", var, var.Lower, var.Upper);
-                        }
+                        reducedCosts = new double[n_variables];
+                        Marshal.Copy(new IntPtr(costs), reducedCosts, 0, n_variables);
+                    }
+                }
+                else
+                {
+                    // Assign the values directly from the solver, without a snapshot
+                    for (int col = 0; col < n_variables; col++)
+                    {
+                        AssignVariable(col, values[col], mipSolve ? 0.0 : costs[col]);
                     }
                 }
             } // unsafe
-            
-            objective.Assign(this, solver.getObjValue() + objective.Constant, IsMIP?(solver.Bound() + objective.Constant): double.NaN);
+
+            AssignObjective(solver.getObjValue(), IsMIP ? solver.Bound() : double.NaN);
+        }
+
+        /// <summary>
+        /// Store the values of the current solution snapshot to the variables (unless lazy) and the objective.
+        /// </summary>
+        /// <param name="mipSolve">Latest solve was mip solve</param>
+        /// <param name="objValue">The objective value at the solver, without the constant term.</param>
+        /// <param name="bound">The best bound at the solver, without the constant term, or NaN if not MIP.</param>
+        private void AssignVariableSnapshot(bool mipSolve, double objValue, double bound)
+        {
+            if (!LazySolutionAssignment)
+            {
+                for (int col = 0; col < variables.Count; col++)
+                {
+                    AssignVariable(col, colSolution[col], mipSolve ? 0.0 : reducedCosts[col]);
+                }
+            }
+
+            AssignObjective(objValue, bound);
+        }
+
+        /// <summary>
+        /// Store the given value and reduced cost to the variable at the given offset.
+        /// </summary>
+        /// <param name="col">The offset of the variable.</param>
+        /// <param name="value">The value of the variable.</param>
+        /// <param name="reducedCost">The reduced cost of the variable.</param>
+        private void AssignVariable(int col, double value, double reducedCost)
+        {
+            Variable var = variables[col];
+
+            var.Assign(this, col, value, reducedCost);
+            if (IsProvenOptimal)
+            {
+                if (!var.IsFeasible())
+                {
+                    log.DebugFormat("Solution is optimal, but variable value {0} is outside of bounds [{1},{2}] ", var, var.Lower, var.Upper);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Store the objective value and bound of the current solution to the objective.
+        /// </summary>
+        /// <param name="objValue">The objective value at the solver, without the constant term.</param>
+        /// <param name="bound">The best bound at the solver, without the constant term, or NaN if not MIP.</param>
+        private void AssignObjective(double objValue, double bound)
+        {
+            objective.Assign(this, objValue + objective.Constant, IsMIP?(bound + objective.Constant): double.NaN);
 
             if (IsProvenOptimal)
             {
@@ -1845,19 +2905,82 @@ namespace Sonnet
                 throw new SonnetException(string.Format("Number of constraints in the solution {0} is not equal to the number of registered constraints {1}", m_constraints, m_solver));
             }
 
+            rowActivity = null;
+            rowPrices = null;
             unsafe
             {
                 double* values = solver.getRowActivityUnsafe();
-                double* prices = null;
-                if (!mipSolve) prices = solver.getRowPriceUnsafe();
+                double* prices = mipSolve ? null : solver.getRowPriceUnsafe();
+
+                if (LazySolutionAssignment)
+                {
+                    // Take the snapshot of the solution, from which the constraints can read their values on demand
+                    rowActivity = new double[m_constraints];
+                    Marshal.Copy(new IntPtr(values), rowActivity, 0, m_constraints);
+                    if (!mipSolve)
+                    {
+                        rowPrices = new double[m_constraints];
+                        Marshal.Copy(new IntPtr(prices), rowPrices, 0, m_constraints);
+                    }
+                }
+                else
+                {
+                    // Assign the values directly from the solver, without a snapshot
+                    for (int row = 0; row < m_constraints; row++)
+                    {
+                        constraints[row].Assign(this, row, mipSolve ? 0.0 : prices[row], values[row]);
+                    }
+                }
+            }
+        }
 
+        /// <summary>
+        /// Store the values of the current solution snapshot to the constraints (unless lazy).
+        /// </summary>
+        /// <param name="mipSolve">Latest solve was mip solve</param>
+        private void AssignConstraintSnapshot(bool mipSolve)
+        {
+            if (!LazySolutionAssignment)
+            {
                 for (int row = 0; row < constraints.Count; row++)
                 {
                     Constraint con = constraints[row];
-                    con.Assign(this, row, mipSolve?0.0:prices[row], values[row]);
+                    con.Assign(this, row, mipSolve?0.0:rowPrices[row], rowActivity[row]);
                 }
             }
         }
+
+        /// <summary>
+        /// Gets the version of the current solution snapshot of this solver. 
+        /// Versions are unique across solvers, and 0 means there is no solution (yet).
+        /// </summary>
+        internal int SolutionVersion { get { return solutionVersion; } }
+
+        /// <summary>
+        /// Gets the value and reduced cost of the variable at the given offset from the current solution snapshot.
+        /// Variables that were added after the latest solve get zero.
+        /// </summary>
+        /// <param name="offset">The offset of the variable.</param>
+        /// <param name="value">The value of the variable in the current solution.</param>
+        /// <param name="reducedCost">The reduced cost of the variable in the current solution.</param>
+        internal void GetVariableSolution(int offset, out double value, out double reducedCost)
+        {
+            value = (colSolution != null && offset >= 0 && offset < colSolution.Length) ? colSolution[offset] : 0.0;
+            reducedCost = (reducedCosts != null && offset >= 0 && offset < reducedCosts.Length) ? reducedCosts[offset] : 0.0;
+        }
+
+        /// <summary>
+        /// Gets the price and value (activity) of the constraint at the given offset from the current solution snapshot.
+        /// Constraints that were added after the latest solve get zero.
+        /// </summary>
+        /// <param name="offset">The offset of the constraint.</param>
+        /// <param name="price">The price of the constraint in the current solution.</param>
+        /// <param name="value">The value of the constraint in the current solution.</param>
+        internal void GetConstraintSolution(int offset, out double price, out double value)
+        {
+            price = (rowPrices != null && offset >= 0 && offset < rowPrices.Length) ? rowPrices[offset] : 0.0;
+            value = (rowActivity != null && offset >= 0 && offset < rowActivity.Length) ? rowActivity[offset] : 0.0;
+        }
         #endregion //Assign Solution methods
         /// <summary>
         /// Is the solver busy Solving?
@@ -2068,8 +3191,8 @@ namespace Sonnet
             Ensure.NotNull(model, "model");
             Ensure.NotNull(solver, "solver");
             
-            id = numberOfSolvers++;
-            log.Info(InternalUtils.GetAssemblyInfo());
+            id = System.Threading.Interlocked.Increment(ref numberOfSolvers) - 1;
+            if (log.IsInfoEnabled) log.Info(InternalUtils.GetAssemblyInfo());
 
             this.model = model;
             this.solver = solver;
@@ -2094,12 +3217,19 @@ namespace Sonnet
         }
 
         private static int numberOfSolvers = 0;
+        private static int numberOfSolutions = 0;
 
         private Objective objective;
         private List<Variable> variables;
         private List<Constraint> constraints;
         private List<Constraint> rawconstraints;
         private bool autoResetMIPSolve = true;
+        private bool lazySolutionAssignment = false;
+        private SolverWorkerPool workerPool = null;
+        private int progressInterval = 0;
+#if (!SONNET_NATIVE)
+        private ClpProgressSampler progressSampler = null;
+#endif
         private double saveOsiDualObjectiveLimit;
         private double[] saveColLower;
         private double[] saveColUpper;
@@ -2113,6 +3243,14 @@ namespace Sonnet
         private bool isDualObjectiveLimitReached;
         private bool isIterationLimitReached;
         private int iterationCount;
+        private bool isLPSolution; // the latest solve was an LP solve of the solver in this process
+
+        // The version of the latest solution, and its snapshot (only with LazySolutionAssignment, or of a worker process)
+        private int solutionVersion;
+        private double[] colSolution;
+        private double[] reducedCosts;
+        private double[] rowActivity;
+        private double[] rowPrices;
 
         private bool isSolving = false; // used for interrupting a solve
 
@@ -0,0 +1,512 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.IO;
+using System.IO.Pipes;
+using System.Linq;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
+using COIN;
+#endif
+
+namespace Sonnet
+{
+    /// <summary>
+    /// The entry point of a worker process of a SolverWorkerPool.
+    /// A worker process reads problems from its standard input, solves them, and writes the solutions to a pipe to the pool,
+    /// until its standard input is closed. The standard output remains available for logging, also of the native solvers.
+    /// Typically, the Main of an application starts with
+    /// <code>
+    /// if (SolverWorker.IsWorker(args)) { SolverWorker.Run(); return; }
+    /// </code>
+    /// such that the application can be used as its own worker (see SolverWorkerPool).
+    /// </summary>
+    public static class SolverWorker
+    {
+        /// <summary>
+        /// The command line argument that tells a process to run as worker.
+        /// </summary>
+        public const string Argument = "--sonnet-worker";
+
+        /// <summary>
+        /// The environment variable that passes the name of the pipe for the solutions to a worker process.
+        /// </summary>
+        internal const string PipeVariable = "SONNET_WORKER_PIPE";
+
+        private const int ConnectTimeout = 10000; // milliseconds
+
+        /// <summary>
+        /// Returns true iff the given command line arguments contain the worker argument.
+        /// </summary>
+        /// <param name="args">The command line arguments.</param>
+        /// <returns>True iff this process should run as worker.</returns>
+        public static bool IsWorker(string[] args)
+        {
+            return args != null && args.Contains(Argument);
+        }
+
+        /// <summary>
+        /// Runs this process as worker, on its standard input and the pipe for the solutions that was passed by the pool.
+        /// If this process was not started by a pool, the solutions are written to the standard output instead. In that case,
+        /// anything written to the console is redirected to the standard error, and the log levels of the native solvers are set to 0.
+        /// </summary>
+        public static void Run()
+        {
+            Stream input = Console.OpenStandardInput();
+
+            string pipeName = Environment.GetEnvironmentVariable(PipeVariable);
+            if (!string.IsNullOrEmpty(pipeName))
+            {
+                using (NamedPipeClientStream output = new NamedPipeClientStream(".", pipeName, PipeDirection.Out))
+                {
+                    output.Connect(ConnectTimeout);
+                    Run(input, output, true);
+                }
+            }
+            else
+            {
+                // Anything else written to the standard output would corrupt the messages to the pool.
+                // Native solvers write to the standard output of the process directly, so their log levels are set to 0.
+                Console.SetOut(Console.Error);
+                Run(input, Console.OpenStandardOutput(), false);
+            }
+        }
+
+        /// <summary>
+        /// Runs as worker on the given streams: reads problems from the input, solves them, and writes the solutions to the output,
+        /// until the input is closed.
+        /// </summary>
+        /// <param name="input">The stream to read the problems from.</param>
+        /// <param name="output">The stream to write the solutions to.</param>
+        public static void Run(Stream input, Stream output)
+        {
+            Ensure.NotNull(input, "input");
+            Ensure.NotNull(output, "output");
+
+            Run(input, output, true);
+        }
+
+        private static void Run(Stream input, Stream output, bool nativeLogging)
+        {
+
+            BinaryReader reader = new BinaryReader(input);
+            BinaryWriter writer = new BinaryWriter(output);
+
+            SolverWorkerRequest request;
+            while ((request = SolverWorkerRequest.Read(reader)) != null)
+            {
+                SolverWorkerResult result;
+                try
+                {
+                    result = Solve(request, nativeLogging);
+                }
+                catch (Exception e)
+                {
+                    SonnetLog.Default.Error(e.ToString());
+                    result = new SolverWorkerResult(e.Message);
+                }
+
+                result.Write(writer);
+                writer.Flush();
+            }
+        }
+
+        private static SolverWorkerResult Solve(SolverWorkerRequest request, bool nativeLogging)
+        {
+            Type type = Type.GetType(request.SolverTypeName, true);
+            Ensure.Is<OsiSolverInterface>(type);
+
+            using (OsiSolverInterface solver = (OsiSolverInterface)Activator.CreateInstance(type))
+            {
+                solver.messageHandler().setLogLevel(nativeLogging ? request.LogLevel : 0);
+                solver.loadProblem(request.NumberOfColumns, request.NumberOfRows, request.Starts, request.Indices, request.Elements,
+                    request.ColLower, request.ColUpper, request.Objective, request.RowLower, request.RowUpper);
+                foreach (int col in request.IntegerColumns) solver.setInteger(col);
+                solver.setObjSense(request.ObjSense);
+                request.ApplyParameters(solver);
+
+                if (request.MipSolve)
+                {
+                    if (solver is OsiCbcSolverInterface cbcSolver)
+                    {
+                        // Without arguments, Cbc uses branch and bound of its model instead of CbcMain, so only append to given arguments
+                        string[] cbcSolverArgs = request.CbcSolverArgs;
+                        if (!nativeLogging && cbcSolverArgs.Length > 0) cbcSolverArgs = cbcSolverArgs.Concat(new string[] { "-log", "0" }).ToArray();
+                        cbcSolver.SetCbcSolverArgs(cbcSolverArgs);
+                    }
+                    Solver.BranchAndBound(solver, false);
+                }
+                else
+                {
+                    solver.initialSolve();
+                }
+
+                return SolverWorkerResult.FromSolver(solver, request.MipSolve, request.IntegerColumns.Length > 0);
+            }
+        }
+    }
+
+    /// <summary>
+    /// A problem to be solved by a worker process, as taken from the (generated) native solver.
+    /// </summary>
+    internal class SolverWorkerRequest
+    {
+        private const int Magic = 0x534E5751; // "SNWQ"
+        private const int Version = 2;
+
+        private SolverWorkerRequest()
+        {
+        }
+
+        /// <summary>
+        /// Returns the request to solve the current problem of the given native solver.
+        /// </summary>
+        /// <param name="solver">The native solver with the problem loaded.</param>
+        /// <param name="mipSolve">Solve with branch and bound or not.</param>
+        /// <returns>The new request.</returns>
+        public static SolverWorkerRequest FromSolver(OsiSolverInterface solver, bool mipSolve)
+        {
+            SolverWorkerRequest request = new SolverWorkerRequest();
+            request.SolverTypeName = solver.GetType().AssemblyQualifiedName;
+            request.MipSolve = mipSolve;
+            request.ObjSense = solver.getObjSense();
+            request.LogLevel = solver.messageHandler().logLevel();
+
+            int n = solver.getNumCols();
+            request.NumberOfColumns = n;
+            request.NumberOfRows = solver.getNumRows();
+
+            // The column-wise copy may have gaps between the columns, so copy only the elements within the column lengths
+            CoinPackedMatrix matrix = solver.getMatrixByCol();
+            int[] starts = matrix.getVectorStarts();
+            int[] lengths = matrix.getVectorLengths();
+            int[] indices = matrix.getIndices();
+            double[] elements = matrix.getElements();
+            GC.KeepAlive(solver);
+
+            request.Starts = new int[n + 1];
+            request.Indices = new int[matrix.getNumElements()];
+            request.Elements = new double[request.Indices.Length];
+            int nz = 0;
+            for (int col = 0; col < n; col++)
+            {
+                request.Starts[col] = nz;
+                Array.Copy(indices, starts[col], request.Indices, nz, lengths[col]);
+                Array.Copy(elements, starts[col], request.Elements, nz, lengths[col]);
+                nz += lengths[col];
+            }
+            request.Starts[n] = nz;
+
+            request.ColLower = solver.getColLower();
+            request.ColUpper = solver.getColUpper();
+            request.Objective = solver.getObjCoefficients();
+            request.RowLower = solver.getRowLower();
+            request.RowUpper = solver.getRowUpper();
+            request.IntegerColumns = Enumerable.Range(0, n).Where(col => solver.isInteger(col)).ToArray();
+            request.CbcSolverArgs = (solver is OsiCbcSolverInterface cbcSolver) ? cbcSolver.GetCbcSolverArgs() : new string[0];
+
+            request.intParams = new int[(int)OsiIntParam.OsiLastIntParam];
+            for (int key = 0; key < request.intParams.Length; key++) solver.getIntParam((OsiIntParam)key, out request.intParams[key]);
+            request.dblParams = new double[(int)OsiDblParam.OsiLastDblParam];
+            for (int key = 0; key < request.dblParams.Length; key++) solver.getDblParam((OsiDblParam)key, out request.dblParams[key]);
+            request.strParams = new string[(int)OsiStrParam.OsiLastStrParam];
+            for (int key = 0; key < request.strParams.Length; key++) solver.getStrParam((OsiStrParam)key, out request.strParams[key]);
+            request.hints = new bool[(int)OsiHintParam.OsiLastHintParam];
+            request.hintStrengths = new int[request.hints.Length];
+            for (int key = 0; key < request.hints.Length; key++)
+            {
+                solver.getHintParam((OsiHintParam)key, out request.hints[key], out OsiHintStrength strength);
+                request.hintStrengths[key] = (int)strength;
+            }
+
+            return request;
+        }
+
+        /// <summary>
+        /// Sets the parameters and hints of this request to the given native solver.
+        /// The solver name is a property of the solver type, and cannot be set.
+        /// </summary>
+        /// <param name="solver">The native solver.</param>
+        public void ApplyParameters(OsiSolverInterface solver)
+        {
+            for (int key = 0; key < intParams.Length; key++) solver.setIntParam((OsiIntParam)key, intParams[key]);
+            for (int key = 0; key < dblParams.Length; key++) solver.setDblParam((OsiDblParam)key, dblParams[key]);
+            for (int key = 0; key < strParams.Length; key++)
+            {
+                if ((OsiStrParam)key != OsiStrParam.OsiSolverName) solver.setStrParam((OsiStrParam)key, strParams[key]);
+            }
+            for (int key = 0; key < hints.Length; key++) solver.setHintParam((OsiHintParam)key, hints[key], (OsiHintStrength)hintStrengths[key]);
+        }
+
+        public string SolverTypeName { get; private set; }
+        public bool MipSolve { get; private set; }
+        public double ObjSense { get; private set; }
+        public int LogLevel { get; private set; }
+        public int NumberOfColumns { get; private set; }
+        public int NumberOfRows { get; private set; }
+        public int[] Starts { get; private set; }
+        public int[] Indices { get; private set; }
+        public double[] Elements { get; private set; }
+        public double[] ColLower { get; private set; }
+        public double[] ColUpper { get; private set; }
+        public double[] Objective { get; private set; }
+        public double[] RowLower { get; private set; }
+        public double[] RowUpper { get; private set; }
+        public int[] IntegerColumns { get; private set; }
+        public string[] CbcSolverArgs { get; private set; }
+
+        // The parameters and hints, indexed by their key
+        private int[] intParams;
+        private double[] dblParams;
+        private string[] strParams;
+        private bool[] hints;
+        private int[] hintStrengths;
+
+        /// <summary>
+        /// Writes this request to the given writer.
+        /// </summary>
+        /// <param name="writer">The writer.</param>
+        public void Write(BinaryWriter writer)
+        {
+            writer.Write(Magic);
+            writer.Write(Version);
+            writer.Write(SolverTypeName);
+            writer.Write(MipSolve);
+            writer.Write(ObjSense);
+            writer.Write(LogLevel);
+            writer.Write(NumberOfColumns);
+            writer.Write(NumberOfRows);
+            WriteArray(writer, Starts);
+            WriteArray(writer, Indices);
+            WriteArray(writer, Elements);
+            WriteArray(writer, ColLower);
+            WriteArray(writer, ColUpper);
+            WriteArray(writer, Objective);
+            WriteArray(writer, RowLower);
+            WriteArray(writer, RowUpper);
+            WriteArray(writer, IntegerColumns);
+            writer.Write(CbcSolverArgs.Length);
+            foreach (string arg in CbcSolverArgs) writer.Write(arg);
+            WriteArray(writer, intParams);
+            WriteArray(writer, dblParams);
+            writer.Write(strParams.Length);
+            foreach (string value in strParams) writer.Write(value ?? string.Empty);
+            writer.Write(hints.Length);
+            foreach (bool yesNo in hints) writer.Write(yesNo);
+            WriteArray(writer, hintStrengths);
+        }
+
+        /// <summary>
+        /// Reads the next request from the given reader, or returns null if the stream was closed.
+        /// </summary>
+        /// <param name="reader">The reader.</param>
+        /// <returns>The request read, or null at the end of the stream.</returns>
+        public static SolverWorkerRequest Read(BinaryReader reader)
+        {
+            int magic;
+            try
+            {
+                magic = reader.ReadInt32();
+            }
+            catch (EndOfStreamException)
+            {
+                return null;
+            }
+
+            if (magic != Magic) throw new SonnetException("Invalid request to worker process.");
+            int version = reader.ReadInt32();
+            if (version != Version) throw new SonnetException(string.Format("Request to worker process has version {0} but expected {1}.", version, Version));
+
+            SolverWorkerRequest request = new SolverWorkerRequest();
+            request.SolverTypeName = reader.ReadString();
+            request.MipSolve = reader.ReadBoolean();
+            request.ObjSense = reader.ReadDouble();
+            request.LogLevel = reader.ReadInt32();
+            request.NumberOfColumns = reader.ReadInt32();
+            request.NumberOfRows = reader.ReadInt32();
+            request.Starts = ReadIntArray(reader);
+            request.Indices = ReadIntArray(reader);
+            request.Elements = ReadDoubleArray(reader);
+            request.ColLower = ReadDoubleArray(reader);
+            request.ColUpper = ReadDoubleArray(reader);
+            request.Objective = ReadDoubleArray(reader);
+            request.RowLower = ReadDoubleArray(reader);
+            request.RowUpper = ReadDoubleArray(reader);
+            request.IntegerColumns = ReadIntArray(reader);
+            request.CbcSolverArgs = new string[reader.ReadInt32()];
+            for (int i = 0; i < request.CbcSolverArgs.Length; i++) request.CbcSolverArgs[i] = reader.ReadString();
+            request.intParams = ReadIntArray(reader);
+            request.dblParams = ReadDoubleArray(reader);
+            request.strParams = new string[reader.ReadInt32()];
+            for (int i = 0; i < request.strParams.Length; i++) request.strParams[i] = reader.ReadString();
+            request.hints = new bool[reader.ReadInt32()];
+            for (int i = 0; i < request.hints.Length; i++) request.hints[i] = reader.ReadBoolean();
+            request.hintStrengths = ReadIntArray(reader);
+            return request;
+        }
+
+        internal static void WriteArray(BinaryWriter writer, int[] values)
+        {
+            writer.Write(values.Length);
+            byte[] buffer = new byte[values.Length * sizeof(int)];
+            Buffer.BlockCopy(values, 0, buffer, 0, buffer.Length);
+            writer.Write(buffer);
+        }
+
+        internal static void WriteArray(BinaryWriter writer, double[] values)
+        {
+            writer.Write(values.Length);
+            byte[] buffer = new byte[values.Length * sizeof(double)];
+            Buffer.BlockCopy(values, 0, buffer, 0, buffer.Length);
+            writer.Write(buffer);
+        }
+
+        internal static int[] ReadIntArray(BinaryReader reader)
+        {
+            int[] values = new int[reader.ReadInt32()];
+            byte[] buffer = ReadBytes(reader, values.Length * sizeof(int));
+            Buffer.BlockCopy(buffer, 0, values, 0, buffer.Length);
+            return values;
+        }
+
+        internal static double[] ReadDoubleArray(BinaryReader reader)
+        {
+            double[] values = new double[reader.ReadInt32()];
+            byte[] buffer = ReadBytes(reader, values.Length * sizeof(double));
+            Buffer.BlockCopy(buffer, 0, values, 0, buffer.Length);
+            return values;
+        }
+
+        private static byte[] ReadBytes(BinaryReader reader, int count)
+        {
+            byte[] buffer = reader.ReadBytes(count);
+            if (buffer.Length != count) throw new EndOfStreamException();
+            return buffer;
+        }
+    }
+
+    /// <summary>
+    /// The solution status and values of a problem solved by a worker process.
+    /// </summary>
+    internal class SolverWorkerResult
+    {
+        private const int Magic = 0x534E5753; // "SNWS"
+
+        private SolverWorkerResult()
+        {
+        }
+
+        /// <summary>
+        /// Constructor of a new result for a solve that failed in the worker process with the given message.
+        /// </summary>
+        /// <param name="errorMessage">The message of the error.</param>
+        public SolverWorkerResult(string errorMessage)
+        {
+            ErrorMessage = errorMessage;
+        }
+
+        /// <summary>
+        /// Returns the result of the latest solve of the given native solver.
+        /// </summary>
+        /// <param name="solver">The native solver.</param>
+        /// <param name="mipSolve">Latest solve was mip solve</param>
+        /// <param name="isMIP">The problem has integer variables.</param>
+        /// <returns>The new result.</returns>
+        public static SolverWorkerResult FromSolver(OsiSolverInterface solver, bool mipSolve, bool isMIP)
+        {
+            SolverWorkerResult result = new SolverWorkerResult();
+            result.IsAbandoned = solver.isAbandoned();
+            result.IsProvenOptimal = solver.isProvenOptimal();
+            result.IsProvenPrimalInfeasible = solver.isProvenPrimalInfeasible();
+            result.IsProvenDualInfeasible = solver.isProvenDualInfeasible();
+            result.IsPrimalObjectiveLimitReached = solver.isPrimalObjectiveLimitReached();
+            result.IsDualObjectiveLimitReached = solver.isDualObjectiveLimitReached();
+            result.IsIterationLimitReached = solver.isIterationLimitReached();
+            result.IterationCount = mipSolve ? 0 : solver.getIterationCount();
+            result.ObjectiveValue = solver.getObjValue();
+            result.Bound = isMIP ? solver.Bound() : double.NaN;
+            result.ColSolution = solver.getColSolution();
+            result.RowActivity = solver.getRowActivity();
+            result.ReducedCost = mipSolve ? new double[0] : solver.getReducedCost();
+            result.RowPrice = mipSolve ? new double[0] : solver.getRowPrice();
+            return result;
+        }
+
+        public string ErrorMessage { get; private set; }
+        public bool IsAbandoned { get; private set; }
+        public bool IsProvenOptimal { get; private set; }
+        public bool IsProvenPrimalInfeasible { get; private set; }
+        public bool IsProvenDualInfeasible { get; private set; }
+        public bool IsPrimalObjectiveLimitReached { get; private set; }
+        public bool IsDualObjectiveLimitReached { get; private set; }
+        public bool IsIterationLimitReached { get; private set; }
+        public int IterationCount { get; private set; }
+        public double ObjectiveValue { get; private set; }
+        public double Bound { get; private set; }
+        public double[] ColSolution { get; private set; }
+        public double[] ReducedCost { get; private set; }
+        public double[] RowActivity { get; private set; }
+        public double[] RowPrice { get; private set; }
+
+        /// <summary>
+        /// Writes this result to the given writer.
+        /// </summary>
+        /// <param name="writer">The writer.</param>
+        public void Write(BinaryWriter writer)
+        {
+            writer.Write(Magic);
+            writer.Write(ErrorMessage != null);
+            if (ErrorMessage != null)
+            {
+                writer.Write(ErrorMessage);
+                return;
+            }
+
+            writer.Write(IsAbandoned);
+            writer.Write(IsProvenOptimal);
+            writer.Write(IsProvenPrimalInfeasible);
+            writer.Write(IsProvenDualInfeasible);
+            writer.Write(IsPrimalObjectiveLimitReached);
+            writer.Write(IsDualObjectiveLimitReached);
+            writer.Write(IsIterationLimitReached);
+            writer.Write(IterationCount);
+            writer.Write(ObjectiveValue);
+            writer.Write(Bound);
+            SolverWorkerRequest.WriteArray(writer, ColSolution);
+            SolverWorkerRequest.WriteArray(writer, ReducedCost);
+            SolverWorkerRequest.WriteArray(writer, RowActivity);
+            SolverWorkerRequest.WriteArray(writer, RowPrice);
+        }
+
+        /// <summary>
+        /// Reads a result from the given reader.
+        /// Throws EndOfStreamException if the stream was closed, e.g., because the worker process exited.
+        /// </summary>
+        /// <param name="reader">The reader.</param>
+        /// <returns>The result read.</returns>
+        public static SolverWorkerResult Read(BinaryReader reader)
+        {
+            if (reader.ReadInt32() != Magic) throw new SonnetException("Invalid result from worker process.");
+            if (reader.ReadBoolean()) return new SolverWorkerResult(reader.ReadString());
+
+            SolverWorkerResult result = new SolverWorkerResult();
+            result.IsAbandoned = reader.ReadBoolean();
+            result.IsProvenOptimal = reader.ReadBoolean();
+            result.IsProvenPrimalInfeasible = reader.ReadBoolean();
+            result.IsProvenDualInfeasible = reader.ReadBoolean();
+            result.IsPrimalObjectiveLimitReached = reader.ReadBoolean();
+            result.IsDualObjectiveLimitReached = reader.ReadBoolean();
+            result.IsIterationLimitReached = reader.ReadBoolean();
+            result.IterationCount = reader.ReadInt32();
+            result.ObjectiveValue = reader.ReadDouble();
+            result.Bound = reader.ReadDouble();
+            result.ColSolution = SolverWorkerRequest.ReadDoubleArray(reader);
+            result.ReducedCost = SolverWorkerRequest.ReadDoubleArray(reader);
+            result.RowActivity = SolverWorkerRequest.ReadDoubleArray(reader);
+            result.RowPrice = SolverWorkerRequest.ReadDoubleArray(reader);
+            return result;
+        }
+    }
+}
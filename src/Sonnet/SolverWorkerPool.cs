@@ -0,0 +1,332 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.IO.Pipes;
+using System.Reflection;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Sonnet
+{
+    /// <summary>
+    /// A pool of local worker processes to solve in (see Solver.WorkerPool).
+    /// Solving in a separate process isolates this process from crashes of the native solver, allows time and memory limits
+    /// to be enforced by killing the worker, and allows multiple solvers to solve in parallel from different threads.
+    /// Worker processes are started on demand, up to MaxWorkers, and reused for subsequent solves.
+    /// A worker process is any executable that calls SolverWorker.Run(), for example the application itself (see SolverWorker).
+    /// </summary>
+    public class SolverWorkerPool : IDisposable
+    {
+        private static readonly SonnetLog log = SonnetLog.Default;
+
+        /// <summary>
+        /// Constructor of a new pool that uses the entry assembly of the current process as worker,
+        /// started with the SolverWorker.Argument.
+        /// If the entry assembly is a dll that is run by a host (e.g., "dotnet app.dll"), the workers are started by the same host.
+        /// </summary>
+        /// <param name="maxWorkers">The maximum number of worker processes.</param>
+        public SolverWorkerPool(int maxWorkers)
+            : this(maxWorkers, Process.GetCurrentProcess().MainModule.FileName, GetEntryAssemblyArguments())
+        {
+        }
+
+        /// <summary>
+        /// Constructor of a new pool that uses the given executable and arguments to start worker processes.
+        /// </summary>
+        /// <param name="maxWorkers">The maximum number of worker processes.</param>
+        /// <param name="fileName">The executable of the worker processes.</param>
+        /// <param name="arguments">The command line arguments of the worker processes.</param>
+        public SolverWorkerPool(int maxWorkers, string fileName, string arguments)
+        {
+            Ensure.IsTrue(maxWorkers > 0, "The maximum number of workers must be positive.");
+            Ensure.NotNullOrWhiteSpace(fileName, "fileName");
+
+            this.maxWorkers = maxWorkers;
+            this.fileName = fileName;
+            this.arguments = arguments ?? string.Empty;
+        }
+
+        /// <summary>
+        /// Gets the maximum number of worker processes.
+        /// </summary>
+        public int MaxWorkers { get { return maxWorkers; } }
+
+        /// <summary>
+        /// Gets or sets the time limit in seconds of a single solve, or 0 for no limit (= Default).
+        /// A worker process that exceeds the time limit is killed, and the solve results in a SonnetException.
+        /// </summary>
+        public double TimeLimit
+        {
+            get { return timeLimit; }
+            set { Ensure.IsTrue(value >= 0.0, "The time limit cannot be negative."); timeLimit = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the limit in bytes of the working set of a worker process, or 0 for no limit (= Default).
+        /// A worker process that exceeds the memory limit is killed, and the solve results in a SonnetException.
+        /// </summary>
+        public long MemoryLimit
+        {
+            get { return memoryLimit; }
+            set { Ensure.IsTrue(value >= 0, "The memory limit cannot be negative."); memoryLimit = value; }
+        }
+
+        /// <summary>
+        /// Solves the given request in a worker process of this pool. Blocks while all worker processes are busy.
+        /// </summary>
+        /// <param name="request">The problem to be solved.</param>
+        /// <returns>The solution sent back by the worker process.</returns>
+        internal SolverWorkerResult Solve(SolverWorkerRequest request)
+        {
+            Worker worker = Acquire();
+            bool reuse = false;
+            try
+            {
+                request.Write(worker.Writer);
+                worker.Writer.Flush();
+
+                Task<SolverWorkerResult> task = Task.Run(() => SolverWorkerResult.Read(worker.Reader));
+                Stopwatch stopwatch = Stopwatch.StartNew();
+                while (!task.Wait(PollInterval))
+                {
+                    string exceeded = null;
+                    if (timeLimit > 0.0 && stopwatch.Elapsed.TotalSeconds > timeLimit)
+                    {
+                        exceeded = string.Format("time limit of {0} seconds", timeLimit);
+                    }
+                    else if (memoryLimit > 0)
+                    {
+                        worker.Process.Refresh();
+                        if (worker.Process.WorkingSet64 > memoryLimit) exceeded = string.Format("memory limit of {0} bytes", memoryLimit);
+                    }
+
+                    if (exceeded != null)
+                    {
+                        // Killing the worker ends the read task with an exception, which is no longer of interest
+                        task.ContinueWith(t => t.Exception, TaskContinuationOptions.OnlyOnFaulted);
+                        worker.Process.Kill();
+                        throw new SonnetException(string.Format("Solve in worker process {0} exceeded the {1}.", worker.Process.Id, exceeded));
+                    }
+                }
+
+                SolverWorkerResult result = task.Result;
+                reuse = true;
+                if (result.ErrorMessage != null) throw new SonnetException("Solve in worker process failed: " + result.ErrorMessage);
+                return result;
+            }
+            catch (AggregateException e) when (e.InnerException is IOException)
+            {
+                throw WorkerExited(worker, e.InnerException);
+            }
+            catch (IOException e)
+            {
+                throw WorkerExited(worker, e);
+            }
+            finally
+            {
+                Release(worker, reuse);
+            }
+        }
+
+        /// <summary>
+        /// Returns the worker arguments for the executable of the current process: only the SolverWorker.Argument if that executable
+        /// is the entry assembly itself (or its apphost), but preceded by the entry assembly if that is a dll run by a host.
+        /// </summary>
+        /// <returns>The command line arguments of the worker processes.</returns>
+        private static string GetEntryAssemblyArguments()
+        {
+            string hostFileName = Process.GetCurrentProcess().MainModule.FileName;
+            Assembly entryAssembly = Assembly.GetEntryAssembly();
+            string entryFileName = entryAssembly?.Location;
+
+            // Single-file applications have no location of the entry assembly, but are their own executable
+            if (string.IsNullOrEmpty(entryFileName)) return SolverWorker.Argument;
+
+            if (string.Equals(Path.GetExtension(entryFileName), ".dll", StringComparison.OrdinalIgnoreCase) &&
+                !string.Equals(Path.GetFileNameWithoutExtension(hostFileName), Path.GetFileNameWithoutExtension(entryFileName), StringComparison.OrdinalIgnoreCase))
+            {
+                return string.Format("\"{0}\" {1}", entryFileName, SolverWorker.Argument);
+            }
+
+            return SolverWorker.Argument;
+        }
+
+        /// <summary>
+        /// Stops all worker processes. Solves that are running in worker processes are not affected, but their workers
+        /// are stopped when done.
+        /// </summary>
+        public void Dispose()
+        {
+            List<Worker> stopping;
+            lock (syncRoot)
+            {
+                disposed = true;
+                stopping = new List<Worker>(idle);
+                idle.Clear();
+                numberOfWorkers -= stopping.Count;
+                Monitor.PulseAll(syncRoot);
+            }
+
+            foreach (Worker worker in stopping) Stop(worker);
+        }
+
+        private Worker Acquire()
+        {
+            lock (syncRoot)
+            {
+                while (true)
+                {
+                    if (disposed) throw new ObjectDisposedException(GetType().Name);
+                    if (idle.Count > 0) return idle.Pop();
+                    if (numberOfWorkers < maxWorkers)
+                    {
+                        numberOfWorkers++;
+                        break;
+                    }
+
+                    Monitor.Wait(syncRoot);
+                }
+            }
+
+            try
+            {
+                return Start();
+            }
+            catch
+            {
+                lock (syncRoot)
+                {
+                    numberOfWorkers--;
+                    Monitor.Pulse(syncRoot);
+                }
+                throw;
+            }
+        }
+
+        private void Release(Worker worker, bool reuse)
+        {
+            lock (syncRoot)
+            {
+                if (reuse && !disposed)
+                {
+                    idle.Push(worker);
+                    worker = null;
+                }
+                else
+                {
+                    numberOfWorkers--;
+                }
+
+                Monitor.Pulse(syncRoot);
+            }
+
+            if (worker != null) Stop(worker);
+        }
+
+        private Worker Start()
+        {
+            ProcessStartInfo startInfo = new ProcessStartInfo(fileName, arguments);
+            startInfo.UseShellExecute = false;
+            startInfo.CreateNoWindow = true;
+            startInfo.RedirectStandardInput = true;
+
+            // The solutions are sent back on a dedicated pipe, since the native solvers write their logging to the standard output.
+            // The pipe is named (with a random name), instead of an anonymous pipe with an inheritable handle, since any process started
+            // elsewhere in this process would also inherit that handle, and keep the pipe open after the worker exited.
+            // A single instance of the pipe is allowed, so no other client can connect once the worker has.
+            string pipeName = "Sonnet-" + Guid.NewGuid().ToString("N");
+            PipeOptions pipeOptions = PipeOptions.Asynchronous;
+#if NET6_0
+            pipeOptions |= PipeOptions.CurrentUserOnly;
+#endif
+            NamedPipeServerStream resultPipe = new NamedPipeServerStream(pipeName, PipeDirection.In, 1, PipeTransmissionMode.Byte, pipeOptions);
+            Process process = null;
+            try
+            {
+                startInfo.EnvironmentVariables[SolverWorker.PipeVariable] = pipeName;
+                process = Process.Start(startInfo);
+
+                // Wait for the worker to connect, but not for a worker that exited
+                Task connect = resultPipe.WaitForConnectionAsync();
+                while (!connect.Wait(PollInterval))
+                {
+                    if (process.HasExited)
+                    {
+                        connect.ContinueWith(t => t.Exception, TaskContinuationOptions.OnlyOnFaulted);
+                        throw new SonnetException(string.Format("Worker process {0} exited with exit code {1} before connecting.", process.Id, process.ExitCode));
+                    }
+                }
+            }
+            catch
+            {
+                resultPipe.Dispose();
+                if (process != null)
+                {
+                    if (!process.HasExited) process.Kill();
+                    process.Dispose();
+                }
+                throw;
+            }
+
+            log.InfoFormat("Started worker process {0}: {1} {2}", process.Id, fileName, arguments);
+            return new Worker(process, resultPipe);
+        }
+
+        private static void Stop(Worker worker)
+        {
+            try
+            {
+                // Closing the standard input ends a healthy worker. Otherwise, kill it.
+                worker.Writer.Close();
+                if (!worker.Process.WaitForExit(StopTimeout)) worker.Process.Kill();
+            }
+            catch (Exception e) when (e is IOException || e is InvalidOperationException || e is System.ComponentModel.Win32Exception)
+            {
+                // Already exited, or broken pipe. Nothing left to stop.
+                if (!worker.Process.HasExited) worker.Process.Kill();
+            }
+            finally
+            {
+                worker.Reader.Dispose();
+                worker.Process.Dispose();
+            }
+        }
+
+        private static SonnetException WorkerExited(Worker worker, Exception innerException)
+        {
+            string exitCode = worker.Process.WaitForExit(StopTimeout) ? worker.Process.ExitCode.ToString() : "unknown";
+            return new SonnetException(string.Format("Worker process {0} exited unexpectedly with exit code {1}.", worker.Process.Id, exitCode), innerException);
+        }
+
+        private class Worker
+        {
+            public Worker(Process process, Stream resultPipe)
+            {
+                Process = process;
+                Writer = new BinaryWriter(process.StandardInput.BaseStream);
+                Reader = new BinaryReader(resultPipe);
+            }
+
+            public Process Process { get; private set; }
+            public BinaryWriter Writer { get; private set; }
+            public BinaryReader Reader { get; private set; }
+        }
+
+        private const int PollInterval = 100; // milliseconds
+        private const int StopTimeout = 1000; // milliseconds
+
+        private readonly int maxWorkers;
+        private readonly string fileName;
+        private readonly string arguments;
+        private readonly object syncRoot = new object();
+        private readonly Stack<Worker> idle = new Stack<Worker>();
+        private int numberOfWorkers = 0;
+        private bool disposed = false;
+        private double timeLimit = 0.0;
+        private long memoryLimit = 0;
+    }
+}
@@ -8,6 +8,12 @@ using System.Diagnostics;
 using System.Linq;
 using System.Runtime.InteropServices;
 
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
+using COIN;
+#endif
+
 namespace Sonnet
 {
     /// <summary>
@@ -121,8 +127,12 @@ namespace Sonnet
     /// </summary>
     public static class Utils
     {
-        //private static readonly Dictionary<COIN.OsiCbcSolverInterface, >
-        private static readonly Dictionary<COIN.OsiCbcSolverInterface, List<string>> cbcSolverArgs = new Dictionary<COIN.OsiCbcSolverInterface, List<string>>();
+        /// <summary>
+        /// The Cbc arguments per solver. The table is thread-safe, and does not keep the solvers alive.
+        /// The lists are locked, since solvers can be used on multiple threads.
+        /// </summary>
+        private static readonly System.Runtime.CompilerServices.ConditionalWeakTable<OsiCbcSolverInterface, List<string>> cbcSolverArgs =
+            new System.Runtime.CompilerServices.ConditionalWeakTable<OsiCbcSolverInterface, List<string>>();
 
         /// <summary>
         /// Adds one or more args to the array of arguments to be used when solving using an instance of OsiCbcSolverInterface.
@@ -131,19 +141,15 @@ namespace Sonnet
         /// </summary>
         /// <param name="solver">The OsiCbcSolverInterface instance.</param>
         /// <param name="args">The list of arguments added for CbcMain1(..)</param>
-        public static void AddCbcSolverArgs(this COIN.OsiCbcSolverInterface solver, params string[] args)
+        public static void AddCbcSolverArgs(this OsiCbcSolverInterface solver, params string[] args)
         {
             Ensure.NotNull(args);
 
-            // Already have some args for this solver?
-            List<string> result;
-            if (!cbcSolverArgs.TryGetValue(solver, out result))
+            List<string> result = cbcSolverArgs.GetValue(solver, s => new List<string>());
+            lock (result)
             {
-                result = new List<string>();
-                cbcSolverArgs[solver] = result;
+                result.AddRange(args);
             }
-
-            result.AddRange(args);
         }
 
         /// <summary>
@@ -153,9 +159,15 @@ namespace Sonnet
         /// </summary>
         /// <param name="solver">The OsiCbcSolverInterface instance.</param>
         /// <returns>The arguments for CbcMain1(..).</returns>
-        public static string[] GetCbcSolverArgs(this COIN.OsiCbcSolverInterface solver)
+        public static string[] GetCbcSolverArgs(this OsiCbcSolverInterface solver)
         {
-            if (cbcSolverArgs.TryGetValue(solver, out var result)) return result.ToArray();
+            if (cbcSolverArgs.TryGetValue(solver, out var result))
+            {
+                lock (result)
+                {
+                    return result.ToArray();
+                }
+            }
             else return new string[0];
         }
         /// <summary>
@@ -164,9 +176,14 @@ namespace Sonnet
         /// </summary>
         /// <param name="solver">The OsiCbcSolverInterface instance.</param>
         /// <param name="args">The arguments for CbcMain1(..).</param>
-        public static void SetCbcSolverArgs(this COIN.OsiCbcSolverInterface solver, params string []args)
+        public static void SetCbcSolverArgs(this OsiCbcSolverInterface solver, params string []args)
         {
-            cbcSolverArgs[solver] = args.ToList();
+            List<string> result = cbcSolverArgs.GetValue(solver, s => new List<string>());
+            lock (result)
+            {
+                result.Clear();
+                result.AddRange(args);
+            }
         }
 
     }
@@ -208,7 +225,7 @@ namespace Sonnet
         /// </summary>
         /// <param name="solver"></param>
         /// <returns></returns>
-        public static bool UseBranchAndBound(this COIN.OsiCbcSolverInterface solver)
+        public static bool UseBranchAndBound(this OsiCbcSolverInterface solver)
         {
             string[] args = solver.GetCbcSolverArgs();
             if (args.Length == 1 && string.Equals(args[0], "-branchAndBound", StringComparison.CurrentCultureIgnoreCase))
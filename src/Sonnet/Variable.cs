@@ -85,7 +85,7 @@ namespace Sonnet
             this.id = NextId();
 
             if (name != null) Name = name;
-            else Name = string.Format("Var_{0}", id);
+            else SetDefaultName("Var_", id);
         }
 
         /// <summary>
@@ -223,7 +223,7 @@ namespace Sonnet
         /// <returns>A string representation of this instance using its value and reduced cost.</returns>
         public string ToLevelString()
         {
-            return string.Format("{0} = {1}   ( {2} )", this, Value, reducedCost);
+            return string.Format("{0} = {1}   ( {2} )", this, Value, ReducedCost);
         }
 
         /// <summary>
@@ -282,7 +282,7 @@ namespace Sonnet
             get { return base.Name; }
             set
             {
-                if (!Name.Equals(value))
+                if (HasLazyName || !Name.Equals(value))
                 {
                     base.Name = value;
                     foreach(Solver solver in solvers) solver.SetVariableName(this, Name);
@@ -349,14 +349,30 @@ namespace Sonnet
         /// <summary>
         /// Get or set the value of this variable in the current solution.
         /// </summary>
-        public double Value { get; set; }
+        public double Value
+        {
+            get
+            {
+                AssignLazySolution();
+                return value;
+            }
+            set
+            {
+                AssignLazySolution();
+                this.value = value;
+            }
+        }
 
         /// <summary>
         /// Get the reduced cost of this variable in the current solution.
         /// </summary>
         public double ReducedCost
         {
-            get { return reducedCost; }
+            get
+            {
+                AssignLazySolution();
+                return reducedCost;
+            }
         }
 
         /// <summary>
@@ -385,8 +401,34 @@ namespace Sonnet
         internal virtual void Assign(Solver solver, int offset, double value, double reducedCost)
         {
             base.Assign(solver, offset);
-            this.Value = value;
+            this.value = value;
             this.reducedCost = reducedCost;
+            this.solutionVersion = solver.SolutionVersion;
+        }
+
+        /// <summary>
+        /// If the assigned solver has a newer solution than the one of this variable, 
+        /// then get the value and reduced cost from the solution snapshot of the solver (see Solver.LazySolutionAssignment).
+        /// </summary>
+        private void AssignLazySolution()
+        {
+            Solver solver = AssignedSolver;
+            if (solver is null) return;
+
+            int version = solver.SolutionVersion;
+            if (version == solutionVersion) return;
+
+            solver.GetVariableSolution(Offset, out value, out reducedCost);
+            solutionVersion = version;
+        }
+
+        /// <summary>
+        /// Keep the current solution when this variable is no longer assigned to its solver.
+        /// </summary>
+        protected override void Unassign()
+        {
+            AssignLazySolution();
+            base.Unassign();
         }
 
         #region Overloaded Operators
@@ -659,12 +701,12 @@ namespace Sonnet
         #endregion
 
         /// <summary>
-        /// Used for assigning this.id as numberOf++
+        /// Used for assigning this.id as numberOf++, atomically since variables can be created on multiple threads.
         /// </summary>
         /// <returns>numberOf++</returns>
         private static int NextId()
         {
-            return numberOfVariables++;
+            return System.Threading.Interlocked.Increment(ref numberOfVariables) - 1;
         }
 
         /// <summary>
@@ -673,7 +715,9 @@ namespace Sonnet
         private static int numberOfVariables = 0;
 
         private int frozen;
+        private double value;
         private double reducedCost;
+        private int solutionVersion;
 
         /// <summary>
         /// The upper bound value.
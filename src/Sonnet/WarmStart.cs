@@ -6,7 +6,11 @@ using System;
 using System.Collections.Generic;
 using System.Text;
 
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
 using COIN;
+#endif
 
 namespace Sonnet
 {
@@ -32,6 +36,18 @@ namespace Sonnet
             }
         }
         
+        internal static WarmStart NewWarmStart(CoinWarmStart coinWarmStart, double[] colSolution, double[] rowPrice)
+        {
+            unsafe
+            {
+                fixed (double* colSolutionPinned = colSolution)
+                fixed (double* rowPricePinned = rowPrice)
+                {
+                    return new WarmStart(coinWarmStart, colSolution.Length, colSolutionPinned, rowPrice.Length, rowPricePinned);
+                }
+            }
+        }
+
         internal static WarmStart NewEmptyWarmStart(OsiSolverInterface solver)
         {
             unsafe
@@ -95,9 +111,6 @@ namespace Sonnet
                         }
                     }
                 }
-#if (!SONNET_SETWARMROWPRICE)
-        		if (numberRows > 0 || rowPrice != null) throw new NotSupportedException();
-#endif
             }
 
             // set the warmstart object
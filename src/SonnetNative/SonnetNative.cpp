@@ -0,0 +1,68 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "SonnetNativeImpl.hpp"
+
+namespace SonnetNative
+{
+	// The message of the last error per thread, such that solvers on different threads do not overwrite each other's errors
+	static thread_local std::string lastError;
+
+	void setLastError(const char *message)
+	{
+		lastError = message != nullptr ? message : "";
+	}
+
+	int copyMatrix(const CoinPackedMatrix *matrix, int *starts, int startsLength, int *indices, double *values, int elementsLength)
+	{
+		if (matrix == nullptr) return 0;
+
+		int majorDim = matrix->getMajorDim();
+		int numberElements = matrix->getNumElements();
+		if (starts == nullptr || indices == nullptr || values == nullptr ||
+			startsLength < majorDim + 1 || elementsLength < numberElements) return numberElements;
+
+		// The matrix can have gaps between the vectors (after deletions), so copy vector by vector
+		const CoinBigIndex *vectorStarts = matrix->getVectorStarts();
+		const int *vectorLengths = matrix->getVectorLengths();
+		const int *matrixIndices = matrix->getIndices();
+		const double *matrixElements = matrix->getElements();
+
+		int k = 0;
+		for (int i = 0; i < majorDim; i++)
+		{
+			starts[i] = k;
+			int length = vectorLengths[i];
+			std::memcpy(indices + k, matrixIndices + vectorStarts[i], sizeof(int) * static_cast<size_t>(length));
+			std::memcpy(values + k, matrixElements + vectorStarts[i], sizeof(double) * static_cast<size_t>(length));
+			k += length;
+		}
+		starts[majorDim] = k;
+		return numberElements;
+	}
+}
+
+using namespace SonnetNative;
+
+extern "C" {
+
+int SonnetNative_version(void)
+{
+	return SONNET_NATIVE_VERSION;
+}
+
+const char *SonnetNative_lastError(void)
+{
+	return lastError.c_str();
+}
+
+int SonnetNative_supportsThreads(void)
+{
+#ifdef CBC_THREAD
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+}
@@ -0,0 +1,451 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+/** SonnetNative: a plain native library with a flat C ABI of the COIN-OR classes that SonnetWrapper exposes to .NET:
+	OsiSolverInterface (OsiClpSolverInterface, OsiCbcSolverInterface), ClpSimplex, CbcModel, CoinMpsIO and CoinLpIO,
+	and message and event handlers that call back via C function pointers instead of gcroot.
+	Where SonnetWrapper needs C++/CLI (and therefore Windows), this library builds on any platform with a C++ compiler,
+	such that Sonnet can call it via P/Invoke, for example on Linux .NET (see NET/SonnetNative.NET.csproj).
+
+	Conventions, to keep all signatures blittable:
+	- Objects are opaque handles. The _new functions create objects that must be deleted with the matching _delete function.
+	  Handles returned by other functions (like SonnetOsi_getCbcModelPtr) are borrowed, and must not be deleted.
+	- Functions that can fail return SONNET_OK or SONNET_ERROR (or a count, or a COIN-OR return code, which is never negative).
+	  After SONNET_ERROR, SonnetNative_lastError returns the message of the error on the calling thread.
+	  No C++ exception ever passes the ABI.
+	- Bool results are ints (0 or 1), strings are null-terminated UTF-8 (or plain ASCII, as COIN-OR).
+	- Arrays are passed in bulk: the getters copy min(length, n) values into the caller's array, and return n,
+	  such that a caller can ask for the size with length 0. Names are packed into a buffer, each terminated by '\0';
+	  the name getters return the number of bytes needed, and only fill the buffer if it is large enough.
+	- The matrix arrays are column-ordered (starts, indices, values), without gaps, like the arguments of loadProblem.
+	- Functions marked "fast" only read a member: they never block, never call back, and never throw,
+	  such that they can be called without a GC transition (SuppressGCTransition).
+*/
+
+#if defined(_WIN32)
+#if defined(SONNETNATIVE_EXPORTS)
+#define SONNET_API __declspec(dllexport)
+#else
+#define SONNET_API __declspec(dllimport)
+#endif
+#else
+#define SONNET_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The version of the ABI. Incremented for incompatible changes.
+#define SONNET_NATIVE_VERSION 1
+
+#define SONNET_OK 0
+#define SONNET_ERROR (-1)
+
+/// OsiSolverInterface (an OsiClpSolverInterface or OsiCbcSolverInterface)
+typedef struct SonnetOsi SonnetOsi;
+/// ClpSimplex
+typedef struct SonnetClp SonnetClp;
+/// CbcModel
+typedef struct SonnetCbc SonnetCbc;
+/// CoinMpsIO
+typedef struct SonnetMpsIO SonnetMpsIO;
+/// CoinLpIO
+typedef struct SonnetLpIO SonnetLpIO;
+/// CoinMessageHandler that calls a SonnetPrintCallback
+typedef struct SonnetMessageHandler SonnetMessageHandler;
+/// CbcEventHandler that calls a SonnetEventCallback
+typedef struct SonnetEventHandler SonnetEventHandler;
+/// CoinWarmStart (the basis of a solver)
+typedef struct SonnetWarmStart SonnetWarmStart;
+
+/** Called for every message that is printed at the log level of the handler, on the thread of the solver.
+	The source and text are only valid during the call. Returns 0 (as CoinMessageHandler::print). */
+typedef int (*SonnetPrintCallback)(void *context, int externalNumber, int detail, const char *source, const char *text);
+
+/** Called for every event of Cbc (CbcEventHandler::CbcEvent, from 200 = node), with the model that raised it,
+	which is often a copy of the original model in a (Cbc) thread. Returns the action (CbcEventHandler::CbcAction, -1 = noAction). */
+typedef int (*SonnetEventCallback)(void *context, SonnetCbc *model, int cbcEvent);
+
+// ---------------------------------------------------------------------------------------------------------------
+// General
+
+/// Returns SONNET_NATIVE_VERSION of the library. Fast.
+SONNET_API int SonnetNative_version(void);
+/// Returns the message of the last error on the calling thread, or an empty string. Valid until the next error on this thread.
+SONNET_API const char *SonnetNative_lastError(void);
+/// Returns 1 if Cbc is built with threads (CBC_THREAD), such that "-threads n" can be used with SonnetCbc_main. Fast.
+SONNET_API int SonnetNative_supportsThreads(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+// OsiSolverInterface
+
+/// Create a new OsiClpSolverInterface, or return null on error.
+SONNET_API SonnetOsi *SonnetOsi_newClp(void);
+/// Create a new OsiCbcSolverInterface (with an OsiClpSolverInterface as the LP solver), or return null on error.
+SONNET_API SonnetOsi *SonnetOsi_newCbc(void);
+/// Create a copy of the given solver, including its problem and solution, or return null on error.
+SONNET_API SonnetOsi *SonnetOsi_clone(const SonnetOsi *osi);
+SONNET_API void SonnetOsi_delete(SonnetOsi *osi);
+
+/// Returns the borrowed ClpSimplex of an OsiClpSolverInterface, or null for other solvers.
+SONNET_API SonnetClp *SonnetOsi_getClpModelPtr(SonnetOsi *osi);
+/// Returns the borrowed CbcModel of an OsiCbcSolverInterface, or null for other solvers.
+SONNET_API SonnetCbc *SonnetOsi_getCbcModelPtr(SonnetOsi *osi);
+/// Returns the borrowed LP solver of an OsiCbcSolverInterface, or null for other solvers.
+SONNET_API SonnetOsi *SonnetOsi_getRealSolverPtr(SonnetOsi *osi);
+
+/// Replace the problem by the given column-ordered problem. Null bounds and objective use the defaults of Osi.
+SONNET_API int SonnetOsi_loadProblem(SonnetOsi *osi, int numberColumns, int numberRows, const int *starts, const int *indices, const double *values,
+	const double *columnLower, const double *columnUpper, const double *objective, const double *rowLower, const double *rowUpper);
+/// Add columns, given column-ordered. starts has numberColumns + 1 entries.
+SONNET_API int SonnetOsi_addCols(SonnetOsi *osi, int numberColumns, const int *starts, const int *rows, const double *values,
+	const double *columnLower, const double *columnUpper, const double *objective);
+/// Add rows, given row-ordered. starts has numberRows + 1 entries.
+SONNET_API int SonnetOsi_addRows(SonnetOsi *osi, int numberRows, const int *starts, const int *columns, const double *values,
+	const double *rowLower, const double *rowUpper);
+SONNET_API int SonnetOsi_deleteCols(SonnetOsi *osi, int count, const int *indices);
+SONNET_API int SonnetOsi_deleteRows(SonnetOsi *osi, int count, const int *indices);
+
+/// Fast.
+SONNET_API int SonnetOsi_getNumCols(const SonnetOsi *osi);
+/// Fast.
+SONNET_API int SonnetOsi_getNumRows(const SonnetOsi *osi);
+/// Fast.
+SONNET_API int SonnetOsi_getNumElements(const SonnetOsi *osi);
+SONNET_API int SonnetOsi_getNumIntegers(const SonnetOsi *osi);
+/// Fast.
+SONNET_API double SonnetOsi_getInfinity(const SonnetOsi *osi);
+
+SONNET_API int SonnetOsi_getColLower(const SonnetOsi *osi, double *values, int length);
+SONNET_API int SonnetOsi_getColUpper(const SonnetOsi *osi, double *values, int length);
+SONNET_API int SonnetOsi_getObjCoefficients(const SonnetOsi *osi, double *values, int length);
+SONNET_API int SonnetOsi_getRowLower(const SonnetOsi *osi, double *values, int length);
+SONNET_API int SonnetOsi_getRowUpper(const SonnetOsi *osi, double *values, int length);
+/// The row senses: 'L', 'G', 'E', 'R' or 'N'.
+SONNET_API int SonnetOsi_getRowSense(const SonnetOsi *osi, char *values, int length);
+/// Per column 1 if integer, 0 if continuous.
+SONNET_API int SonnetOsi_getIntegerColumns(const SonnetOsi *osi, unsigned char *values, int length);
+/// Returns 1 if the column is integer, 0 if continuous, or SONNET_ERROR.
+SONNET_API int SonnetOsi_isInteger(const SonnetOsi *osi, int index);
+SONNET_API int SonnetOsi_getColSolution(const SonnetOsi *osi, double *values, int length);
+SONNET_API int SonnetOsi_getRowActivity(const SonnetOsi *osi, double *values, int length);
+SONNET_API int SonnetOsi_getReducedCost(const SonnetOsi *osi, double *values, int length);
+SONNET_API int SonnetOsi_getRowPrice(const SonnetOsi *osi, double *values, int length);
+
+/** Pointers to the arrays of the solver itself, without copying, as the getters of OsiSolverInterface.
+	The arrays are owned by the solver, and only valid until the problem or solution of the solver changes. Null if not available. */
+SONNET_API const double *SonnetOsi_getColLowerPtr(const SonnetOsi *osi);
+SONNET_API const double *SonnetOsi_getColUpperPtr(const SonnetOsi *osi);
+SONNET_API const double *SonnetOsi_getObjCoefficientsPtr(const SonnetOsi *osi);
+SONNET_API const double *SonnetOsi_getRowLowerPtr(const SonnetOsi *osi);
+SONNET_API const double *SonnetOsi_getRowUpperPtr(const SonnetOsi *osi);
+SONNET_API const double *SonnetOsi_getColSolutionPtr(const SonnetOsi *osi);
+SONNET_API const double *SonnetOsi_getRowActivityPtr(const SonnetOsi *osi);
+SONNET_API const double *SonnetOsi_getReducedCostPtr(const SonnetOsi *osi);
+SONNET_API const double *SonnetOsi_getRowPricePtr(const SonnetOsi *osi);
+
+/// Set the values of the columns first, .., first + count - 1.
+SONNET_API int SonnetOsi_setColLower(SonnetOsi *osi, int first, int count, const double *values);
+SONNET_API int SonnetOsi_setColUpper(SonnetOsi *osi, int first, int count, const double *values);
+SONNET_API int SonnetOsi_setObjCoefficients(SonnetOsi *osi, int first, int count, const double *values);
+/// Set the values of the rows first, .., first + count - 1.
+SONNET_API int SonnetOsi_setRowLower(SonnetOsi *osi, int first, int count, const double *values);
+SONNET_API int SonnetOsi_setRowUpper(SonnetOsi *osi, int first, int count, const double *values);
+/// Set the bounds of the given columns (setColSetBounds).
+SONNET_API int SonnetOsi_setColSetBounds(SonnetOsi *osi, int count, const int *indices, const double *lower, const double *upper);
+/// Set the bounds of the given rows (setRowSetBounds).
+SONNET_API int SonnetOsi_setRowSetBounds(SonnetOsi *osi, int count, const int *indices, const double *lower, const double *upper);
+SONNET_API int SonnetOsi_setInteger(SonnetOsi *osi, int count, const int *indices);
+SONNET_API int SonnetOsi_setContinuous(SonnetOsi *osi, int count, const int *indices);
+/// Set the primal solution, of all columns.
+SONNET_API int SonnetOsi_setColSolution(SonnetOsi *osi, const double *values);
+/// Set the dual solution, of all rows.
+SONNET_API int SonnetOsi_setRowPrice(SonnetOsi *osi, const double *values);
+
+/// Set the objective sense: 1 to minimise, -1 to maximise.
+SONNET_API int SonnetOsi_setObjSense(SonnetOsi *osi, double sense);
+/// Fast.
+SONNET_API double SonnetOsi_getObjSense(const SonnetOsi *osi);
+/// Fast.
+SONNET_API double SonnetOsi_getObjValue(const SonnetOsi *osi);
+
+/// Set the names of the columns first, .., first + count - 1, from the packed names.
+SONNET_API int SonnetOsi_setColNames(SonnetOsi *osi, int first, int count, const char *names);
+/// Set the names of the rows first, .., first + count - 1, from the packed names.
+SONNET_API int SonnetOsi_setRowNames(SonnetOsi *osi, int first, int count, const char *names);
+SONNET_API int SonnetOsi_setObjName(SonnetOsi *osi, const char *name);
+/// Get the packed names of all columns.
+SONNET_API int SonnetOsi_getColNames(const SonnetOsi *osi, char *buffer, int capacity);
+/// Get the packed names of all rows.
+SONNET_API int SonnetOsi_getRowNames(const SonnetOsi *osi, char *buffer, int capacity);
+SONNET_API int SonnetOsi_getObjName(const SonnetOsi *osi, char *buffer, int capacity);
+
+/// Get the column-ordered matrix. Returns the number of elements, and only fills the arrays if
+/// starts has at least getNumCols() + 1 entries and indices and values at least the number of elements.
+SONNET_API int SonnetOsi_getMatrixByCol(const SonnetOsi *osi, int *starts, int startsLength, int *indices, double *values, int elementsLength);
+/// Get the row-ordered matrix, as SonnetOsi_getMatrixByCol.
+SONNET_API int SonnetOsi_getMatrixByRow(const SonnetOsi *osi, int *starts, int startsLength, int *indices, double *values, int elementsLength);
+
+/// Set an OsiIntParam. Returns 1 if the parameter was accepted, 0 if not, or SONNET_ERROR.
+SONNET_API int SonnetOsi_setIntParam(SonnetOsi *osi, int key, int value);
+SONNET_API int SonnetOsi_getIntParam(const SonnetOsi *osi, int key, int *value);
+/// Set an OsiDblParam. Returns 1 if the parameter was accepted, 0 if not, or SONNET_ERROR.
+SONNET_API int SonnetOsi_setDblParam(SonnetOsi *osi, int key, double value);
+SONNET_API int SonnetOsi_getDblParam(const SonnetOsi *osi, int key, double *value);
+/// Set an OsiHintParam with an OsiHintStrength. Returns 1 if the hint was accepted, 0 if not, or SONNET_ERROR.
+SONNET_API int SonnetOsi_setHintParam(SonnetOsi *osi, int key, int yesNo, int strength);
+SONNET_API int SonnetOsi_getHintParam(const SonnetOsi *osi, int key, int *yesNo, int *strength);
+/// Set an OsiStrParam. Returns 1 if the parameter was accepted, 0 if not, or SONNET_ERROR.
+SONNET_API int SonnetOsi_setStrParam(SonnetOsi *osi, int key, const char *value);
+/// Get an OsiStrParam, packed as a single name. Returns the number of bytes needed, or SONNET_ERROR.
+SONNET_API int SonnetOsi_getStrParam(const SonnetOsi *osi, int key, char *buffer, int capacity);
+
+SONNET_API int SonnetOsi_initialSolve(SonnetOsi *osi);
+SONNET_API int SonnetOsi_resolve(SonnetOsi *osi);
+SONNET_API int SonnetOsi_branchAndBound(SonnetOsi *osi);
+SONNET_API int SonnetOsi_markHotStart(SonnetOsi *osi);
+SONNET_API int SonnetOsi_solveFromHotStart(SonnetOsi *osi);
+SONNET_API int SonnetOsi_unmarkHotStart(SonnetOsi *osi);
+
+/// Fast.
+SONNET_API int SonnetOsi_isAbandoned(const SonnetOsi *osi);
+/// Fast.
+SONNET_API int SonnetOsi_isProvenOptimal(const SonnetOsi *osi);
+/// Fast.
+SONNET_API int SonnetOsi_isProvenPrimalInfeasible(const SonnetOsi *osi);
+/// Fast.
+SONNET_API int SonnetOsi_isProvenDualInfeasible(const SonnetOsi *osi);
+/// Fast.
+SONNET_API int SonnetOsi_isPrimalObjectiveLimitReached(const SonnetOsi *osi);
+/// Fast.
+SONNET_API int SonnetOsi_isDualObjectiveLimitReached(const SonnetOsi *osi);
+/// Fast.
+SONNET_API int SonnetOsi_isIterationLimitReached(const SonnetOsi *osi);
+/// Fast.
+SONNET_API int SonnetOsi_getIterationCount(const SonnetOsi *osi);
+
+/// Get the basis status of all columns and rows (0 free, 1 basic, 2 at upper, 3 at lower), as warm start.
+SONNET_API int SonnetOsi_getBasisStatus(const SonnetOsi *osi, int *columnStatus, int *rowStatus);
+/// Set the basis status of all columns and rows. Returns 0 if the basis was accepted, as OsiSolverInterface::setBasisStatus.
+SONNET_API int SonnetOsi_setBasisStatus(SonnetOsi *osi, const int *columnStatus, const int *rowStatus);
+/// Create a copy of the warm start (basis) of the solver, or return null on error.
+SONNET_API SonnetWarmStart *SonnetOsi_getWarmStart(const SonnetOsi *osi);
+/// Create an empty warm start of the type of the solver, or return null on error.
+SONNET_API SonnetWarmStart *SonnetOsi_getEmptyWarmStart(const SonnetOsi *osi);
+/// Set the warm start of the solver (a copy is kept). Returns 1 if the warm start was accepted, 0 if not, or SONNET_ERROR.
+SONNET_API int SonnetOsi_setWarmStart(SonnetOsi *osi, const SonnetWarmStart *warmStart);
+SONNET_API void SonnetWarmStart_delete(SonnetWarmStart *warmStart);
+
+/// Save the bounds and rows of the LP solver, to be restored by SonnetOsi_restoreBaseModel, as before a branch and bound.
+SONNET_API int SonnetOsi_saveBaseModel(SonnetOsi *osi);
+/// Restore the saved problem, keeping the first numberRows rows.
+SONNET_API int SonnetOsi_restoreBaseModel(SonnetOsi *osi, int numberRows);
+/// Save the current solver of the model of an OsiCbcSolverInterface as its reference solver, as before a branch and bound.
+SONNET_API int SonnetOsi_saveCbcReferenceSolver(SonnetOsi *osi);
+/** Reset the model of an OsiCbcSolverInterface to its reference solver, as the OsiCbcSolverInterface of SonnetWrapper.
+	Returns a new OsiCbcSolverInterface with a copy of the reference solver, and the message handler of the given one,
+	which is deleted; or returns null on error, and the given solver is kept. */
+SONNET_API SonnetOsi *SonnetOsi_resetCbcToReferenceSolver(SonnetOsi *osi);
+
+/// Read an mps file into the solver. Returns the number of errors (0 is success), or SONNET_ERROR.
+SONNET_API int SonnetOsi_readMps(SonnetOsi *osi, const char *fileName, const char *extension);
+/// Write the problem to an mps file. objSense -1 writes a maximisation as minimisation, 0 as is.
+SONNET_API int SonnetOsi_writeMps(const SonnetOsi *osi, const char *fileName, const char *extension, double objSense);
+/// Write the problem to an lp file, with the names of the columns and rows. objSense as SonnetOsi_writeMps.
+SONNET_API int SonnetOsi_writeLp(const SonnetOsi *osi, const char *fileName, const char *extension, double objSense);
+
+/// Pass in the handler (not null), which must outlive the solver or be replaced.
+SONNET_API int SonnetOsi_passInMessageHandler(SonnetOsi *osi, SonnetMessageHandler *handler);
+/// Set the log level of the current message handler of the solver.
+SONNET_API int SonnetOsi_setLogLevel(SonnetOsi *osi, int level);
+
+// ---------------------------------------------------------------------------------------------------------------
+// ClpSimplex
+
+SONNET_API SonnetClp *SonnetClp_new(void);
+SONNET_API void SonnetClp_delete(SonnetClp *clp);
+/// Read an mps file. Returns the number of errors (0 is success), or SONNET_ERROR.
+SONNET_API int SonnetClp_readMps(SonnetClp *clp, const char *fileName, int keepNames, int ignoreErrors);
+SONNET_API int SonnetClp_writeMps(const SonnetClp *clp, const char *fileName, int formatType, int numberAcross, double objSense);
+SONNET_API int SonnetClp_loadProblem(SonnetClp *clp, int numberColumns, int numberRows, const int *starts, const int *indices, const double *values,
+	const double *columnLower, const double *columnUpper, const double *objective, const double *rowLower, const double *rowUpper);
+/** Load the quadratic part of the objective, given column-ordered: starts has numberColumns + 1 entries, and only the upper half
+	of the symmetric matrix is given, with the diagonal elements doubled (as ClpModel::loadQuadraticObjective). */
+SONNET_API int SonnetClp_loadQuadraticObjective(SonnetClp *clp, int numberColumns, const int *starts, const int *columns, const double *elements);
+/// Set the element of the given row and column of the matrix (0 removes it).
+SONNET_API int SonnetClp_modifyCoefficient(SonnetClp *clp, int row, int column, double element);
+
+/// Solve with the primal simplex. Returns the return code of Clp, or SONNET_ERROR.
+SONNET_API int SonnetClp_primal(SonnetClp *clp, int ifValuesPass);
+/// Solve with the dual simplex. Returns the return code of Clp, or SONNET_ERROR.
+SONNET_API int SonnetClp_dual(SonnetClp *clp, int ifValuesPass);
+/// Solve with the default strategy of Clp. Returns the return code of Clp, or SONNET_ERROR.
+SONNET_API int SonnetClp_initialSolve(SonnetClp *clp);
+
+/** Dual ranging of the count given variables (sequence numbers, the rows from numberColumns) of an optimal basis,
+	as ClpSimplex::dualRanging: each of the four arrays has count entries. Returns the return code of Clp, or SONNET_ERROR. */
+SONNET_API int SonnetClp_dualRanging(SonnetClp *clp, int count, const int *which, double *costIncrease, int *sequenceIncrease,
+	double *costDecrease, int *sequenceDecrease);
+/// Primal ranging of the count given variables, as ClpSimplex::primalRanging and SonnetClp_dualRanging.
+SONNET_API int SonnetClp_primalRanging(SonnetClp *clp, int count, const int *which, double *valueIncrease, int *sequenceIncrease,
+	double *valueDecrease, int *sequenceDecrease);
+
+/// The problem status: 0 optimal, 1 primal infeasible, 2 dual infeasible, 3 stopped on iterations or time, 4 stopped due to errors. Fast.
+SONNET_API int SonnetClp_status(const SonnetClp *clp);
+/// Fast.
+SONNET_API int SonnetClp_secondaryStatus(const SonnetClp *clp);
+/// Fast.
+SONNET_API int SonnetClp_numberIterations(const SonnetClp *clp);
+/// Fast.
+SONNET_API double SonnetClp_objectiveValue(const SonnetClp *clp);
+/// Fast.
+SONNET_API int SonnetClp_getNumCols(const SonnetClp *clp);
+/// Fast.
+SONNET_API int SonnetClp_getNumRows(const SonnetClp *clp);
+
+/// 1 to minimise, -1 to maximise.
+SONNET_API int SonnetClp_setOptimizationDirection(SonnetClp *clp, double direction);
+SONNET_API int SonnetClp_setMaximumIterations(SonnetClp *clp, int value);
+SONNET_API int SonnetClp_setMaximumSeconds(SonnetClp *clp, double value);
+SONNET_API int SonnetClp_setPrimalTolerance(SonnetClp *clp, double value);
+SONNET_API int SonnetClp_setDualTolerance(SonnetClp *clp, double value);
+/// Set the scaling mode: 0 off, 1 equilibrium, 2 geometric, 3 auto, 4 auto-but-as-initialSolve-in-bab.
+SONNET_API int SonnetClp_scaling(SonnetClp *clp, int mode);
+SONNET_API int SonnetClp_setLogLevel(SonnetClp *clp, int level);
+SONNET_API int SonnetClp_passInMessageHandler(SonnetClp *clp, SonnetMessageHandler *handler);
+
+SONNET_API int SonnetClp_getColLower(const SonnetClp *clp, double *values, int length);
+SONNET_API int SonnetClp_getColUpper(const SonnetClp *clp, double *values, int length);
+SONNET_API int SonnetClp_getObjCoefficients(const SonnetClp *clp, double *values, int length);
+SONNET_API int SonnetClp_getRowLower(const SonnetClp *clp, double *values, int length);
+SONNET_API int SonnetClp_getRowUpper(const SonnetClp *clp, double *values, int length);
+SONNET_API int SonnetClp_getColSolution(const SonnetClp *clp, double *values, int length);
+SONNET_API int SonnetClp_getRowActivity(const SonnetClp *clp, double *values, int length);
+SONNET_API int SonnetClp_getReducedCost(const SonnetClp *clp, double *values, int length);
+SONNET_API int SonnetClp_getRowPrice(const SonnetClp *clp, double *values, int length);
+
+// ---------------------------------------------------------------------------------------------------------------
+// CbcModel
+
+/// Create a new model with a copy of the given solver (as CbcModel(const OsiSolverInterface &)), or return null on error.
+SONNET_API SonnetCbc *SonnetCbc_new(const SonnetOsi *solver);
+SONNET_API void SonnetCbc_delete(SonnetCbc *cbc);
+/// Returns the borrowed current solver of the model.
+SONNET_API SonnetOsi *SonnetCbc_solver(SonnetCbc *cbc);
+
+SONNET_API int SonnetCbc_branchAndBound(SonnetCbc *cbc);
+/** Solve with CbcMain0 and CbcMain1, as the cbc executable, with the given arguments (like "-log", "0", "-solve", "-quit").
+	A timeLimit other than 0 sets the time limit of the parameters. Returns the return code of CbcMain1, or SONNET_ERROR. */
+SONNET_API int SonnetCbc_main(SonnetCbc *cbc, int argc, const char **argv, double timeLimit);
+
+SONNET_API int SonnetCbc_setMaximumNodes(SonnetCbc *cbc, int value);
+SONNET_API int SonnetCbc_setMaximumSeconds(SonnetCbc *cbc, double value);
+SONNET_API int SonnetCbc_setMaximumSolutions(SonnetCbc *cbc, int value);
+SONNET_API int SonnetCbc_setAllowableGap(SonnetCbc *cbc, double value);
+SONNET_API int SonnetCbc_setAllowableFractionGap(SonnetCbc *cbc, double value);
+SONNET_API int SonnetCbc_setNumberThreads(SonnetCbc *cbc, int value);
+SONNET_API int SonnetCbc_setLogLevel(SonnetCbc *cbc, int level);
+/// Set the best solution (of length columns) with its objective value, as a MIP start. If check is 1, the solution is checked first.
+SONNET_API int SonnetCbc_setBestSolution(SonnetCbc *cbc, const double *solution, int length, double objectiveValue, int check);
+/// Remove the strategy of the model if it is the default strategy (CbcStrategyDefault), as set by OsiCbcSolverInterface, such that
+/// SonnetCbc_main solves as the cbc executable. Returns 1 if the strategy was removed, or 0.
+SONNET_API int SonnetCbc_clearDefaultStrategy(SonnetCbc *cbc);
+
+/// The status: -1 before branchAndBound, 0 finished, 1 stopped on a limit, 2 difficulties, 5 stopped by an event. Fast.
+SONNET_API int SonnetCbc_status(const SonnetCbc *cbc);
+/// Fast.
+SONNET_API int SonnetCbc_secondaryStatus(const SonnetCbc *cbc);
+SONNET_API int SonnetCbc_isProvenOptimal(const SonnetCbc *cbc);
+SONNET_API int SonnetCbc_isProvenInfeasible(const SonnetCbc *cbc);
+SONNET_API int SonnetCbc_isNodeLimitReached(const SonnetCbc *cbc);
+SONNET_API int SonnetCbc_isSecondsLimitReached(const SonnetCbc *cbc);
+SONNET_API int SonnetCbc_isSolutionLimitReached(const SonnetCbc *cbc);
+/// Fast.
+SONNET_API int SonnetCbc_getNodeCount(const SonnetCbc *cbc);
+/// Fast.
+SONNET_API int SonnetCbc_getIterationCount(const SonnetCbc *cbc);
+/// Fast.
+SONNET_API int SonnetCbc_getSolutionCount(const SonnetCbc *cbc);
+/// Fast.
+SONNET_API double SonnetCbc_getObjValue(const SonnetCbc *cbc);
+/// Fast.
+SONNET_API double SonnetCbc_getBestPossibleObjValue(const SonnetCbc *cbc);
+/// Get the best solution found. Returns the number of columns, or 0 if there is no solution.
+SONNET_API int SonnetCbc_bestSolution(const SonnetCbc *cbc, double *values, int length);
+
+/// Pass in (a copy of) the handler. The context of the handler must stay valid while the model can raise events.
+SONNET_API int SonnetCbc_passInEventHandler(SonnetCbc *cbc, const SonnetEventHandler *handler);
+SONNET_API int SonnetCbc_passInMessageHandler(SonnetCbc *cbc, SonnetMessageHandler *handler);
+
+// ---------------------------------------------------------------------------------------------------------------
+// CoinMpsIO and CoinLpIO
+
+SONNET_API SonnetMpsIO *SonnetMpsIO_new(void);
+SONNET_API void SonnetMpsIO_delete(SonnetMpsIO *mps);
+/// Read an mps file. Returns the number of errors (0 is success), or SONNET_ERROR.
+SONNET_API int SonnetMpsIO_readMps(SonnetMpsIO *mps, const char *fileName, const char *extension);
+SONNET_API int SonnetMpsIO_passInMessageHandler(SonnetMpsIO *mps, SonnetMessageHandler *handler);
+/// Fast.
+SONNET_API int SonnetMpsIO_getNumCols(const SonnetMpsIO *mps);
+/// Fast.
+SONNET_API int SonnetMpsIO_getNumRows(const SonnetMpsIO *mps);
+SONNET_API int SonnetMpsIO_getNumElements(const SonnetMpsIO *mps);
+SONNET_API double SonnetMpsIO_objectiveOffset(const SonnetMpsIO *mps);
+SONNET_API int SonnetMpsIO_getMatrixByCol(const SonnetMpsIO *mps, int *starts, int startsLength, int *indices, double *values, int elementsLength);
+SONNET_API int SonnetMpsIO_getColLower(const SonnetMpsIO *mps, double *values, int length);
+SONNET_API int SonnetMpsIO_getColUpper(const SonnetMpsIO *mps, double *values, int length);
+SONNET_API int SonnetMpsIO_getObjCoefficients(const SonnetMpsIO *mps, double *values, int length);
+SONNET_API int SonnetMpsIO_getRowLower(const SonnetMpsIO *mps, double *values, int length);
+SONNET_API int SonnetMpsIO_getRowUpper(const SonnetMpsIO *mps, double *values, int length);
+SONNET_API int SonnetMpsIO_getIntegerColumns(const SonnetMpsIO *mps, unsigned char *values, int length);
+SONNET_API int SonnetMpsIO_getColNames(const SonnetMpsIO *mps, char *buffer, int capacity);
+SONNET_API int SonnetMpsIO_getRowNames(const SonnetMpsIO *mps, char *buffer, int capacity);
+SONNET_API int SonnetMpsIO_getProblemName(const SonnetMpsIO *mps, char *buffer, int capacity);
+SONNET_API int SonnetMpsIO_getObjectiveName(const SonnetMpsIO *mps, char *buffer, int capacity);
+
+SONNET_API SonnetLpIO *SonnetLpIO_new(void);
+SONNET_API void SonnetLpIO_delete(SonnetLpIO *lp);
+SONNET_API int SonnetLpIO_readLp(SonnetLpIO *lp, const char *fileName);
+SONNET_API int SonnetLpIO_passInMessageHandler(SonnetLpIO *lp, SonnetMessageHandler *handler);
+/// Fast.
+SONNET_API int SonnetLpIO_getNumCols(const SonnetLpIO *lp);
+/// Fast.
+SONNET_API int SonnetLpIO_getNumRows(const SonnetLpIO *lp);
+SONNET_API int SonnetLpIO_getNumElements(const SonnetLpIO *lp);
+SONNET_API double SonnetLpIO_objectiveOffset(const SonnetLpIO *lp);
+SONNET_API int SonnetLpIO_getMatrixByCol(const SonnetLpIO *lp, int *starts, int startsLength, int *indices, double *values, int elementsLength);
+SONNET_API int SonnetLpIO_getColLower(const SonnetLpIO *lp, double *values, int length);
+SONNET_API int SonnetLpIO_getColUpper(const SonnetLpIO *lp, double *values, int length);
+SONNET_API int SonnetLpIO_getObjCoefficients(const SonnetLpIO *lp, double *values, int length);
+SONNET_API int SonnetLpIO_getRowLower(const SonnetLpIO *lp, double *values, int length);
+SONNET_API int SonnetLpIO_getRowUpper(const SonnetLpIO *lp, double *values, int length);
+SONNET_API int SonnetLpIO_getIntegerColumns(const SonnetLpIO *lp, unsigned char *values, int length);
+SONNET_API int SonnetLpIO_getColNames(const SonnetLpIO *lp, char *buffer, int capacity);
+SONNET_API int SonnetLpIO_getRowNames(const SonnetLpIO *lp, char *buffer, int capacity);
+SONNET_API int SonnetLpIO_getProblemName(const SonnetLpIO *lp, char *buffer, int capacity);
+SONNET_API int SonnetLpIO_getObjectiveName(const SonnetLpIO *lp, char *buffer, int capacity);
+
+// ---------------------------------------------------------------------------------------------------------------
+// Message and event handlers
+
+/** Create a message handler that calls print with the context for every printed message, or return null on error.
+	Copies of the handler (as made by some solvers) call the same function with the same context. */
+SONNET_API SonnetMessageHandler *SonnetMessageHandler_new(SonnetPrintCallback print, void *context);
+SONNET_API void SonnetMessageHandler_delete(SonnetMessageHandler *handler);
+SONNET_API int SonnetMessageHandler_setLogLevel(SonnetMessageHandler *handler, int level);
+/// Fast.
+SONNET_API int SonnetMessageHandler_logLevel(const SonnetMessageHandler *handler);
+/** Print the text as a message of the handler, if its detail is at most the log level, as a CoinOneMessage with the given
+	external number (which gives the severity, see CoinOneMessage) and source of at most 4 characters. */
+SONNET_API int SonnetMessageHandler_message(SonnetMessageHandler *handler, int externalNumber, int detail, const char *source, const char *text);
+
+/// Create an event handler that calls event with the context for every event of Cbc, or return null on error.
+SONNET_API SonnetEventHandler *SonnetEventHandler_new(SonnetEventCallback event, void *context);
+SONNET_API void SonnetEventHandler_delete(SonnetEventHandler *handler);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,178 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "SonnetNativeImpl.hpp"
+
+#include <CbcSolver.hpp>
+#include <CbcParamUtils.hpp>
+#include <CbcStrategy.hpp>
+
+using namespace SonnetNative;
+
+// The callback of CbcMain1. Progress is available via SonnetCbc_passInEventHandler instead.
+static int NativeCallBack(CbcModel *, int)
+{
+	return 0;
+}
+
+extern "C" {
+
+SonnetCbc *SonnetCbc_new(const SonnetOsi *solver)
+{
+	return guard<SonnetCbc *>(nullptr, [&]() {
+		checkHandle(solver, "SonnetCbc_new");
+		return handle(new CbcModel(*osi(solver)));
+	});
+}
+
+void SonnetCbc_delete(SonnetCbc *model)
+{
+	delete cbc(model);
+}
+
+SonnetOsi *SonnetCbc_solver(SonnetCbc *model)
+{
+	return handle(cbc(model)->solver());
+}
+
+int SonnetCbc_branchAndBound(SonnetCbc *model)
+{
+	return guard([&]() {
+		cbc(model)->branchAndBound();
+		return SONNET_OK;
+	});
+}
+
+int SonnetCbc_main(SonnetCbc *model, int argc, const char **argv, double timeLimit)
+{
+	return guard([&]() {
+		// As CbcSolver.CbcMain of SonnetWrapper
+		CbcParameters cbcData;
+		if (timeLimit != 0.0) cbcData[CbcParam::TIMELIMIT]->setDblVal(timeLimit);
+
+		cbcData.enablePrinting();
+		::CbcMain0(*cbc(model), cbcData);
+		return ::CbcMain1(argc, argv, *cbc(model), NativeCallBack, cbcData);
+	});
+}
+
+int SonnetCbc_setMaximumNodes(SonnetCbc *model, int value)
+{
+	return guard([&]() { return cbc(model)->setMaximumNodes(value) ? 1 : 0; });
+}
+
+int SonnetCbc_setMaximumSeconds(SonnetCbc *model, double value)
+{
+	return guard([&]() { return cbc(model)->setMaximumSeconds(value) ? 1 : 0; });
+}
+
+int SonnetCbc_setMaximumSolutions(SonnetCbc *model, int value)
+{
+	return guard([&]() { return cbc(model)->setMaximumSolutions(value) ? 1 : 0; });
+}
+
+int SonnetCbc_setAllowableGap(SonnetCbc *model, double value)
+{
+	return guard([&]() { return cbc(model)->setAllowableGap(value) ? 1 : 0; });
+}
+
+int SonnetCbc_setAllowableFractionGap(SonnetCbc *model, double value)
+{
+	return guard([&]() { return cbc(model)->setAllowableFractionGap(value) ? 1 : 0; });
+}
+
+int SonnetCbc_setNumberThreads(SonnetCbc *model, int value)
+{
+	return guard([&]() {
+		cbc(model)->setNumberThreads(value);
+		return SONNET_OK;
+	});
+}
+
+int SonnetCbc_setLogLevel(SonnetCbc *model, int level)
+{
+	return guard([&]() {
+		cbc(model)->setLogLevel(level);
+		return SONNET_OK;
+	});
+}
+
+int SonnetCbc_setBestSolution(SonnetCbc *model, const double *solution, int length, double objectiveValue, int check)
+{
+	return guard([&]() {
+		if (length != cbc(model)->getNumCols()) throw std::invalid_argument("Length of solution differs from the number of columns in SonnetCbc_setBestSolution");
+		cbc(model)->setBestSolution(solution, length, objectiveValue, check != 0);
+		return SONNET_OK;
+	});
+}
+
+int SonnetCbc_clearDefaultStrategy(SonnetCbc *model)
+{
+	return guard([&]() {
+		CbcStrategy *strategy = cbc(model)->strategy();
+		if (dynamic_cast<CbcStrategyDefault *>(strategy) == nullptr) return 0;
+
+		// The model owns its strategy
+		delete strategy;
+		cbc(model)->setStrategy(nullptr);
+		return 1;
+	});
+}
+
+int SonnetCbc_status(const SonnetCbc *model) { return cbc(model)->status(); }
+int SonnetCbc_secondaryStatus(const SonnetCbc *model) { return cbc(model)->secondaryStatus(); }
+
+int SonnetCbc_isProvenOptimal(const SonnetCbc *model)
+{
+	return guard([&]() { return cbc(model)->isProvenOptimal() ? 1 : 0; });
+}
+
+int SonnetCbc_isProvenInfeasible(const SonnetCbc *model)
+{
+	return guard([&]() { return cbc(model)->isProvenInfeasible() ? 1 : 0; });
+}
+
+int SonnetCbc_isNodeLimitReached(const SonnetCbc *model)
+{
+	return guard([&]() { return cbc(model)->isNodeLimitReached() ? 1 : 0; });
+}
+
+int SonnetCbc_isSecondsLimitReached(const SonnetCbc *model)
+{
+	return guard([&]() { return cbc(model)->isSecondsLimitReached() ? 1 : 0; });
+}
+
+int SonnetCbc_isSolutionLimitReached(const SonnetCbc *model)
+{
+	return guard([&]() { return cbc(model)->isSolutionLimitReached() ? 1 : 0; });
+}
+
+int SonnetCbc_getNodeCount(const SonnetCbc *model) { return cbc(model)->getNodeCount(); }
+int SonnetCbc_getIterationCount(const SonnetCbc *model) { return cbc(model)->getIterationCount(); }
+int SonnetCbc_getSolutionCount(const SonnetCbc *model) { return cbc(model)->getSolutionCount(); }
+double SonnetCbc_getObjValue(const SonnetCbc *model) { return cbc(model)->getObjValue(); }
+double SonnetCbc_getBestPossibleObjValue(const SonnetCbc *model) { return cbc(model)->getBestPossibleObjValue(); }
+
+int SonnetCbc_bestSolution(const SonnetCbc *model, double *values, int length)
+{
+	return guard([&]() { return copyOut(cbc(model)->bestSolution(), cbc(model)->getNumCols(), values, length); });
+}
+
+int SonnetCbc_passInEventHandler(SonnetCbc *model, const SonnetEventHandler *handler)
+{
+	return guard([&]() {
+		checkHandle(handler, "SonnetCbc_passInEventHandler");
+		cbc(model)->passInEventHandler(reinterpret_cast<const CallbackEventHandler *>(handler));
+		return SONNET_OK;
+	});
+}
+
+int SonnetCbc_passInMessageHandler(SonnetCbc *model, SonnetMessageHandler *handler)
+{
+	return guard([&]() {
+		cbc(model)->passInMessageHandler(messageHandler(handler));
+		return SONNET_OK;
+	});
+}
+
+}
@@ -0,0 +1,201 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "SonnetNativeImpl.hpp"
+
+using namespace SonnetNative;
+
+extern "C" {
+
+SonnetClp *SonnetClp_new(void)
+{
+	return guard<SonnetClp *>(nullptr, []() { return handle(new ClpSimplex()); });
+}
+
+void SonnetClp_delete(SonnetClp *model)
+{
+	delete clp(model);
+}
+
+int SonnetClp_readMps(SonnetClp *model, const char *fileName, int keepNames, int ignoreErrors)
+{
+	return guard([&]() { return clp(model)->readMps(fileName, keepNames != 0, ignoreErrors != 0); });
+}
+
+int SonnetClp_writeMps(const SonnetClp *model, const char *fileName, int formatType, int numberAcross, double objSense)
+{
+	return guard([&]() { return clp(model)->writeMps(fileName, formatType, numberAcross, objSense); });
+}
+
+int SonnetClp_loadProblem(SonnetClp *model, int numberColumns, int numberRows, const int *starts, const int *indices, const double *values,
+	const double *columnLower, const double *columnUpper, const double *objective, const double *rowLower, const double *rowUpper)
+{
+	return guard([&]() {
+		clp(model)->loadProblem(numberColumns, numberRows, starts, indices, values, columnLower, columnUpper, objective, rowLower, rowUpper);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_loadQuadraticObjective(SonnetClp *model, int numberColumns, const int *starts, const int *columns, const double *elements)
+{
+	return guard([&]() {
+		if (numberColumns != clp(model)->getNumCols()) throw std::invalid_argument("Number of columns differs in SonnetClp_loadQuadraticObjective");
+		clp(model)->loadQuadraticObjective(numberColumns, starts, columns, elements);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_modifyCoefficient(SonnetClp *model, int row, int column, double element)
+{
+	return guard([&]() {
+		checkRange(row, 1, clp(model)->getNumRows(), "SonnetClp_modifyCoefficient");
+		checkRange(column, 1, clp(model)->getNumCols(), "SonnetClp_modifyCoefficient");
+		clp(model)->modifyCoefficient(row, column, element);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_primal(SonnetClp *model, int ifValuesPass)
+{
+	return guard([&]() { return clp(model)->primal(ifValuesPass); });
+}
+
+int SonnetClp_dual(SonnetClp *model, int ifValuesPass)
+{
+	return guard([&]() { return clp(model)->dual(ifValuesPass); });
+}
+
+int SonnetClp_initialSolve(SonnetClp *model)
+{
+	return guard([&]() { return clp(model)->initialSolve(); });
+}
+
+int SonnetClp_dualRanging(SonnetClp *model, int count, const int *which, double *costIncrease, int *sequenceIncrease,
+	double *costDecrease, int *sequenceDecrease)
+{
+	return guard([&]() { return clp(model)->dualRanging(count, which, costIncrease, sequenceIncrease, costDecrease, sequenceDecrease); });
+}
+
+int SonnetClp_primalRanging(SonnetClp *model, int count, const int *which, double *valueIncrease, int *sequenceIncrease,
+	double *valueDecrease, int *sequenceDecrease)
+{
+	return guard([&]() { return clp(model)->primalRanging(count, which, valueIncrease, sequenceIncrease, valueDecrease, sequenceDecrease); });
+}
+
+int SonnetClp_status(const SonnetClp *model) { return clp(model)->status(); }
+int SonnetClp_secondaryStatus(const SonnetClp *model) { return clp(model)->secondaryStatus(); }
+int SonnetClp_numberIterations(const SonnetClp *model) { return clp(model)->numberIterations(); }
+double SonnetClp_objectiveValue(const SonnetClp *model) { return clp(model)->objectiveValue(); }
+int SonnetClp_getNumCols(const SonnetClp *model) { return clp(model)->getNumCols(); }
+int SonnetClp_getNumRows(const SonnetClp *model) { return clp(model)->getNumRows(); }
+
+int SonnetClp_setOptimizationDirection(SonnetClp *model, double direction)
+{
+	return guard([&]() {
+		clp(model)->setOptimizationDirection(direction);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_setMaximumIterations(SonnetClp *model, int value)
+{
+	return guard([&]() {
+		clp(model)->setMaximumIterations(value);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_setMaximumSeconds(SonnetClp *model, double value)
+{
+	return guard([&]() {
+		clp(model)->setMaximumSeconds(value);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_setPrimalTolerance(SonnetClp *model, double value)
+{
+	return guard([&]() {
+		clp(model)->setPrimalTolerance(value);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_setDualTolerance(SonnetClp *model, double value)
+{
+	return guard([&]() {
+		clp(model)->setDualTolerance(value);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_scaling(SonnetClp *model, int mode)
+{
+	return guard([&]() {
+		clp(model)->scaling(mode);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_setLogLevel(SonnetClp *model, int level)
+{
+	return guard([&]() {
+		clp(model)->setLogLevel(level);
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_passInMessageHandler(SonnetClp *model, SonnetMessageHandler *handler)
+{
+	return guard([&]() {
+		clp(model)->passInMessageHandler(messageHandler(handler));
+		return SONNET_OK;
+	});
+}
+
+int SonnetClp_getColLower(const SonnetClp *model, double *values, int length)
+{
+	return guard([&]() { return copyOut<double>(clp(model)->columnLower(), clp(model)->getNumCols(), values, length); });
+}
+
+int SonnetClp_getColUpper(const SonnetClp *model, double *values, int length)
+{
+	return guard([&]() { return copyOut<double>(clp(model)->columnUpper(), clp(model)->getNumCols(), values, length); });
+}
+
+int SonnetClp_getObjCoefficients(const SonnetClp *model, double *values, int length)
+{
+	return guard([&]() { return copyOut<double>(clp(model)->objective(), clp(model)->getNumCols(), values, length); });
+}
+
+int SonnetClp_getRowLower(const SonnetClp *model, double *values, int length)
+{
+	return guard([&]() { return copyOut<double>(clp(model)->rowLower(), clp(model)->getNumRows(), values, length); });
+}
+
+int SonnetClp_getRowUpper(const SonnetClp *model, double *values, int length)
+{
+	return guard([&]() { return copyOut<double>(clp(model)->rowUpper(), clp(model)->getNumRows(), values, length); });
+}
+
+int SonnetClp_getColSolution(const SonnetClp *model, double *values, int length)
+{
+	return guard([&]() { return copyOut<double>(clp(model)->primalColumnSolution(), clp(model)->getNumCols(), values, length); });
+}
+
+int SonnetClp_getRowActivity(const SonnetClp *model, double *values, int length)
+{
+	return guard([&]() { return copyOut<double>(clp(model)->primalRowSolution(), clp(model)->getNumRows(), values, length); });
+}
+
+int SonnetClp_getReducedCost(const SonnetClp *model, double *values, int length)
+{
+	return guard([&]() { return copyOut<double>(clp(model)->dualColumnSolution(), clp(model)->getNumCols(), values, length); });
+}
+
+int SonnetClp_getRowPrice(const SonnetClp *model, double *values, int length)
+{
+	return guard([&]() { return copyOut<double>(clp(model)->dualRowSolution(), clp(model)->getNumRows(), values, length); });
+}
+
+}
@@ -0,0 +1,77 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "SonnetNativeImpl.hpp"
+
+using namespace SonnetNative;
+
+int CallbackMessageHandler::print()
+{
+	if (print_ == nullptr) return 0;
+
+	const CoinOneMessage &message = currentMessage();
+	return print_(context_, message.externalNumber(), message.detail(), currentSource().c_str(), messageBuffer());
+}
+
+CbcEventHandler::CbcAction CallbackEventHandler::event(CbcEvent whichEvent)
+{
+	if (event_ == nullptr) return noAction;
+
+	// model_ is likely a copy of the original model, used by Cbc for a (thread) sub problem.
+	return static_cast<CbcAction>(event_(context_, handle(model_), static_cast<int>(whichEvent)));
+}
+
+extern "C" {
+
+SonnetMessageHandler *SonnetMessageHandler_new(SonnetPrintCallback print, void *context)
+{
+	return guard<SonnetMessageHandler *>(nullptr, [&]() {
+		return reinterpret_cast<SonnetMessageHandler *>(new CallbackMessageHandler(print, context));
+	});
+}
+
+void SonnetMessageHandler_delete(SonnetMessageHandler *handler)
+{
+	delete reinterpret_cast<CallbackMessageHandler *>(handler);
+}
+
+int SonnetMessageHandler_setLogLevel(SonnetMessageHandler *handler, int level)
+{
+	return guard([&]() {
+		messageHandler(handler)->setLogLevel(level);
+		return SONNET_OK;
+	});
+}
+
+int SonnetMessageHandler_logLevel(const SonnetMessageHandler *handler)
+{
+	return reinterpret_cast<const CallbackMessageHandler *>(handler)->logLevel();
+}
+
+int SonnetMessageHandler_message(SonnetMessageHandler *handler, int externalNumber, int detail, const char *source, const char *text)
+{
+	return guard([&]() {
+		// As SonnetMessages of Sonnet: a single message "%s", such that the handler applies its log level and prefix
+		CoinMessages messages(1);
+		std::strncpy(messages.source_, source != nullptr ? source : "", 4);
+		messages.source_[4] = '\0';
+		messages.addMessage(0, CoinOneMessage(externalNumber, static_cast<char>(detail), "%s"));
+
+		messageHandler(handler)->message(0, messages) << (text != nullptr ? text : "") << CoinMessageEol;
+		return SONNET_OK;
+	});
+}
+
+SonnetEventHandler *SonnetEventHandler_new(SonnetEventCallback event, void *context)
+{
+	return guard<SonnetEventHandler *>(nullptr, [&]() {
+		return reinterpret_cast<SonnetEventHandler *>(new CallbackEventHandler(event, context));
+	});
+}
+
+void SonnetEventHandler_delete(SonnetEventHandler *handler)
+{
+	delete reinterpret_cast<CallbackEventHandler *>(handler);
+}
+
+}
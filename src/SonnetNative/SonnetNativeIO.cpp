@@ -0,0 +1,207 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "SonnetNativeImpl.hpp"
+
+using namespace SonnetNative;
+
+namespace
+{
+	// CoinMpsIO and CoinLpIO have the same getters, so both are exposed via these templates
+
+	template <typename IO>
+	int getIntegerColumns(const IO *io, unsigned char *values, int length)
+	{
+		int n = io->getNumCols();
+		if (values != nullptr)
+		{
+			for (int i = 0; i < n && i < length; i++) values[i] = io->isInteger(i) ? 1 : 0;
+		}
+		return n;
+	}
+
+	template <typename IO>
+	int getColNames(const IO *io, char *buffer, int capacity)
+	{
+		return packNames(io->getNumCols(), [io](int i) { return io->columnName(i); }, buffer, capacity);
+	}
+
+	template <typename IO>
+	int getRowNames(const IO *io, char *buffer, int capacity)
+	{
+		return packNames(io->getNumRows(), [io](int i) { return io->rowName(i); }, buffer, capacity);
+	}
+}
+
+extern "C" {
+
+SonnetMpsIO *SonnetMpsIO_new(void)
+{
+	return guard<SonnetMpsIO *>(nullptr, []() { return reinterpret_cast<SonnetMpsIO *>(new CoinMpsIO()); });
+}
+
+void SonnetMpsIO_delete(SonnetMpsIO *io)
+{
+	delete mps(io);
+}
+
+int SonnetMpsIO_readMps(SonnetMpsIO *io, const char *fileName, const char *extension)
+{
+	return guard([&]() { return mps(io)->readMps(fileName, extension != nullptr ? extension : "mps"); });
+}
+
+int SonnetMpsIO_passInMessageHandler(SonnetMpsIO *io, SonnetMessageHandler *handler)
+{
+	return guard([&]() {
+		mps(io)->passInMessageHandler(messageHandler(handler));
+		return SONNET_OK;
+	});
+}
+
+int SonnetMpsIO_getNumCols(const SonnetMpsIO *io) { return mps(io)->getNumCols(); }
+int SonnetMpsIO_getNumRows(const SonnetMpsIO *io) { return mps(io)->getNumRows(); }
+int SonnetMpsIO_getNumElements(const SonnetMpsIO *io) { return static_cast<int>(mps(io)->getNumElements()); }
+double SonnetMpsIO_objectiveOffset(const SonnetMpsIO *io) { return mps(io)->objectiveOffset(); }
+
+int SonnetMpsIO_getMatrixByCol(const SonnetMpsIO *io, int *starts, int startsLength, int *indices, double *values, int elementsLength)
+{
+	return guard([&]() { return copyMatrix(mps(io)->getMatrixByCol(), starts, startsLength, indices, values, elementsLength); });
+}
+
+int SonnetMpsIO_getColLower(const SonnetMpsIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(mps(io)->getColLower(), mps(io)->getNumCols(), values, length); });
+}
+
+int SonnetMpsIO_getColUpper(const SonnetMpsIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(mps(io)->getColUpper(), mps(io)->getNumCols(), values, length); });
+}
+
+int SonnetMpsIO_getObjCoefficients(const SonnetMpsIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(mps(io)->getObjCoefficients(), mps(io)->getNumCols(), values, length); });
+}
+
+int SonnetMpsIO_getRowLower(const SonnetMpsIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(mps(io)->getRowLower(), mps(io)->getNumRows(), values, length); });
+}
+
+int SonnetMpsIO_getRowUpper(const SonnetMpsIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(mps(io)->getRowUpper(), mps(io)->getNumRows(), values, length); });
+}
+
+int SonnetMpsIO_getIntegerColumns(const SonnetMpsIO *io, unsigned char *values, int length)
+{
+	return guard([&]() { return getIntegerColumns(mps(io), values, length); });
+}
+
+int SonnetMpsIO_getColNames(const SonnetMpsIO *io, char *buffer, int capacity)
+{
+	return guard([&]() { return getColNames(mps(io), buffer, capacity); });
+}
+
+int SonnetMpsIO_getRowNames(const SonnetMpsIO *io, char *buffer, int capacity)
+{
+	return guard([&]() { return getRowNames(mps(io), buffer, capacity); });
+}
+
+int SonnetMpsIO_getProblemName(const SonnetMpsIO *io, char *buffer, int capacity)
+{
+	return guard([&]() { return packName(mps(io)->getProblemName(), buffer, capacity); });
+}
+
+int SonnetMpsIO_getObjectiveName(const SonnetMpsIO *io, char *buffer, int capacity)
+{
+	return guard([&]() { return packName(mps(io)->getObjectiveName(), buffer, capacity); });
+}
+
+SonnetLpIO *SonnetLpIO_new(void)
+{
+	return guard<SonnetLpIO *>(nullptr, []() { return reinterpret_cast<SonnetLpIO *>(new CoinLpIO()); });
+}
+
+void SonnetLpIO_delete(SonnetLpIO *io)
+{
+	delete lp(io);
+}
+
+int SonnetLpIO_readLp(SonnetLpIO *io, const char *fileName)
+{
+	return guard([&]() {
+		lp(io)->readLp(fileName);
+		return SONNET_OK;
+	});
+}
+
+int SonnetLpIO_passInMessageHandler(SonnetLpIO *io, SonnetMessageHandler *handler)
+{
+	return guard([&]() {
+		lp(io)->passInMessageHandler(messageHandler(handler));
+		return SONNET_OK;
+	});
+}
+
+int SonnetLpIO_getNumCols(const SonnetLpIO *io) { return lp(io)->getNumCols(); }
+int SonnetLpIO_getNumRows(const SonnetLpIO *io) { return lp(io)->getNumRows(); }
+int SonnetLpIO_getNumElements(const SonnetLpIO *io) { return static_cast<int>(lp(io)->getNumElements()); }
+double SonnetLpIO_objectiveOffset(const SonnetLpIO *io) { return lp(io)->objectiveOffset(); }
+
+int SonnetLpIO_getMatrixByCol(const SonnetLpIO *io, int *starts, int startsLength, int *indices, double *values, int elementsLength)
+{
+	return guard([&]() { return copyMatrix(lp(io)->getMatrixByCol(), starts, startsLength, indices, values, elementsLength); });
+}
+
+int SonnetLpIO_getColLower(const SonnetLpIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(lp(io)->getColLower(), lp(io)->getNumCols(), values, length); });
+}
+
+int SonnetLpIO_getColUpper(const SonnetLpIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(lp(io)->getColUpper(), lp(io)->getNumCols(), values, length); });
+}
+
+int SonnetLpIO_getObjCoefficients(const SonnetLpIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(lp(io)->getObjCoefficients(), lp(io)->getNumCols(), values, length); });
+}
+
+int SonnetLpIO_getRowLower(const SonnetLpIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(lp(io)->getRowLower(), lp(io)->getNumRows(), values, length); });
+}
+
+int SonnetLpIO_getRowUpper(const SonnetLpIO *io, double *values, int length)
+{
+	return guard([&]() { return copyOut(lp(io)->getRowUpper(), lp(io)->getNumRows(), values, length); });
+}
+
+int SonnetLpIO_getIntegerColumns(const SonnetLpIO *io, unsigned char *values, int length)
+{
+	return guard([&]() { return getIntegerColumns(lp(io), values, length); });
+}
+
+int SonnetLpIO_getColNames(const SonnetLpIO *io, char *buffer, int capacity)
+{
+	return guard([&]() { return getColNames(lp(io), buffer, capacity); });
+}
+
+int SonnetLpIO_getRowNames(const SonnetLpIO *io, char *buffer, int capacity)
+{
+	return guard([&]() { return getRowNames(lp(io), buffer, capacity); });
+}
+
+int SonnetLpIO_getProblemName(const SonnetLpIO *io, char *buffer, int capacity)
+{
+	return guard([&]() { return packName(lp(io)->getProblemName(), buffer, capacity); });
+}
+
+int SonnetLpIO_getObjectiveName(const SonnetLpIO *io, char *buffer, int capacity)
+{
+	return guard([&]() { return packName(lp(io)->getObjName(), buffer, capacity); });
+}
+
+}
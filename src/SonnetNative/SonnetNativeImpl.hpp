@@ -0,0 +1,202 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+/** Internals of SonnetNative, shared by its translation units: the guard that turns exceptions into SONNET_ERROR,
+	the conversions between the opaque handles and the COIN-OR classes, the bulk copy helpers, and the callback handlers. */
+
+#include "SonnetNative.h"
+
+#include <CoinError.hpp>
+#include <CoinMessageHandler.hpp>
+#include <CoinPackedMatrix.hpp>
+#include <CoinWarmStart.hpp>
+#include <OsiSolverInterface.hpp>
+#include <CbcEventHandler.hpp>
+#include <CbcModel.hpp>
+#include <ClpSimplex.hpp>
+#include <CoinMpsIO.hpp>
+#include <CoinLpIO.hpp>
+
+#include <cstring>
+#include <exception>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+static_assert(sizeof(CoinBigIndex) == sizeof(int), "SonnetNative passes the matrix starts as int: build COIN-OR with CoinBigIndex int");
+
+/// Native message handler that calls a C function pointer, as CoinMessageHandlerProxy of SonnetWrapper calls managed code.
+class CallbackMessageHandler : public CoinMessageHandler
+{
+public:
+	CallbackMessageHandler(SonnetPrintCallback print, void *context)
+		: print_(print), context_(context)
+	{
+	}
+
+	/// Clones call the same function with the same context
+	CoinMessageHandler *clone() const override
+	{
+		return new CallbackMessageHandler(*this);
+	}
+
+	int print() override;
+
+private:
+	SonnetPrintCallback print_;
+	void *context_;
+};
+
+/// Native Cbc event handler that calls a C function pointer, as CbcDelegateEventHandlerProxy of SonnetWrapper calls a delegate.
+class CallbackEventHandler : public CbcEventHandler
+{
+public:
+	CallbackEventHandler(SonnetEventCallback event, void *context)
+		: event_(event), context_(context)
+	{
+	}
+
+	/// Clones call the same function with the same context. Cbc clones the handler for every (thread) model.
+	CbcEventHandler *clone() const override
+	{
+		return new CallbackEventHandler(*this);
+	}
+
+	CbcAction event(CbcEvent whichEvent) override;
+
+private:
+	SonnetEventCallback event_;
+	void *context_;
+};
+
+namespace SonnetNative
+{
+	/// Set the last error of the calling thread
+	void setLastError(const char *message);
+
+	/** Run f and return its result, or SONNET_ERROR (R is int) or null (R is a pointer) if it throws.
+		No exception passes the C ABI: the message of the exception is kept as the last error of the thread. */
+	template <typename R, typename F>
+	R guard(R error, F f)
+	{
+		try
+		{
+			return f();
+		}
+		catch (const CoinError &err)
+		{
+			// As COIN::CoinError of SonnetWrapper: message, class::method, and the file and line if known
+			std::string message = err.message() + " in " + err.className() + "::" + err.methodName();
+			if (!err.fileName().empty()) message += " (" + err.fileName() + ":" + std::to_string(err.lineNumber()) + ")";
+			setLastError(message.c_str());
+		}
+		catch (const std::exception &err)
+		{
+			setLastError(err.what());
+		}
+		catch (...)
+		{
+			setLastError("Unknown native exception");
+		}
+		return error;
+	}
+
+	template <typename F>
+	int guard(F f)
+	{
+		return guard<int>(SONNET_ERROR, f);
+	}
+
+	/// Throw std::invalid_argument if the handle is null
+	inline void checkHandle(const void *handle, const char *method)
+	{
+		if (handle == nullptr) throw std::invalid_argument(std::string("Null handle passed to ") + method);
+	}
+
+	/// Throw std::out_of_range unless 0 <= first and first + count <= size
+	inline void checkRange(int first, int count, int size, const char *method)
+	{
+		if (first < 0 || count < 0 || first > size - count) throw std::out_of_range(std::string("Index out of range in ") + method);
+	}
+
+	/// Copy min(length, n) values of source into target (if any), and return n, or 0 if there is no source.
+	template <typename T>
+	int copyOut(const T *source, int n, T *target, int length)
+	{
+		if (source == nullptr) return 0;
+		if (target != nullptr && length > 0) std::memcpy(target, source, sizeof(T) * static_cast<size_t>(length < n ? length : n));
+		return n;
+	}
+
+	/** Copy the given matrix without gaps into starts (majorDim + 1), indices and values (the number of elements).
+		Returns the number of elements, and copies only if the arrays are large enough. */
+	int copyMatrix(const CoinPackedMatrix *matrix, int *starts, int startsLength, int *indices, double *values, int elementsLength);
+
+	/// Pack the count names, each terminated by '\0', into buffer if capacity is large enough. Returns the number of bytes needed.
+	template <typename F>
+	int packNames(int count, F name, char *buffer, int capacity)
+	{
+		std::string packed;
+		for (int i = 0; i < count; i++)
+		{
+			const char *value = name(i);
+			packed.append(value != nullptr ? value : "");
+			packed.push_back('\0');
+		}
+
+		int size = static_cast<int>(packed.size());
+		if (buffer != nullptr && capacity >= size) std::memcpy(buffer, packed.data(), packed.size());
+		return size;
+	}
+
+	/// Pack a single name, as packNames
+	inline int packName(const std::string &name, char *buffer, int capacity)
+	{
+		return packNames(1, [&name](int) { return name.c_str(); }, buffer, capacity);
+	}
+
+	/// Call f(i, name) for each of the count packed names
+	template <typename F>
+	void unpackNames(int count, const char *names, F f)
+	{
+		if (count > 0 && names == nullptr) throw std::invalid_argument("Null names");
+		for (int i = 0; i < count; i++)
+		{
+			size_t length = std::strlen(names);
+			f(i, std::string(names, length));
+			names += length + 1;
+		}
+	}
+
+	inline OsiSolverInterface *osi(SonnetOsi *handle) { return reinterpret_cast<OsiSolverInterface *>(handle); }
+	inline const OsiSolverInterface *osi(const SonnetOsi *handle) { return reinterpret_cast<const OsiSolverInterface *>(handle); }
+	inline SonnetOsi *handle(OsiSolverInterface *solver) { return reinterpret_cast<SonnetOsi *>(solver); }
+
+	inline ClpSimplex *clp(SonnetClp *handle) { return reinterpret_cast<ClpSimplex *>(handle); }
+	inline const ClpSimplex *clp(const SonnetClp *handle) { return reinterpret_cast<const ClpSimplex *>(handle); }
+	inline SonnetClp *handle(ClpSimplex *model) { return reinterpret_cast<SonnetClp *>(model); }
+
+	inline CbcModel *cbc(SonnetCbc *handle) { return reinterpret_cast<CbcModel *>(handle); }
+	inline const CbcModel *cbc(const SonnetCbc *handle) { return reinterpret_cast<const CbcModel *>(handle); }
+	inline SonnetCbc *handle(CbcModel *model) { return reinterpret_cast<SonnetCbc *>(model); }
+
+	inline CoinWarmStart *warmStart(SonnetWarmStart *handle) { return reinterpret_cast<CoinWarmStart *>(handle); }
+	inline const CoinWarmStart *warmStart(const SonnetWarmStart *handle) { return reinterpret_cast<const CoinWarmStart *>(handle); }
+	inline SonnetWarmStart *handle(CoinWarmStart *warmStart) { return reinterpret_cast<SonnetWarmStart *>(warmStart); }
+
+	inline CoinMpsIO *mps(SonnetMpsIO *handle) { return reinterpret_cast<CoinMpsIO *>(handle); }
+	inline const CoinMpsIO *mps(const SonnetMpsIO *handle) { return reinterpret_cast<const CoinMpsIO *>(handle); }
+
+	inline CoinLpIO *lp(SonnetLpIO *handle) { return reinterpret_cast<CoinLpIO *>(handle); }
+	inline const CoinLpIO *lp(const SonnetLpIO *handle) { return reinterpret_cast<const CoinLpIO *>(handle); }
+
+	/// The message handler of the handle. Throws if null, since the COIN-OR classes do not accept a null handler.
+	inline CoinMessageHandler *messageHandler(SonnetMessageHandler *handle)
+	{
+		checkHandle(handle, "passInMessageHandler");
+		return reinterpret_cast<CallbackMessageHandler *>(handle);
+	}
+}
@@ -0,0 +1,626 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "SonnetNativeImpl.hpp"
+
+#include <OsiClpSolverInterface.hpp>
+#include <OsiCbcSolverInterface.hpp>
+
+using namespace SonnetNative;
+
+extern "C" {
+
+SonnetOsi *SonnetOsi_newClp(void)
+{
+	return guard<SonnetOsi *>(nullptr, []() { return handle(new OsiClpSolverInterface()); });
+}
+
+SonnetOsi *SonnetOsi_newCbc(void)
+{
+	return guard<SonnetOsi *>(nullptr, []() { return handle(new OsiCbcSolverInterface()); });
+}
+
+SonnetOsi *SonnetOsi_clone(const SonnetOsi *solver)
+{
+	return guard<SonnetOsi *>(nullptr, [&]() { return handle(osi(solver)->clone(true)); });
+}
+
+void SonnetOsi_delete(SonnetOsi *solver)
+{
+	delete osi(solver);
+}
+
+SonnetClp *SonnetOsi_getClpModelPtr(SonnetOsi *solver)
+{
+	OsiClpSolverInterface *clpSolver = dynamic_cast<OsiClpSolverInterface *>(osi(solver));
+	return clpSolver != nullptr ? handle(clpSolver->getModelPtr()) : nullptr;
+}
+
+SonnetCbc *SonnetOsi_getCbcModelPtr(SonnetOsi *solver)
+{
+	OsiCbcSolverInterface *cbcSolver = dynamic_cast<OsiCbcSolverInterface *>(osi(solver));
+	return cbcSolver != nullptr ? handle(cbcSolver->getModelPtr()) : nullptr;
+}
+
+SonnetOsi *SonnetOsi_getRealSolverPtr(SonnetOsi *solver)
+{
+	OsiCbcSolverInterface *cbcSolver = dynamic_cast<OsiCbcSolverInterface *>(osi(solver));
+	return cbcSolver != nullptr ? handle(cbcSolver->getRealSolverPtr()) : nullptr;
+}
+
+int SonnetOsi_loadProblem(SonnetOsi *solver, int numberColumns, int numberRows, const int *starts, const int *indices, const double *values,
+	const double *columnLower, const double *columnUpper, const double *objective, const double *rowLower, const double *rowUpper)
+{
+	return guard([&]() {
+		osi(solver)->loadProblem(numberColumns, numberRows, starts, indices, values, columnLower, columnUpper, objective, rowLower, rowUpper);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_addCols(SonnetOsi *solver, int numberColumns, const int *starts, const int *rows, const double *values,
+	const double *columnLower, const double *columnUpper, const double *objective)
+{
+	return guard([&]() {
+		osi(solver)->addCols(numberColumns, starts, rows, values, columnLower, columnUpper, objective);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_addRows(SonnetOsi *solver, int numberRows, const int *starts, const int *columns, const double *values,
+	const double *rowLower, const double *rowUpper)
+{
+	return guard([&]() {
+		osi(solver)->addRows(numberRows, starts, columns, values, rowLower, rowUpper);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_deleteCols(SonnetOsi *solver, int count, const int *indices)
+{
+	return guard([&]() {
+		osi(solver)->deleteCols(count, indices);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_deleteRows(SonnetOsi *solver, int count, const int *indices)
+{
+	return guard([&]() {
+		osi(solver)->deleteRows(count, indices);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_getNumCols(const SonnetOsi *solver) { return osi(solver)->getNumCols(); }
+int SonnetOsi_getNumRows(const SonnetOsi *solver) { return osi(solver)->getNumRows(); }
+int SonnetOsi_getNumElements(const SonnetOsi *solver) { return static_cast<int>(osi(solver)->getNumElements()); }
+int SonnetOsi_getNumIntegers(const SonnetOsi *solver) { return guard([&]() { return osi(solver)->getNumIntegers(); }); }
+double SonnetOsi_getInfinity(const SonnetOsi *solver) { return osi(solver)->getInfinity(); }
+
+int SonnetOsi_getColLower(const SonnetOsi *solver, double *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getColLower(), osi(solver)->getNumCols(), values, length); });
+}
+
+int SonnetOsi_getColUpper(const SonnetOsi *solver, double *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getColUpper(), osi(solver)->getNumCols(), values, length); });
+}
+
+int SonnetOsi_getObjCoefficients(const SonnetOsi *solver, double *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getObjCoefficients(), osi(solver)->getNumCols(), values, length); });
+}
+
+int SonnetOsi_getRowLower(const SonnetOsi *solver, double *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getRowLower(), osi(solver)->getNumRows(), values, length); });
+}
+
+int SonnetOsi_getRowUpper(const SonnetOsi *solver, double *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getRowUpper(), osi(solver)->getNumRows(), values, length); });
+}
+
+int SonnetOsi_getRowSense(const SonnetOsi *solver, char *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getRowSense(), osi(solver)->getNumRows(), values, length); });
+}
+
+int SonnetOsi_getIntegerColumns(const SonnetOsi *solver, unsigned char *values, int length)
+{
+	return guard([&]() {
+		const OsiSolverInterface *s = osi(solver);
+		int n = s->getNumCols();
+		if (values != nullptr)
+		{
+			for (int i = 0; i < n && i < length; i++) values[i] = s->isInteger(i) ? 1 : 0;
+		}
+		return n;
+	});
+}
+
+int SonnetOsi_isInteger(const SonnetOsi *solver, int index)
+{
+	return guard([&]() {
+		checkRange(index, 1, osi(solver)->getNumCols(), "SonnetOsi_isInteger");
+		return osi(solver)->isInteger(index) ? 1 : 0;
+	});
+}
+
+int SonnetOsi_getColSolution(const SonnetOsi *solver, double *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getColSolution(), osi(solver)->getNumCols(), values, length); });
+}
+
+int SonnetOsi_getRowActivity(const SonnetOsi *solver, double *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getRowActivity(), osi(solver)->getNumRows(), values, length); });
+}
+
+int SonnetOsi_getReducedCost(const SonnetOsi *solver, double *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getReducedCost(), osi(solver)->getNumCols(), values, length); });
+}
+
+int SonnetOsi_getRowPrice(const SonnetOsi *solver, double *values, int length)
+{
+	return guard([&]() { return copyOut(osi(solver)->getRowPrice(), osi(solver)->getNumRows(), values, length); });
+}
+
+const double *SonnetOsi_getColLowerPtr(const SonnetOsi *solver) { return osi(solver)->getColLower(); }
+const double *SonnetOsi_getColUpperPtr(const SonnetOsi *solver) { return osi(solver)->getColUpper(); }
+const double *SonnetOsi_getObjCoefficientsPtr(const SonnetOsi *solver) { return osi(solver)->getObjCoefficients(); }
+const double *SonnetOsi_getRowLowerPtr(const SonnetOsi *solver) { return osi(solver)->getRowLower(); }
+const double *SonnetOsi_getRowUpperPtr(const SonnetOsi *solver) { return osi(solver)->getRowUpper(); }
+const double *SonnetOsi_getColSolutionPtr(const SonnetOsi *solver) { return osi(solver)->getColSolution(); }
+const double *SonnetOsi_getRowActivityPtr(const SonnetOsi *solver) { return osi(solver)->getRowActivity(); }
+const double *SonnetOsi_getReducedCostPtr(const SonnetOsi *solver) { return osi(solver)->getReducedCost(); }
+const double *SonnetOsi_getRowPricePtr(const SonnetOsi *solver) { return osi(solver)->getRowPrice(); }
+
+int SonnetOsi_setColLower(SonnetOsi *solver, int first, int count, const double *values)
+{
+	return guard([&]() {
+		OsiSolverInterface *s = osi(solver);
+		checkRange(first, count, s->getNumCols(), "SonnetOsi_setColLower");
+		for (int i = 0; i < count; i++) s->setColLower(first + i, values[i]);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setColUpper(SonnetOsi *solver, int first, int count, const double *values)
+{
+	return guard([&]() {
+		OsiSolverInterface *s = osi(solver);
+		checkRange(first, count, s->getNumCols(), "SonnetOsi_setColUpper");
+		for (int i = 0; i < count; i++) s->setColUpper(first + i, values[i]);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setObjCoefficients(SonnetOsi *solver, int first, int count, const double *values)
+{
+	return guard([&]() {
+		OsiSolverInterface *s = osi(solver);
+		checkRange(first, count, s->getNumCols(), "SonnetOsi_setObjCoefficients");
+		if (first == 0 && count == s->getNumCols()) s->setObjective(values);
+		else for (int i = 0; i < count; i++) s->setObjCoeff(first + i, values[i]);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setRowLower(SonnetOsi *solver, int first, int count, const double *values)
+{
+	return guard([&]() {
+		OsiSolverInterface *s = osi(solver);
+		checkRange(first, count, s->getNumRows(), "SonnetOsi_setRowLower");
+		for (int i = 0; i < count; i++) s->setRowLower(first + i, values[i]);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setRowUpper(SonnetOsi *solver, int first, int count, const double *values)
+{
+	return guard([&]() {
+		OsiSolverInterface *s = osi(solver);
+		checkRange(first, count, s->getNumRows(), "SonnetOsi_setRowUpper");
+		for (int i = 0; i < count; i++) s->setRowUpper(first + i, values[i]);
+		return SONNET_OK;
+	});
+}
+
+// setColSetBounds and setRowSetBounds take the bounds interleaved (lower, upper, lower, ..)
+static void interleave(int count, const double *lower, const double *upper, std::vector<double> &bounds)
+{
+	bounds.resize(2 * static_cast<size_t>(count));
+	for (int i = 0; i < count; i++)
+	{
+		bounds[2 * i] = lower[i];
+		bounds[2 * i + 1] = upper[i];
+	}
+}
+
+int SonnetOsi_setColSetBounds(SonnetOsi *solver, int count, const int *indices, const double *lower, const double *upper)
+{
+	return guard([&]() {
+		if (count <= 0) return SONNET_OK;
+		std::vector<double> bounds;
+		interleave(count, lower, upper, bounds);
+		osi(solver)->setColSetBounds(indices, indices + count, bounds.data());
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setRowSetBounds(SonnetOsi *solver, int count, const int *indices, const double *lower, const double *upper)
+{
+	return guard([&]() {
+		if (count <= 0) return SONNET_OK;
+		std::vector<double> bounds;
+		interleave(count, lower, upper, bounds);
+		osi(solver)->setRowSetBounds(indices, indices + count, bounds.data());
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setInteger(SonnetOsi *solver, int count, const int *indices)
+{
+	return guard([&]() {
+		osi(solver)->setInteger(indices, count);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setContinuous(SonnetOsi *solver, int count, const int *indices)
+{
+	return guard([&]() {
+		osi(solver)->setContinuous(indices, count);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setColSolution(SonnetOsi *solver, const double *values)
+{
+	return guard([&]() {
+		osi(solver)->setColSolution(values);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setRowPrice(SonnetOsi *solver, const double *values)
+{
+	return guard([&]() {
+		osi(solver)->setRowPrice(values);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setObjSense(SonnetOsi *solver, double sense)
+{
+	return guard([&]() {
+		osi(solver)->setObjSense(sense);
+		return SONNET_OK;
+	});
+}
+
+double SonnetOsi_getObjSense(const SonnetOsi *solver) { return osi(solver)->getObjSense(); }
+double SonnetOsi_getObjValue(const SonnetOsi *solver) { return osi(solver)->getObjValue(); }
+
+int SonnetOsi_setColNames(SonnetOsi *solver, int first, int count, const char *names)
+{
+	return guard([&]() {
+		OsiSolverInterface *s = osi(solver);
+		checkRange(first, count, s->getNumCols(), "SonnetOsi_setColNames");
+		unpackNames(count, names, [&](int i, const std::string &name) { s->setColName(first + i, name); });
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setRowNames(SonnetOsi *solver, int first, int count, const char *names)
+{
+	return guard([&]() {
+		OsiSolverInterface *s = osi(solver);
+		checkRange(first, count, s->getNumRows(), "SonnetOsi_setRowNames");
+		unpackNames(count, names, [&](int i, const std::string &name) { s->setRowName(first + i, name); });
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setObjName(SonnetOsi *solver, const char *name)
+{
+	return guard([&]() {
+		osi(solver)->setObjName(name != nullptr ? name : "");
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_getColNames(const SonnetOsi *solver, char *buffer, int capacity)
+{
+	return guard([&]() {
+		const OsiSolverInterface *s = osi(solver);
+		std::string name;
+		return packNames(s->getNumCols(), [&](int i) { name = s->getColName(i); return name.c_str(); }, buffer, capacity);
+	});
+}
+
+int SonnetOsi_getRowNames(const SonnetOsi *solver, char *buffer, int capacity)
+{
+	return guard([&]() {
+		const OsiSolverInterface *s = osi(solver);
+		std::string name;
+		return packNames(s->getNumRows(), [&](int i) { name = s->getRowName(i); return name.c_str(); }, buffer, capacity);
+	});
+}
+
+int SonnetOsi_getObjName(const SonnetOsi *solver, char *buffer, int capacity)
+{
+	return guard([&]() { return packName(osi(solver)->getObjName(), buffer, capacity); });
+}
+
+int SonnetOsi_getMatrixByCol(const SonnetOsi *solver, int *starts, int startsLength, int *indices, double *values, int elementsLength)
+{
+	return guard([&]() { return copyMatrix(osi(solver)->getMatrixByCol(), starts, startsLength, indices, values, elementsLength); });
+}
+
+int SonnetOsi_getMatrixByRow(const SonnetOsi *solver, int *starts, int startsLength, int *indices, double *values, int elementsLength)
+{
+	return guard([&]() { return copyMatrix(osi(solver)->getMatrixByRow(), starts, startsLength, indices, values, elementsLength); });
+}
+
+int SonnetOsi_setIntParam(SonnetOsi *solver, int key, int value)
+{
+	return guard([&]() {
+		checkRange(key, 1, OsiLastIntParam, "SonnetOsi_setIntParam");
+		return osi(solver)->setIntParam(static_cast<OsiIntParam>(key), value) ? 1 : 0;
+	});
+}
+
+int SonnetOsi_getIntParam(const SonnetOsi *solver, int key, int *value)
+{
+	return guard([&]() {
+		checkRange(key, 1, OsiLastIntParam, "SonnetOsi_getIntParam");
+		return osi(solver)->getIntParam(static_cast<OsiIntParam>(key), *value) ? 1 : 0;
+	});
+}
+
+int SonnetOsi_setDblParam(SonnetOsi *solver, int key, double value)
+{
+	return guard([&]() {
+		checkRange(key, 1, OsiLastDblParam, "SonnetOsi_setDblParam");
+		return osi(solver)->setDblParam(static_cast<OsiDblParam>(key), value) ? 1 : 0;
+	});
+}
+
+int SonnetOsi_getDblParam(const SonnetOsi *solver, int key, double *value)
+{
+	return guard([&]() {
+		checkRange(key, 1, OsiLastDblParam, "SonnetOsi_getDblParam");
+		return osi(solver)->getDblParam(static_cast<OsiDblParam>(key), *value) ? 1 : 0;
+	});
+}
+
+int SonnetOsi_setHintParam(SonnetOsi *solver, int key, int yesNo, int strength)
+{
+	return guard([&]() {
+		checkRange(key, 1, OsiLastHintParam, "SonnetOsi_setHintParam");
+		return osi(solver)->setHintParam(static_cast<OsiHintParam>(key), yesNo != 0, static_cast<OsiHintStrength>(strength)) ? 1 : 0;
+	});
+}
+
+int SonnetOsi_getHintParam(const SonnetOsi *solver, int key, int *yesNo, int *strength)
+{
+	return guard([&]() {
+		checkRange(key, 1, OsiLastHintParam, "SonnetOsi_getHintParam");
+		bool value = false;
+		OsiHintStrength hintStrength = OsiHintIgnore;
+		bool result = osi(solver)->getHintParam(static_cast<OsiHintParam>(key), value, hintStrength);
+		*yesNo = value ? 1 : 0;
+		*strength = static_cast<int>(hintStrength);
+		return result ? 1 : 0;
+	});
+}
+
+int SonnetOsi_setStrParam(SonnetOsi *solver, int key, const char *value)
+{
+	return guard([&]() {
+		checkRange(key, 1, OsiLastStrParam, "SonnetOsi_setStrParam");
+		return osi(solver)->setStrParam(static_cast<OsiStrParam>(key), value != nullptr ? value : "") ? 1 : 0;
+	});
+}
+
+int SonnetOsi_getStrParam(const SonnetOsi *solver, int key, char *buffer, int capacity)
+{
+	return guard([&]() {
+		checkRange(key, 1, OsiLastStrParam, "SonnetOsi_getStrParam");
+		std::string value;
+		osi(solver)->getStrParam(static_cast<OsiStrParam>(key), value);
+		return packName(value, buffer, capacity);
+	});
+}
+
+int SonnetOsi_initialSolve(SonnetOsi *solver)
+{
+	return guard([&]() {
+		osi(solver)->initialSolve();
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_resolve(SonnetOsi *solver)
+{
+	return guard([&]() {
+		osi(solver)->resolve();
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_branchAndBound(SonnetOsi *solver)
+{
+	return guard([&]() {
+		osi(solver)->branchAndBound();
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_markHotStart(SonnetOsi *solver)
+{
+	return guard([&]() {
+		osi(solver)->markHotStart();
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_solveFromHotStart(SonnetOsi *solver)
+{
+	return guard([&]() {
+		osi(solver)->solveFromHotStart();
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_unmarkHotStart(SonnetOsi *solver)
+{
+	return guard([&]() {
+		osi(solver)->unmarkHotStart();
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_isAbandoned(const SonnetOsi *solver) { return osi(solver)->isAbandoned() ? 1 : 0; }
+int SonnetOsi_isProvenOptimal(const SonnetOsi *solver) { return osi(solver)->isProvenOptimal() ? 1 : 0; }
+int SonnetOsi_isProvenPrimalInfeasible(const SonnetOsi *solver) { return osi(solver)->isProvenPrimalInfeasible() ? 1 : 0; }
+int SonnetOsi_isProvenDualInfeasible(const SonnetOsi *solver) { return osi(solver)->isProvenDualInfeasible() ? 1 : 0; }
+int SonnetOsi_isPrimalObjectiveLimitReached(const SonnetOsi *solver) { return osi(solver)->isPrimalObjectiveLimitReached() ? 1 : 0; }
+int SonnetOsi_isDualObjectiveLimitReached(const SonnetOsi *solver) { return osi(solver)->isDualObjectiveLimitReached() ? 1 : 0; }
+int SonnetOsi_isIterationLimitReached(const SonnetOsi *solver) { return osi(solver)->isIterationLimitReached() ? 1 : 0; }
+int SonnetOsi_getIterationCount(const SonnetOsi *solver) { return osi(solver)->getIterationCount(); }
+
+int SonnetOsi_getBasisStatus(const SonnetOsi *solver, int *columnStatus, int *rowStatus)
+{
+	return guard([&]() {
+		osi(solver)->getBasisStatus(columnStatus, rowStatus);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setBasisStatus(SonnetOsi *solver, const int *columnStatus, const int *rowStatus)
+{
+	return guard([&]() { return osi(solver)->setBasisStatus(columnStatus, rowStatus); });
+}
+
+SonnetWarmStart *SonnetOsi_getWarmStart(const SonnetOsi *solver)
+{
+	return guard<SonnetWarmStart *>(nullptr, [&]() {
+		CoinWarmStart *result = osi(solver)->getWarmStart();
+		if (result == nullptr) throw std::runtime_error("No warm start available in SonnetOsi_getWarmStart");
+		return handle(result);
+	});
+}
+
+SonnetWarmStart *SonnetOsi_getEmptyWarmStart(const SonnetOsi *solver)
+{
+	return guard<SonnetWarmStart *>(nullptr, [&]() {
+		CoinWarmStart *result = osi(solver)->getEmptyWarmStart();
+		if (result == nullptr) throw std::runtime_error("No warm start available in SonnetOsi_getEmptyWarmStart");
+		return handle(result);
+	});
+}
+
+int SonnetOsi_setWarmStart(SonnetOsi *solver, const SonnetWarmStart *warmStart)
+{
+	return guard([&]() { return osi(solver)->setWarmStart(SonnetNative::warmStart(warmStart)) ? 1 : 0; });
+}
+
+void SonnetWarmStart_delete(SonnetWarmStart *warmStart)
+{
+	delete SonnetNative::warmStart(warmStart);
+}
+
+int SonnetOsi_saveBaseModel(SonnetOsi *solver)
+{
+	return guard([&]() {
+		osi(solver)->saveBaseModel();
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_restoreBaseModel(SonnetOsi *solver, int numberRows)
+{
+	return guard([&]() {
+		checkRange(0, numberRows, osi(solver)->getNumRows(), "SonnetOsi_restoreBaseModel");
+		osi(solver)->restoreBaseModel(numberRows);
+		return SONNET_OK;
+	});
+}
+
+static OsiCbcSolverInterface *cbcSolver(SonnetOsi *solver, const char *method)
+{
+	OsiCbcSolverInterface *result = dynamic_cast<OsiCbcSolverInterface *>(osi(solver));
+	if (result == nullptr) throw std::invalid_argument(std::string("Not an OsiCbcSolverInterface in ") + method);
+	return result;
+}
+
+int SonnetOsi_saveCbcReferenceSolver(SonnetOsi *solver)
+{
+	return guard([&]() {
+		cbcSolver(solver, "SonnetOsi_saveCbcReferenceSolver")->getModelPtr()->saveReferenceSolver();
+		return SONNET_OK;
+	});
+}
+
+SonnetOsi *SonnetOsi_resetCbcToReferenceSolver(SonnetOsi *solver)
+{
+	return guard<SonnetOsi *>(nullptr, [&]() {
+		// As resetModelToReferenceSolver of OsiCbcSolverInterface of SonnetWrapper, but the new OsiCbcSolverInterface (its CbcModel)
+		// takes a copy of the reference solver, such that the given solver, with its model and the original, can be deleted.
+		OsiCbcSolverInterface *original = cbcSolver(solver, "SonnetOsi_resetCbcToReferenceSolver");
+		CbcModel *model = original->getModelPtr();
+		model->resetToReferenceSolver();
+
+		OsiCbcSolverInterface *result = new OsiCbcSolverInterface(model->solver());
+		if (!original->defaultHandler()) result->passInMessageHandler(original->messageHandler());
+		else result->messageHandler()->setLogLevel(original->messageHandler()->logLevel());
+
+		delete original;
+		return handle(result);
+	});
+}
+
+int SonnetOsi_readMps(SonnetOsi *solver, const char *fileName, const char *extension)
+{
+	return guard([&]() { return osi(solver)->readMps(fileName, extension != nullptr ? extension : "mps"); });
+}
+
+int SonnetOsi_writeMps(const SonnetOsi *solver, const char *fileName, const char *extension, double objSense)
+{
+	return guard([&]() {
+		osi(solver)->writeMps(fileName, extension != nullptr ? extension : "mps", objSense);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_writeLp(const SonnetOsi *solver, const char *fileName, const char *extension, double objSense)
+{
+	return guard([&]() {
+		// The defaults of OsiSolverInterface::writeLp, with the names of the rows
+		osi(solver)->writeLp(fileName, extension != nullptr ? extension : "lp", 1e-5, 10, 5, objSense, true);
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_passInMessageHandler(SonnetOsi *solver, SonnetMessageHandler *handler)
+{
+	return guard([&]() {
+		osi(solver)->passInMessageHandler(messageHandler(handler));
+		return SONNET_OK;
+	});
+}
+
+int SonnetOsi_setLogLevel(SonnetOsi *solver, int level)
+{
+	return guard([&]() {
+		osi(solver)->messageHandler()->setLogLevel(level);
+		return SONNET_OK;
+	});
+}
+
+}
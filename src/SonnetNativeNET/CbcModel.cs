@@ -0,0 +1,166 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+
+namespace COIN.Native
+{
+    /// <summary>
+    /// CbcModel via the C ABI of SonnetNative, with the method names of COIN.CbcModel of SonnetWrapper.
+    /// </summary>
+    public unsafe class CbcModel : NativeObject
+    {
+        private CoinMessageHandler handler;
+
+        /// <summary>
+        /// Create a new model with a copy of the given solver.
+        /// </summary>
+        public CbcModel(OsiSolverInterface solver)
+            : base(NativeMethods.SonnetCbc_new(solver.Handle), true, "CbcModel")
+        {
+            GC.KeepAlive(solver);
+        }
+
+        internal CbcModel(IntPtr handle, NativeObject owner)
+            : base(handle, owner, "CbcModel")
+        {
+        }
+
+        protected override void Delete(IntPtr handle)
+        {
+            NativeMethods.SonnetCbc_delete(handle);
+        }
+
+        /// <summary>
+        /// Gets the current solver of the model, which is owned by the model.
+        /// </summary>
+        public OsiSolverInterface solver()
+        {
+            IntPtr solver = NativeMethods.SonnetCbc_solver(Handle);
+            GC.KeepAlive(this);
+            return new OsiSolverInterface(solver, this);
+        }
+
+        public void branchAndBound()
+        {
+            Check(NativeMethods.SonnetCbc_branchAndBound(Handle), "branchAndBound");
+            ThrowPendingOfSolve();
+        }
+
+        internal void ThrowPendingOfSolve()
+        {
+            handler?.ThrowPendingPrint();
+            ThrowPending();
+        }
+
+        public bool setMaximumNodes(int value) { return Check(NativeMethods.SonnetCbc_setMaximumNodes(Handle, value), "setMaximumNodes") != 0; }
+        public bool setMaximumSeconds(double value) { return Check(NativeMethods.SonnetCbc_setMaximumSeconds(Handle, value), "setMaximumSeconds") != 0; }
+        public bool setMaximumSolutions(int value) { return Check(NativeMethods.SonnetCbc_setMaximumSolutions(Handle, value), "setMaximumSolutions") != 0; }
+        public bool setAllowableGap(double value) { return Check(NativeMethods.SonnetCbc_setAllowableGap(Handle, value), "setAllowableGap") != 0; }
+        public bool setAllowableFractionGap(double value) { return Check(NativeMethods.SonnetCbc_setAllowableFractionGap(Handle, value), "setAllowableFractionGap") != 0; }
+        public void setNumberThreads(int value) { Check(NativeMethods.SonnetCbc_setNumberThreads(Handle, value), "setNumberThreads"); }
+        public void setLogLevel(int value) { Check(NativeMethods.SonnetCbc_setLogLevel(Handle, value), "setLogLevel"); }
+
+        /// <summary>
+        /// Set the best solution with its objective value, as a MIP start. If check, the solution is checked first.
+        /// </summary>
+        public void setBestSolution(double[] solution, int numberColumns, double objectiveValue, bool check = false)
+        {
+            if (solution.Length < numberColumns) throw new ArgumentException("The solution must have numberColumns values.");
+            fixed (double* p = solution)
+            {
+                Check(NativeMethods.SonnetCbc_setBestSolution(Handle, p, numberColumns, objectiveValue, check ? 1 : 0), "setBestSolution");
+            }
+        }
+
+        /// <summary>
+        /// Remove the strategy of the model if it is the default strategy (CbcStrategyDefault), such that CbcMain solves as the cbc executable.
+        /// Returns whether the strategy was removed.
+        /// </summary>
+        public bool clearDefaultStrategy() { return Check(NativeMethods.SonnetCbc_clearDefaultStrategy(Handle), "clearDefaultStrategy") != 0; }
+
+        /// <summary>
+        /// Gets the status: -1 before branchAndBound, 0 finished, 1 stopped on a limit, 2 difficulties, 5 stopped by an event.
+        /// </summary>
+        public int status() { return NativeMethods.SonnetCbc_status(Handle); }
+        public int secondaryStatus() { return NativeMethods.SonnetCbc_secondaryStatus(Handle); }
+        public bool isProvenOptimal() { return Check(NativeMethods.SonnetCbc_isProvenOptimal(Handle), "isProvenOptimal") != 0; }
+        public bool isProvenInfeasible() { return Check(NativeMethods.SonnetCbc_isProvenInfeasible(Handle), "isProvenInfeasible") != 0; }
+        public bool isNodeLimitReached() { return Check(NativeMethods.SonnetCbc_isNodeLimitReached(Handle), "isNodeLimitReached") != 0; }
+        public bool isSecondsLimitReached() { return Check(NativeMethods.SonnetCbc_isSecondsLimitReached(Handle), "isSecondsLimitReached") != 0; }
+        public bool isSolutionLimitReached() { return Check(NativeMethods.SonnetCbc_isSolutionLimitReached(Handle), "isSolutionLimitReached") != 0; }
+        public int getNodeCount() { return NativeMethods.SonnetCbc_getNodeCount(Handle); }
+        public int getIterationCount() { return NativeMethods.SonnetCbc_getIterationCount(Handle); }
+        public int getSolutionCount() { return NativeMethods.SonnetCbc_getSolutionCount(Handle); }
+        public double getObjValue() { return NativeMethods.SonnetCbc_getObjValue(Handle); }
+        public double getBestPossibleObjValue() { return NativeMethods.SonnetCbc_getBestPossibleObjValue(Handle); }
+
+        /// <summary>
+        /// Gets the best solution found, or an empty array if there is no solution.
+        /// </summary>
+        public double[] bestSolution() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetCbc_bestSolution, "bestSolution"); }
+
+        /// <summary>
+        /// Pass in the event handler. Cbc copies the native handler for every (thread) model, which all invoke the delegate.
+        /// The delegate is kept until the owner of the native model (this model, or its OsiCbcSolverInterface) is disposed or finalized.
+        /// </summary>
+        public void passInEventHandler(CbcEventHandler eventHandler)
+        {
+            if (eventHandler == null) throw new ArgumentNullException(nameof(eventHandler));
+            CbcEventHandlerNative.PassIn(this, eventHandler, this);
+        }
+
+        /// <summary>
+        /// Pass in the message handler. The model keeps a reference to the handler.
+        /// </summary>
+        public void passInMessageHandler(CoinMessageHandler handler)
+        {
+            if (handler == null) throw new ArgumentNullException(nameof(handler));
+            Check(NativeMethods.SonnetCbc_passInMessageHandler(Handle, handler.Handle), "passInMessageHandler");
+            this.handler = handler;
+            GC.KeepAlive(handler);
+        }
+    }
+
+    /// <summary>
+    /// CbcMain0 and CbcMain1 via the C ABI of SonnetNative, as COIN.CbcSolver of SonnetWrapper.
+    /// </summary>
+    public static unsafe class CbcSolver
+    {
+        /// <summary>
+        /// Gets whether Cbc is built with threads (CBC_THREAD), such that "-threads n" can be used.
+        /// </summary>
+        public static bool SupportsThreads { get { return NativeMethods.SonnetNative_supportsThreads() != 0; } }
+
+        /// <summary>
+        /// Call CbcMain0 and CbcMain1 with the given arguments, like "Sonnet", "-solve", "-quit".
+        /// A timeLimit other than 0 sets the time limit of the parameters.
+        /// </summary>
+        public static int CbcMain(string[] args, CbcModel cbcModel, double timeLimit = 0.0)
+        {
+            if (cbcModel == null) throw new ArgumentNullException(nameof(cbcModel));
+            args = args ?? new string[0];
+
+            // Pin all arguments as null-terminated UTF-8 in one buffer
+            byte[] buffer = Marshalling.PackNames(args);
+            byte** argv = stackalloc byte*[args.Length + 1];
+            fixed (byte* p = buffer)
+            {
+                int offset = 0;
+                for (int i = 0; i < args.Length; i++)
+                {
+                    argv[i] = p + offset;
+                    while (buffer[offset] != 0) offset++;
+                    offset++;
+                }
+                argv[args.Length] = null;
+
+                int result = NativeMethods.SonnetCbc_main(cbcModel.Handle, args.Length, argv, timeLimit);
+                GC.KeepAlive(cbcModel);
+                if (result < 0) throw CoinError.FromLastError("CbcMain");
+                cbcModel.ThrowPendingOfSolve();
+                return result;
+            }
+        }
+    }
+}
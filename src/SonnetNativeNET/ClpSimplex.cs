@@ -0,0 +1,170 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+
+namespace COIN.Native
+{
+    /// <summary>
+    /// ClpSimplex via the C ABI of SonnetNative, with the method names of COIN.ClpSimplex of SonnetWrapper.
+    /// </summary>
+    public unsafe class ClpSimplex : NativeObject
+    {
+        private CoinMessageHandler handler;
+
+        public ClpSimplex()
+            : base(NativeMethods.SonnetClp_new(), true, "ClpSimplex")
+        {
+        }
+
+        internal ClpSimplex(IntPtr handle, NativeObject owner)
+            : base(handle, owner, "ClpSimplex")
+        {
+        }
+
+        protected override void Delete(IntPtr handle)
+        {
+            NativeMethods.SonnetClp_delete(handle);
+        }
+
+        /// <summary>
+        /// Read an mps file. Returns the number of errors, so 0 is success.
+        /// </summary>
+        public int readMps(string fileName, bool keepNames = false, bool ignoreErrors = false)
+        {
+            fixed (byte* p = Marshalling.ToUtf8(fileName))
+            {
+                return Check(NativeMethods.SonnetClp_readMps(Handle, p, keepNames ? 1 : 0, ignoreErrors ? 1 : 0), "readMps");
+            }
+        }
+
+        public int writeMps(string fileName, int formatType = 0, int numberAcross = 2, double objSense = 0.0)
+        {
+            fixed (byte* p = Marshalling.ToUtf8(fileName))
+            {
+                return Check(NativeMethods.SonnetClp_writeMps(Handle, p, formatType, numberAcross, objSense), "writeMps");
+            }
+        }
+
+        /// <summary>
+        /// Replace the problem by the given column-ordered problem. Null bounds and objective use the defaults.
+        /// </summary>
+        public void loadProblem(int numberColumns, int numberRows, int[] starts, int[] indices, double[] values,
+            double[] columnLower, double[] columnUpper, double[] objective, double[] rowLower, double[] rowUpper)
+        {
+            fixed (int* pStarts = starts, pIndices = indices)
+            fixed (double* pValues = values, pColumnLower = columnLower, pColumnUpper = columnUpper, pObjective = objective, pRowLower = rowLower, pRowUpper = rowUpper)
+            {
+                Check(NativeMethods.SonnetClp_loadProblem(Handle, numberColumns, numberRows, pStarts, pIndices, pValues,
+                    pColumnLower, pColumnUpper, pObjective, pRowLower, pRowUpper), "loadProblem");
+            }
+        }
+
+        /// <summary>
+        /// Load the quadratic part of the objective from native memory, given column-ordered (see ClpModel::loadQuadraticObjective).
+        /// </summary>
+        public void loadQuadraticObjectiveUnsafe(int numberColumns, int* starts, int* columns, double* elements)
+        {
+            Check(NativeMethods.SonnetClp_loadQuadraticObjective(Handle, numberColumns, starts, columns, elements), "loadQuadraticObjectiveUnsafe");
+        }
+
+        /// <summary>
+        /// Set the element of the given row and column of the matrix (0 removes it).
+        /// </summary>
+        public void modifyCoefficient(int row, int column, double newElement)
+        {
+            Check(NativeMethods.SonnetClp_modifyCoefficient(Handle, row, column, newElement), "modifyCoefficient");
+        }
+
+        public int primal(int ifValuesPass = 0) { return CheckSolve(NativeMethods.SonnetClp_primal(Handle, ifValuesPass), "primal"); }
+        public int dual(int ifValuesPass = 0) { return CheckSolve(NativeMethods.SonnetClp_dual(Handle, ifValuesPass), "dual"); }
+        public int initialSolve() { return CheckSolve(NativeMethods.SonnetClp_initialSolve(Handle), "initialSolve"); }
+
+        private int CheckSolve(int result, string method)
+        {
+            Check(result, method);
+            handler?.ThrowPendingPrint();
+            return result;
+        }
+
+        /// <summary>
+        /// Gets the problem status: 0 optimal, 1 primal infeasible, 2 dual infeasible, 3 stopped on iterations or time, 4 stopped due to errors.
+        /// </summary>
+        /// <summary>
+        /// Dual ranging of the given variables (the rows from getNumCols()) of an optimal basis. Each array has numberCheck entries.
+        /// </summary>
+        public int dualRanging(int numberCheck, int[] which, double[] costIncrease, int[] sequenceIncrease, double[] costDecrease, int[] sequenceDecrease)
+        {
+            CheckRanging(numberCheck, which, costIncrease, sequenceIncrease, costDecrease, sequenceDecrease);
+            fixed (int* pWhich = which, pSequenceIncrease = sequenceIncrease, pSequenceDecrease = sequenceDecrease)
+            fixed (double* pIncrease = costIncrease, pDecrease = costDecrease)
+            {
+                return Check(NativeMethods.SonnetClp_dualRanging(Handle, numberCheck, pWhich, pIncrease, pSequenceIncrease, pDecrease, pSequenceDecrease), "dualRanging");
+            }
+        }
+
+        /// <summary>
+        /// Primal ranging of the given variables of an optimal basis, as dualRanging.
+        /// </summary>
+        public int primalRanging(int numberCheck, int[] which, double[] valueIncrease, int[] sequenceIncrease, double[] valueDecrease, int[] sequenceDecrease)
+        {
+            CheckRanging(numberCheck, which, valueIncrease, sequenceIncrease, valueDecrease, sequenceDecrease);
+            fixed (int* pWhich = which, pSequenceIncrease = sequenceIncrease, pSequenceDecrease = sequenceDecrease)
+            fixed (double* pIncrease = valueIncrease, pDecrease = valueDecrease)
+            {
+                return Check(NativeMethods.SonnetClp_primalRanging(Handle, numberCheck, pWhich, pIncrease, pSequenceIncrease, pDecrease, pSequenceDecrease), "primalRanging");
+            }
+        }
+
+        private static void CheckRanging(int numberCheck, int[] which, double[] increase, int[] sequenceIncrease, double[] decrease, int[] sequenceDecrease)
+        {
+            if (which.Length < numberCheck || increase.Length < numberCheck || sequenceIncrease.Length < numberCheck ||
+                decrease.Length < numberCheck || sequenceDecrease.Length < numberCheck)
+            {
+                throw new ArgumentException("The arrays of the ranging must have numberCheck entries.");
+            }
+        }
+
+        public int status() { return NativeMethods.SonnetClp_status(Handle); }
+        public int secondaryStatus() { return NativeMethods.SonnetClp_secondaryStatus(Handle); }
+        public int numberIterations() { return NativeMethods.SonnetClp_numberIterations(Handle); }
+        public double objectiveValue() { return NativeMethods.SonnetClp_objectiveValue(Handle); }
+        public int getNumCols() { return NativeMethods.SonnetClp_getNumCols(Handle); }
+        public int getNumRows() { return NativeMethods.SonnetClp_getNumRows(Handle); }
+
+        /// <summary>
+        /// Set the optimization direction: 1 to minimise, -1 to maximise.
+        /// </summary>
+        public void setOptimizationDirection(double value) { Check(NativeMethods.SonnetClp_setOptimizationDirection(Handle, value), "setOptimizationDirection"); }
+        public void setMaximumIterations(int value) { Check(NativeMethods.SonnetClp_setMaximumIterations(Handle, value), "setMaximumIterations"); }
+        public void setMaximumSeconds(double value) { Check(NativeMethods.SonnetClp_setMaximumSeconds(Handle, value), "setMaximumSeconds"); }
+        public void setPrimalTolerance(double value) { Check(NativeMethods.SonnetClp_setPrimalTolerance(Handle, value), "setPrimalTolerance"); }
+        public void setDualTolerance(double value) { Check(NativeMethods.SonnetClp_setDualTolerance(Handle, value), "setDualTolerance"); }
+        /// <summary>
+        /// Set the scaling mode: 0 off, 1 equilibrium, 2 geometric, 3 auto, 4 auto-but-as-initialSolve-in-bab.
+        /// </summary>
+        public void scaling(int mode) { Check(NativeMethods.SonnetClp_scaling(Handle, mode), "scaling"); }
+        public void setLogLevel(int value) { Check(NativeMethods.SonnetClp_setLogLevel(Handle, value), "setLogLevel"); }
+
+        /// <summary>
+        /// Pass in the message handler. The model keeps a reference to the handler.
+        /// </summary>
+        public void passInMessageHandler(CoinMessageHandler handler)
+        {
+            if (handler == null) throw new ArgumentNullException(nameof(handler));
+            Check(NativeMethods.SonnetClp_passInMessageHandler(Handle, handler.Handle), "passInMessageHandler");
+            this.handler = handler;
+            GC.KeepAlive(handler);
+        }
+
+        public double[] columnLower() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetClp_getColLower, "columnLower"); }
+        public double[] columnUpper() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetClp_getColUpper, "columnUpper"); }
+        public double[] objective() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetClp_getObjCoefficients, "objective"); }
+        public double[] rowLower() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetClp_getRowLower, "rowLower"); }
+        public double[] rowUpper() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetClp_getRowUpper, "rowUpper"); }
+        public double[] primalColumnSolution() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetClp_getColSolution, "primalColumnSolution"); }
+        public double[] primalRowSolution() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetClp_getRowActivity, "primalRowSolution"); }
+        public double[] dualColumnSolution() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetClp_getReducedCost, "dualColumnSolution"); }
+        public double[] dualRowSolution() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetClp_getRowPrice, "dualRowSolution"); }
+    }
+}
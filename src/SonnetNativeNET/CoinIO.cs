@@ -0,0 +1,169 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+
+namespace COIN.Native
+{
+    /// <summary>
+    /// CoinMpsIO via the C ABI of SonnetNative, with the method names of COIN.CoinMpsIO of SonnetWrapper.
+    /// </summary>
+    public unsafe class CoinMpsIO : NativeObject
+    {
+        private CoinMessageHandler handler;
+
+        public CoinMpsIO()
+            : base(NativeMethods.SonnetMpsIO_new(), true, "CoinMpsIO")
+        {
+        }
+
+        protected override void Delete(IntPtr handle)
+        {
+            NativeMethods.SonnetMpsIO_delete(handle);
+        }
+
+        /// <summary>
+        /// Read an mps file. Returns the number of errors, so 0 is success.
+        /// </summary>
+        public int readMps(string fileName, string extension = "mps")
+        {
+            fixed (byte* pFileName = Marshalling.ToUtf8(fileName), pExtension = Marshalling.ToUtf8(extension))
+            {
+                int result = Check(NativeMethods.SonnetMpsIO_readMps(Handle, pFileName, pExtension), "readMps");
+                handler?.ThrowPendingPrint();
+                return result;
+            }
+        }
+
+        public void passInMessageHandler(CoinMessageHandler handler)
+        {
+            if (handler == null) throw new ArgumentNullException(nameof(handler));
+            Check(NativeMethods.SonnetMpsIO_passInMessageHandler(Handle, handler.Handle), "passInMessageHandler");
+            this.handler = handler;
+            GC.KeepAlive(handler);
+        }
+
+        public int getNumCols() { return NativeMethods.SonnetMpsIO_getNumCols(Handle); }
+        public int getNumRows() { return NativeMethods.SonnetMpsIO_getNumRows(Handle); }
+        public int getNumElements() { return Check(NativeMethods.SonnetMpsIO_getNumElements(Handle), "getNumElements"); }
+
+        public double objectiveOffset()
+        {
+            double result = NativeMethods.SonnetMpsIO_objectiveOffset(Handle);
+            GC.KeepAlive(this);
+            return result;
+        }
+
+        /// <summary>
+        /// Get the column-ordered matrix, without gaps.
+        /// </summary>
+        public void getMatrixByCol(out int[] starts, out int[] indices, out double[] values)
+        {
+            int numberElements = Check(NativeMethods.SonnetMpsIO_getMatrixByCol(Handle, null, 0, null, null, 0), "getMatrixByCol");
+            starts = new int[getNumCols() + 1];
+            indices = new int[numberElements];
+            values = new double[numberElements];
+            fixed (int* pStarts = starts, pIndices = indices)
+            fixed (double* pValues = values)
+            {
+                Check(NativeMethods.SonnetMpsIO_getMatrixByCol(Handle, pStarts, starts.Length, pIndices, pValues, numberElements), "getMatrixByCol");
+            }
+        }
+
+        public double[] getColLower() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetMpsIO_getColLower, "getColLower"); }
+        public double[] getColUpper() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetMpsIO_getColUpper, "getColUpper"); }
+        public double[] getObjCoefficients() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetMpsIO_getObjCoefficients, "getObjCoefficients"); }
+        public double[] getRowLower() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetMpsIO_getRowLower, "getRowLower"); }
+        public double[] getRowUpper() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetMpsIO_getRowUpper, "getRowUpper"); }
+
+        public bool[] getIntegerColumns()
+        {
+            byte[] integers = Marshalling.GetArray<byte>(this, &NativeMethods.SonnetMpsIO_getIntegerColumns, "getIntegerColumns");
+            return Array.ConvertAll(integers, b => b != 0);
+        }
+
+        public string[] columnNames() { return Marshalling.GetNames(this, &NativeMethods.SonnetMpsIO_getColNames, "columnNames"); }
+        public string[] rowNames() { return Marshalling.GetNames(this, &NativeMethods.SonnetMpsIO_getRowNames, "rowNames"); }
+        public string getProblemName() { return Marshalling.GetName(this, &NativeMethods.SonnetMpsIO_getProblemName, "getProblemName"); }
+        public string getObjectiveName() { return Marshalling.GetName(this, &NativeMethods.SonnetMpsIO_getObjectiveName, "getObjectiveName"); }
+    }
+
+    /// <summary>
+    /// CoinLpIO via the C ABI of SonnetNative, with the method names of COIN.CoinLpIO of SonnetWrapper.
+    /// </summary>
+    public unsafe class CoinLpIO : NativeObject
+    {
+        private CoinMessageHandler handler;
+
+        public CoinLpIO()
+            : base(NativeMethods.SonnetLpIO_new(), true, "CoinLpIO")
+        {
+        }
+
+        protected override void Delete(IntPtr handle)
+        {
+            NativeMethods.SonnetLpIO_delete(handle);
+        }
+
+        public void readLp(string fileName)
+        {
+            fixed (byte* p = Marshalling.ToUtf8(fileName))
+            {
+                Check(NativeMethods.SonnetLpIO_readLp(Handle, p), "readLp");
+                handler?.ThrowPendingPrint();
+            }
+        }
+
+        public void passInMessageHandler(CoinMessageHandler handler)
+        {
+            if (handler == null) throw new ArgumentNullException(nameof(handler));
+            Check(NativeMethods.SonnetLpIO_passInMessageHandler(Handle, handler.Handle), "passInMessageHandler");
+            this.handler = handler;
+            GC.KeepAlive(handler);
+        }
+
+        public int getNumCols() { return NativeMethods.SonnetLpIO_getNumCols(Handle); }
+        public int getNumRows() { return NativeMethods.SonnetLpIO_getNumRows(Handle); }
+        public int getNumElements() { return Check(NativeMethods.SonnetLpIO_getNumElements(Handle), "getNumElements"); }
+
+        public double objectiveOffset()
+        {
+            double result = NativeMethods.SonnetLpIO_objectiveOffset(Handle);
+            GC.KeepAlive(this);
+            return result;
+        }
+
+        /// <summary>
+        /// Get the column-ordered matrix, without gaps.
+        /// </summary>
+        public void getMatrixByCol(out int[] starts, out int[] indices, out double[] values)
+        {
+            int numberElements = Check(NativeMethods.SonnetLpIO_getMatrixByCol(Handle, null, 0, null, null, 0), "getMatrixByCol");
+            starts = new int[getNumCols() + 1];
+            indices = new int[numberElements];
+            values = new double[numberElements];
+            fixed (int* pStarts = starts, pIndices = indices)
+            fixed (double* pValues = values)
+            {
+                Check(NativeMethods.SonnetLpIO_getMatrixByCol(Handle, pStarts, starts.Length, pIndices, pValues, numberElements), "getMatrixByCol");
+            }
+        }
+
+        public double[] getColLower() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetLpIO_getColLower, "getColLower"); }
+        public double[] getColUpper() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetLpIO_getColUpper, "getColUpper"); }
+        public double[] getObjCoefficients() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetLpIO_getObjCoefficients, "getObjCoefficients"); }
+        public double[] getRowLower() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetLpIO_getRowLower, "getRowLower"); }
+        public double[] getRowUpper() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetLpIO_getRowUpper, "getRowUpper"); }
+
+        public bool[] getIntegerColumns()
+        {
+            byte[] integers = Marshalling.GetArray<byte>(this, &NativeMethods.SonnetLpIO_getIntegerColumns, "getIntegerColumns");
+            return Array.ConvertAll(integers, b => b != 0);
+        }
+
+        public string[] getColNames() { return Marshalling.GetNames(this, &NativeMethods.SonnetLpIO_getColNames, "getColNames"); }
+        public string[] getRowNames() { return Marshalling.GetNames(this, &NativeMethods.SonnetLpIO_getRowNames, "getRowNames"); }
+        public string getProblemName() { return Marshalling.GetName(this, &NativeMethods.SonnetLpIO_getProblemName, "getProblemName"); }
+        public string getObjName() { return Marshalling.GetName(this, &NativeMethods.SonnetLpIO_getObjectiveName, "getObjName"); }
+    }
+}
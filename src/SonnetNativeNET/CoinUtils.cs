@@ -0,0 +1,95 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+
+namespace COIN.Native
+{
+    /// <summary>
+    /// The helpers of COIN.CoinUtils of SonnetWrapper, in managed code. The arrays are allocated from native memory,
+    /// since these are passed to the native solver as pointers, and must be deleted by DeleteArray.
+    /// </summary>
+    public static unsafe class CoinUtils
+    {
+        public static double* NewDoubleArray(int size) { return (double*)Marshal.AllocHGlobal(sizeof(double) * Math.Max(size, 1)); }
+        public static int* NewIntArray(int size) { return (int*)Marshal.AllocHGlobal(sizeof(int) * Math.Max(size, 1)); }
+
+        public static void DeleteArray(double* to) { Marshal.FreeHGlobal((IntPtr)to); }
+        public static void DeleteArray(int* to) { Marshal.FreeHGlobal((IntPtr)to); }
+
+        public static void CoinDisjointCopyN(double* from, int size, double* to)
+        {
+            if (size > 0) new ReadOnlySpan<double>(from, size).CopyTo(new Span<double>(to, size));
+        }
+
+        public static void CoinZeroN(double* to, int size)
+        {
+            if (size > 0) new Span<double>(to, size).Clear();
+        }
+
+        public static void CoinDisjointCopyN(double[] from, int size, double[] to) { Array.Copy(from, to, size); }
+        public static void CoinZeroN(double[] to, int size) { Array.Clear(to, 0, size); }
+
+        /// <summary>
+        /// Gets the user CPU time of this process in seconds, as CoinCpuTime on Linux.
+        /// </summary>
+        public static double CoinCpuTime() { return Process.GetCurrentProcess().UserProcessorTime.TotalSeconds; }
+    }
+
+    /// <summary>
+    /// A copy of the matrix of a solver, without gaps, with the getters of COIN.CoinPackedMatrix of SonnetWrapper.
+    /// </summary>
+    public class CoinPackedMatrix
+    {
+        private readonly bool colOrdered;
+        private readonly int[] starts;
+        private readonly int[] indices;
+        private readonly double[] elements;
+
+        public CoinPackedMatrix(bool colOrdered, int[] starts, int[] indices, double[] elements)
+        {
+            this.colOrdered = colOrdered;
+            this.starts = starts ?? throw new ArgumentNullException(nameof(starts));
+            this.indices = indices ?? throw new ArgumentNullException(nameof(indices));
+            this.elements = elements ?? throw new ArgumentNullException(nameof(elements));
+        }
+
+        public bool isColOrdered() { return colOrdered; }
+        public int getMajorDim() { return starts.Length - 1; }
+        public int getNumElements() { return elements.Length; }
+
+        /// <summary>
+        /// Gets the starts of the major vectors, with getMajorDim() + 1 entries (the last is the number of elements).
+        /// </summary>
+        public int[] getVectorStarts() { return starts; }
+
+        public int[] getVectorLengths()
+        {
+            int[] lengths = new int[getMajorDim()];
+            for (int i = 0; i < lengths.Length; i++) lengths[i] = starts[i + 1] - starts[i];
+            return lengths;
+        }
+
+        public int getVectorSize(int i) { return starts[i + 1] - starts[i]; }
+        public int[] getIndices() { return indices; }
+        public double[] getElements() { return elements; }
+    }
+
+    /// <summary>
+    /// The warm start (basis) of a solver, as COIN.CoinWarmStart of SonnetWrapper. Only to be passed back to a solver.
+    /// </summary>
+    public class CoinWarmStart : NativeObject
+    {
+        internal CoinWarmStart(IntPtr handle, string method)
+            : base(handle, true, method)
+        {
+        }
+
+        protected override void Delete(IntPtr handle)
+        {
+            NativeMethods.SonnetWarmStart_delete(handle);
+        }
+    }
+}
@@ -0,0 +1,248 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace COIN.Native
+{
+    /// <summary>
+    /// Events known to cbc, as COIN.CbcEvent of SonnetWrapper.
+    /// </summary>
+    public enum CbcEvent
+    {
+        /// <summary>Processing of the current node is complete.</summary>
+        node = 200,
+        /// <summary>A tree status interval has arrived.</summary>
+        treeStatus,
+        /// <summary>A solution has been found.</summary>
+        solution,
+        /// <summary>A heuristic solution has been found.</summary>
+        heuristicSolution,
+        /// <summary>A solution will be found unless user takes action (first check).</summary>
+        beforeSolution1,
+        /// <summary>A solution will be found unless user takes action (thorough check).</summary>
+        beforeSolution2,
+        /// <summary>After failed heuristic.</summary>
+        afterHeuristic,
+        /// <summary>On entry to small branch and bound.</summary>
+        smallBranchAndBound,
+        /// <summary>After a pass of heuristic.</summary>
+        heuristicPass,
+        /// <summary>When converting constraints to cuts.</summary>
+        convertToCuts,
+        /// <summary>Having generated cuts, allows user to think.</summary>
+        generatedCuts,
+        /// <summary>End of search.</summary>
+        endSearch
+    }
+
+    /// <summary>
+    /// Action codes returned by the event handler, as COIN.CbcAction of SonnetWrapper.
+    /// </summary>
+    public enum CbcAction
+    {
+        /// <summary>Continue --- no action required.</summary>
+        noAction = -1,
+        /// <summary>Stop --- abort the current run at the next opportunity.</summary>
+        stop = 0,
+        /// <summary>Restart --- restart branch-and-cut search; do not undo root node processing.</summary>
+        restart,
+        /// <summary>RestartRoot --- undo root node and start branch-and-cut afresh.</summary>
+        restartRoot,
+        /// <summary>Add special cuts.</summary>
+        addCuts,
+        /// <summary>Pretend solution never happened.</summary>
+        killSolution,
+        /// <summary>Take action on modified data.</summary>
+        takeAction
+    }
+
+    /// <summary>
+    /// Delegate for handling CbcEvents, as COIN.CbcEventHandler of SonnetWrapper.
+    /// The model is often a copy of the original model, used by Cbc for a sub problem or a thread.
+    /// </summary>
+    public delegate CbcAction CbcEventHandler(CbcModel model, CbcEvent cbcEvent);
+
+    /// <summary>
+    /// Message handler to pass in to the native COIN-OR classes, as COIN.CoinMessageHandler of SonnetWrapper.
+    /// The native handler calls print() of this object for every message at the log level; by default the message is written to the Console.
+    /// The solvers keep a reference to the handler that is passed in, such that it lives as long as these.
+    /// </summary>
+    public unsafe class CoinMessageHandler : NativeObject
+    {
+        private GCHandle context;
+        private string currentText;
+        private string currentSourceText;
+        private Exception pendingException;
+
+        public CoinMessageHandler()
+            : this(GCHandle.Alloc(null, GCHandleType.Weak))
+        {
+        }
+
+        private CoinMessageHandler(GCHandle context)
+            : base(NativeMethods.SonnetMessageHandler_new((IntPtr)(delegate* unmanaged[Cdecl]<IntPtr, int, int, byte*, byte*, int>)&PrintCallback, GCHandle.ToIntPtr(context)),
+                  true, "CoinMessageHandler")
+        {
+            // Weak, such that the native handler does not keep this object alive
+            this.context = context;
+            this.context.Target = this;
+        }
+
+        public virtual int logLevel()
+        {
+            return NativeMethods.SonnetMessageHandler_logLevel(Handle);
+        }
+
+        public virtual void setLogLevel(int value)
+        {
+            Check(NativeMethods.SonnetMessageHandler_setLogLevel(Handle, value), "setLogLevel");
+        }
+
+        /// <summary>
+        /// Print the given text as a message of this handler, if its detail is at most the log level, via print().
+        /// The external number gives the severity (see CoinOneMessage), and the source has at most 4 characters.
+        /// </summary>
+        public void message(int externalNumber, int detail, string source, string text)
+        {
+            fixed (byte* pSource = Marshalling.ToUtf8(source ?? string.Empty), pText = Marshalling.ToUtf8(text ?? string.Empty))
+            {
+                Check(NativeMethods.SonnetMessageHandler_message(Handle, externalNumber, detail, pSource, pText), "message");
+            }
+            ThrowPendingPrint();
+        }
+
+        /// <summary>
+        /// Print the current message. By default, writes the messageBuffer to the Console.
+        /// </summary>
+        public virtual int print()
+        {
+            Console.WriteLine(currentText);
+            return 0;
+        }
+
+        /// <summary>
+        /// Gets the text of the current message, valid during print().
+        /// </summary>
+        public string messageBuffer()
+        {
+            return currentText;
+        }
+
+        /// <summary>
+        /// Gets the source of the current message (like "Clp"), valid during print().
+        /// </summary>
+        public string currentSource()
+        {
+            return currentSourceText;
+        }
+
+        /// <summary>
+        /// Gets the external number of the current message, valid during print().
+        /// </summary>
+        public int externalNumber { get; private set; }
+
+        /// <summary>
+        /// Gets the detail level of the current message, valid during print().
+        /// </summary>
+        public int detail { get; private set; }
+
+        /// <summary>
+        /// Throw the exception of print(), if any, since exceptions cannot pass the native code.
+        /// </summary>
+        internal void ThrowPendingPrint()
+        {
+            Exception exception = System.Threading.Interlocked.Exchange(ref pendingException, null);
+            if (exception != null) throw new CoinError("Exception in CoinMessageHandler.print: " + exception.Message, exception);
+        }
+
+        protected override void Delete(IntPtr handle)
+        {
+            NativeMethods.SonnetMessageHandler_delete(handle);
+        }
+
+        protected override void Dispose(bool disposing)
+        {
+            base.Dispose(disposing);
+            if (context.IsAllocated) context.Free();
+        }
+
+        [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static int PrintCallback(IntPtr context, int externalNumber, int detail, byte* source, byte* text)
+        {
+            if (!(GCHandle.FromIntPtr(context).Target is CoinMessageHandler handler)) return 0;
+
+            try
+            {
+                handler.externalNumber = externalNumber;
+                handler.detail = detail;
+                handler.currentSourceText = Marshalling.ToString(source);
+                handler.currentText = Marshalling.ToString(text);
+                return handler.print();
+            }
+            catch (Exception exception)
+            {
+                // Exceptions cannot pass the native code: keep the first, to be thrown after the native call
+                System.Threading.Interlocked.CompareExchange(ref handler.pendingException, exception, null);
+                return 0;
+            }
+        }
+    }
+
+    /// <summary>
+    /// The native event handler of a CbcEventHandler delegate, with its context.
+    /// The context is a (normal) GCHandle, kept by the owner of the native model, and freed when the owner is disposed or finalized.
+    /// </summary>
+    internal static unsafe class CbcEventHandlerNative
+    {
+        internal sealed class Context : ICallbackContext
+        {
+            internal CbcEventHandler EventHandler;
+            internal Exception PendingException;
+
+            public Exception TakePendingException()
+            {
+                return System.Threading.Interlocked.Exchange(ref PendingException, null);
+            }
+        }
+
+        internal static void PassIn(CbcModel model, CbcEventHandler eventHandler, NativeObject owner)
+        {
+            Context context = new Context() { EventHandler = eventHandler };
+            GCHandle handle = GCHandle.Alloc(context);
+            owner.AddCallbackContext(handle);
+
+            IntPtr nativeHandler = NativeMethods.SonnetEventHandler_new((IntPtr)(delegate* unmanaged[Cdecl]<IntPtr, IntPtr, int, int>)&EventCallback, GCHandle.ToIntPtr(handle));
+            if (nativeHandler == IntPtr.Zero) throw CoinError.FromLastError("passInEventHandler");
+            try
+            {
+                // Cbc clones the handler, so the native handler can be deleted here
+                if (NativeMethods.SonnetCbc_passInEventHandler(model.Handle, nativeHandler) < 0) throw CoinError.FromLastError("passInEventHandler");
+                GC.KeepAlive(model);
+            }
+            finally
+            {
+                NativeMethods.SonnetEventHandler_delete(nativeHandler);
+            }
+        }
+
+        [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static int EventCallback(IntPtr context, IntPtr model, int cbcEvent)
+        {
+            if (!(GCHandle.FromIntPtr(context).Target is Context eventContext) || eventContext.EventHandler == null) return (int)CbcAction.noAction;
+
+            try
+            {
+                return (int)eventContext.EventHandler(new CbcModel(model, null), (CbcEvent)cbcEvent);
+            }
+            catch (Exception exception)
+            {
+                // Exceptions cannot pass the native code: keep the first, and stop the search
+                System.Threading.Interlocked.CompareExchange(ref eventContext.PendingException, exception, null);
+                return (int)CbcAction.stop;
+            }
+        }
+    }
+}
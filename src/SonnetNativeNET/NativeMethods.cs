@@ -0,0 +1,494 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace COIN.Native
+{
+    /// <summary>
+    /// The P/Invoke declarations of the C ABI of SonnetNative (see SonnetNative.h).
+    /// All signatures are blittable: handles are IntPtr, arrays are pointers to pinned or stack memory, strings are null-terminated UTF-8 bytes,
+    /// and bools are ints. The functions that only read a member are called without a GC transition (SuppressGCTransition).
+    /// </summary>
+    internal static unsafe class NativeMethods
+    {
+        /// <summary>
+        /// The name of the native library: SonnetNative.dll on Windows, libSonnetNative.so on Linux and libSonnetNative.dylib on macOS.
+        /// </summary>
+        internal const string Library = "SonnetNative";
+
+        // General
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetNative_version();
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern byte* SonnetNative_lastError();
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetNative_supportsThreads();
+
+        // OsiSolverInterface
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetOsi_newClp();
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetOsi_newCbc();
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetOsi_clone(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern void SonnetOsi_delete(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetOsi_getClpModelPtr(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetOsi_getCbcModelPtr(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetOsi_getRealSolverPtr(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_loadProblem(IntPtr osi, int numberColumns, int numberRows, int* starts, int* indices, double* values, double* columnLower, double* columnUpper, double* objective, double* rowLower, double* rowUpper);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_addCols(IntPtr osi, int numberColumns, int* starts, int* rows, double* values, double* columnLower, double* columnUpper, double* objective);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_addRows(IntPtr osi, int numberRows, int* starts, int* columns, double* values, double* rowLower, double* rowUpper);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_deleteCols(IntPtr osi, int count, int* indices);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_deleteRows(IntPtr osi, int count, int* indices);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getNumCols(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getNumRows(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getNumElements(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getNumIntegers(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double SonnetOsi_getInfinity(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getColLower(IntPtr osi, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getColUpper(IntPtr osi, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getObjCoefficients(IntPtr osi, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getRowLower(IntPtr osi, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getRowUpper(IntPtr osi, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getRowSense(IntPtr osi, byte* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getIntegerColumns(IntPtr osi, byte* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_isInteger(IntPtr osi, int index);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getColSolution(IntPtr osi, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getRowActivity(IntPtr osi, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getReducedCost(IntPtr osi, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getRowPrice(IntPtr osi, double* values, int length);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double* SonnetOsi_getColLowerPtr(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double* SonnetOsi_getColUpperPtr(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double* SonnetOsi_getObjCoefficientsPtr(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double* SonnetOsi_getRowLowerPtr(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double* SonnetOsi_getRowUpperPtr(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double* SonnetOsi_getColSolutionPtr(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double* SonnetOsi_getRowActivityPtr(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double* SonnetOsi_getReducedCostPtr(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double* SonnetOsi_getRowPricePtr(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setColLower(IntPtr osi, int first, int count, double* values);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setColUpper(IntPtr osi, int first, int count, double* values);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setObjCoefficients(IntPtr osi, int first, int count, double* values);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setRowLower(IntPtr osi, int first, int count, double* values);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setRowUpper(IntPtr osi, int first, int count, double* values);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setColSetBounds(IntPtr osi, int count, int* indices, double* lower, double* upper);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setRowSetBounds(IntPtr osi, int count, int* indices, double* lower, double* upper);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setInteger(IntPtr osi, int count, int* indices);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setContinuous(IntPtr osi, int count, int* indices);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setColSolution(IntPtr osi, double* values);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setRowPrice(IntPtr osi, double* values);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setObjSense(IntPtr osi, double sense);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double SonnetOsi_getObjSense(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double SonnetOsi_getObjValue(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setColNames(IntPtr osi, int first, int count, byte* names);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setRowNames(IntPtr osi, int first, int count, byte* names);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setObjName(IntPtr osi, byte* name);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getColNames(IntPtr osi, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getRowNames(IntPtr osi, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getObjName(IntPtr osi, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getMatrixByCol(IntPtr osi, int* starts, int startsLength, int* indices, double* values, int elementsLength);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getMatrixByRow(IntPtr osi, int* starts, int startsLength, int* indices, double* values, int elementsLength);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setIntParam(IntPtr osi, int key, int value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getIntParam(IntPtr osi, int key, int* value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setDblParam(IntPtr osi, int key, double value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getDblParam(IntPtr osi, int key, double* value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setHintParam(IntPtr osi, int key, int yesNo, int strength);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getHintParam(IntPtr osi, int key, int* yesNo, int* strength);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setStrParam(IntPtr osi, int key, byte* value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getStrParam(IntPtr osi, int key, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_initialSolve(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_resolve(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_branchAndBound(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_markHotStart(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_solveFromHotStart(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_unmarkHotStart(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_isAbandoned(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_isProvenOptimal(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_isProvenPrimalInfeasible(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_isProvenDualInfeasible(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_isPrimalObjectiveLimitReached(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_isDualObjectiveLimitReached(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_isIterationLimitReached(IntPtr osi);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getIterationCount(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_getBasisStatus(IntPtr osi, int* columnStatus, int* rowStatus);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setBasisStatus(IntPtr osi, int* columnStatus, int* rowStatus);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetOsi_getWarmStart(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetOsi_getEmptyWarmStart(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setWarmStart(IntPtr osi, IntPtr warmStart);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern void SonnetWarmStart_delete(IntPtr warmStart);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_saveBaseModel(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_restoreBaseModel(IntPtr osi, int numberRows);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_saveCbcReferenceSolver(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetOsi_resetCbcToReferenceSolver(IntPtr osi);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_readMps(IntPtr osi, byte* fileName, byte* extension);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_writeMps(IntPtr osi, byte* fileName, byte* extension, double objSense);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_writeLp(IntPtr osi, byte* fileName, byte* extension, double objSense);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_passInMessageHandler(IntPtr osi, IntPtr handler);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetOsi_setLogLevel(IntPtr osi, int level);
+
+        // ClpSimplex
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetClp_new();
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern void SonnetClp_delete(IntPtr clp);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_readMps(IntPtr clp, byte* fileName, int keepNames, int ignoreErrors);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_writeMps(IntPtr clp, byte* fileName, int formatType, int numberAcross, double objSense);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_loadProblem(IntPtr clp, int numberColumns, int numberRows, int* starts, int* indices, double* values, double* columnLower, double* columnUpper, double* objective, double* rowLower, double* rowUpper);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_loadQuadraticObjective(IntPtr clp, int numberColumns, int* starts, int* columns, double* elements);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_modifyCoefficient(IntPtr clp, int row, int column, double element);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_primal(IntPtr clp, int ifValuesPass);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_dual(IntPtr clp, int ifValuesPass);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_initialSolve(IntPtr clp);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_dualRanging(IntPtr clp, int count, int* which, double* costIncrease, int* sequenceIncrease, double* costDecrease, int* sequenceDecrease);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_primalRanging(IntPtr clp, int count, int* which, double* valueIncrease, int* sequenceIncrease, double* valueDecrease, int* sequenceDecrease);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_status(IntPtr clp);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_secondaryStatus(IntPtr clp);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_numberIterations(IntPtr clp);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double SonnetClp_objectiveValue(IntPtr clp);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getNumCols(IntPtr clp);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getNumRows(IntPtr clp);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_setOptimizationDirection(IntPtr clp, double direction);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_setMaximumIterations(IntPtr clp, int value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_setMaximumSeconds(IntPtr clp, double value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_setPrimalTolerance(IntPtr clp, double value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_setDualTolerance(IntPtr clp, double value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_scaling(IntPtr clp, int mode);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_setLogLevel(IntPtr clp, int level);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_passInMessageHandler(IntPtr clp, IntPtr handler);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getColLower(IntPtr clp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getColUpper(IntPtr clp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getObjCoefficients(IntPtr clp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getRowLower(IntPtr clp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getRowUpper(IntPtr clp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getColSolution(IntPtr clp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getRowActivity(IntPtr clp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getReducedCost(IntPtr clp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetClp_getRowPrice(IntPtr clp, double* values, int length);
+
+        // CbcModel
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetCbc_new(IntPtr solver);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern void SonnetCbc_delete(IntPtr cbc);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetCbc_solver(IntPtr cbc);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_branchAndBound(IntPtr cbc);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_main(IntPtr cbc, int argc, byte** argv, double timeLimit);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_setMaximumNodes(IntPtr cbc, int value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_setMaximumSeconds(IntPtr cbc, double value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_setMaximumSolutions(IntPtr cbc, int value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_setAllowableGap(IntPtr cbc, double value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_setAllowableFractionGap(IntPtr cbc, double value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_setNumberThreads(IntPtr cbc, int value);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_setLogLevel(IntPtr cbc, int level);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_setBestSolution(IntPtr cbc, double* solution, int length, double objectiveValue, int check);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_clearDefaultStrategy(IntPtr cbc);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_status(IntPtr cbc);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_secondaryStatus(IntPtr cbc);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_isProvenOptimal(IntPtr cbc);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_isProvenInfeasible(IntPtr cbc);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_isNodeLimitReached(IntPtr cbc);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_isSecondsLimitReached(IntPtr cbc);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_isSolutionLimitReached(IntPtr cbc);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_getNodeCount(IntPtr cbc);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_getIterationCount(IntPtr cbc);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_getSolutionCount(IntPtr cbc);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double SonnetCbc_getObjValue(IntPtr cbc);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double SonnetCbc_getBestPossibleObjValue(IntPtr cbc);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_bestSolution(IntPtr cbc, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_passInEventHandler(IntPtr cbc, IntPtr handler);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetCbc_passInMessageHandler(IntPtr cbc, IntPtr handler);
+
+        // CoinMpsIO and CoinLpIO
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetMpsIO_new();
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern void SonnetMpsIO_delete(IntPtr mps);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_readMps(IntPtr mps, byte* fileName, byte* extension);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_passInMessageHandler(IntPtr mps, IntPtr handler);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getNumCols(IntPtr mps);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getNumRows(IntPtr mps);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getNumElements(IntPtr mps);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double SonnetMpsIO_objectiveOffset(IntPtr mps);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getMatrixByCol(IntPtr mps, int* starts, int startsLength, int* indices, double* values, int elementsLength);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getColLower(IntPtr mps, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getColUpper(IntPtr mps, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getObjCoefficients(IntPtr mps, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getRowLower(IntPtr mps, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getRowUpper(IntPtr mps, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getIntegerColumns(IntPtr mps, byte* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getColNames(IntPtr mps, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getRowNames(IntPtr mps, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getProblemName(IntPtr mps, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMpsIO_getObjectiveName(IntPtr mps, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetLpIO_new();
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern void SonnetLpIO_delete(IntPtr lp);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_readLp(IntPtr lp, byte* fileName);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_passInMessageHandler(IntPtr lp, IntPtr handler);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getNumCols(IntPtr lp);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getNumRows(IntPtr lp);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getNumElements(IntPtr lp);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern double SonnetLpIO_objectiveOffset(IntPtr lp);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getMatrixByCol(IntPtr lp, int* starts, int startsLength, int* indices, double* values, int elementsLength);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getColLower(IntPtr lp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getColUpper(IntPtr lp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getObjCoefficients(IntPtr lp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getRowLower(IntPtr lp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getRowUpper(IntPtr lp, double* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getIntegerColumns(IntPtr lp, byte* values, int length);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getColNames(IntPtr lp, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getRowNames(IntPtr lp, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getProblemName(IntPtr lp, byte* buffer, int capacity);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetLpIO_getObjectiveName(IntPtr lp, byte* buffer, int capacity);
+
+        // Message and event handlers
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetMessageHandler_new(IntPtr print, IntPtr context);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern void SonnetMessageHandler_delete(IntPtr handler);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMessageHandler_setLogLevel(IntPtr handler, int level);
+        [SuppressGCTransition]
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMessageHandler_logLevel(IntPtr handler);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern int SonnetMessageHandler_message(IntPtr handler, int externalNumber, int detail, byte* source, byte* text);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern IntPtr SonnetEventHandler_new(IntPtr @event, IntPtr context);
+        [DllImport(Library, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        internal static extern void SonnetEventHandler_delete(IntPtr handler);
+    }
+}
@@ -0,0 +1,305 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace COIN.Native
+{
+    /// <summary>
+    /// The exception for errors of the native COIN-OR classes, as COIN.CoinError of SonnetWrapper.
+    /// </summary>
+    public class CoinError : Exception
+    {
+        public CoinError(string message)
+            : base(message)
+        {
+        }
+
+        public CoinError(string message, Exception innerException)
+            : base(message, innerException)
+        {
+        }
+
+        /// <summary>
+        /// Create a new CoinError with the last error of SonnetNative on this thread.
+        /// </summary>
+        internal static unsafe CoinError FromLastError(string method)
+        {
+            string message = Marshalling.ToString(NativeMethods.SonnetNative_lastError());
+            return new CoinError(string.IsNullOrEmpty(message) ? "Error in " + method : message);
+        }
+    }
+
+    /// <summary>
+    /// The context of native callbacks, which keeps the exceptions of the callbacks.
+    /// </summary>
+    internal interface ICallbackContext
+    {
+        /// <summary>
+        /// Returns the first exception since the last call, or null.
+        /// </summary>
+        Exception TakePendingException();
+    }
+
+    /// <summary>
+    /// Base class of the wrappers of native objects of SonnetNative, as WrapperBase of SonnetWrapper.
+    /// An owned native object is deleted by Dispose, or else by the finalizer. A borrowed object (like the CbcModel of an OsiCbcSolverInterface)
+    /// is never deleted, and keeps its owner alive.
+    /// </summary>
+    public abstract class NativeObject : IDisposable
+    {
+        private IntPtr handle;
+        private readonly bool ownsHandle;
+        private readonly NativeObject owner;
+        private List<GCHandle> callbackContexts;
+
+        /// <summary>
+        /// Wrap the given owned native object, or throw a CoinError with the last error if the handle is null.
+        /// </summary>
+        protected NativeObject(IntPtr handle, bool ownsHandle, string method)
+        {
+            if (handle == IntPtr.Zero) throw CoinError.FromLastError(method);
+
+            this.handle = handle;
+            this.ownsHandle = ownsHandle;
+            if (!ownsHandle) GC.SuppressFinalize(this);
+        }
+
+        /// <summary>
+        /// Wrap the given native object, borrowed from the given owner (if any).
+        /// </summary>
+        protected NativeObject(IntPtr handle, NativeObject owner, string method)
+            : this(handle, false, method)
+        {
+            this.owner = owner;
+        }
+
+        ~NativeObject()
+        {
+            Dispose(false);
+        }
+
+        /// <summary>
+        /// Gets the handle of the native object. Throws if the object was disposed.
+        /// </summary>
+        public IntPtr Handle
+        {
+            get
+            {
+                if (handle == IntPtr.Zero) throw new ObjectDisposedException(GetType().Name);
+                return handle;
+            }
+        }
+
+        public bool IsDisposed { get { return handle == IntPtr.Zero; } }
+
+        public void Dispose()
+        {
+            Dispose(true);
+            GC.SuppressFinalize(this);
+        }
+
+        protected virtual void Dispose(bool disposing)
+        {
+            IntPtr oldHandle = handle;
+            handle = IntPtr.Zero;
+            if (ownsHandle && oldHandle != IntPtr.Zero) Delete(oldHandle);
+
+            // Only after the native object is deleted, it cannot call back anymore
+            if (callbackContexts != null)
+            {
+                lock (callbackContexts)
+                {
+                    foreach (GCHandle context in callbackContexts) context.Free();
+                    callbackContexts.Clear();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Keep the given context of native callbacks until the (owner of the) native object is deleted.
+        /// </summary>
+        internal void AddCallbackContext(GCHandle context)
+        {
+            if (!ownsHandle)
+            {
+                if (owner == null) throw new NotSupportedException("Cannot pass in a handler to a native object without owner, like the model of an event.");
+                owner.AddCallbackContext(context);
+                return;
+            }
+
+            if (callbackContexts == null) System.Threading.Interlocked.CompareExchange(ref callbackContexts, new List<GCHandle>(), null);
+            lock (callbackContexts) callbackContexts.Add(context);
+        }
+
+        /// <summary>
+        /// Throw the first exception of the callbacks of this (or the owner's) native object since the last call, if any.
+        /// Exceptions cannot pass the native code, so the callbacks keep these until the native call returns.
+        /// </summary>
+        internal void ThrowPending()
+        {
+            if (!ownsHandle)
+            {
+                owner?.ThrowPending();
+                return;
+            }
+
+            if (callbackContexts == null) return;
+
+            Exception exception = null;
+            lock (callbackContexts)
+            {
+                foreach (GCHandle context in callbackContexts)
+                {
+                    Exception pending = (context.Target as ICallbackContext)?.TakePendingException();
+                    if (exception == null) exception = pending;
+                }
+            }
+            if (exception != null) throw new CoinError("Exception in a native callback: " + exception.Message, exception);
+        }
+
+        /// <summary>
+        /// Delete the owned native object.
+        /// </summary>
+        protected abstract void Delete(IntPtr handle);
+
+        /// <summary>
+        /// Replace the owned native object by the given one, returned by a native function that deleted the current one,
+        /// like SonnetOsi_resetCbcToReferenceSolver. Throws a CoinError with the last error if the new handle is null.
+        /// The borrowed objects of the current one (like its CbcModel) are no longer valid.
+        /// </summary>
+        protected void ReplaceHandle(IntPtr newHandle, string method)
+        {
+            if (!ownsHandle) throw new InvalidOperationException("Cannot replace a borrowed native object in " + method);
+            if (newHandle == IntPtr.Zero) throw CoinError.FromLastError(method);
+            handle = newHandle;
+        }
+
+        /// <summary>
+        /// Throw a CoinError with the last error if the result is SONNET_ERROR. Returns the result otherwise.
+        /// </summary>
+        protected int Check(int result, string method)
+        {
+            GC.KeepAlive(this);
+            if (result < 0) throw CoinError.FromLastError(method);
+            return result;
+        }
+    }
+
+    /// <summary>
+    /// Marshalling helpers for the bulk arrays and packed names of SonnetNative.
+    /// </summary>
+    internal static unsafe class Marshalling
+    {
+        /// <summary>
+        /// Get all values of a bulk getter, like SonnetOsi_getColSolution: first the size, then the values.
+        /// </summary>
+        internal static T[] GetArray<T>(NativeObject obj, delegate*<IntPtr, T*, int, int> getter, string method) where T : unmanaged
+        {
+            IntPtr handle = obj.Handle;
+            int n = getter(handle, null, 0);
+            if (n < 0) throw CoinError.FromLastError(method);
+
+            T[] values = new T[n];
+            if (n > 0)
+            {
+                fixed (T* p = values)
+                {
+                    if (getter(handle, p, n) < 0) throw CoinError.FromLastError(method);
+                }
+            }
+            GC.KeepAlive(obj);
+            return values;
+        }
+
+        /// <summary>
+        /// Copy the values of a bulk getter into the given span, without allocating. Returns the number of values of the native object.
+        /// </summary>
+        internal static int GetSpan<T>(NativeObject obj, delegate*<IntPtr, T*, int, int> getter, Span<T> values, string method) where T : unmanaged
+        {
+            fixed (T* p = values)
+            {
+                int n = getter(obj.Handle, p, values.Length);
+                GC.KeepAlive(obj);
+                if (n < 0) throw CoinError.FromLastError(method);
+                return n;
+            }
+        }
+
+        /// <summary>
+        /// Get the packed names of a name getter, like SonnetOsi_getColNames: first the size, then the names.
+        /// </summary>
+        internal static string[] GetNames(NativeObject obj, delegate*<IntPtr, byte*, int, int> getter, string method)
+        {
+            IntPtr handle = obj.Handle;
+            int size = getter(handle, null, 0);
+            if (size < 0) throw CoinError.FromLastError(method);
+
+            byte[] buffer = new byte[size];
+            List<string> names = new List<string>();
+            fixed (byte* p = buffer)
+            {
+                if (size > 0 && getter(handle, p, size) < 0) throw CoinError.FromLastError(method);
+
+                int start = 0;
+                for (int i = 0; i < size; i++)
+                {
+                    if (buffer[i] != 0) continue;
+                    names.Add(Encoding.UTF8.GetString(p + start, i - start));
+                    start = i + 1;
+                }
+            }
+            GC.KeepAlive(obj);
+            return names.ToArray();
+        }
+
+        /// <summary>
+        /// Get a single name of a name getter, like SonnetOsi_getObjName.
+        /// </summary>
+        internal static string GetName(NativeObject obj, delegate*<IntPtr, byte*, int, int> getter, string method)
+        {
+            string[] names = GetNames(obj, getter, method);
+            return names.Length > 0 ? names[0] : string.Empty;
+        }
+
+        /// <summary>
+        /// Pack the given names as null-terminated UTF-8 strings, as expected by SonnetOsi_setColNames.
+        /// </summary>
+        internal static byte[] PackNames(IReadOnlyList<string> names)
+        {
+            int size = 0;
+            for (int i = 0; i < names.Count; i++) size += Encoding.UTF8.GetByteCount(names[i] ?? string.Empty) + 1;
+
+            byte[] buffer = new byte[size];
+            int offset = 0;
+            for (int i = 0; i < names.Count; i++)
+            {
+                offset += Encoding.UTF8.GetBytes(names[i] ?? string.Empty, 0, (names[i] ?? string.Empty).Length, buffer, offset);
+                buffer[offset++] = 0;
+            }
+            return buffer;
+        }
+
+        /// <summary>
+        /// Get the null-terminated UTF-8 bytes of the given string, or null.
+        /// </summary>
+        internal static byte[] ToUtf8(string value)
+        {
+            return value == null ? null : PackNames(new[] { value });
+        }
+
+        /// <summary>
+        /// Get the string of the given null-terminated UTF-8 bytes.
+        /// </summary>
+        internal static string ToString(byte* value)
+        {
+            if (value == null) return null;
+            int length = 0;
+            while (value[length] != 0) length++;
+            return Encoding.UTF8.GetString(value, length);
+        }
+    }
+}
@@ -0,0 +1,804 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+
+namespace COIN.Native
+{
+    public enum OsiIntParam
+    {
+        OsiMaxNumIteration = 0,
+        OsiMaxNumIterationHotStart,
+        OsiNameDiscipline,
+        OsiLastIntParam
+    }
+
+    public enum OsiDblParam
+    {
+        OsiDualObjectiveLimit = 0,
+        OsiPrimalObjectiveLimit,
+        OsiDualTolerance,
+        OsiPrimalTolerance,
+        OsiObjOffset,
+        OsiLastDblParam
+    }
+
+    public enum OsiStrParam
+    {
+        OsiProbName = 0,
+        OsiSolverName,
+        OsiLastStrParam
+    }
+
+    public enum OsiHintParam
+    {
+        OsiDoPresolveInInitial = 0,
+        OsiDoDualInInitial,
+        OsiDoPresolveInResolve,
+        OsiDoDualInResolve,
+        OsiDoScale,
+        OsiDoCrash,
+        OsiDoReducePrint,
+        OsiDoInBranchAndCut,
+        OsiLastHintParam
+    }
+
+    public enum OsiHintStrength
+    {
+        OsiHintIgnore = 0,
+        OsiHintTry,
+        OsiHintDo,
+        OsiForceDo
+    }
+
+    /// <summary>
+    /// OsiSolverInterface via the C ABI of SonnetNative, with the method names of COIN.OsiSolverInterface of SonnetWrapper.
+    /// The arrays are passed in bulk: one native call per array, instead of one per element.
+    /// The getters that only read a member are called without a GC transition, so these are as cheap as a managed call.
+    /// </summary>
+    public unsafe class OsiSolverInterface : NativeObject
+    {
+        private CoinMessageHandler handler;
+
+        internal OsiSolverInterface(IntPtr handle, bool ownsHandle, string method)
+            : base(handle, ownsHandle, method)
+        {
+        }
+
+        internal OsiSolverInterface(IntPtr handle, NativeObject owner)
+            : base(handle, owner, "OsiSolverInterface")
+        {
+        }
+
+        /// <summary>
+        /// Wrap the given owned native solver as OsiClpSolverInterface, OsiCbcSolverInterface or else OsiSolverInterface.
+        /// </summary>
+        internal static OsiSolverInterface Create(IntPtr handle, string method)
+        {
+            if (handle == IntPtr.Zero) throw CoinError.FromLastError(method);
+            if (NativeMethods.SonnetOsi_getClpModelPtr(handle) != IntPtr.Zero) return new OsiClpSolverInterface(handle);
+            if (NativeMethods.SonnetOsi_getCbcModelPtr(handle) != IntPtr.Zero) return new OsiCbcSolverInterface(handle);
+            return new OsiSolverInterface(handle, true, method);
+        }
+
+        protected override void Delete(IntPtr handle)
+        {
+            NativeMethods.SonnetOsi_delete(handle);
+        }
+
+        /// <summary>
+        /// Create a copy of this solver, including its problem and solution.
+        /// </summary>
+        public OsiSolverInterface clone()
+        {
+            OsiSolverInterface copy = Create(NativeMethods.SonnetOsi_clone(Handle), "clone");
+            GC.KeepAlive(this);
+            return copy;
+        }
+
+        #region Problem
+        /// <summary>
+        /// Replace the problem by the given column-ordered problem. Null bounds and objective use the defaults.
+        /// </summary>
+        public void loadProblem(int numberColumns, int numberRows, int[] starts, int[] indices, double[] values,
+            double[] columnLower, double[] columnUpper, double[] objective, double[] rowLower, double[] rowUpper)
+        {
+            fixed (int* pStarts = starts, pIndices = indices)
+            fixed (double* pValues = values, pColumnLower = columnLower, pColumnUpper = columnUpper, pObjective = objective, pRowLower = rowLower, pRowUpper = rowUpper)
+            {
+                Check(NativeMethods.SonnetOsi_loadProblem(Handle, numberColumns, numberRows, pStarts, pIndices, pValues,
+                    pColumnLower, pColumnUpper, pObjective, pRowLower, pRowUpper), "loadProblem");
+            }
+        }
+
+        /// <summary>
+        /// Add columns, given column-ordered. starts has numberColumns + 1 entries.
+        /// </summary>
+        public void addCols(int numberColumns, int[] starts, int[] rows, double[] values, double[] columnLower, double[] columnUpper, double[] objective)
+        {
+            fixed (int* pStarts = starts, pRows = rows)
+            fixed (double* pValues = values, pColumnLower = columnLower, pColumnUpper = columnUpper, pObjective = objective)
+            {
+                Check(NativeMethods.SonnetOsi_addCols(Handle, numberColumns, pStarts, pRows, pValues, pColumnLower, pColumnUpper, pObjective), "addCols");
+            }
+        }
+
+        /// <summary>
+        /// Add rows, given row-ordered. starts has numberRows + 1 entries.
+        /// </summary>
+        public void addRows(int numberRows, int[] starts, int[] columns, double[] values, double[] rowLower, double[] rowUpper)
+        {
+            fixed (int* pStarts = starts, pColumns = columns)
+            fixed (double* pValues = values, pRowLower = rowLower, pRowUpper = rowUpper)
+            {
+                Check(NativeMethods.SonnetOsi_addRows(Handle, numberRows, pStarts, pColumns, pValues, pRowLower, pRowUpper), "addRows");
+            }
+        }
+
+        public void deleteCols(int[] indices)
+        {
+            fixed (int* p = indices) Check(NativeMethods.SonnetOsi_deleteCols(Handle, indices.Length, p), "deleteCols");
+        }
+
+        public void deleteRows(int[] indices)
+        {
+            fixed (int* p = indices) Check(NativeMethods.SonnetOsi_deleteRows(Handle, indices.Length, p), "deleteRows");
+        }
+
+        public int getNumCols() { return NativeMethods.SonnetOsi_getNumCols(Handle); }
+        public int getNumRows() { return NativeMethods.SonnetOsi_getNumRows(Handle); }
+        public int getNumElements() { return NativeMethods.SonnetOsi_getNumElements(Handle); }
+        public int getNumIntegers() { return Check(NativeMethods.SonnetOsi_getNumIntegers(Handle), "getNumIntegers"); }
+        public double getInfinity() { return NativeMethods.SonnetOsi_getInfinity(Handle); }
+
+        /// <summary>
+        /// Replace the problem by the given column-ordered problem in native memory, as loadProblemUnsafe of SonnetWrapper.
+        /// </summary>
+        public void loadProblemUnsafe(int numberColumns, int numberRows, int* starts, int* indices, double* values,
+            double* columnLower, double* columnUpper, double* objective, double* rowLower, double* rowUpper)
+        {
+            Check(NativeMethods.SonnetOsi_loadProblem(Handle, numberColumns, numberRows, starts, indices, values,
+                columnLower, columnUpper, objective, rowLower, rowUpper), "loadProblemUnsafe");
+        }
+
+        /// <summary>
+        /// Add a single column with the given elements. The rows and elements may be null if numberElements is 0.
+        /// </summary>
+        public void addCol(int numberElements, int[] rows, double[] elements, double columnLower, double columnUpper, double objective)
+        {
+            int[] starts = new int[] { 0, numberElements };
+            addCols(1, starts, rows ?? new int[0], elements ?? new double[0], new[] { columnLower }, new[] { columnUpper }, new[] { objective });
+        }
+
+        /// <summary>
+        /// Add a single row with the given elements.
+        /// </summary>
+        public void addRow(int numberElements, int[] columns, double[] elements, double rowLower, double rowUpper)
+        {
+            int[] starts = new int[] { 0, numberElements };
+            addRows(1, starts, columns ?? new int[0], elements ?? new double[0], new[] { rowLower }, new[] { rowUpper });
+        }
+
+        public double[] getColLower() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetOsi_getColLower, "getColLower"); }
+        public double[] getColUpper() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetOsi_getColUpper, "getColUpper"); }
+        public double[] getObjCoefficients() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetOsi_getObjCoefficients, "getObjCoefficients"); }
+        public double[] getRowLower() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetOsi_getRowLower, "getRowLower"); }
+        public double[] getRowUpper() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetOsi_getRowUpper, "getRowUpper"); }
+
+        /// <summary>
+        /// Gets the row senses: 'L', 'G', 'E', 'R' or 'N'.
+        /// </summary>
+        public char[] getRowSense()
+        {
+            byte[] senses = Marshalling.GetArray<byte>(this, &NativeMethods.SonnetOsi_getRowSense, "getRowSense");
+            char[] result = new char[senses.Length];
+            for (int i = 0; i < senses.Length; i++) result[i] = (char)senses[i];
+            return result;
+        }
+
+        /// <summary>
+        /// Gets the arrays of the solver itself, without copying, as the Unsafe getters of SonnetWrapper.
+        /// These are only valid until the problem or solution of the solver changes, and null if not available.
+        /// </summary>
+        public double* getColLowerUnsafe() { return NativeMethods.SonnetOsi_getColLowerPtr(Handle); }
+        public double* getColUpperUnsafe() { return NativeMethods.SonnetOsi_getColUpperPtr(Handle); }
+        public double* getObjCoefficientsUnsafe() { return NativeMethods.SonnetOsi_getObjCoefficientsPtr(Handle); }
+        public double* getRowLowerUnsafe() { return NativeMethods.SonnetOsi_getRowLowerPtr(Handle); }
+        public double* getRowUpperUnsafe() { return NativeMethods.SonnetOsi_getRowUpperPtr(Handle); }
+
+        public bool isInteger(int index) { return Check(NativeMethods.SonnetOsi_isInteger(Handle, index), "isInteger") != 0; }
+
+        /// <summary>
+        /// Gets per column whether it is integer.
+        /// </summary>
+        public bool[] getIntegerColumns()
+        {
+            byte[] integers = Marshalling.GetArray<byte>(this, &NativeMethods.SonnetOsi_getIntegerColumns, "getIntegerColumns");
+            bool[] result = new bool[integers.Length];
+            for (int i = 0; i < integers.Length; i++) result[i] = integers[i] != 0;
+            return result;
+        }
+
+        /// <summary>
+        /// Set the lower bounds of the columns first, .., first + values.Length - 1.
+        /// </summary>
+        public void setColLower(int first, ReadOnlySpan<double> values)
+        {
+            fixed (double* p = values) Check(NativeMethods.SonnetOsi_setColLower(Handle, first, values.Length, p), "setColLower");
+        }
+
+        public void setColLower(int index, double value) { setColLower(index, new ReadOnlySpan<double>(&value, 1)); }
+
+        /// <summary>
+        /// Set the lower bounds of all columns.
+        /// </summary>
+        public void setColLower(double[] values) { setColLower(0, values); }
+
+        /// <summary>
+        /// Set the upper bounds of the columns first, .., first + values.Length - 1.
+        /// </summary>
+        public void setColUpper(int first, ReadOnlySpan<double> values)
+        {
+            fixed (double* p = values) Check(NativeMethods.SonnetOsi_setColUpper(Handle, first, values.Length, p), "setColUpper");
+        }
+
+        public void setColUpper(int index, double value) { setColUpper(index, new ReadOnlySpan<double>(&value, 1)); }
+
+        /// <summary>
+        /// Set the upper bounds of all columns.
+        /// </summary>
+        public void setColUpper(double[] values) { setColUpper(0, values); }
+
+        public void setColBounds(int index, double lower, double upper)
+        {
+            setColSetBounds(new ReadOnlySpan<int>(&index, 1), new ReadOnlySpan<double>(&lower, 1), new ReadOnlySpan<double>(&upper, 1));
+        }
+
+        /// <summary>
+        /// Set the objective coefficients of the columns first, .., first + values.Length - 1.
+        /// </summary>
+        public void setObjCoeff(int first, ReadOnlySpan<double> values)
+        {
+            fixed (double* p = values) Check(NativeMethods.SonnetOsi_setObjCoefficients(Handle, first, values.Length, p), "setObjCoeff");
+        }
+
+        public void setObjCoeff(int index, double value) { setObjCoeff(index, new ReadOnlySpan<double>(&value, 1)); }
+
+        /// <summary>
+        /// Set the objective coefficients of all columns.
+        /// </summary>
+        public void setObjective(double[] values)
+        {
+            if (values.Length != getNumCols()) throw new ArgumentException("The objective must have a coefficient per column.");
+            setObjCoeff(0, values);
+        }
+
+        /// <summary>
+        /// Set the lower bounds of the rows first, .., first + values.Length - 1.
+        /// </summary>
+        public void setRowLower(int first, ReadOnlySpan<double> values)
+        {
+            fixed (double* p = values) Check(NativeMethods.SonnetOsi_setRowLower(Handle, first, values.Length, p), "setRowLower");
+        }
+
+        public void setRowLower(int index, double value) { setRowLower(index, new ReadOnlySpan<double>(&value, 1)); }
+
+        /// <summary>
+        /// Set the upper bounds of the rows first, .., first + values.Length - 1.
+        /// </summary>
+        public void setRowUpper(int first, ReadOnlySpan<double> values)
+        {
+            fixed (double* p = values) Check(NativeMethods.SonnetOsi_setRowUpper(Handle, first, values.Length, p), "setRowUpper");
+        }
+
+        public void setRowUpper(int index, double value) { setRowUpper(index, new ReadOnlySpan<double>(&value, 1)); }
+
+        public void setRowBounds(int index, double lower, double upper)
+        {
+            setRowSetBounds(new ReadOnlySpan<int>(&index, 1), new ReadOnlySpan<double>(&lower, 1), new ReadOnlySpan<double>(&upper, 1));
+        }
+
+        /// <summary>
+        /// Set the type of the row by its sense ('E', 'L', 'G', 'R' or 'N'), right-hand side and range, as OsiSolverInterface::setRowType.
+        /// The sense is an sbyte, as the C++ char of SonnetWrapper.
+        /// </summary>
+        public void setRowType(int index, sbyte sense, double rightHandSide, double range)
+        {
+            double infinity = getInfinity();
+            switch ((char)sense)
+            {
+                case 'E': setRowBounds(index, rightHandSide, rightHandSide); break;
+                case 'L': setRowBounds(index, -infinity, rightHandSide); break;
+                case 'G': setRowBounds(index, rightHandSide, infinity); break;
+                case 'R': setRowBounds(index, rightHandSide - range, rightHandSide); break;
+                case 'N': setRowBounds(index, -infinity, infinity); break;
+                default: throw new ArgumentException("Unknown row sense " + (char)sense, nameof(sense));
+            }
+        }
+
+        /// <summary>
+        /// Set the bounds of the given columns.
+        /// </summary>
+        public void setColSetBounds(ReadOnlySpan<int> indices, ReadOnlySpan<double> lower, ReadOnlySpan<double> upper)
+        {
+            if (lower.Length != indices.Length || upper.Length != indices.Length) throw new ArgumentException("The number of bounds must equal the number of indices.");
+            fixed (int* pIndices = indices)
+            fixed (double* pLower = lower, pUpper = upper)
+            {
+                Check(NativeMethods.SonnetOsi_setColSetBounds(Handle, indices.Length, pIndices, pLower, pUpper), "setColSetBounds");
+            }
+        }
+
+        /// <summary>
+        /// Set the bounds of the given rows.
+        /// </summary>
+        public void setRowSetBounds(ReadOnlySpan<int> indices, ReadOnlySpan<double> lower, ReadOnlySpan<double> upper)
+        {
+            if (lower.Length != indices.Length || upper.Length != indices.Length) throw new ArgumentException("The number of bounds must equal the number of indices.");
+            fixed (int* pIndices = indices)
+            fixed (double* pLower = lower, pUpper = upper)
+            {
+                Check(NativeMethods.SonnetOsi_setRowSetBounds(Handle, indices.Length, pIndices, pLower, pUpper), "setRowSetBounds");
+            }
+        }
+
+        public void setInteger(ReadOnlySpan<int> indices)
+        {
+            fixed (int* p = indices) Check(NativeMethods.SonnetOsi_setInteger(Handle, indices.Length, p), "setInteger");
+        }
+
+        public void setInteger(int index) { setInteger(new ReadOnlySpan<int>(&index, 1)); }
+
+        public void setContinuous(ReadOnlySpan<int> indices)
+        {
+            fixed (int* p = indices) Check(NativeMethods.SonnetOsi_setContinuous(Handle, indices.Length, p), "setContinuous");
+        }
+
+        public void setContinuous(int index) { setContinuous(new ReadOnlySpan<int>(&index, 1)); }
+
+        /// <summary>
+        /// Set the objective sense: 1 to minimise, -1 to maximise.
+        /// </summary>
+        public void setObjSense(double sense) { Check(NativeMethods.SonnetOsi_setObjSense(Handle, sense), "setObjSense"); }
+        public double getObjSense() { return NativeMethods.SonnetOsi_getObjSense(Handle); }
+
+        /// <summary>
+        /// Get the column-ordered matrix, without gaps.
+        /// </summary>
+        public void getMatrixByCol(out int[] starts, out int[] indices, out double[] values)
+        {
+            GetMatrix(&NativeMethods.SonnetOsi_getMatrixByCol, getNumCols(), out starts, out indices, out values, "getMatrixByCol");
+        }
+
+        /// <summary>
+        /// Get the row-ordered matrix, without gaps.
+        /// </summary>
+        public void getMatrixByRow(out int[] starts, out int[] indices, out double[] values)
+        {
+            GetMatrix(&NativeMethods.SonnetOsi_getMatrixByRow, getNumRows(), out starts, out indices, out values, "getMatrixByRow");
+        }
+
+        /// <summary>
+        /// Get a copy of the column-ordered matrix, without gaps.
+        /// </summary>
+        public CoinPackedMatrix getMatrixByCol()
+        {
+            getMatrixByCol(out int[] starts, out int[] indices, out double[] values);
+            return new CoinPackedMatrix(true, starts, indices, values);
+        }
+
+        /// <summary>
+        /// Get a copy of the row-ordered matrix, without gaps.
+        /// </summary>
+        public CoinPackedMatrix getMatrixByRow()
+        {
+            getMatrixByRow(out int[] starts, out int[] indices, out double[] values);
+            return new CoinPackedMatrix(false, starts, indices, values);
+        }
+
+        private void GetMatrix(delegate*<IntPtr, int*, int, int*, double*, int, int> getter, int majorDim, out int[] starts, out int[] indices, out double[] values, string method)
+        {
+            int numberElements = Check(getter(Handle, null, 0, null, null, 0), method);
+            starts = new int[majorDim + 1];
+            indices = new int[numberElements];
+            values = new double[numberElements];
+            fixed (int* pStarts = starts, pIndices = indices)
+            fixed (double* pValues = values)
+            {
+                Check(getter(Handle, pStarts, starts.Length, pIndices, pValues, numberElements), method);
+            }
+        }
+        #endregion
+
+        #region Names
+        /// <summary>
+        /// Set the names of the columns first, .., first + names.Count - 1. Set OsiNameDiscipline to keep the names.
+        /// </summary>
+        public void setColNames(int first, IReadOnlyList<string> names)
+        {
+            fixed (byte* p = Marshalling.PackNames(names)) Check(NativeMethods.SonnetOsi_setColNames(Handle, first, names.Count, p), "setColNames");
+        }
+
+        public void setColName(int index, string name) { setColNames(index, new[] { name }); }
+
+        /// <summary>
+        /// Set the names of the rows first, .., first + names.Count - 1. Set OsiNameDiscipline to keep the names.
+        /// </summary>
+        public void setRowNames(int first, IReadOnlyList<string> names)
+        {
+            fixed (byte* p = Marshalling.PackNames(names)) Check(NativeMethods.SonnetOsi_setRowNames(Handle, first, names.Count, p), "setRowNames");
+        }
+
+        public void setRowName(int index, string name) { setRowNames(index, new[] { name }); }
+
+        public void setObjName(string name)
+        {
+            fixed (byte* p = Marshalling.ToUtf8(name ?? string.Empty)) Check(NativeMethods.SonnetOsi_setObjName(Handle, p), "setObjName");
+        }
+
+        /// <summary>
+        /// Gets the names of all columns, in a single native call.
+        /// </summary>
+        public string[] getColNames() { return Marshalling.GetNames(this, &NativeMethods.SonnetOsi_getColNames, "getColNames"); }
+
+        /// <summary>
+        /// Gets the names of all rows, in a single native call.
+        /// </summary>
+        public string[] getRowNames() { return Marshalling.GetNames(this, &NativeMethods.SonnetOsi_getRowNames, "getRowNames"); }
+
+        public string getObjName() { return Marshalling.GetName(this, &NativeMethods.SonnetOsi_getObjName, "getObjName"); }
+        #endregion
+
+        #region Parameters
+        public bool setIntParam(OsiIntParam key, int value)
+        {
+            return Check(NativeMethods.SonnetOsi_setIntParam(Handle, (int)key, value), "setIntParam") != 0;
+        }
+
+        public bool getIntParam(OsiIntParam key, out int value)
+        {
+            int result;
+            int success = Check(NativeMethods.SonnetOsi_getIntParam(Handle, (int)key, &result), "getIntParam");
+            value = result;
+            return success != 0;
+        }
+
+        public bool setDblParam(OsiDblParam key, double value)
+        {
+            return Check(NativeMethods.SonnetOsi_setDblParam(Handle, (int)key, value), "setDblParam") != 0;
+        }
+
+        public bool getDblParam(OsiDblParam key, out double value)
+        {
+            double result;
+            int success = Check(NativeMethods.SonnetOsi_getDblParam(Handle, (int)key, &result), "getDblParam");
+            value = result;
+            return success != 0;
+        }
+
+        public bool setHintParam(OsiHintParam key, bool yesNo = true, OsiHintStrength strength = OsiHintStrength.OsiHintTry)
+        {
+            return Check(NativeMethods.SonnetOsi_setHintParam(Handle, (int)key, yesNo ? 1 : 0, (int)strength), "setHintParam") != 0;
+        }
+
+        public bool getHintParam(OsiHintParam key, out bool yesNo, out OsiHintStrength strength)
+        {
+            int resultYesNo, resultStrength;
+            int success = Check(NativeMethods.SonnetOsi_getHintParam(Handle, (int)key, &resultYesNo, &resultStrength), "getHintParam");
+            yesNo = resultYesNo != 0;
+            strength = (OsiHintStrength)resultStrength;
+            return success != 0;
+        }
+
+        public bool getHintParam(OsiHintParam key, out bool yesNo)
+        {
+            return getHintParam(key, out yesNo, out OsiHintStrength _);
+        }
+
+        public bool setStrParam(OsiStrParam key, string value)
+        {
+            fixed (byte* p = Marshalling.ToUtf8(value ?? string.Empty))
+            {
+                return Check(NativeMethods.SonnetOsi_setStrParam(Handle, (int)key, p), "setStrParam") != 0;
+            }
+        }
+
+        public bool getStrParam(OsiStrParam key, out string value)
+        {
+            int size = Check(NativeMethods.SonnetOsi_getStrParam(Handle, (int)key, null, 0), "getStrParam");
+            byte[] buffer = new byte[size];
+            fixed (byte* p = buffer)
+            {
+                Check(NativeMethods.SonnetOsi_getStrParam(Handle, (int)key, p, size), "getStrParam");
+                value = Marshalling.ToString(p);
+            }
+            return true;
+        }
+        #endregion
+
+        #region Solve
+        public void initialSolve() { CheckSolve(NativeMethods.SonnetOsi_initialSolve(Handle), "initialSolve"); }
+        public void resolve() { CheckSolve(NativeMethods.SonnetOsi_resolve(Handle), "resolve"); }
+        public void branchAndBound() { CheckSolve(NativeMethods.SonnetOsi_branchAndBound(Handle), "branchAndBound"); }
+        public void markHotStart() { CheckSolve(NativeMethods.SonnetOsi_markHotStart(Handle), "markHotStart"); }
+        public void solveFromHotStart() { CheckSolve(NativeMethods.SonnetOsi_solveFromHotStart(Handle), "solveFromHotStart"); }
+        public void unmarkHotStart() { Check(NativeMethods.SonnetOsi_unmarkHotStart(Handle), "unmarkHotStart"); }
+
+        /// <summary>
+        /// Check the result of a solve, and throw the exceptions of the message handler and event handlers during the solve, if any.
+        /// </summary>
+        private void CheckSolve(int result, string method)
+        {
+            Check(result, method);
+            handler?.ThrowPendingPrint();
+            ThrowPending();
+        }
+
+        public bool isAbandoned() { return NativeMethods.SonnetOsi_isAbandoned(Handle) != 0; }
+        public bool isProvenOptimal() { return NativeMethods.SonnetOsi_isProvenOptimal(Handle) != 0; }
+        public bool isProvenPrimalInfeasible() { return NativeMethods.SonnetOsi_isProvenPrimalInfeasible(Handle) != 0; }
+        public bool isProvenDualInfeasible() { return NativeMethods.SonnetOsi_isProvenDualInfeasible(Handle) != 0; }
+        public bool isPrimalObjectiveLimitReached() { return NativeMethods.SonnetOsi_isPrimalObjectiveLimitReached(Handle) != 0; }
+        public bool isDualObjectiveLimitReached() { return NativeMethods.SonnetOsi_isDualObjectiveLimitReached(Handle) != 0; }
+        public bool isIterationLimitReached() { return NativeMethods.SonnetOsi_isIterationLimitReached(Handle) != 0; }
+        public int getIterationCount() { return NativeMethods.SonnetOsi_getIterationCount(Handle); }
+        public double getObjValue() { return NativeMethods.SonnetOsi_getObjValue(Handle); }
+        #endregion
+
+        #region Solution
+        public double[] getColSolution() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetOsi_getColSolution, "getColSolution"); }
+        public double[] getRowActivity() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetOsi_getRowActivity, "getRowActivity"); }
+        public double[] getReducedCost() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetOsi_getReducedCost, "getReducedCost"); }
+        public double[] getRowPrice() { return Marshalling.GetArray<double>(this, &NativeMethods.SonnetOsi_getRowPrice, "getRowPrice"); }
+
+        /// <summary>
+        /// Copy the primal solution into the given span, without allocating. Returns the number of columns.
+        /// </summary>
+        public int getColSolution(Span<double> values) { return Marshalling.GetSpan(this, &NativeMethods.SonnetOsi_getColSolution, values, "getColSolution"); }
+        /// <summary>
+        /// Copy the row activities into the given span, without allocating. Returns the number of rows.
+        /// </summary>
+        public int getRowActivity(Span<double> values) { return Marshalling.GetSpan(this, &NativeMethods.SonnetOsi_getRowActivity, values, "getRowActivity"); }
+        /// <summary>
+        /// Copy the reduced costs into the given span, without allocating. Returns the number of columns.
+        /// </summary>
+        public int getReducedCost(Span<double> values) { return Marshalling.GetSpan(this, &NativeMethods.SonnetOsi_getReducedCost, values, "getReducedCost"); }
+        /// <summary>
+        /// Copy the dual solution into the given span, without allocating. Returns the number of rows.
+        /// </summary>
+        public int getRowPrice(Span<double> values) { return Marshalling.GetSpan(this, &NativeMethods.SonnetOsi_getRowPrice, values, "getRowPrice"); }
+
+        /// <summary>
+        /// Gets the solution arrays of the solver itself, without copying, as the Unsafe getters of SonnetWrapper.
+        /// These are only valid until the problem or solution of the solver changes, and null if not available.
+        /// </summary>
+        public double* getColSolutionUnsafe() { return NativeMethods.SonnetOsi_getColSolutionPtr(Handle); }
+        public double* getRowActivityUnsafe() { return NativeMethods.SonnetOsi_getRowActivityPtr(Handle); }
+        public double* getReducedCostUnsafe() { return NativeMethods.SonnetOsi_getReducedCostPtr(Handle); }
+        public double* getRowPriceUnsafe() { return NativeMethods.SonnetOsi_getRowPricePtr(Handle); }
+
+        /// <summary>
+        /// Set the primal solution of all columns.
+        /// </summary>
+        public void setColSolution(ReadOnlySpan<double> values)
+        {
+            if (values.Length < getNumCols()) throw new ArgumentException("The solution must have a value per column.");
+            fixed (double* p = values) Check(NativeMethods.SonnetOsi_setColSolution(Handle, p), "setColSolution");
+        }
+
+        /// <summary>
+        /// Set the dual solution of all rows.
+        /// </summary>
+        public void setRowPrice(ReadOnlySpan<double> values)
+        {
+            if (values.Length < getNumRows()) throw new ArgumentException("The dual solution must have a value per row.");
+            fixed (double* p = values) Check(NativeMethods.SonnetOsi_setRowPrice(Handle, p), "setRowPrice");
+        }
+
+        /// <summary>
+        /// Set the primal solution of all columns from native memory (getNumCols() values).
+        /// </summary>
+        public void setColSolutionUnsafe(double* values) { Check(NativeMethods.SonnetOsi_setColSolution(Handle, values), "setColSolutionUnsafe"); }
+
+        /// <summary>
+        /// Set the dual solution of all rows from native memory (getNumRows() values).
+        /// </summary>
+        public void setRowPriceUnsafe(double* values) { Check(NativeMethods.SonnetOsi_setRowPrice(Handle, values), "setRowPriceUnsafe"); }
+
+        /// <summary>
+        /// Get the basis status of all columns and rows (0 free, 1 basic, 2 at upper, 3 at lower).
+        /// </summary>
+        public void getBasisStatus(out int[] columnStatus, out int[] rowStatus)
+        {
+            columnStatus = new int[getNumCols()];
+            rowStatus = new int[getNumRows()];
+            fixed (int* pColumnStatus = columnStatus, pRowStatus = rowStatus)
+            {
+                Check(NativeMethods.SonnetOsi_getBasisStatus(Handle, pColumnStatus, pRowStatus), "getBasisStatus");
+            }
+        }
+
+        /// <summary>
+        /// Set the basis status of all columns and rows. Returns 0 if the basis was accepted.
+        /// </summary>
+        public int setBasisStatus(int[] columnStatus, int[] rowStatus)
+        {
+            if (columnStatus.Length < getNumCols() || rowStatus.Length < getNumRows()) throw new ArgumentException("The basis must have a status per column and per row.");
+            fixed (int* pColumnStatus = columnStatus, pRowStatus = rowStatus)
+            {
+                return Check(NativeMethods.SonnetOsi_setBasisStatus(Handle, pColumnStatus, pRowStatus), "setBasisStatus");
+            }
+        }
+
+        /// <summary>
+        /// Get a copy of the warm start (basis) of the solver, to be disposed by the caller.
+        /// </summary>
+        public CoinWarmStart getWarmStart()
+        {
+            CoinWarmStart warmStart = new CoinWarmStart(NativeMethods.SonnetOsi_getWarmStart(Handle), "getWarmStart");
+            GC.KeepAlive(this);
+            return warmStart;
+        }
+
+        /// <summary>
+        /// Get an empty warm start of the type of the solver, to be disposed by the caller.
+        /// </summary>
+        public CoinWarmStart getEmptyWarmStart()
+        {
+            CoinWarmStart warmStart = new CoinWarmStart(NativeMethods.SonnetOsi_getEmptyWarmStart(Handle), "getEmptyWarmStart");
+            GC.KeepAlive(this);
+            return warmStart;
+        }
+
+        /// <summary>
+        /// Set the warm start of the solver, which keeps a copy. Returns whether the warm start was accepted.
+        /// </summary>
+        public bool setWarmStart(CoinWarmStart warmStart)
+        {
+            if (warmStart == null) throw new ArgumentNullException(nameof(warmStart));
+            bool result = Check(NativeMethods.SonnetOsi_setWarmStart(Handle, warmStart.Handle), "setWarmStart") != 0;
+            GC.KeepAlive(warmStart);
+            return result;
+        }
+
+        /// <summary>
+        /// Save the bounds and rows of the solver, to be restored by restoreBaseModel.
+        /// </summary>
+        public void saveBaseModel() { Check(NativeMethods.SonnetOsi_saveBaseModel(Handle), "saveBaseModel"); }
+
+        /// <summary>
+        /// Restore the saved bounds, and keep only the first numberRows rows.
+        /// </summary>
+        public void restoreBaseModel(int numberRows) { Check(NativeMethods.SonnetOsi_restoreBaseModel(Handle, numberRows), "restoreBaseModel"); }
+        #endregion
+
+        #region Files and messages
+        /// <summary>
+        /// Read an mps file. Returns the number of errors, so 0 is success.
+        /// </summary>
+        public int readMps(string fileName, string extension = "mps")
+        {
+            fixed (byte* pFileName = Marshalling.ToUtf8(fileName), pExtension = Marshalling.ToUtf8(extension))
+            {
+                return Check(NativeMethods.SonnetOsi_readMps(Handle, pFileName, pExtension), "readMps");
+            }
+        }
+
+        public void writeMps(string fileName, string extension = "mps", double objSense = 0.0)
+        {
+            fixed (byte* pFileName = Marshalling.ToUtf8(fileName), pExtension = Marshalling.ToUtf8(extension))
+            {
+                Check(NativeMethods.SonnetOsi_writeMps(Handle, pFileName, pExtension, objSense), "writeMps");
+            }
+        }
+
+        /// <summary>
+        /// Write the problem to an lp file, with the names of the columns and rows.
+        /// </summary>
+        public void writeLp(string fileName, string extension = "lp", double objSense = 0.0)
+        {
+            fixed (byte* pFileName = Marshalling.ToUtf8(fileName), pExtension = Marshalling.ToUtf8(extension))
+            {
+                Check(NativeMethods.SonnetOsi_writeLp(Handle, pFileName, pExtension, objSense), "writeLp");
+            }
+        }
+
+        /// <summary>
+        /// Pass in the message handler. The solver keeps a reference to the handler.
+        /// </summary>
+        public virtual void passInMessageHandler(CoinMessageHandler handler)
+        {
+            if (handler == null) throw new ArgumentNullException(nameof(handler));
+            Check(NativeMethods.SonnetOsi_passInMessageHandler(Handle, handler.Handle), "passInMessageHandler");
+            this.handler = handler;
+            GC.KeepAlive(handler);
+        }
+
+        /// <summary>
+        /// Gets the message handler that was passed in, or null.
+        /// </summary>
+        public CoinMessageHandler messageHandler() { return handler; }
+
+        /// <summary>
+        /// Set the log level of the current message handler of the solver.
+        /// </summary>
+        public void setLogLevel(int level) { Check(NativeMethods.SonnetOsi_setLogLevel(Handle, level), "setLogLevel"); }
+        #endregion
+    }
+
+    /// <summary>
+    /// OsiClpSolverInterface via the C ABI of SonnetNative.
+    /// </summary>
+    public class OsiClpSolverInterface : OsiSolverInterface
+    {
+        public OsiClpSolverInterface()
+            : base(NativeMethods.SonnetOsi_newClp(), true, "OsiClpSolverInterface")
+        {
+        }
+
+        internal OsiClpSolverInterface(IntPtr handle)
+            : base(handle, true, "OsiClpSolverInterface")
+        {
+        }
+
+        /// <summary>
+        /// Gets the ClpSimplex of this solver, which is owned by this solver.
+        /// </summary>
+        public ClpSimplex getModelPtr()
+        {
+            return new ClpSimplex(NativeMethods.SonnetOsi_getClpModelPtr(Handle), this);
+        }
+    }
+
+    /// <summary>
+    /// OsiCbcSolverInterface via the C ABI of SonnetNative, with an OsiClpSolverInterface as the LP solver.
+    /// </summary>
+    public class OsiCbcSolverInterface : OsiSolverInterface
+    {
+        public OsiCbcSolverInterface()
+            : base(NativeMethods.SonnetOsi_newCbc(), true, "OsiCbcSolverInterface")
+        {
+        }
+
+        internal OsiCbcSolverInterface(IntPtr handle)
+            : base(handle, true, "OsiCbcSolverInterface")
+        {
+        }
+
+        /// <summary>
+        /// Gets the CbcModel of this solver, which is owned by this solver.
+        /// </summary>
+        public CbcModel getModelPtr()
+        {
+            return new CbcModel(NativeMethods.SonnetOsi_getCbcModelPtr(Handle), this);
+        }
+
+        /// <summary>
+        /// Gets the CbcModel of this solver, as the Model property of SonnetWrapper.
+        /// </summary>
+        public CbcModel Model { get { return getModelPtr(); } }
+
+        /// <summary>
+        /// Save the current LP solver of the model as its reference solver, to be restored by resetModelToReferenceSolver.
+        /// </summary>
+        public void saveModelReferenceSolver() { Check(NativeMethods.SonnetOsi_saveCbcReferenceSolver(Handle), "saveModelReferenceSolver"); }
+
+        /// <summary>
+        /// Replace the native solver by a new one with a copy of the reference solver of the model, keeping the message handler.
+        /// The models and solvers obtained from this solver before (getModelPtr, getRealSolverPtr) are no longer valid.
+        /// </summary>
+        public void resetModelToReferenceSolver()
+        {
+            ReplaceHandle(NativeMethods.SonnetOsi_resetCbcToReferenceSolver(Handle), "resetModelToReferenceSolver");
+        }
+
+        /// <summary>
+        /// Gets the LP solver of this solver, which is owned by this solver.
+        /// </summary>
+        public OsiSolverInterface getRealSolverPtr()
+        {
+            return new OsiSolverInterface(NativeMethods.SonnetOsi_getRealSolverPtr(Handle), this);
+        }
+    }
+}
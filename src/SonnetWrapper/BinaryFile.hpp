@@ -0,0 +1,242 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+// Helpers shared by the native binary file formats (ProblemSnapshot, SolutionFile, ProblemPatch): a file is a fixed header
+// followed by sections (arrays) that are each padded to 8 bytes, and a checksum over all of it.
+// Only to be included in files compiled without /clr.
+
+#include <CoinError.hpp>
+#include <CoinFinite.hpp>
+#include <CoinWarmStartBasis.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace BinaryFile
+{
+	const uint32_t ByteOrderMark = 0x01020304;
+	const size_t WriteBufferSize = 1 << 20;
+
+	inline size_t padded(size_t bytes)
+	{
+		return (bytes + 7) & ~static_cast<size_t>(7);
+	}
+
+	/// The number of bytes of each status array of a CoinWarmStartBasis, which are packed per 4 bytes.
+	inline size_t basisStatusSize(int n)
+	{
+		return 4 * static_cast<size_t>((n + 15) >> 4);
+	}
+
+	/// Returns the status of a nonbasic column at a finite bound, or free.
+	inline CoinWarmStartBasis::Status nonbasicStatus(double lower, double upper)
+	{
+		if (lower > -COIN_DBL_MAX) return CoinWarmStartBasis::atLowerBound;
+		if (upper < COIN_DBL_MAX) return CoinWarmStartBasis::atUpperBound;
+		return CoinWarmStartBasis::isFree;
+	}
+
+	/// Restores the number of basic variables of a basis to its number of rows, after columns or rows of the basis were
+	/// removed, added or matched to another problem: first slacks of nonbasic rows become basic, and then basic columns
+	/// become nonbasic, the last ones first. Without column bounds (nullptr), such columns are set at their lower bound.
+	inline void repairBasis(CoinWarmStartBasis &basis, const double *colLower, const double *colUpper)
+	{
+		const int numberRows = basis.getNumArtificial();
+		const int numberColumns = basis.getNumStructural();
+		int numberBasic = basis.numberBasicStructurals();
+		for (int i = 0; i < numberRows; i++)
+		{
+			if (basis.getArtifStatus(i) == CoinWarmStartBasis::basic) numberBasic++;
+		}
+
+		for (int i = 0; i < numberRows && numberBasic < numberRows; i++)
+		{
+			if (basis.getArtifStatus(i) != CoinWarmStartBasis::basic)
+			{
+				basis.setArtifStatus(i, CoinWarmStartBasis::basic);
+				numberBasic++;
+			}
+		}
+
+		for (int j = numberColumns - 1; j >= 0 && numberBasic > numberRows; j--)
+		{
+			if (basis.getStructStatus(j) == CoinWarmStartBasis::basic)
+			{
+				basis.setStructStatus(j, colLower != nullptr ? nonbasicStatus(colLower[j], colUpper[j]) : CoinWarmStartBasis::atLowerBound);
+				numberBasic--;
+			}
+		}
+	}
+
+	/// A 64-bit FNV-1a checksum over 64-bit words, such that it is fast enough to verify on every load.
+	/// The data can be added in parts of any size; the result is that of the concatenated data.
+	class Checksum
+	{
+	public:
+		Checksum() : hash_(0xcbf29ce484222325ULL), pendingSize_(0) {}
+
+		void add(const void *data, size_t size)
+		{
+			const unsigned char *p = static_cast<const unsigned char *>(data);
+			while (pendingSize_ > 0 && size > 0)
+			{
+				pending_[pendingSize_++] = *p++;
+				size--;
+				if (pendingSize_ == 8)
+				{
+					addWord(pending_);
+					pendingSize_ = 0;
+				}
+			}
+
+			for (; size >= 8; p += 8, size -= 8) addWord(p);
+
+			if (size > 0) memcpy(pending_, p, size);
+			pendingSize_ = size;
+		}
+
+		uint64_t value() const
+		{
+			uint64_t hash = hash_;
+			for (size_t i = 0; i < pendingSize_; i++) hash = (hash ^ pending_[i]) * Prime;
+			return hash;
+		}
+
+	private:
+		static const uint64_t Prime = 0x100000001b3ULL;
+
+		void addWord(const unsigned char *p)
+		{
+			uint64_t word;
+			memcpy(&word, p, 8);
+			hash_ = (hash_ ^ word) * Prime;
+		}
+
+		uint64_t hash_;
+		unsigned char pending_[8];
+		size_t pendingSize_;
+	};
+
+	/// An array to be written as a section of a file
+	struct Section
+	{
+		const void *data;
+		size_t size;
+	};
+
+	/// Returns the size of a file with a header of the given size and the given sections.
+	inline uint64_t fileSize(size_t headerSize, const std::vector<Section> &sections)
+	{
+		uint64_t result = headerSize;
+		for (const Section &section : sections) result += padded(section.size);
+		return result;
+	}
+
+	/// Returns the checksum of the first checksumOffset bytes of the header, and of all (padded) sections.
+	inline uint64_t checksumOf(const void *header, size_t checksumOffset, const std::vector<Section> &sections)
+	{
+		static const char padding[8] = { 0 };
+		Checksum checksum;
+		checksum.add(header, checksumOffset);
+		for (const Section &section : sections)
+		{
+			checksum.add(section.data, section.size);
+			checksum.add(padding, padded(section.size) - section.size);
+		}
+		return checksum.value();
+	}
+
+	/// Closes the file on destruction, such that it is closed if writing throws.
+	struct FileCloser
+	{
+		void operator()(FILE *file) const { fclose(file); }
+	};
+
+	/// Writes the header and the padded sections to the given file. On failure the file is removed,
+	/// and a CoinError is thrown with the given method and class name.
+	inline void write(const char *filename, const void *header, size_t headerSize, const std::vector<Section> &sections,
+		const char *methodName, const char *className)
+	{
+		static const char padding[8] = { 0 };
+
+		std::unique_ptr<FILE, FileCloser> file(fopen(filename, "wb"));
+		if (!file) throw CoinError(std::string("Unable to create file ") + filename, methodName, className);
+		setvbuf(file.get(), nullptr, _IOFBF, WriteBufferSize);
+
+		bool success = fwrite(header, headerSize, 1, file.get()) == 1;
+		for (const Section &section : sections)
+		{
+			if (!success) break;
+
+			size_t paddingSize = padded(section.size) - section.size;
+			if (section.size > 0) success = fwrite(section.data, 1, section.size, file.get()) == section.size;
+			if (success && paddingSize > 0) success = fwrite(padding, 1, paddingSize, file.get()) == paddingSize;
+		}
+
+		if (fclose(file.release()) != 0) success = false;
+		if (!success)
+		{
+			remove(filename);
+			throw CoinError(std::string("Unable to write file ") + filename, methodName, className);
+		}
+	}
+
+	/// Returns true iff the given file exists and starts with the given magic bytes.
+	inline bool hasMagic(const char *filename, const char *magic, size_t size)
+	{
+		FILE *file = fopen(filename, "rb");
+		if (file == nullptr) return false;
+
+		std::vector<char> buffer(size);
+		bool result = fread(buffer.data(), 1, size, file) == size && memcmp(buffer.data(), magic, size) == 0;
+		fclose(file);
+		return result;
+	}
+
+	/// Reads the consecutive sections of a mapped file, checking that each section lies within the file.
+	/// Errors are thrown as CoinError with the given method and class name.
+	class SectionReader
+	{
+	public:
+		SectionReader(const char *begin, const char *end, const char *methodName, const char *className)
+			: position_(begin), end_(end), methodName_(methodName), className_(className)
+		{
+		}
+
+		template<class T>
+		const T *next(size_t count)
+		{
+			size_t available = static_cast<size_t>(end_ - position_);
+			if (count > available / sizeof(T) || padded(count * sizeof(T)) > available) throw CoinError("File is truncated", methodName_, className_);
+			size_t size = padded(count * sizeof(T));
+
+			const T *result = reinterpret_cast<const T *>(position_);
+			position_ += size;
+			return result;
+		}
+
+		/// Reads the next null-terminated string from [position, end) of a strings section, and moves position past it.
+		std::string nextString(const char *&position, const char *end) const
+		{
+			const char *stringEnd = static_cast<const char *>(memchr(position, '\0', end - position));
+			if (stringEnd == nullptr) throw CoinError("File has invalid names", methodName_, className_);
+
+			std::string result(position, stringEnd);
+			position = stringEnd + 1;
+			return result;
+		}
+
+	private:
+		const char *position_;
+		const char *end_;
+		const char *methodName_;
+		const char *className_;
+	};
+}
@@ -0,0 +1,29 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "BufferedMessageHandler.h"
+
+#include <vector>
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	int BufferedMessageHandler::take(System::Text::StringBuilder ^ text, int maximum)
+	{
+		if (maximum <= 0) return 0;
+
+		// One transition for the whole batch
+		std::vector<::BufferedMessageHandler::Message> messages;
+		messages.reserve(maximum < 1024 ? maximum : 1024);
+		int count = Base->take(messages, maximum);
+
+		for (const ::BufferedMessageHandler::Message &message : messages)
+		{
+			text->Append(gcnew String(message.text.c_str()));
+			text->Append(L'\n');
+		}
+		return count;
+	}
+}
@@ -0,0 +1,143 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "CoinMessageHandler.h"
+
+#include "BufferedMessageHandler.hpp"
+
+#include "CoinError.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// Native message handler that filters the messages by number and detail level, and appends the accepted messages to a
+	/// lock-free ring buffer without calling managed code. The messages are taken from the buffer in batches, for example
+	/// by a background thread. See BufferedMessageHandler.hpp.
+	public ref class BufferedMessageHandler : WrapperBase<::BufferedMessageHandler>
+	{
+	public:
+		/// The default number of messages in the ring buffer.
+		literal int DefaultCapacity = ::BufferedMessageHandler::DefaultCapacity;
+		/// The maximum number of characters of a buffered message. Longer messages are truncated.
+		literal int MaxTextLength = ::BufferedMessageHandler::MaxTextLength;
+		/// Messages with an external number from 0 up to this number can be disabled individually.
+		literal int MaxExternalNumber = ::BufferedMessageHandler::MaxExternalNumber;
+
+		BufferedMessageHandler() {}
+
+		/// Construct a handler with a ring buffer of the given number of messages, rounded up to a power of two.
+		BufferedMessageHandler(int capacity)
+			: WrapperBase(new ::BufferedMessageHandler(capacity))
+		{
+			deleteBase = true;
+		}
+
+		/// Gets the message handler to pass in to solvers, like OsiSolverInterface::passInMessageHandler.
+		/// The handler can only be used while this object is alive.
+		property CoinMessageHandler ^ Handler
+		{
+			CoinMessageHandler ^ get()
+			{
+				if (handler == nullptr) handler = gcnew CoinMessageHandler(Base);
+				return handler;
+			}
+		}
+
+		/// Returns a new handler that shares the ring buffer and the filters of this one, but not its current message.
+		/// A message handler builds one message at a time, so each thread that prints (not through a solver) needs its own clone.
+		BufferedMessageHandler ^ clone()
+		{
+			return gcnew BufferedMessageHandler(static_cast<::BufferedMessageHandler *>(Base->clone()));
+		}
+
+		int logLevel()
+		{
+			return Base->logLevel();
+		}
+
+		void setLogLevel(int value)
+		{
+			Base->setLogLevel(value);
+		}
+
+		/// Set the maximum detail level of accepted messages, or -1 to accept all levels (= Default). Applies on top of the log level.
+		/// Unlike the log level, this filter is applied after the message is formatted.
+		void setMaximumDetail(int value)
+		{
+			Base->setMaximumDetail(value);
+		}
+
+		/// Get the maximum detail level of accepted messages, or -1 if all levels are accepted.
+		int getMaximumDetail()
+		{
+			return Base->getMaximumDetail();
+		}
+
+		/// Enable or disable the messages with the given external number (from 0 to MaxExternalNumber). All messages are enabled by default.
+		void setMessageEnabled(int externalNumber, bool enabled)
+		{
+			try
+			{
+				Base->setMessageEnabled(externalNumber, enabled);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		/// Returns true iff the messages with the given external number are enabled.
+		bool isMessageEnabled(int externalNumber)
+		{
+			return Base->isMessageEnabled(externalNumber);
+		}
+
+		/// Move at most maximum messages from the buffer to the given text, one line per message, in the order of printing.
+		/// Returns the number of messages taken. Can be called while solvers print on other threads.
+		int take(System::Text::StringBuilder ^ text, int maximum);
+
+		/// Get the number of messages in the ring buffer.
+		int getCapacity()
+		{
+			return Base->getCapacity();
+		}
+
+		/// Get the number of messages currently in the buffer.
+		int getNumberBuffered()
+		{
+			return Base->getNumberBuffered();
+		}
+
+		/// Get the number of messages dropped because the buffer was full.
+		long long getNumberDropped()
+		{
+			return Base->getNumberDropped();
+		}
+
+		/// Get the number of messages not buffered because of the filters.
+		long long getNumberFiltered()
+		{
+			return Base->getNumberFiltered();
+		}
+
+		/// Get the number of buffered messages that were truncated to MaxTextLength characters.
+		long long getNumberTruncated()
+		{
+			return Base->getNumberTruncated();
+		}
+
+	private:
+		BufferedMessageHandler(::BufferedMessageHandler *clone)
+			: WrapperBase(clone)
+		{
+			deleteBase = true;
+		}
+
+		CoinMessageHandler ^ handler;
+	};
+}
@@ -0,0 +1,91 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CoinMessageHandler.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/** Native message handler that filters messages by number and detail level, and appends the accepted messages
+	to a lock-free ring buffer, instead of printing them. A consumer (like the managed SonnetLog) takes the messages
+	from the buffer in batches, on another thread.
+
+	print() never blocks and never calls managed code: if the buffer is full, the message is dropped and counted.
+	Messages longer than MaxTextLength characters are truncated. The ring buffer is a bounded multi-producer queue
+	(as Vyukov's), such that clones of this handler, for example of Cbc threads, share the buffer and the filters
+	of the original. Taking messages is serialized by a mutex, which is never used by print().
+
+	The filters are applied in print(), so only after CoinMessageHandler has formatted the message into messageBuffer().
+	Filtered messages are not copied into the buffer and never reach the consumer, but they are still formatted.
+	Only the log level (setLogLevel) is checked by CoinMessageHandler before formatting, so lower the log level to
+	avoid the formatting of messages that are not needed at all.
+
+	This class is compiled as native code (not /clr) to be able to use std::atomic and std::mutex.
+*/
+class BufferedMessageHandler : public CoinMessageHandler
+{
+public:
+	/// The default number of messages in the ring buffer
+	static const int DefaultCapacity = 4096;
+	/// The maximum number of characters of a buffered message
+	static const int MaxTextLength = 511;
+	/// Messages with an external number from 0 up to this number can be disabled individually
+	static const int MaxExternalNumber = 9999;
+
+	/// A message taken from the buffer
+	struct Message
+	{
+		int externalNumber;
+		int detail;
+		/// The severity: I(nformation), W(arning), E(rror) or S(evere), from the external number, as CoinMessageHandler
+		char severity;
+		std::string source;
+		std::string text;
+	};
+
+	/** Construct a handler with a new ring buffer of the given number of messages, rounded up to a power of two. */
+	explicit BufferedMessageHandler(int capacity = DefaultCapacity);
+	/** The copy shares the ring buffer and the filters of the given handler. */
+	BufferedMessageHandler(const BufferedMessageHandler &rhs);
+	BufferedMessageHandler &operator=(const BufferedMessageHandler &rhs);
+	~BufferedMessageHandler() override;
+
+	/// Clone, which shares the ring buffer and the filters
+	CoinMessageHandler *clone() const override;
+
+	/// Append the current message to the buffer, unless it is filtered. Never blocks.
+	int print() override;
+
+	/// Set the maximum detail level of accepted messages, or -1 to accept all levels (= Default). Applies on top of the log level.
+	void setMaximumDetail(int value);
+	/// Get the maximum detail level of accepted messages, or -1 if all levels are accepted.
+	int getMaximumDetail() const;
+
+	/// Enable or disable the messages with the given external number (from 0 to MaxExternalNumber). All messages are enabled by default.
+	void setMessageEnabled(int externalNumber, bool enabled);
+	/// Returns true iff the messages with the given external number are enabled.
+	bool isMessageEnabled(int externalNumber) const;
+
+	/** Move at most maximum messages from the buffer to the end of the given vector, in the order of printing.
+		Returns the number of messages taken. Thread-safe, and can be called while other threads print. */
+	int take(std::vector<Message> &messages, int maximum);
+
+	/// Get the number of messages in the ring buffer
+	int getCapacity() const;
+	/// Get the number of messages currently in the buffer (approximately, while other threads print or take)
+	int getNumberBuffered() const;
+	/// Get the number of messages dropped because the buffer was full
+	long long getNumberDropped() const;
+	/// Get the number of messages not buffered because of the filters
+	long long getNumberFiltered() const;
+	/// Get the number of buffered messages that were truncated to MaxTextLength characters
+	long long getNumberTruncated() const;
+
+private:
+	class Buffer;
+
+	std::shared_ptr<Buffer> buffer_;
+};
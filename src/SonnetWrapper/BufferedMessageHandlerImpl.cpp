@@ -0,0 +1,258 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native implementation of BufferedMessageHandler, compiled without /clr (see BufferedMessageHandler.hpp)
+
+#include "BufferedMessageHandler.hpp"
+
+#include <CoinError.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+	/// The severity of a message from its external number, as CoinMessageHandler
+	char severityOf(int externalNumber)
+	{
+		if (externalNumber < 3000) return 'I';
+		if (externalNumber < 6000) return 'W';
+		if (externalNumber < 9000) return 'E';
+		return 'S';
+	}
+}
+
+/// The ring buffer and the filters, shared by a handler and its clones
+class BufferedMessageHandler::Buffer
+{
+public:
+	explicit Buffer(int capacity)
+		: maximumDetail(-1), dropped(0), filtered(0), truncated(0), enqueuePosition_(0), dequeuePosition_(0)
+	{
+		size_t size = 1;
+		while (size < static_cast<size_t>(std::max(capacity, 2))) size <<= 1;
+
+		slots_.reset(new Slot[size]);
+		mask_ = size - 1;
+		for (size_t i = 0; i < size; i++) slots_[i].sequence.store(i, std::memory_order_relaxed);
+
+		for (int i = 0; i <= MaxExternalNumber; i++) disabled[i].store(0, std::memory_order_relaxed);
+	}
+
+	bool accepts(int externalNumber, int detail) const
+	{
+		int maximum = maximumDetail.load(std::memory_order_relaxed);
+		if (maximum >= 0 && detail > maximum) return false;
+		if (externalNumber >= 0 && externalNumber <= MaxExternalNumber && disabled[externalNumber].load(std::memory_order_relaxed) != 0) return false;
+		return true;
+	}
+
+	/// Append a message to the buffer, or return false if the buffer is full
+	bool push(int externalNumber, int detail, const char *source, const char *text)
+	{
+		size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+		Slot *slot;
+		for (;;)
+		{
+			slot = &slots_[position & mask_];
+			size_t sequence = slot->sequence.load(std::memory_order_acquire);
+			std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+			if (difference == 0)
+			{
+				if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+			}
+			else if (difference < 0)
+			{
+				return false;
+			}
+			else
+			{
+				position = enqueuePosition_.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->externalNumber = externalNumber;
+		slot->detail = detail;
+		copyText(slot->source, source, sizeof(slot->source) - 1);
+		if (copyText(slot->text, text, MaxTextLength)) truncated.fetch_add(1, std::memory_order_relaxed);
+
+		slot->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	int take(std::vector<Message> &messages, int maximum)
+	{
+		std::lock_guard<std::mutex> lock(takeMutex_);
+
+		int count = 0;
+		size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+		while (count < maximum)
+		{
+			Slot &slot = slots_[position & mask_];
+			if (slot.sequence.load(std::memory_order_acquire) != position + 1) break;
+
+			Message message;
+			message.externalNumber = slot.externalNumber;
+			message.detail = slot.detail;
+			message.severity = severityOf(slot.externalNumber);
+			message.source = slot.source;
+			message.text = slot.text;
+			messages.push_back(std::move(message));
+
+			// The slot is free for the producer of the next round
+			slot.sequence.store(position + mask_ + 1, std::memory_order_release);
+			position++;
+			count++;
+		}
+		dequeuePosition_.store(position, std::memory_order_relaxed);
+		return count;
+	}
+
+	int capacity() const
+	{
+		return static_cast<int>(mask_ + 1);
+	}
+
+	int numberBuffered() const
+	{
+		size_t enqueued = enqueuePosition_.load(std::memory_order_relaxed);
+		size_t dequeued = dequeuePosition_.load(std::memory_order_relaxed);
+		return enqueued > dequeued ? static_cast<int>(enqueued - dequeued) : 0;
+	}
+
+	std::atomic<int> maximumDetail;
+	std::atomic<unsigned char> disabled[MaxExternalNumber + 1];
+	std::atomic<long long> dropped;
+	std::atomic<long long> filtered;
+	std::atomic<long long> truncated;
+
+private:
+	struct Slot
+	{
+		Slot() : sequence(0), externalNumber(0), detail(0) { source[0] = '\0'; text[0] = '\0'; }
+
+		std::atomic<size_t> sequence;
+		int externalNumber;
+		int detail;
+		char source[8];
+		char text[MaxTextLength + 1];
+	};
+
+	/// Copy at most length characters of text, and return true if it was truncated
+	static bool copyText(char *destination, const char *text, size_t length)
+	{
+		if (text == nullptr) text = "";
+		size_t n = strlen(text);
+		bool truncated = n > length;
+		if (truncated) n = length;
+		memcpy(destination, text, n);
+		destination[n] = '\0';
+		return truncated;
+	}
+
+	std::unique_ptr<Slot[]> slots_;
+	size_t mask_;
+	// Separate cache lines for the producers and the consumer
+	alignas(64) std::atomic<size_t> enqueuePosition_;
+	alignas(64) std::atomic<size_t> dequeuePosition_;
+	std::mutex takeMutex_;
+};
+
+BufferedMessageHandler::BufferedMessageHandler(int capacity)
+	: buffer_(std::make_shared<Buffer>(capacity))
+{
+}
+
+BufferedMessageHandler::BufferedMessageHandler(const BufferedMessageHandler &rhs)
+	: CoinMessageHandler(rhs), buffer_(rhs.buffer_)
+{
+}
+
+BufferedMessageHandler &BufferedMessageHandler::operator=(const BufferedMessageHandler &rhs)
+{
+	if (this != &rhs)
+	{
+		CoinMessageHandler::operator=(rhs);
+		buffer_ = rhs.buffer_;
+	}
+	return *this;
+}
+
+BufferedMessageHandler::~BufferedMessageHandler()
+{
+}
+
+CoinMessageHandler *BufferedMessageHandler::clone() const
+{
+	return new BufferedMessageHandler(*this);
+}
+
+int BufferedMessageHandler::print()
+{
+	const CoinOneMessage &message = currentMessage();
+	int externalNumber = message.externalNumber();
+	int detail = message.detail();
+
+	if (!buffer_->accepts(externalNumber, detail))
+	{
+		buffer_->filtered.fetch_add(1, std::memory_order_relaxed);
+		return 0;
+	}
+
+	if (!buffer_->push(externalNumber, detail, currentSource().c_str(), messageBuffer())) buffer_->dropped.fetch_add(1, std::memory_order_relaxed);
+	return 0;
+}
+
+void BufferedMessageHandler::setMaximumDetail(int value)
+{
+	buffer_->maximumDetail.store(value, std::memory_order_relaxed);
+}
+
+int BufferedMessageHandler::getMaximumDetail() const
+{
+	return buffer_->maximumDetail.load(std::memory_order_relaxed);
+}
+
+void BufferedMessageHandler::setMessageEnabled(int externalNumber, bool enabled)
+{
+	if (externalNumber < 0 || externalNumber > MaxExternalNumber) throw CoinError("External number out of range", "setMessageEnabled", "BufferedMessageHandler");
+	buffer_->disabled[externalNumber].store(enabled ? 0 : 1, std::memory_order_relaxed);
+}
+
+bool BufferedMessageHandler::isMessageEnabled(int externalNumber) const
+{
+	if (externalNumber < 0 || externalNumber > MaxExternalNumber) return true;
+	return buffer_->disabled[externalNumber].load(std::memory_order_relaxed) == 0;
+}
+
+int BufferedMessageHandler::take(std::vector<Message> &messages, int maximum)
+{
+	return buffer_->take(messages, maximum);
+}
+
+int BufferedMessageHandler::getCapacity() const
+{
+	return buffer_->capacity();
+}
+
+int BufferedMessageHandler::getNumberBuffered() const
+{
+	return buffer_->numberBuffered();
+}
+
+long long BufferedMessageHandler::getNumberDropped() const
+{
+	return buffer_->dropped.load(std::memory_order_relaxed);
+}
+
+long long BufferedMessageHandler::getNumberFiltered() const
+{
+	return buffer_->filtered.load(std::memory_order_relaxed);
+}
+
+long long BufferedMessageHandler::getNumberTruncated() const
+{
+	return buffer_->truncated.load(std::memory_order_relaxed);
+}
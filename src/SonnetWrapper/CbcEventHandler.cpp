@@ -10,6 +10,7 @@ namespace COIN
 {
 	::CbcEventHandler::CbcAction CbcDelegateEventHandlerProxy::event(::CbcEventHandler::CbcEvent whichEvent)
 	{
+		SONNET_TRANSITION();
 		// this->getModel() is a cbcModel is likely a _submodel_ used by cbc, not the parent cbcModel of OsiCbc. 
 		// Therefore, wrap it again.
 		COIN::CbcModel^ wrapperCbcModel = gcnew COIN::CbcModel(this->getModel());
@@ -33,6 +33,7 @@ namespace COIN
 		/// </summary>
 		void initialSolve()
 		{
+			SONNET_TRANSITION();
 			Base->initialSolve();
 		}
 
@@ -49,6 +50,7 @@ namespace COIN
 		/// if 3 then also one line per node</param>
 		void branchAndBound(int doStatistics)
 		{
+			SONNET_TRANSITION();
 			Base->branchAndBound(doStatistics);
 		}
 
@@ -336,6 +338,8 @@ namespace COIN
 		/// <param name="check">If check true then does not save solution if not feasible.</param>
 		inline void setBestSolutionUnsafe(const double* solution, int numberColumns, double objectiveValue, bool check /*= false*/)
 		{
+			SONNET_TRANSITION();
+			SONNET_TRANSITION_BYTES(numberColumns * sizeof(double));
 			Base->setBestSolution(solution, numberColumns, objectiveValue, check);
 		}
 
@@ -371,6 +375,8 @@ namespace COIN
 		/// <param name="objectiveValue">The objective value of this solution</param>
 		inline void setBestSolutionUnsafe(const double* solution, int numberColumns, double objectiveValue)
 		{
+			SONNET_TRANSITION();
+			SONNET_TRANSITION_BYTES(numberColumns * sizeof(double));
 			Base->setBestSolution(solution, numberColumns, objectiveValue);
 		}
 
@@ -7,6 +7,7 @@ namespace COIN
 {
 	static int NativeCallBackProxy(::CbcModel* model, int whereFrom)
 	{
+		SONNET_TRANSITION();
 		if (COIN::CbcSolver::CallBack != nullptr)
 		{
 			COIN::CbcModel^ wrapperCbcModel = gcnew COIN::CbcModel(model);
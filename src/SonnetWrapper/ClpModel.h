@@ -4,12 +4,21 @@
 #pragma once
 
 #include "ClpObjective.h"
+#include "ClpProgressSampler.h"
 #include "CoinMessageHandler.h"
 #include "CoinError.h"
 #include "Helpers.h"
 
 #include <ClpModel.hpp>
 #include <ClpSimplex.hpp>
+#include <ClpSimplexOther.hpp>
+#include <ClpMessage.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+#include <string>
 
 
 using namespace System;
@@ -126,6 +135,18 @@ namespace COIN
 			return result;
 		}
 
+		/// All row names at once, as rowName(i) for each row, or empty strings if no names were kept
+		array<String^>^ rowNames()
+		{
+			return namesOf(Base->rowNames(), Base->getNumRows());
+		}
+
+		/// All column names at once, as columnName(j) for each column, or empty strings if no names were kept
+		array<String^>^ columnNames()
+		{
+			return namesOf(Base->columnNames(), Base->getNumCols());
+		}
+
 		/// Number of rows
 		inline int getNumRows()
 		{
@@ -300,6 +321,15 @@ namespace COIN
 			Base->loadProblem(numcols, numrows, start, index, value, collb, colub, obj, rowlb, rowub);
 		}
 
+	private:
+		/// The given names, or empty strings if there are fewer names than count (if names were not kept)
+		array<String^>^ namesOf(const std::vector<std::string> *names, int count)
+		{
+			std::vector<const char *> pointers(count, nullptr);
+			int size = std::min(count, static_cast<int>(names->size()));
+			for (int i = 0; i < size; i++) pointers[i] = (*names)[i].c_str();
+			return ToStringArray(pointers.data(), count);
+		}
 	};
 
 	// This class is merely an intermediate class for all derived classes
@@ -336,6 +366,69 @@ namespace COIN
 		}
 	};
 
+	/// <summary>
+	/// Native message handler that captures the theta, objective value and entering/leaving names
+	/// of the parametrics report messages (CLP_PARAMETRICS_STATS and CLP_PARAMETRICS_STATS2) of ClpSimplexOther::parametrics.
+	/// Nothing is printed.
+	/// </summary>
+	class ClpParametricsMessageHandler : public ::CoinMessageHandler
+	{
+	public:
+		ClpParametricsMessageHandler(int statsNumber, int stats2Number)
+			: statsNumber(statsNumber), stats2Number(stats2Number)
+		{
+			// CLP_PARAMETRICS_STATS2 (with the basis change) has detail level 2
+			setLogLevel(2);
+		}
+
+		CoinMessageHandler * clone() const override
+		{
+			return new ClpParametricsMessageHandler(*this);
+		}
+
+		int print() override
+		{
+			int number = currentMessage().externalNumber();
+			if (number != statsNumber && number != stats2Number) return 0;
+			if (numberDoubleFields() < 2) return 0;
+
+			double theta = doubleValue(0);
+			double objective = doubleValue(1);
+			bool isDuplicate = !thetas.empty() && thetas.back() == theta && objectives.back() == objective;
+
+			if (number == stats2Number && numberStringFields() >= 2)
+			{
+				// the same breakpoint may have been reported already without the basis change
+				if (!isDuplicate)
+				{
+					thetas.push_back(theta);
+					objectives.push_back(objective);
+					enteringNames.push_back(std::string());
+					leavingNames.push_back(std::string());
+				}
+				enteringNames.back() = stringValue(0);
+				leavingNames.back() = stringValue(1);
+			}
+			else if (!isDuplicate)
+			{
+				thetas.push_back(theta);
+				objectives.push_back(objective);
+				enteringNames.push_back(std::string());
+				leavingNames.push_back(std::string());
+			}
+			return 0;
+		}
+
+		std::vector<double> thetas;
+		std::vector<double> objectives;
+		std::vector<std::string> enteringNames;
+		std::vector<std::string> leavingNames;
+
+	private:
+		int statsNumber;
+		int stats2Number;
+	};
+
 	public ref class ClpSimplex : ClpModelGeneric<::ClpModel>
 	{
 	public:
@@ -373,6 +466,235 @@ namespace COIN
 			}
 		}
 
+		/** Dual ranging.
+		  This computes increase/decrease in cost for each given variable and corresponding
+		  sequence numbers which would change basis.  Sequence numbers are 0..numberColumns
+		  and numberColumns.. for artificials/slacks.
+		  For non-basic variables the information is trivial to compute and the change in cost is just minus the
+		  reduced cost and the sequence number will be that of the non-basic variables.
+		  For basic variables a ratio test is between the reduced costs for non-basic variables
+		  and the row of the tableau corresponding to the basic variable.
+		  The increase/decrease value is always >= 0.0
+
+		  Up to user to provide correct length arrays where each array is of length numberCheck.
+		  which contains list of variables for which information is desired.  All other
+		  arrays will be filled in by function.  If fifth entry in which is variable 7 then fifth entry in output arrays
+		  will be information for variable 7.
+
+		  If valueIncrease/Decrease not NULL (both must be NULL or both non NULL) then these are filled with
+		  the value of variable if such a change in cost were made (the existing bounds are ignored)
+
+		  Returns non-zero if infeasible unbounded etc
+		*/
+		int dualRangingUnsafe(int numberCheck, const int* which,
+			double* costIncrease, int* sequenceIncrease,
+			double* costDecrease, int* sequenceDecrease,
+			double* valueIncrease, double* valueDecrease)
+		{
+			try
+			{
+				return Derived->dualRanging(numberCheck, which, costIncrease, sequenceIncrease,
+					costDecrease, sequenceDecrease, valueIncrease, valueDecrease);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		int dualRanging(int numberCheck, array<int>^ which,
+			array<double>^ costIncrease, array<int>^ sequenceIncrease,
+			array<double>^ costDecrease, array<int>^ sequenceDecrease,
+			array<double>^ valueIncrease, array<double>^ valueDecrease)
+		{
+			pin_ptr<int> whichPinned = GetPinablePtr(which);
+			pin_ptr<double> costIncreasePinned = GetPinablePtr(costIncrease);
+			pin_ptr<int> sequenceIncreasePinned = GetPinablePtr(sequenceIncrease);
+			pin_ptr<double> costDecreasePinned = GetPinablePtr(costDecrease);
+			pin_ptr<int> sequenceDecreasePinned = GetPinablePtr(sequenceDecrease);
+			pin_ptr<double> valueIncreasePinned = GetPinablePtr(valueIncrease);
+			pin_ptr<double> valueDecreasePinned = GetPinablePtr(valueDecrease);
+
+			return dualRangingUnsafe(numberCheck, whichPinned, costIncreasePinned, sequenceIncreasePinned,
+				costDecreasePinned, sequenceDecreasePinned, valueIncreasePinned, valueDecreasePinned);
+		}
+
+		int dualRanging(int numberCheck, array<int>^ which,
+			array<double>^ costIncrease, array<int>^ sequenceIncrease,
+			array<double>^ costDecrease, array<int>^ sequenceDecrease)
+		{
+			return dualRanging(numberCheck, which, costIncrease, sequenceIncrease, costDecrease, sequenceDecrease, nullptr, nullptr);
+		}
+
+		/** Primal ranging.
+		  This computes increase/decrease in value for each given variable and corresponding
+		  sequence numbers which would change basis.  Sequence numbers are 0..numberColumns
+		  and numberColumns.. for artificials/slacks.
+		  This should only be used for non-basic variabls as otherwise information is pretty useless
+		  For basic variables the sequence number will be that of the basic variables.
+
+		  Up to user to provide correct length arrays where each array is of length numberCheck.
+		  which contains list of variables for which information is desired.  All other
+		  arrays will be filled in by function.  If fifth entry in which is variable 7 then fifth entry in output arrays
+		  will be information for variable 7.
+
+		  Returns non-zero if infeasible unbounded etc
+		*/
+		int primalRangingUnsafe(int numberCheck, const int* which,
+			double* valueIncrease, int* sequenceIncrease,
+			double* valueDecrease, int* sequenceDecrease)
+		{
+			try
+			{
+				return Derived->primalRanging(numberCheck, which, valueIncrease, sequenceIncrease,
+					valueDecrease, sequenceDecrease);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		int primalRanging(int numberCheck, array<int>^ which,
+			array<double>^ valueIncrease, array<int>^ sequenceIncrease,
+			array<double>^ valueDecrease, array<int>^ sequenceDecrease)
+		{
+			pin_ptr<int> whichPinned = GetPinablePtr(which);
+			pin_ptr<double> valueIncreasePinned = GetPinablePtr(valueIncrease);
+			pin_ptr<int> sequenceIncreasePinned = GetPinablePtr(sequenceIncrease);
+			pin_ptr<double> valueDecreasePinned = GetPinablePtr(valueDecrease);
+			pin_ptr<int> sequenceDecreasePinned = GetPinablePtr(sequenceDecrease);
+
+			return primalRangingUnsafe(numberCheck, whichPinned, valueIncreasePinned, sequenceIncreasePinned,
+				valueDecreasePinned, sequenceDecreasePinned);
+		}
+
+		/** Parametrics
+		  This is an initial slow version.
+		  The code uses current bounds + theta * change (if change array not NULL)
+		  and similarly for objective.
+		  It starts at startingTheta and returns ending theta in endingTheta.
+		  If reportIncrement 0.0 it will report on any movement
+		  If reportIncrement >0.0 it will report at startingTheta+k*reportIncrement.
+		  If it can not reach input endingTheta return code will be 1 for infeasible,
+		  2 for unbounded, if error on ranges -1,  otherwise 0.
+		  Normal report is just theta and objective but
+		  if event handler exists it may do more
+		  On exit endingTheta is maximum reached (can be used for next startingTheta)
+		*/
+		int parametricsUnsafe(double startingTheta, double% endingTheta, double reportIncrement,
+			const double* changeLowerBound, const double* changeUpperBound,
+			const double* changeLowerRhs, const double* changeUpperRhs,
+			const double* changeObjective)
+		{
+			try
+			{
+				double nativeEndingTheta = endingTheta;
+				int result = static_cast<::ClpSimplexOther*>(Derived)->parametrics(startingTheta, nativeEndingTheta, reportIncrement,
+					changeLowerBound, changeUpperBound, changeLowerRhs, changeUpperRhs, changeObjective);
+				endingTheta = nativeEndingTheta;
+				return result;
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+
+		int parametrics(double startingTheta, double% endingTheta, double reportIncrement,
+			array<double>^ changeLowerBound, array<double>^ changeUpperBound,
+			array<double>^ changeLowerRhs, array<double>^ changeUpperRhs,
+			array<double>^ changeObjective)
+		{
+			pin_ptr<double> changeLowerBoundPinned = GetPinablePtr(changeLowerBound);
+			pin_ptr<double> changeUpperBoundPinned = GetPinablePtr(changeUpperBound);
+			pin_ptr<double> changeLowerRhsPinned = GetPinablePtr(changeLowerRhs);
+			pin_ptr<double> changeUpperRhsPinned = GetPinablePtr(changeUpperRhs);
+			pin_ptr<double> changeObjectivePinned = GetPinablePtr(changeObjective);
+
+			return parametricsUnsafe(startingTheta, endingTheta, reportIncrement,
+				changeLowerBoundPinned, changeUpperBoundPinned, changeLowerRhsPinned, changeUpperRhsPinned, changeObjectivePinned);
+		}
+
+		/// <summary>
+		/// Parametrics as above, but the reported breakpoints are returned instead of printed: 
+		/// for each breakpoint the theta, the objective value, and the names of the entering and leaving variables (if reported).
+		/// The message handler of this model is temporarily replaced while solving.
+		/// </summary>
+		int parametrics(double startingTheta, double% endingTheta, double reportIncrement,
+			array<double>^ changeLowerBound, array<double>^ changeUpperBound,
+			array<double>^ changeLowerRhs, array<double>^ changeUpperRhs,
+			array<double>^ changeObjective,
+			[Out] array<double>^% thetas, [Out] array<double>^% objectives,
+			[Out] array<String^>^% enteringNames, [Out] array<String^>^% leavingNames)
+		{
+			::CoinMessages* messages = Derived->messagesPointer();
+			ClpParametricsMessageHandler handler(messages->message_[CLP_PARAMETRICS_STATS]->externalNumber(),
+				messages->message_[CLP_PARAMETRICS_STATS2]->externalNumber());
+
+			bool oldDefault;
+			::CoinMessageHandler* oldHandler = Derived->pushMessageHandler(&handler, oldDefault);
+			int result;
+			try
+			{
+				result = parametrics(startingTheta, endingTheta, reportIncrement,
+					changeLowerBound, changeUpperBound, changeLowerRhs, changeUpperRhs, changeObjective);
+			}
+			finally
+			{
+				Derived->popMessageHandler(oldHandler, oldDefault);
+			}
+
+			int n = (int)handler.thetas.size();
+			thetas = gcnew array<double>(n);
+			objectives = gcnew array<double>(n);
+			enteringNames = gcnew array<String^>(n);
+			leavingNames = gcnew array<String^>(n);
+			for (int i = 0; i < n; i++)
+			{
+				thetas[i] = handler.thetas[i];
+				objectives[i] = handler.objectives[i];
+				enteringNames[i] = gcnew String(handler.enteringNames[i].c_str());
+				leavingNames[i] = gcnew String(handler.leavingNames[i].c_str());
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Pass in the progress sampler as event handler of this model. A clone of the sampler is stored, which shares the samples
+		/// of the given sampler. The sampler keeps (a clone of) the current event handler, and passes all events on to it,
+		/// until removeEventHandler restores it. A sampler passed in before is replaced.
+		/// </summary>
+		void passInEventHandler(ClpProgressSampler^ sampler)
+		{
+			::ClpEventHandler *current = Derived->eventHandler();
+			::ClpProgressSampler *currentSampler = dynamic_cast<::ClpProgressSampler *>(current);
+			const ::ClpEventHandler *previous = (currentSampler != nullptr) ? currentSampler->getPrevious() : current;
+			// The default event handler does nothing, so need not be kept
+			if (previous != nullptr && typeid(*previous) == typeid(::ClpEventHandler)) previous = nullptr;
+
+			::ClpProgressSampler handler(*sampler->Base);
+			handler.setPrevious(previous);
+			Derived->passInEventHandler(&handler);
+			GC::KeepAlive(sampler);
+		}
+
+		/// <summary>
+		/// Remove the progress sampler from this model, and restore the event handler that it replaced (or the default event handler).
+		/// Does nothing if the event handler of this model is not a progress sampler.
+		/// </summary>
+		void removeEventHandler()
+		{
+			::ClpProgressSampler *currentSampler = dynamic_cast<::ClpProgressSampler *>(Derived->eventHandler());
+			if (currentSampler == nullptr) return;
+
+			// Clone the previous handler first, since passInEventHandler deletes the sampler that owns it
+			const ::ClpEventHandler *previous = currentSampler->getPrevious();
+			std::unique_ptr<::ClpEventHandler> handler(previous != nullptr ? previous->clone() : new ::ClpEventHandler());
+			Derived->passInEventHandler(handler.get());
+		}
+
 	protected:
 		property ::ClpSimplex* Derived
 		{
@@ -0,0 +1,48 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "ClpProgressSampler.h"
+#include "ClpModel.h"
+
+#include <vector>
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	void ClpProgressSampler::sample(ClpSimplex ^ model)
+	{
+		try
+		{
+			Base->sample((::ClpSimplex*)(model->Base));
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		GC::KeepAlive(model);
+	}
+
+	array<ClpProgressSample>^ ClpProgressSampler::getSamples()
+	{
+		std::vector<::ClpProgressSampler::Sample> samples;
+		int n = Base->getSamples(samples);
+
+		array<ClpProgressSample>^ result = gcnew array<ClpProgressSample>(n);
+		for (int i = 0; i < n; i++)
+		{
+			const ::ClpProgressSampler::Sample &sample = samples[i];
+			result[i].Iteration = sample.iteration;
+			result[i].Algorithm = sample.algorithm;
+			result[i].Phase = sample.phase;
+			result[i].ObjectiveValue = sample.objectiveValue;
+			result[i].SumPrimalInfeasibilities = sample.sumPrimalInfeasibilities;
+			result[i].NumberPrimalInfeasibilities = sample.numberPrimalInfeasibilities;
+			result[i].SumDualInfeasibilities = sample.sumDualInfeasibilities;
+			result[i].NumberDualInfeasibilities = sample.numberDualInfeasibilities;
+			result[i].Seconds = sample.seconds;
+		}
+		return result;
+	}
+}
@@ -0,0 +1,109 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "ClpProgressSampler.hpp"
+
+#include "CoinError.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	ref class ClpSimplex;
+
+	/// A sample of the progress of the simplex algorithm, see ClpProgressSampler.
+	public value struct ClpProgressSample
+	{
+		/// The number of iterations.
+		int Iteration;
+		/// 1 for primal, -1 for dual, 0 if unknown.
+		int Algorithm;
+		/// 1 while the algorithm has infeasibilities of its own kind (primal for primal, dual for dual), and 2 otherwise.
+		int Phase;
+		double ObjectiveValue;
+		double SumPrimalInfeasibilities;
+		int NumberPrimalInfeasibilities;
+		double SumDualInfeasibilities;
+		int NumberDualInfeasibilities;
+		/// The wall-clock time since the last reset, in seconds.
+		double Seconds;
+	};
+
+	/// Native Clp event handler that records the progress of the simplex algorithm every interval iterations
+	/// in a preallocated buffer, without calling managed code while solving. Pass it to ClpSimplex::passInEventHandler.
+	/// The samples can be read during the solve from another thread. See ClpProgressSampler.hpp.
+	public ref class ClpProgressSampler : WrapperBase<::ClpProgressSampler>
+	{
+	public:
+		/// The default number of samples in the buffer.
+		literal int DefaultCapacity = ::ClpProgressSampler::DefaultCapacity;
+
+		/// Construct a sampler that records every interval iterations, in a buffer of DefaultCapacity samples.
+		ClpProgressSampler(int interval)
+			: WrapperBase(newSampler(interval, DefaultCapacity))
+		{
+			deleteBase = true;
+		}
+
+		/// Construct a sampler that records every interval iterations, in a buffer of the given number of samples.
+		/// If the buffer is full, every other sample is discarded and the interval is doubled.
+		ClpProgressSampler(int interval, int capacity)
+			: WrapperBase(newSampler(interval, capacity))
+		{
+			deleteBase = true;
+		}
+
+		/// Record a sample of the given model now, regardless of the interval, for example after the solve.
+		void sample(ClpSimplex ^ model);
+
+		/// Remove all samples, restore the interval and restart the clock.
+		void reset()
+		{
+			Base->reset();
+		}
+
+		/// Get a copy of the samples, in the order of recording. Can be called while solving.
+		array<ClpProgressSample>^ getSamples();
+
+		/// Get the number of samples recorded.
+		int getNumberSamples()
+		{
+			return Base->getNumberSamples();
+		}
+
+		/// Get the number of samples in the buffer.
+		int getCapacity()
+		{
+			return Base->getCapacity();
+		}
+
+		/// Get the interval given at construction.
+		int getInterval()
+		{
+			return Base->getInterval();
+		}
+
+		/// Get the current interval, which is doubled each time the buffer is full.
+		int getCurrentInterval()
+		{
+			return Base->getCurrentInterval();
+		}
+
+	private:
+		static ::ClpProgressSampler* newSampler(int interval, int capacity)
+		{
+			try
+			{
+				return new ::ClpProgressSampler(interval, capacity);
+			}
+			catch (::CoinError err)
+			{
+				throw gcnew CoinError(err);
+			}
+		}
+	};
+}
@@ -0,0 +1,97 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <ClpEventHandler.hpp>
+
+#include <memory>
+#include <vector>
+
+/** Native Clp event handler that samples the progress of the simplex algorithm: every interval iterations,
+	the iteration count, phase, objective value, infeasibilities and elapsed time are recorded in a preallocated buffer.
+	No managed code is called while solving.
+
+	If the buffer is full, every other sample is discarded and the interval is doubled, such that the samples
+	always cover the whole solve. Clones (made by ClpModel::passInEventHandler, and when Clp copies its model,
+	for example for presolve or Cbc) share the buffer of the original, which can be read during the solve from another thread.
+
+	A sampler can keep the event handler that it replaced in a model (see setPrevious): all events are passed on to that
+	handler, and its result is returned, such that sampling does not change the solve, and the handler can be restored afterwards.
+
+	This class is compiled as native code (not /clr) to be able to use std::mutex and std::chrono.
+*/
+class ClpProgressSampler : public ClpEventHandler
+{
+public:
+	/// The default number of samples in the buffer
+	static const int DefaultCapacity = 1024;
+
+	/// A sample of the progress of the simplex algorithm
+	struct Sample
+	{
+		/// The number of iterations
+		int iteration;
+		/// 1 for primal, -1 for dual, 0 if unknown (as ClpSimplex::algorithm)
+		int algorithm;
+		/// 1 while the algorithm has infeasibilities of its own kind (primal for primal, dual for dual), and 2 otherwise
+		int phase;
+		double objectiveValue;
+		double sumPrimalInfeasibilities;
+		int numberPrimalInfeasibilities;
+		double sumDualInfeasibilities;
+		int numberDualInfeasibilities;
+		/// The wall-clock time since the last reset, in seconds
+		double seconds;
+	};
+
+	/** Construct a sampler that records every interval iterations, in a buffer of the given number of samples. */
+	explicit ClpProgressSampler(int interval, int capacity = DefaultCapacity);
+	/** The copy shares the buffer of the given sampler. */
+	ClpProgressSampler(const ClpProgressSampler &rhs);
+	ClpProgressSampler &operator=(const ClpProgressSampler &rhs);
+	~ClpProgressSampler() override;
+
+	/// Clone, which shares the buffer, and has a clone of the previous handler
+	ClpEventHandler *clone() const override;
+
+	/// Record a sample at the end of an iteration, if interval iterations have passed.
+	/// Returns the result of the previous handler, or -1 (no action) if none.
+	int event(Event whichEvent) override;
+	/// Returns the result of the previous handler, or -1 (no action) if none.
+	int eventWithInfo(Event whichEvent, void *info) override;
+
+	/// Keep a clone of the given event handler (or none if null), to pass all events on to.
+	void setPrevious(const ClpEventHandler *previous);
+	/// Get the handler that all events are passed on to, or null if none.
+	const ClpEventHandler *getPrevious() const;
+
+	/// Record a sample of the given model now, regardless of the interval, for example after the solve.
+	void sample(ClpSimplex *model);
+
+	/// Remove all samples, restore the interval and restart the clock.
+	void reset();
+
+	/** Copy the samples to the end of the given vector, in the order of recording. Returns the number of samples.
+		Thread-safe, and can be called while solving. */
+	int getSamples(std::vector<Sample> &samples) const;
+
+	/// Get the number of samples recorded
+	int getNumberSamples() const;
+	/// Get the number of samples in the buffer
+	int getCapacity() const;
+	/// Get the interval given at construction
+	int getInterval() const;
+	/// Get the current interval, which is doubled each time the buffer is full
+	int getCurrentInterval() const;
+
+private:
+	class Buffer;
+
+	std::shared_ptr<Buffer> buffer_;
+	std::unique_ptr<ClpEventHandler> previous_;
+	// The iteration count of this clone, restarted at a reset of the buffer
+	int generation_;
+	int lastIteration_;
+	int nextIteration_;
+};
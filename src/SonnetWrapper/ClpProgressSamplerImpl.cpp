@@ -0,0 +1,193 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native implementation of ClpProgressSampler, compiled without /clr (see ClpProgressSampler.hpp)
+
+#include "ClpProgressSampler.hpp"
+
+#include <ClpSimplex.hpp>
+#include <CoinError.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+/// The samples, shared by a sampler and its clones
+class ClpProgressSampler::Buffer
+{
+public:
+	Buffer(int interval, int capacity)
+		: interval(interval), currentInterval(interval), generation(0), numberSamples(0), samples(std::max(capacity, 2)),
+		start(std::chrono::steady_clock::now())
+	{
+	}
+
+	void record(ClpSimplex *model)
+	{
+		Sample sample;
+		sample.iteration = model->numberIterations();
+		sample.algorithm = model->algorithm() > 0 ? 1 : model->algorithm() < 0 ? -1 : 0;
+		sample.numberPrimalInfeasibilities = model->numberPrimalInfeasibilities();
+		sample.sumPrimalInfeasibilities = model->sumPrimalInfeasibilities();
+		sample.numberDualInfeasibilities = model->numberDualInfeasibilities();
+		sample.sumDualInfeasibilities = model->sumDualInfeasibilities();
+		int infeasibilities = sample.algorithm < 0 ? sample.numberDualInfeasibilities : sample.numberPrimalInfeasibilities;
+		sample.phase = infeasibilities > 0 ? 1 : 2;
+		sample.objectiveValue = model->objectiveValue();
+
+		std::lock_guard<std::mutex> lock(mutex);
+		sample.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		int capacity = static_cast<int>(samples.size());
+		if (numberSamples == capacity)
+		{
+			// Keep every other sample, such that the samples still cover the whole solve
+			for (int i = 1; i < capacity / 2; i++) samples[i] = samples[2 * i];
+			numberSamples = capacity / 2;
+			currentInterval.store(currentInterval.load() * 2);
+		}
+		samples[numberSamples++] = sample;
+	}
+
+	void reset()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		numberSamples = 0;
+		currentInterval.store(interval);
+		generation.fetch_add(1);
+		start = std::chrono::steady_clock::now();
+	}
+
+	const int interval;
+	// Read without the mutex at every iteration
+	std::atomic<int> currentInterval;
+	std::atomic<int> generation;
+	int numberSamples;
+	std::vector<Sample> samples;
+	std::chrono::steady_clock::time_point start;
+	mutable std::mutex mutex;
+};
+
+ClpProgressSampler::ClpProgressSampler(int interval, int capacity)
+	: ClpEventHandler(), buffer_(), generation_(-1), lastIteration_(0), nextIteration_(0)
+{
+	if (interval <= 0) throw CoinError("Interval must be positive", "ClpProgressSampler", "ClpProgressSampler");
+	buffer_ = std::make_shared<Buffer>(interval, capacity);
+}
+
+ClpProgressSampler::ClpProgressSampler(const ClpProgressSampler &rhs)
+	: ClpEventHandler(rhs), buffer_(rhs.buffer_), generation_(-1), lastIteration_(0), nextIteration_(0)
+{
+	setPrevious(rhs.previous_.get());
+}
+
+ClpProgressSampler &ClpProgressSampler::operator=(const ClpProgressSampler &rhs)
+{
+	if (this != &rhs)
+	{
+		ClpEventHandler::operator=(rhs);
+		buffer_ = rhs.buffer_;
+		setPrevious(rhs.previous_.get());
+		generation_ = -1;
+		lastIteration_ = 0;
+		nextIteration_ = 0;
+	}
+	return *this;
+}
+
+ClpProgressSampler::~ClpProgressSampler()
+{
+}
+
+ClpEventHandler *ClpProgressSampler::clone() const
+{
+	return new ClpProgressSampler(*this);
+}
+
+int ClpProgressSampler::event(Event whichEvent)
+{
+	if (whichEvent == endOfIteration && model_ != nullptr)
+	{
+		int iteration = model_->numberIterations();
+		int currentInterval = buffer_->currentInterval.load(std::memory_order_relaxed);
+		int generation = buffer_->generation.load(std::memory_order_relaxed);
+
+		// A reset, or a new solve of this model (like the node LPs of Cbc), restarts the count
+		if (generation != generation_ || iteration < lastIteration_)
+		{
+			generation_ = generation;
+			nextIteration_ = iteration - iteration % currentInterval + currentInterval;
+		}
+		lastIteration_ = iteration;
+		if (iteration >= nextIteration_)
+		{
+			buffer_->record(model_);
+			nextIteration_ = iteration + currentInterval;
+		}
+	}
+
+	if (!previous_) return -1;
+
+	// setSimplex is not virtual, so the model of the previous handler is only set here
+	previous_->setSimplex(model_);
+	return previous_->event(whichEvent);
+}
+
+int ClpProgressSampler::eventWithInfo(Event whichEvent, void *info)
+{
+	if (!previous_) return -1;
+
+	previous_->setSimplex(model_);
+	return previous_->eventWithInfo(whichEvent, info);
+}
+
+void ClpProgressSampler::setPrevious(const ClpEventHandler *previous)
+{
+	previous_.reset(previous != nullptr ? previous->clone() : nullptr);
+}
+
+const ClpEventHandler *ClpProgressSampler::getPrevious() const
+{
+	return previous_.get();
+}
+
+void ClpProgressSampler::sample(ClpSimplex *model)
+{
+	if (model == nullptr) throw CoinError("No model given", "sample", "ClpProgressSampler");
+	buffer_->record(model);
+}
+
+void ClpProgressSampler::reset()
+{
+	buffer_->reset();
+}
+
+int ClpProgressSampler::getSamples(std::vector<Sample> &samples) const
+{
+	std::lock_guard<std::mutex> lock(buffer_->mutex);
+	samples.insert(samples.end(), buffer_->samples.begin(), buffer_->samples.begin() + buffer_->numberSamples);
+	return buffer_->numberSamples;
+}
+
+int ClpProgressSampler::getNumberSamples() const
+{
+	std::lock_guard<std::mutex> lock(buffer_->mutex);
+	return buffer_->numberSamples;
+}
+
+int ClpProgressSampler::getCapacity() const
+{
+	return static_cast<int>(buffer_->samples.size());
+}
+
+int ClpProgressSampler::getInterval() const
+{
+	return buffer_->interval;
+}
+
+int ClpProgressSampler::getCurrentInterval() const
+{
+	std::lock_guard<std::mutex> lock(buffer_->mutex);
+	return buffer_->currentInterval.load();
+}
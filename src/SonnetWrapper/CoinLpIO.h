@@ -7,6 +7,7 @@
 #include "CoinError.h"
 #include "CoinMessageHandler.h"
 #include "CoinPackedMatrix.h"
+#include "CompressedFileInput.h"
 #include "Helpers.h"
 
 #include <CoinLpIO.hpp>
@@ -33,8 +34,16 @@ namespace COIN
 			return Base->getInfinity();
 		}
 
+		/// Read a problem in LP format from the given filename.
+		/// A gzip-compressed file is decompressed on a background thread while it is read.
 		void readLp(String^ fileName)
 		{
+			if (CompressedFileInput::IsCompressed(fileName))
+			{
+				readCompressedLp(fileName, false, 0.0);
+				return;
+			}
+
 			try
 			{
 				char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
@@ -49,6 +58,12 @@ namespace COIN
 
 		void readLp(String^ fileName, double epsilon)
 		{
+			if (CompressedFileInput::IsCompressed(fileName))
+			{
+				readCompressedLp(fileName, true, epsilon);
+				return;
+			}
+
 			try
 			{
 				char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
@@ -185,11 +200,28 @@ namespace COIN
 			return result;
 		}
 
+		/// Return all row names at once, as rowName(i) for each row (without the objective function name).
+		array<String^>^ getRowNames()
+		{
+			return ToStringArray(Base->getRowNames(), Base->getNumRows());
+		}
+
+		/// Return all column names at once, as columnName(j) for each column.
+		array<String^>^ getColNames()
+		{
+			return ToStringArray(Base->getColNames(), Base->getNumCols());
+		}
+
 		CoinPackedMatrix ^ getMatrixByRow()
 		{
 			return gcnew CoinPackedMatrix(Base->getMatrixByRow());
 		}
 
+		CoinPackedMatrix ^ getMatrixByCol()
+		{
+			return gcnew CoinPackedMatrix(Base->getMatrixByCol());
+		}
+
 		/** Pass in Message handler
 
 		Supply a custom message handler. It will not be destroyed when the
@@ -199,5 +231,24 @@ namespace COIN
 		{
 			Base->passInMessageHandler(handler->Base);
 		}
+
+	private:
+		void readCompressedLp(String^ fileName, bool hasEpsilon, double epsilon)
+		{
+			// The FILE of the pipe is closed by CoinLpIO (CoinPlainFileInput)
+			CompressedFileInput^ input = gcnew CompressedFileInput(fileName);
+			try
+			{
+				if (hasEpsilon) Base->readLp(input->TakeFile(), epsilon);
+				else Base->readLp(input->TakeFile());
+			}
+			catch (::CoinError err)
+			{
+				// An error while decompressing explains the error while reading
+				input->Wait();
+				throw gcnew CoinError(err);
+			}
+			input->Wait();
+		}
 	};
 }
\ No newline at end of file
@@ -16,6 +16,7 @@ namespace COIN
 
 	int CoinMessageHandlerProxy::print()
 	{
+		SONNET_TRANSITION();
 		return wrapper->print();
 	}
 }
\ No newline at end of file
@@ -188,6 +188,12 @@ namespace COIN
 			return gcnew String(base->messageBuffer());
 		}
 
+		/// Print the current message now, instead of when the next message starts.
+		void finish()
+		{
+			base->finish();
+		}
+
 		CoinMessageHandler ^ message(int messageNumber, CoinMessages ^ m,  ... array<Object^>^ variableArgs )
 		{
 			::CoinMessageHandler &h = base->message(messageNumber, *(m->Base));
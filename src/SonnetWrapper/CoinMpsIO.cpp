@@ -2,13 +2,65 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include "CoinMpsIO.h"
+#include "CoinError.h"
 #include "CoinPackedMatrix.h"
+#include "CompressedFileInput.h"
+
+#include <CoinFileIO.hpp>
+#include <CoinHelperFunctions.hpp>
+
+#include <vector>
 
 using namespace System;
 using namespace System::Runtime::InteropServices;
 
 namespace COIN
 {
+	/// Gives access to the protected members of ::CoinMpsIO that are needed to read from an already opened file.
+	class CoinMpsIOAccess : public ::CoinMpsIO
+	{
+	public:
+		/// Reads a problem in MPS format from the given file, which is closed afterwards.
+		static int readMps(::CoinMpsIO *mpsIO, FILE *fp, const char *fileName)
+		{
+			CoinMpsCardReader *&cardReader = mpsIO->*(&CoinMpsIOAccess::cardReader_);
+			char *&mpsFileName = mpsIO->*(&CoinMpsIOAccess::fileName_);
+
+			delete cardReader;
+			cardReader = new CoinMpsCardReader(new CoinPlainFileInput(fp), mpsIO);
+			free(mpsFileName);
+			mpsFileName = CoinStrdup(fileName);
+
+			int numberSets = 0;
+			CoinSet **sets = nullptr;
+			int result;
+			try
+			{
+				result = mpsIO->readMps(numberSets, sets);
+			}
+			catch (...)
+			{
+				release(cardReader, mpsFileName);
+				throw;
+			}
+
+			for (int i = 0; i < numberSets; i++) delete sets[i];
+			delete[] sets;
+			release(cardReader, mpsFileName);
+			return result;
+		}
+
+	private:
+		/// Closes the file, and forgets the file name, such that a next readMps does not try to continue reading it.
+		static void release(CoinMpsCardReader *&cardReader, char *&mpsFileName)
+		{
+			delete cardReader;
+			cardReader = nullptr;
+			free(mpsFileName);
+			mpsFileName = nullptr;
+		}
+	};
+
 	/// Set infinity
 	void CoinMpsIO::setInfinity(double value)
 	{
@@ -31,6 +83,8 @@ namespace COIN
 
 	int CoinMpsIO::readMps(String^ fileName, String ^ extension)
 	{
+		if (CompressedFileInput::IsCompressed(fileName)) return readCompressedMps(fileName);
+
 		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
 		char * charExtension = (char*)Marshal::StringToHGlobalAnsi(extension).ToPointer();
 		int result = Base->readMps(charFileName,charExtension);
@@ -39,6 +93,29 @@ namespace COIN
 		return result;
 	}
 
+	int CoinMpsIO::readCompressedMps(String^ fileName)
+	{
+		CompressedFileInput^ input = gcnew CompressedFileInput(fileName);
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		int result;
+		try
+		{
+			result = CoinMpsIOAccess::readMps(Base, input->TakeFile(), charFileName);
+		}
+		catch (::CoinError err)
+		{
+			// An error while decompressing explains the error while reading
+			input->Wait();
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+		}
+		input->Wait();
+		return result;
+	}
+
 	/// Get pointer to array[getNumRows()] of row lower bounds
 	array<double>^ CoinMpsIO::getRowLower()
 	{
@@ -171,4 +248,20 @@ namespace COIN
 		String ^ result = gcnew String(Base->columnName(index));
 		return result;
 	}
+
+	array<String^>^ CoinMpsIO::rowNames()
+	{
+		int n = Base->getNumRows();
+		std::vector<const char *> names(n);
+		for (int i = 0; i < n; i++) names[i] = Base->rowName(i);
+		return ToStringArray(names.data(), n);
+	}
+
+	array<String^>^ CoinMpsIO::columnNames()
+	{
+		int n = Base->getNumCols();
+		std::vector<const char *> names(n);
+		for (int j = 0; j < n; j++) names[j] = Base->columnName(j);
+		return ToStringArray(names.data(), n);
+	}
 };
\ No newline at end of file
@@ -29,6 +29,7 @@ namespace COIN
 
 		/// Read a problem in MPS format from the given filename.
 		// Use "stdin" or "-" to read from stdin.
+		// A gzip-compressed file is decompressed on a background thread while it is read.
 		int readMps(String^ filename); // extension = "mps"
 		int readMps(String^ filename, String^ extension);
 
@@ -92,11 +93,22 @@ namespace COIN
 		*/
 		String^ columnName(int index);
 
+		/// Returns all row names at once, as rowName(i) for each row.
+		array<String^>^ rowNames();
+
+		/// Returns all column names at once, as columnName(j) for each column.
+		array<String^>^ columnNames();
+
 		CoinPackedMatrix ^ getMatrixByRow()
 		{
 			return gcnew CoinPackedMatrix(Base->getMatrixByRow());
 		}
 
+		CoinPackedMatrix ^ getMatrixByCol()
+		{
+			return gcnew CoinPackedMatrix(Base->getMatrixByCol());
+		}
+
 		/** Pass in Message handler
   
 			Supply a custom message handler. It will not be destroyed when the
@@ -106,5 +118,8 @@ namespace COIN
 		{
 			Base->passInMessageHandler(handler->Base);
 		}
+
+	private:
+		int readCompressedMps(String^ fileName);
 	};
 }
\ No newline at end of file
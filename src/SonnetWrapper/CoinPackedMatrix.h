@@ -25,6 +25,7 @@ namespace COIN
 		/** Return the i'th vector in matrix. */
 		CoinShallowPackedVector ^ getVector(int i)
 		{
+			SONNET_TRANSITION();
 			::CoinShallowPackedVector *tmp = new ::CoinShallowPackedVector(Base->getVector(i));
 			CoinShallowPackedVector ^result = gcnew CoinShallowPackedVector(tmp);
 			result->deleteBase = true;
@@ -32,6 +33,116 @@ namespace COIN
 		}
 #endif
 
+		/** Whether the packed matrix is column major ordered or not. */
+		bool isColOrdered()
+		{
+			return Base->isColOrdered();
+		}
+
+		/** Number of entries in the packed matrix. */
+		CoinBigIndex getNumElements()
+		{
+			return Base->getNumElements();
+		}
+
+		/** Number of columns. */
+		int getNumCols()
+		{
+			return Base->getNumCols();
+		}
+
+		/** Number of rows. */
+		int getNumRows()
+		{
+			return Base->getNumRows();
+		}
+
+		/** Major dimension. For row ordered matrix this would be the number of rows. */
+		int getMajorDim()
+		{
+			return Base->getMajorDim();
+		}
+
+		/** Minor dimension. For row ordered matrix this would be the number of columns. */
+		int getMinorDim()
+		{
+			return Base->getMinorDim();
+		}
+
+		/** A vector containing the elements in the packed matrix. Note that there
+		  might be gaps in this list, entries that do not belong to any
+		  major-dimension vector. To get the actual elements one should look at
+		  this vector together with vectorStarts and vectorLengths. */
+		const double *getElementsUnsafe()
+		{
+			return Base->getElements();
+		}
+
+		/** A vector containing the minor indices of the elements in the packed matrix. */
+		const int *getIndicesUnsafe()
+		{
+			return Base->getIndices();
+		}
+
+		/** The positions where the major-dimension vectors start in elements and indices. */
+		const CoinBigIndex *getVectorStartsUnsafe()
+		{
+			return Base->getVectorStarts();
+		}
+
+		/** The lengths of the major-dimension vectors. */
+		const int *getVectorLengthsUnsafe()
+		{
+			return Base->getVectorLengths();
+		}
+
+		/** The size of the elements and indices vectors, including gaps. */
+		CoinBigIndex getSizeVectorElements()
+		{
+			int n = Base->getMajorDim();
+			return (n == 0) ? 0 : Base->getVectorStarts()[n];
+		}
+
+		array<double> ^ getElements()
+		{
+			SONNET_TRANSITION();
+			int n = getSizeVectorElements();
+			SONNET_TRANSITION_BYTES(n * sizeof(double));
+			array<double> ^result = gcnew array<double>(n);
+			if (n > 0) System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)(double *)Base->getElements(), result, 0, n);
+			return result;
+		}
+
+		array<int> ^ getIndices()
+		{
+			SONNET_TRANSITION();
+			int n = getSizeVectorElements();
+			SONNET_TRANSITION_BYTES(n * sizeof(int));
+			array<int> ^result = gcnew array<int>(n);
+			if (n > 0) System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)(int *)Base->getIndices(), result, 0, n);
+			return result;
+		}
+
+		array<CoinBigIndex> ^ getVectorStarts()
+		{
+			SONNET_TRANSITION();
+			int n = Base->getMajorDim();
+			SONNET_TRANSITION_BYTES((n + 1) * sizeof(CoinBigIndex));
+			array<CoinBigIndex> ^result = gcnew array<CoinBigIndex>(n + 1);
+			if (n > 0) System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)(CoinBigIndex *)Base->getVectorStarts(), result, 0, n + 1);
+			return result;
+		}
+
+		array<int> ^ getVectorLengths()
+		{
+			SONNET_TRANSITION();
+			int n = Base->getMajorDim();
+			SONNET_TRANSITION_BYTES(n * sizeof(int));
+			array<int> ^result = gcnew array<int>(n);
+			if (n > 0) System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)(int *)Base->getVectorLengths(), result, 0, n);
+			return result;
+		}
+
 	internal:
 		CoinPackedMatrix(const ::CoinPackedMatrix *obj)
 			: WrapperBase(obj)
@@ -0,0 +1,117 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CompressedFileInput.h"
+
+#include <fcntl.h>
+#include <io.h>
+
+using namespace System::IO;
+using namespace System::IO::Compression;
+using namespace Microsoft::Win32::SafeHandles;
+
+namespace COIN
+{
+	// The size of the pipe buffer, and of the blocks written to it
+	static const int PipeSize = 1 << 20;
+
+	// Win32 errors when writing to a pipe of which the read end is closed
+	static const int ErrorBrokenPipe = 109;
+	static const int ErrorNoData = 232;
+
+	bool CompressedFileInput::IsCompressed(String^ fileName)
+	{
+		if (!File::Exists(fileName)) return false;
+
+		FileStream^ stream = File::OpenRead(fileName);
+		try
+		{
+			return stream->ReadByte() == 0x1f && stream->ReadByte() == 0x8b;
+		}
+		finally
+		{
+			delete stream;
+		}
+	}
+
+	CompressedFileInput::CompressedFileInput(String^ fileName)
+	{
+		this->fileName = fileName;
+
+		int descriptors[2];
+		if (_pipe(descriptors, PipeSize, _O_BINARY | _O_NOINHERIT) != 0) throw gcnew IOException("Unable to create a pipe to decompress " + fileName);
+
+		// A second read descriptor to discard the data that is not read by the native reader, see Wait
+		drainDescriptor = _dup(descriptors[0]);
+		file = _fdopen(descriptors[0], "rb");
+		writeDescriptor = descriptors[1];
+
+		thread = gcnew Thread(gcnew ThreadStart(this, &CompressedFileInput::Decompress));
+		thread->IsBackground = true;
+		thread->Name = "Decompress " + Path::GetFileName(fileName);
+		thread->Start();
+	}
+
+	FILE *CompressedFileInput::TakeFile()
+	{
+		FILE *result = file;
+		file = nullptr;
+		return result;
+	}
+
+	void CompressedFileInput::Decompress()
+	{
+		try
+		{
+			FileStream^ pipe = gcnew FileStream(gcnew SafeFileHandle((IntPtr)_get_osfhandle(writeDescriptor), false), FileAccess::Write, PipeSize);
+			GZipStream^ source = gcnew GZipStream(File::OpenRead(fileName), CompressionMode::Decompress);
+			try
+			{
+				source->CopyTo(pipe, PipeSize);
+				pipe->Flush();
+			}
+			finally
+			{
+				delete source;
+				delete pipe;
+			}
+		}
+		catch (IOException^ e)
+		{
+			// A closed read end only means that the reader is done
+			int code = e->HResult & 0xFFFF;
+			if (code != ErrorBrokenPipe && code != ErrorNoData) error = e;
+		}
+		catch (Exception^ e)
+		{
+			error = e;
+		}
+		finally
+		{
+			_close(writeDescriptor);
+		}
+	}
+
+	void CompressedFileInput::Wait()
+	{
+		if (file != nullptr)
+		{
+			fclose(file);
+			file = nullptr;
+		}
+
+		if (drainDescriptor >= 0)
+		{
+			char buffer[4096];
+			while (_read(drainDescriptor, buffer, sizeof(buffer)) > 0)
+			{
+				// discard
+			}
+			_close(drainDescriptor);
+			drainDescriptor = -1;
+		}
+
+		thread->Join();
+		if (error != nullptr) throw gcnew IOException("Error while decompressing " + fileName + ": " + error->Message, error);
+	}
+}
@@ -0,0 +1,42 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <cstdio>
+
+using namespace System;
+using namespace System::Threading;
+
+namespace COIN
+{
+	/// Decompresses a gzip-compressed file on a background thread into an anonymous pipe.
+	/// The native readers (CoinMpsIO, CoinLpIO) parse the uncompressed data from the read end of the pipe
+	/// while it is being decompressed, without an uncompressed copy of the file on disk or in memory.
+	ref class CompressedFileInput
+	{
+	public:
+		/// Returns true if the given file exists and starts with the gzip magic number.
+		static bool IsCompressed(String^ fileName);
+
+		/// Starts decompressing the given file.
+		CompressedFileInput(String^ fileName);
+
+		/// Takes the read end of the pipe. The native reader is responsible for closing it (for example via CoinPlainFileInput).
+		FILE *TakeFile();
+
+		/// Waits until the decompression is done, discarding any data that the native reader did not read,
+		/// and throws an IOException if an error occurred during decompression.
+		void Wait();
+
+	private:
+		void Decompress();
+
+		String^ fileName;
+		FILE *file;
+		int writeDescriptor;
+		int drainDescriptor;
+		Thread^ thread;
+		Exception^ error;
+	};
+}
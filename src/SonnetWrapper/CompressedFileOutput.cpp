@@ -0,0 +1,85 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "CompressedFileOutput.h"
+
+#include <fcntl.h>
+#include <io.h>
+
+using namespace System::IO;
+using namespace System::IO::Compression;
+using namespace Microsoft::Win32::SafeHandles;
+
+namespace COIN
+{
+	// The size of the pipe buffer, and of the blocks read from it
+	static const int PipeSize = 1 << 20;
+
+	CompressedFileOutput::CompressedFileOutput(String^ fileName)
+	{
+		this->fileName = fileName;
+
+		int descriptors[2];
+		if (_pipe(descriptors, PipeSize, _O_BINARY | _O_NOINHERIT) != 0) throw gcnew IOException("Unable to create a pipe to compress " + fileName);
+
+		readDescriptor = descriptors[0];
+		file = _fdopen(descriptors[1], "wb");
+
+		thread = gcnew Thread(gcnew ThreadStart(this, &CompressedFileOutput::Compress));
+		thread->IsBackground = true;
+		thread->Name = "Compress " + Path::GetFileName(fileName);
+		thread->Start();
+	}
+
+	FILE *CompressedFileOutput::TakeFile()
+	{
+		FILE *result = file;
+		file = nullptr;
+		return result;
+	}
+
+	void CompressedFileOutput::Compress()
+	{
+		try
+		{
+			FileStream^ pipe = gcnew FileStream(gcnew SafeFileHandle((IntPtr)_get_osfhandle(readDescriptor), false), FileAccess::Read, PipeSize);
+			GZipStream^ target = gcnew GZipStream(File::Create(fileName), CompressionMode::Compress);
+			try
+			{
+				pipe->CopyTo(target, PipeSize);
+			}
+			finally
+			{
+				delete target;
+				delete pipe;
+			}
+		}
+		catch (Exception^ e)
+		{
+			error = e;
+
+			// Keep reading, such that the native writer does not block on a full pipe
+			char buffer[4096];
+			while (_read(readDescriptor, buffer, sizeof(buffer)) > 0)
+			{
+				// discard
+			}
+		}
+		finally
+		{
+			_close(readDescriptor);
+		}
+	}
+
+	void CompressedFileOutput::Wait()
+	{
+		if (file != nullptr)
+		{
+			fclose(file);
+			file = nullptr;
+		}
+
+		thread->Join();
+		if (error != nullptr) throw gcnew IOException("Error while compressing " + fileName + ": " + error->Message, error);
+	}
+}
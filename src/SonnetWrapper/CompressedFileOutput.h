@@ -0,0 +1,37 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <cstdio>
+
+using namespace System;
+using namespace System::Threading;
+
+namespace COIN
+{
+	/// Compresses the data written to an anonymous pipe into a gzip-compressed file on a background thread.
+	/// The native writers (ModelWriter) write the uncompressed data to the write end of the pipe
+	/// while it is being compressed, without an uncompressed copy of the file on disk or in memory.
+	ref class CompressedFileOutput
+	{
+	public:
+		/// Starts compressing into the given file, which is created or overwritten.
+		CompressedFileOutput(String^ fileName);
+
+		/// Takes the write end of the pipe. The native writer writes to it, and the caller must close it before calling Wait.
+		FILE *TakeFile();
+
+		/// Waits until the compression is done, and throws an IOException if an error occurred during compression.
+		void Wait();
+
+	private:
+		void Compress();
+
+		String^ fileName;
+		FILE *file;
+		int readDescriptor;
+		Thread^ thread;
+		Exception^ error;
+	};
+}
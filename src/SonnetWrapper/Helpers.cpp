@@ -2,3 +2,17 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include "Helpers.h"
+
+namespace COIN
+{
+	array<String^>^ ToStringArray(const char * const *names, int count)
+	{
+		array<String^>^ result = gcnew array<String^>(count);
+		for (int i = 0; i < count; i++)
+		{
+			const char *name = (names != nullptr) ? names[i] : nullptr;
+			result[i] = (name != nullptr && name[0] != '\0') ? gcnew String(name) : String::Empty;
+		}
+		return result;
+	}
+}
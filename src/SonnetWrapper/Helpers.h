@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include "TransitionCounters.h"
+
 using namespace System;
 using namespace System::Runtime::InteropServices;
 
@@ -142,4 +144,14 @@ namespace COIN
 	{
 		return (t == nullptr || t->LongLength == 0)?nullptr:&t[0];
 	}
+
+	/// <summary>
+	/// Returns the managed strings of the given native names in one call, for the bulk name getters
+	/// (like CoinMpsIO::columnNames), instead of one call per name from managed code.
+	/// Null names, and all names if names is null, become empty strings.
+	/// </summary>
+	/// <param name="names">The array[count] of native names, or null</param>
+	/// <param name="count">The number of names</param>
+	/// <returns>The managed array of names</returns>
+	array<String^>^ ToStringArray(const char * const *names, int count);
 }
@@ -0,0 +1,139 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "LpReader.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	int LpReader::readLp(String^ fileName)
+	{
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			return Base->readLp(charFileName);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+		}
+	}
+
+	array<String^>^ LpReader::rowNames()
+	{
+		int n = Base->getNumRows();
+		std::vector<const char *> names(n);
+		for (int i = 0; i < n; i++) names[i] = Base->rowName(i);
+		return ToStringArray(names.data(), n);
+	}
+
+	array<String^>^ LpReader::columnNames()
+	{
+		int n = Base->getNumCols();
+		std::vector<const char *> names(n);
+		for (int j = 0; j < n; j++) names[j] = Base->columnName(j);
+		return ToStringArray(names.data(), n);
+	}
+
+	array<int>^ LpReader::getVectorStarts()
+	{
+		int n = Base->getNumCols() + 1;
+		array<int> ^result = gcnew array<int>(n);
+		Marshal::Copy((IntPtr)(void *)Base->getVectorStarts(), result, 0, n);
+		return result;
+	}
+
+	array<int>^ LpReader::getIndices()
+	{
+		int n = Base->getNumElements();
+		array<int> ^result = gcnew array<int>(n);
+		if (n > 0) Marshal::Copy((IntPtr)(void *)Base->getIndices(), result, 0, n);
+		return result;
+	}
+
+	array<double>^ LpReader::getElements()
+	{
+		int n = Base->getNumElements();
+		array<double> ^result = gcnew array<double>(n);
+		if (n > 0) Marshal::Copy((IntPtr)(void *)Base->getElements(), result, 0, n);
+		return result;
+	}
+
+	array<int>^ LpReader::getRowStarts()
+	{
+		int n = Base->getNumRows() + 1;
+		array<int> ^result = gcnew array<int>(n);
+		Marshal::Copy((IntPtr)(void *)Base->getRowStarts(), result, 0, n);
+		return result;
+	}
+
+	array<int>^ LpReader::getRowIndices()
+	{
+		int n = Base->getNumElements();
+		array<int> ^result = gcnew array<int>(n);
+		if (n > 0) Marshal::Copy((IntPtr)(void *)Base->getRowIndices(), result, 0, n);
+		return result;
+	}
+
+	array<double>^ LpReader::getRowElements()
+	{
+		int n = Base->getNumElements();
+		array<double> ^result = gcnew array<double>(n);
+		if (n > 0) Marshal::Copy((IntPtr)(void *)Base->getRowElements(), result, 0, n);
+		return result;
+	}
+
+	array<double>^ LpReader::getRowLower()
+	{
+		int n = Base->getNumRows();
+		array<double> ^result = gcnew array<double>(n);
+		if (n > 0) Marshal::Copy((IntPtr)(void *)Base->getRowLower(), result, 0, n);
+		return result;
+	}
+
+	array<double>^ LpReader::getRowUpper()
+	{
+		int n = Base->getNumRows();
+		array<double> ^result = gcnew array<double>(n);
+		if (n > 0) Marshal::Copy((IntPtr)(void *)Base->getRowUpper(), result, 0, n);
+		return result;
+	}
+
+	array<double>^ LpReader::getObjCoefficients()
+	{
+		int n = Base->getNumCols();
+		array<double> ^result = gcnew array<double>(n);
+		if (n > 0) Marshal::Copy((IntPtr)(void *)Base->getObjCoefficients(), result, 0, n);
+		return result;
+	}
+
+	array<double>^ LpReader::getColLower()
+	{
+		int n = Base->getNumCols();
+		array<double> ^result = gcnew array<double>(n);
+		if (n > 0) Marshal::Copy((IntPtr)(void *)Base->getColLower(), result, 0, n);
+		return result;
+	}
+
+	array<double>^ LpReader::getColUpper()
+	{
+		int n = Base->getNumCols();
+		array<double> ^result = gcnew array<double>(n);
+		if (n > 0) Marshal::Copy((IntPtr)(void *)Base->getColUpper(), result, 0, n);
+		return result;
+	}
+
+	array<__wchar_t>^ LpReader::getRowSense()
+	{
+		int n = Base->getNumRows();
+		if (n == 0) return gcnew array<__wchar_t>(n);
+		String ^ result = gcnew String(Base->getRowSense(), 0, n);
+		return result->ToCharArray();
+	}
+}
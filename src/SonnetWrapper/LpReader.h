@@ -0,0 +1,163 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "CoinPackedMatrix.h"
+
+#include "LpReader.hpp"
+
+#include "CoinError.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// Reader of LP files for large problems, in the format of CoinLpIO. The file is memory-mapped and read in a single pass,
+	/// building the matrix by row and by column without intermediate copies. Unsupported features, such as ranges or
+	/// quadratic terms, throw a CoinError, so the caller can fall back to CoinLpIO. See LpReader.hpp.
+	public ref class LpReader : WrapperBase<::LpReader>
+	{
+	public:
+		LpReader() {}
+
+		/// Set infinity
+		void setInfinity(double value)
+		{
+			Base->setInfinity(value);
+		}
+
+		/// Get infinity
+		double getInfinity()
+		{
+			return Base->getInfinity();
+		}
+
+		/// Read a problem in LP format from the given filename.
+		/// Throws a CoinError if the file cannot be opened, or contains errors or unsupported sections.
+		int readLp(String^ filename);
+
+		/// Get number of columns
+		int getNumCols()
+		{
+			return Base->getNumCols();
+		}
+
+		/// Get number of rows
+		int getNumRows()
+		{
+			return Base->getNumRows();
+		}
+
+		/// Get number of nonzero elements
+		int getNumElements()
+		{
+			return Base->getNumElements();
+		}
+
+		/// Get array[getNumCols()+1] of column starts
+		array<int>^ getVectorStarts();
+
+		/// Get array[getNumElements()] of row indices, column by column
+		array<int>^ getIndices();
+
+		/// Get array[getNumElements()] of elements, column by column
+		array<double>^ getElements();
+
+		/// Get array[getNumRows()+1] of row starts
+		array<int>^ getRowStarts();
+
+		/// Get array[getNumElements()] of column indices, row by row
+		array<int>^ getRowIndices();
+
+		/// Get array[getNumElements()] of elements, row by row
+		array<double>^ getRowElements();
+
+		/// Get array[getNumRows()] of row lower bounds
+		array<double>^ getRowLower();
+
+		/// Get array[getNumRows()] of row upper bounds
+		array<double>^ getRowUpper();
+
+		/// Get array[getNumCols()] of objective function coefficients (of the minimization problem)
+		array<double>^ getObjCoefficients();
+
+		/// Get array[getNumCols()] of column lower bounds
+		array<double>^ getColLower();
+
+		/// Get array[getNumCols()] of column upper bounds
+		array<double>^ getColUpper();
+
+		/** Get array[getNumRows()] of constraint senses.
+		<ul>
+		<li>'L': <= constraint
+		<li>'E': =  constraint
+		<li>'G': >= constraint
+		<li>'N': free constraint
+		</ul>
+		*/
+		array<__wchar_t>^ getRowSense();
+
+		/// Return the objective offset, the constant of the objective (of the minimization problem).
+		double objectiveOffset()
+		{
+			return Base->objectiveOffset();
+		}
+
+		/// Return true if the objective in the file was maximized, such that the objective coefficients and offset are negated.
+		bool wasMaximization()
+		{
+			return Base->wasMaximization();
+		}
+
+		/// Return the objective name
+		String^ getObjName()
+		{
+			return gcnew String(Base->getObjName());
+		}
+
+		/// Return true if column is a continuous variable
+		bool isContinuous(int colNumber)
+		{
+			return Base->isContinuous(colNumber);
+		}
+
+		/// Return true if column is an integer variable
+		bool isInteger(int columnNumber)
+		{
+			return Base->isInteger(columnNumber);
+		}
+
+		/// Returns the row name for the specified index.
+		String^ rowName(int index)
+		{
+			return gcnew String(Base->rowName(index));
+		}
+
+		/// Returns the column name for the specified index.
+		String^ columnName(int index)
+		{
+			return gcnew String(Base->columnName(index));
+		}
+
+		/// Returns all row names at once, as rowName(i) for each row.
+		array<String^>^ rowNames();
+
+		/// Returns all column names at once, as columnName(j) for each column.
+		array<String^>^ columnNames();
+
+		/// Get the matrix by column. The matrix is owned by this reader.
+		CoinPackedMatrix ^ getMatrixByCol()
+		{
+			return gcnew CoinPackedMatrix(Base->getMatrixByCol());
+		}
+
+		/// Get the matrix by row. The matrix is owned by this reader.
+		CoinPackedMatrix ^ getMatrixByRow()
+		{
+			return gcnew CoinPackedMatrix(Base->getMatrixByRow());
+		}
+	};
+}
@@ -0,0 +1,137 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+class CoinPackedMatrix;
+
+/** Native reader of LP files that builds the matrix in a single pass over the file.
+
+	The file is memory-mapped and tokenized in place. Column names are interned in a hash table
+	on first appearance, and each constraint is appended to row-ordered (CSR) arrays as it is read;
+	the column-ordered (CSC) arrays are made by one transpose at the end. Hence there are no
+	intermediate copies of the problem, and no allocations per token.
+
+	The format is that of CoinLpIO: the objective (Minimize or Maximize) with an optional name and constant,
+	the constraints (Subject To) with optional names, and the optional Bounds, Integers, Generals and Binaries
+	sections, with comments starting with \ or /. As CoinLpIO, the objective of a maximization problem is negated.
+	Columns get the default bounds 0 and infinity, also if integer. Binaries get bounds 0 and 1.
+	Unnamed constraints are named cons0, cons1, ..., by their row index, and an unnamed objective obj.
+	Coefficients of the same column in the same row are summed. A ranged row is a constraint followed by a constraint
+	with the same name and only the other bound, like "R1: <= 5", as written by ModelWriter.
+
+	Anything else, such as semi-continuous columns, SOS or quadratic terms, throws a CoinError,
+	such that the caller can fall back to CoinLpIO.
+
+	This class is compiled as native code (not /clr).
+*/
+class LpReader
+{
+public:
+	LpReader();
+	~LpReader();
+
+	/// Set infinity
+	void setInfinity(double value) { infinity_ = value; }
+	/// Get infinity
+	double getInfinity() const { return infinity_; }
+
+	/** Read a problem in LP format from the given filename.
+		Throws a CoinError if the file cannot be opened, or contains errors or unsupported sections.
+		Returns 0 on success. */
+	int readLp(const char *filename);
+
+	/// Get number of columns
+	int getNumCols() const { return static_cast<int>(colLower_.size()); }
+	/// Get number of rows
+	int getNumRows() const { return static_cast<int>(rowLower_.size()); }
+	/// Get number of nonzero elements
+	int getNumElements() const { return static_cast<int>(rowElements_.size()); }
+
+	/// Get pointer to array[getNumCols()+1] of column starts
+	const int *getVectorStarts() const { return starts_.data(); }
+	/// Get pointer to array[getNumElements()] of row indices, column by column
+	const int *getIndices() const { return indices_.data(); }
+	/// Get pointer to array[getNumElements()] of elements, column by column
+	const double *getElements() const { return elements_.data(); }
+
+	/// Get pointer to array[getNumRows()+1] of row starts
+	const int *getRowStarts() const { return rowStarts_.data(); }
+	/// Get pointer to array[getNumElements()] of column indices, row by row, in the order of the file
+	const int *getRowIndices() const { return rowIndices_.data(); }
+	/// Get pointer to array[getNumElements()] of elements, row by row
+	const double *getRowElements() const { return rowElements_.data(); }
+
+	/// Get pointer to array[getNumCols()] of column lower bounds
+	const double *getColLower() const { return colLower_.data(); }
+	/// Get pointer to array[getNumCols()] of column upper bounds
+	const double *getColUpper() const { return colUpper_.data(); }
+	/// Get pointer to array[getNumRows()] of row lower bounds
+	const double *getRowLower() const { return rowLower_.data(); }
+	/// Get pointer to array[getNumRows()] of row upper bounds
+	const double *getRowUpper() const { return rowUpper_.data(); }
+	/// Get pointer to array[getNumCols()] of objective function coefficients (of the minimization problem)
+	const double *getObjCoefficients() const { return objective_.data(); }
+
+	/** Get pointer to array[getNumRows()] of constraint senses, as CoinLpIO:
+		'L', 'E', 'G' or 'N' (free, if the right-hand side is infinite). */
+	const char *getRowSense() const { return rowSense_.data(); }
+
+	/// Return the objective offset, the constant of the objective (of the minimization problem).
+	double objectiveOffset() const { return objectiveOffset_; }
+	/// Return true if the objective in the file was maximized, such that the objective coefficients and offset are negated.
+	bool wasMaximization() const { return wasMaximization_; }
+
+	/// Return the objective name
+	const char *getObjName() const { return objectiveName_.c_str(); }
+
+	/// Return true if column is an integer variable
+	bool isInteger(int columnNumber) const { return integer_[columnNumber] != 0; }
+	/// Return true if column is a continuous variable
+	bool isContinuous(int columnNumber) const { return integer_[columnNumber] == 0; }
+
+	/// Returns the row name for the specified index, or 0 if the index is out of range.
+	const char *rowName(int index) const;
+	/// Returns the column name for the specified index, or 0 if the index is out of range.
+	const char *columnName(int index) const;
+
+	/// Get the matrix by column. The matrix is created on the first call, and owned by this reader.
+	const CoinPackedMatrix *getMatrixByCol() const;
+	/// Get the matrix by row. The matrix is created on the first call, and owned by this reader.
+	const CoinPackedMatrix *getMatrixByRow() const;
+
+private:
+	LpReader(const LpReader &);
+	LpReader &operator=(const LpReader &);
+
+	class Parser;
+
+	void clear();
+
+	double infinity_;
+
+	std::string objectiveName_;
+	double objectiveOffset_;
+	bool wasMaximization_;
+	std::vector<std::string> rowNames_;
+	std::vector<std::string> columnNames_;
+	std::vector<double> rowLower_;
+	std::vector<double> rowUpper_;
+	std::vector<char> rowSense_;
+	std::vector<double> colLower_;
+	std::vector<double> colUpper_;
+	std::vector<double> objective_;
+	std::vector<char> integer_;
+	std::vector<int> rowStarts_;
+	std::vector<int> rowIndices_;
+	std::vector<double> rowElements_;
+	std::vector<int> starts_;
+	std::vector<int> indices_;
+	std::vector<double> elements_;
+
+	mutable CoinPackedMatrix *matrixByColumn_;
+	mutable CoinPackedMatrix *matrixByRow_;
+};
@@ -0,0 +1,689 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native implementation of LpReader. This file is compiled without /clr, and as C++17 (std::from_chars).
+
+#include "LpReader.hpp"
+#include "MappedFile.hpp"
+
+#include <CoinError.hpp>
+#include <CoinPackedMatrix.hpp>
+
+#include <algorithm>
+#include <cfloat>
+#include <charconv>
+#include <cctype>
+#include <cstring>
+#include <initializer_list>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+	const double LpInfinity = 1.0e30;
+
+	/// An error at the given position in the file
+	struct ParseError
+	{
+		const char *position;
+		std::string message;
+	};
+
+	enum TokenType { EndOfFile, Number, Name, Plus, Minus, Colon, LessEqual, GreaterEqual, Equal };
+
+	struct Token
+	{
+		TokenType type;
+		std::string_view text;
+		double value;
+	};
+
+	enum Section { NoSection, ObjectiveSection, ConstraintsSection, BoundsSection, IntegersSection, BinariesSection, EndSection };
+
+	inline bool isSpace(char c)
+	{
+		return static_cast<unsigned char>(c) <= ' ';
+	}
+
+	inline bool isNameChar(char c)
+	{
+		return !isSpace(c) && strchr("+-<>=:\\/[]^*", c) == nullptr;
+	}
+
+	/// Compares the token case-insensitively with the given lowercase text
+	inline bool equalsIgnoreCase(std::string_view token, const char *text)
+	{
+		size_t length = strlen(text);
+		if (token.size() != length) return false;
+		for (size_t i = 0; i < length; i++)
+		{
+			if (tolower(static_cast<unsigned char>(token[i])) != text[i]) return false;
+		}
+		return true;
+	}
+
+	inline bool isAnyOf(std::string_view token, std::initializer_list<const char *> texts)
+	{
+		for (const char *text : texts)
+		{
+			if (equalsIgnoreCase(token, text)) return true;
+		}
+		return false;
+	}
+
+	/// Reads the token at position, and moves position past it. Comments and whitespace are skipped.
+	Token lex(const char *&position, const char *end)
+	{
+		const char *p = position;
+		for (;;)
+		{
+			while (p < end && isSpace(*p)) p++;
+			if (p < end && (*p == '\\' || *p == '/'))
+			{
+				const char *lineEnd = static_cast<const char *>(memchr(p, '\n', end - p));
+				p = (lineEnd == nullptr) ? end : lineEnd;
+				continue;
+			}
+			break;
+		}
+
+		Token token = { EndOfFile, std::string_view(p, 0), 0.0 };
+		if (p == end)
+		{
+			position = p;
+			return token;
+		}
+
+		const char *start = p;
+		char c = *p;
+		switch (c)
+		{
+		case '+': token.type = Plus; p++; break;
+		case '-': token.type = Minus; p++; break;
+		case ':': token.type = Colon; p++; break;
+		case '<':
+			token.type = LessEqual;
+			p++;
+			if (p < end && *p == '=') p++;
+			break;
+		case '>':
+			token.type = GreaterEqual;
+			p++;
+			if (p < end && *p == '=') p++;
+			break;
+		case '=':
+			token.type = Equal;
+			p++;
+			if (p < end && *p == '<') { token.type = LessEqual; p++; }
+			else if (p < end && *p == '>') { token.type = GreaterEqual; p++; }
+			else if (p < end && *p == '=') p++;
+			break;
+		default:
+			if (isdigit(static_cast<unsigned char>(c)) || c == '.')
+			{
+				// A name may follow the coefficient without space, as in 2x
+				token.type = Number;
+				std::from_chars_result result = std::from_chars(p, end, token.value);
+				if (result.ec != std::errc())
+				{
+					const char *tokenEnd = p;
+					while (tokenEnd < end && isNameChar(*tokenEnd)) tokenEnd++;
+					throw ParseError{ start, "invalid number " + std::string(start, tokenEnd) };
+				}
+				p = result.ptr;
+			}
+			else if (isNameChar(c))
+			{
+				token.type = Name;
+				while (p < end && isNameChar(*p)) p++;
+			}
+			else
+			{
+				// Such as the brackets of quadratic terms
+				throw ParseError{ start, std::string("unsupported character ") + c };
+			}
+			break;
+		}
+
+		token.text = std::string_view(start, p - start);
+		position = p;
+		return token;
+	}
+
+	inline bool isSense(TokenType type)
+	{
+		return type == LessEqual || type == GreaterEqual || type == Equal;
+	}
+}
+
+/// The single pass over the file. Columns are interned by their name in the mapped file, and converted
+/// to strings only at the end.
+class LpReader::Parser
+{
+public:
+	Parser(LpReader &reader, const char *begin, const char *end)
+		: reader_(reader), position_(begin), end_(end), section_(NoSection), hasObjective_(false), objectiveName_()
+	{
+		advance();
+	}
+
+	void parse()
+	{
+		while (token_.type != EndOfFile && section_ != EndSection)
+		{
+			if (parseSectionKeyword()) continue;
+
+			switch (section_)
+			{
+			case ObjectiveSection:
+				parseObjective();
+				// The objective is complete, so a section keyword must follow
+				if (token_.type != EndOfFile && !isSectionKeyword()) throw ParseError{ token_.text.data(), "expected Subject To" };
+				break;
+			case ConstraintsSection:
+				parseConstraint();
+				break;
+			case BoundsSection:
+				parseBound();
+				break;
+			case IntegersSection:
+			case BinariesSection:
+				parseInteger();
+				break;
+			default:
+				throw ParseError{ token_.text.data(), "expected Minimize or Maximize" };
+			}
+		}
+
+		if (!hasObjective_) throw ParseError{ end_, "no Minimize or Maximize section" };
+		finish();
+	}
+
+private:
+	void advance()
+	{
+		token_ = lex(position_, end_);
+	}
+
+	Token peek() const
+	{
+		const char *position = position_;
+		return lex(position, end_);
+	}
+
+	ParseError error(const std::string &message) const
+	{
+		return ParseError{ token_.text.data(), message };
+	}
+
+	/// Returns the section of the keyword at the current token, or NoSection. For two-word keywords, words is set to 2.
+	Section sectionOf(int &words) const
+	{
+		words = 1;
+		if (token_.type != Name) return NoSection;
+
+		std::string_view text = token_.text;
+		if (isAnyOf(text, { "min", "minimize", "minimise", "minimum", "max", "maximize", "maximise", "maximum" })) return ObjectiveSection;
+		if (isAnyOf(text, { "st", "s.t.", "st." })) return ConstraintsSection;
+		if (isAnyOf(text, { "subject", "such" }))
+		{
+			Token next = peek();
+			if (next.type == Name && isAnyOf(next.text, { "to", "that" }))
+			{
+				words = 2;
+				return ConstraintsSection;
+			}
+			return NoSection;
+		}
+		if (isAnyOf(text, { "bound", "bounds" })) return BoundsSection;
+		if (isAnyOf(text, { "int", "integer", "integers", "gen", "general", "generals" })) return IntegersSection;
+		if (isAnyOf(text, { "bin", "binary", "binaries" })) return BinariesSection;
+		if (isAnyOf(text, { "end" })) return EndSection;
+		return NoSection;
+	}
+
+	bool isUnsupportedKeyword() const
+	{
+		if (token_.type != Name) return false;
+		if (isAnyOf(token_.text, { "semi", "semis", "sos", "sos1", "sos2", "pwl" })) return true;
+
+		const char *secondWord = equalsIgnoreCase(token_.text, "lazy") ? "constraints" : equalsIgnoreCase(token_.text, "user") ? "cuts" : nullptr;
+		if (secondWord == nullptr) return false;
+
+		Token next = peek();
+		return next.type == Name && equalsIgnoreCase(next.text, secondWord);
+	}
+
+	bool isSectionKeyword() const
+	{
+		int words;
+		return sectionOf(words) != NoSection || isUnsupportedKeyword();
+	}
+
+	/// If the current token is a section keyword, moves to that section and returns true.
+	bool parseSectionKeyword()
+	{
+		if (isUnsupportedKeyword()) throw error("section " + std::string(token_.text) + " is not supported");
+
+		int words;
+		Section section = sectionOf(words);
+		if (section == NoSection) return false;
+
+		if (section == ObjectiveSection)
+		{
+			if (hasObjective_) throw error("more than one objective");
+			hasObjective_ = true;
+			reader_.wasMaximization_ = tolower(static_cast<unsigned char>(token_.text[1])) == 'a';
+		}
+		else if (!hasObjective_ && section != EndSection)
+		{
+			throw error("expected Minimize or Maximize");
+		}
+
+		section_ = section;
+		for (int k = 0; k < words; k++) advance();
+		return true;
+	}
+
+	/// Parses the optional name of the objective or a constraint: a name followed by a colon.
+	std::string_view parseLabel()
+	{
+		if (token_.type != Name || peek().type != Colon) return std::string_view();
+
+		std::string_view name = token_.text;
+		advance();
+		advance();
+		return name;
+	}
+
+	/// Parses a linear expression, calling addTerm(column, coefficient) for each term, and returns the sum of the constants.
+	/// The expression ends before a token that is not a term, or before a name not preceded by a sign.
+	template<class AddTerm>
+	double parseTerms(AddTerm addTerm)
+	{
+		double constant = 0.0;
+		for (bool first = true;; first = false)
+		{
+			double sign = 1.0;
+			bool hasSign = false;
+			while (token_.type == Plus || token_.type == Minus)
+			{
+				if (token_.type == Minus) sign = -sign;
+				hasSign = true;
+				advance();
+			}
+
+			if (!first && !hasSign) return constant;
+
+			if (token_.type == Number)
+			{
+				double value = sign * token_.value;
+				advance();
+				if (token_.type == Name && !isSectionKeyword())
+				{
+					addTerm(column(token_.text), value);
+					advance();
+				}
+				else constant += value;
+			}
+			else if (token_.type == Name && !isSectionKeyword())
+			{
+				addTerm(column(token_.text), sign);
+				advance();
+			}
+			else
+			{
+				if (hasSign) throw error("expected a number or name");
+				return constant;
+			}
+		}
+	}
+
+	void parseObjective()
+	{
+		std::string_view name = parseLabel();
+		if (!name.empty()) objectiveName_ = name;
+
+		std::vector<double> &objective = reader_.objective_;
+		reader_.objectiveOffset_ += parseTerms([&](int j, double value) { objective[j] += value; });
+	}
+
+	void parseConstraint()
+	{
+		std::string_view name = parseLabel();
+		int row = static_cast<int>(rowNames_.size());
+
+		std::vector<int> &indices = reader_.rowIndices_;
+		std::vector<double> &elements = reader_.rowElements_;
+		size_t rowStart = indices.size();
+
+		double constant = parseTerms([&](int j, double value)
+		{
+			// Sum the coefficients of the same column in this row
+			if (lastRow_[j] == row) elements[positions_[j]] += value;
+			else
+			{
+				lastRow_[j] = row;
+				positions_[j] = indices.size();
+				indices.push_back(j);
+				elements.push_back(value);
+			}
+		});
+
+		if (indices.size() == rowStart)
+		{
+			// The other bound of a ranged row is a constraint with the name of the previous row and without columns
+			if (isSense(token_.type) && !name.empty() && !rowNames_.empty() && rowNames_.back() == name)
+			{
+				parseRange(row - 1, constant);
+				return;
+			}
+			if (isSense(token_.type)) throw error("constraint without columns is not supported, except as range of the previous row");
+			throw error("expected a constraint");
+		}
+		if (!isSense(token_.type)) throw error("expected <=, >= or =");
+		TokenType sense = token_.type;
+		advance();
+
+		double rhs = parseValue() - constant;
+		if (isSense(token_.type)) throw error("ranged constraints are not supported");
+
+		rowNames_.push_back(name);
+		reader_.rowStarts_.push_back(static_cast<int>(indices.size()));
+		reader_.rowLower_.push_back((sense == LessEqual) ? -reader_.infinity_ : rhs);
+		reader_.rowUpper_.push_back((sense == GreaterEqual) ? reader_.infinity_ : rhs);
+	}
+
+	void parseRange(int row, double constant)
+	{
+		TokenType sense = token_.type;
+		advance();
+		double rhs = parseValue() - constant;
+
+		double &lower = reader_.rowLower_[row];
+		double &upper = reader_.rowUpper_[row];
+		if (sense == LessEqual && upper >= reader_.infinity_) upper = rhs;
+		else if (sense == GreaterEqual && lower <= -reader_.infinity_) lower = rhs;
+		else throw error("the range must give the missing bound of the previous row");
+	}
+
+	void parseBound()
+	{
+		if (token_.type == Name && !(isInfinity(token_.text) && isSense(peek().type)))
+		{
+			int j = column(token_.text);
+			advance();
+
+			if (token_.type == Name && equalsIgnoreCase(token_.text, "free"))
+			{
+				reader_.colLower_[j] = -reader_.infinity_;
+				reader_.colUpper_[j] = reader_.infinity_;
+				advance();
+				return;
+			}
+
+			if (!isSense(token_.type)) throw error("expected <=, >=, = or free");
+			TokenType sense = token_.type;
+			advance();
+			setBound(j, sense, parseValue());
+			return;
+		}
+
+		// value <= name [<= value]
+		double value = parseValue();
+		if (!isSense(token_.type)) throw error("expected <=, >= or =");
+		TokenType sense = token_.type;
+		advance();
+
+		if (token_.type != Name) throw error("expected a column name");
+		int j = column(token_.text);
+		advance();
+		setBound(j, (sense == LessEqual) ? GreaterEqual : (sense == GreaterEqual) ? LessEqual : Equal, value);
+
+		if (isSense(token_.type))
+		{
+			sense = token_.type;
+			advance();
+			setBound(j, sense, parseValue());
+		}
+	}
+
+	/// Sets the bound of: column sense value
+	void setBound(int j, TokenType sense, double value)
+	{
+		if (sense != GreaterEqual) reader_.colUpper_[j] = value;
+		if (sense != LessEqual) reader_.colLower_[j] = value;
+	}
+
+	void parseInteger()
+	{
+		if (token_.type != Name) throw error("expected a column name");
+
+		int j = column(token_.text);
+		reader_.integer_[j] = 1;
+		if (section_ == BinariesSection)
+		{
+			reader_.colLower_[j] = 0.0;
+			reader_.colUpper_[j] = 1.0;
+		}
+		advance();
+	}
+
+	static bool isInfinity(std::string_view text)
+	{
+		return isAnyOf(text, { "inf", "infinity" });
+	}
+
+	/// Parses a signed number or infinity
+	double parseValue()
+	{
+		double sign = 1.0;
+		while (token_.type == Plus || token_.type == Minus)
+		{
+			if (token_.type == Minus) sign = -sign;
+			advance();
+		}
+
+		double value;
+		if (token_.type == Number) value = token_.value;
+		else if (token_.type == Name && isInfinity(token_.text)) value = LpInfinity;
+		else throw error("expected a number");
+		advance();
+
+		value *= sign;
+		if (value >= LpInfinity) return reader_.infinity_;
+		if (value <= -LpInfinity) return -reader_.infinity_;
+		return value;
+	}
+
+	/// Returns the index of the column with the given name, which is added if it is new.
+	int column(std::string_view name)
+	{
+		// Find first, since emplace allocates a node also if the name exists
+		std::unordered_map<std::string_view, int>::const_iterator it = columns_.find(name);
+		if (it != columns_.end()) return it->second;
+
+		int j = static_cast<int>(columnNames_.size());
+		columns_.emplace(name, j);
+		columnNames_.push_back(name);
+		reader_.objective_.push_back(0.0);
+		reader_.colLower_.push_back(0.0);
+		reader_.colUpper_.push_back(reader_.infinity_);
+		reader_.integer_.push_back(0);
+		lastRow_.push_back(-1);
+		positions_.push_back(0);
+		return j;
+	}
+
+	void finish()
+	{
+		LpReader &r = reader_;
+		int numberColumns = static_cast<int>(columnNames_.size());
+		int numberRows = static_cast<int>(rowNames_.size());
+
+		if (r.wasMaximization_)
+		{
+			for (double &value : r.objective_) value = -value;
+			r.objectiveOffset_ = -r.objectiveOffset_;
+		}
+
+		r.objectiveName_ = objectiveName_.empty() ? std::string("obj") : std::string(objectiveName_);
+		r.columnNames_.assign(columnNames_.begin(), columnNames_.end());
+		r.rowNames_.resize(numberRows);
+		for (int i = 0; i < numberRows; i++)
+		{
+			r.rowNames_[i] = rowNames_[i].empty() ? "cons" + std::to_string(i) : std::string(rowNames_[i]);
+		}
+
+		r.rowSense_.resize(numberRows);
+		for (int i = 0; i < numberRows; i++)
+		{
+			bool hasLower = r.rowLower_[i] > -r.infinity_;
+			bool hasUpper = r.rowUpper_[i] < r.infinity_;
+			if (hasLower && hasUpper) r.rowSense_[i] = (r.rowLower_[i] == r.rowUpper_[i]) ? 'E' : 'R';
+			else if (hasLower) r.rowSense_[i] = 'G';
+			else if (hasUpper) r.rowSense_[i] = 'L';
+			else r.rowSense_[i] = 'N';
+		}
+
+		// Transpose the rows into columns
+		int numberElements = static_cast<int>(r.rowIndices_.size());
+		r.starts_.assign(numberColumns + 1, 0);
+		for (int k = 0; k < numberElements; k++) r.starts_[r.rowIndices_[k] + 1]++;
+		for (int j = 0; j < numberColumns; j++) r.starts_[j + 1] += r.starts_[j];
+
+		r.indices_.resize(numberElements);
+		r.elements_.resize(numberElements);
+		std::vector<int> next(r.starts_.begin(), r.starts_.end() - 1);
+		for (int i = 0; i < numberRows; i++)
+		{
+			for (int k = r.rowStarts_[i]; k < r.rowStarts_[i + 1]; k++)
+			{
+				int position = next[r.rowIndices_[k]]++;
+				r.indices_[position] = i;
+				r.elements_[position] = r.rowElements_[k];
+			}
+		}
+	}
+
+	LpReader &reader_;
+	const char *position_;
+	const char *end_;
+	Token token_;
+	Section section_;
+	bool hasObjective_;
+	std::string_view objectiveName_;
+
+	std::unordered_map<std::string_view, int> columns_;
+	std::vector<std::string_view> columnNames_;
+	std::vector<std::string_view> rowNames_;
+	/// For each column, the last row it was added to, and its position in that row, to sum duplicates
+	std::vector<int> lastRow_;
+	std::vector<size_t> positions_;
+};
+
+LpReader::LpReader()
+	: infinity_(DBL_MAX), objectiveOffset_(0.0), wasMaximization_(false),
+	rowStarts_(1, 0), starts_(1, 0), matrixByColumn_(nullptr), matrixByRow_(nullptr)
+{
+}
+
+LpReader::~LpReader()
+{
+	clear();
+}
+
+void LpReader::clear()
+{
+	objectiveName_.clear();
+	objectiveOffset_ = 0.0;
+	wasMaximization_ = false;
+	rowNames_.clear();
+	columnNames_.clear();
+	rowLower_.clear();
+	rowUpper_.clear();
+	rowSense_.clear();
+	colLower_.clear();
+	colUpper_.clear();
+	objective_.clear();
+	integer_.clear();
+	rowStarts_.assign(1, 0);
+	rowIndices_.clear();
+	rowElements_.clear();
+	starts_.assign(1, 0);
+	indices_.clear();
+	elements_.clear();
+
+	delete matrixByColumn_;
+	delete matrixByRow_;
+	matrixByColumn_ = nullptr;
+	matrixByRow_ = nullptr;
+}
+
+int LpReader::readLp(const char *filename)
+{
+	clear();
+
+	MappedFile file(filename, "readLp", "LpReader");
+	const char *data = file.data();
+	const char *end = data + file.size();
+
+	try
+	{
+		Parser parser(*this, data, end);
+		parser.parse();
+	}
+	catch (ParseError &error)
+	{
+		long long line = 1 + std::count(data, std::min(error.position, end), '\n');
+		clear();
+		throw CoinError("LP line " + std::to_string(line) + ": " + error.message, "readLp", "LpReader");
+	}
+	catch (...)
+	{
+		clear();
+		throw;
+	}
+
+	return 0;
+}
+
+const char *LpReader::rowName(int index) const
+{
+	if (index < 0 || index >= getNumRows()) return nullptr;
+	return rowNames_[index].c_str();
+}
+
+const char *LpReader::columnName(int index) const
+{
+	if (index < 0 || index >= getNumCols()) return nullptr;
+	return columnNames_[index].c_str();
+}
+
+const CoinPackedMatrix *LpReader::getMatrixByCol() const
+{
+	if (matrixByColumn_ == nullptr)
+	{
+		int numberColumns = getNumCols();
+		std::vector<int> lengths(numberColumns);
+		for (int j = 0; j < numberColumns; j++) lengths[j] = starts_[j + 1] - starts_[j];
+
+		matrixByColumn_ = new CoinPackedMatrix(true, getNumRows(), numberColumns, getNumElements(),
+			elements_.data(), indices_.data(), starts_.data(), lengths.data());
+	}
+	return matrixByColumn_;
+}
+
+const CoinPackedMatrix *LpReader::getMatrixByRow() const
+{
+	if (matrixByRow_ == nullptr)
+	{
+		int numberRows = getNumRows();
+		std::vector<int> lengths(numberRows);
+		for (int i = 0; i < numberRows; i++) lengths[i] = rowStarts_[i + 1] - rowStarts_[i];
+
+		matrixByRow_ = new CoinPackedMatrix(false, getNumCols(), numberRows, getNumElements(),
+			rowElements_.data(), rowIndices_.data(), rowStarts_.data(), lengths.data());
+	}
+	return matrixByRow_;
+}
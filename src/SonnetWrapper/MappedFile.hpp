@@ -0,0 +1,110 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+// A read-only memory mapping of a file, shared by the native readers (MpsParallelReader, LpReader, ProblemSnapshot, SolutionFile, ProblemPatch).
+// Only to be included in files compiled without /clr.
+
+#include <CoinError.hpp>
+
+#include <cstddef>
+#include <string>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/** A read-only memory mapping of a file.
+	Errors are thrown as CoinError with the given method and class name of the caller.
+*/
+class MappedFile
+{
+public:
+	MappedFile(const char *filename, const char *methodName, const char *className)
+		: data_(nullptr), size_(0), methodName_(methodName), className_(className)
+	{
+#ifdef _WIN32
+		mapping_ = nullptr;
+		file_ = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file_ == INVALID_HANDLE_VALUE) throw CoinError(std::string("Unable to open file ") + filename, methodName_, className_);
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file_, &size)) Fail(filename);
+		size_ = static_cast<size_t>(size.QuadPart);
+		if (size_ == 0) return;
+
+		mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping_ == nullptr) Fail(filename);
+		data_ = static_cast<const char *>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+		if (data_ == nullptr) Fail(filename);
+#else
+		file_ = open(filename, O_RDONLY);
+		if (file_ < 0) throw CoinError(std::string("Unable to open file ") + filename, methodName_, className_);
+
+		struct stat status;
+		if (fstat(file_, &status) != 0) Fail(filename);
+		size_ = static_cast<size_t>(status.st_size);
+		if (size_ == 0) return;
+
+		void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_, 0);
+		if (data == MAP_FAILED) Fail(filename);
+		madvise(data, size_, MADV_SEQUENTIAL);
+		data_ = static_cast<const char *>(data);
+#endif
+	}
+
+	~MappedFile()
+	{
+		Close();
+	}
+
+	/// The start of the file, aligned to at least the page size, or nullptr for an empty file
+	const char *data() const { return data_; }
+	/// The size of the file in bytes
+	size_t size() const { return size_; }
+
+private:
+	MappedFile(const MappedFile &);
+	MappedFile &operator=(const MappedFile &);
+
+	void Close()
+	{
+#ifdef _WIN32
+		if (data_ != nullptr) UnmapViewOfFile(data_);
+		if (mapping_ != nullptr) CloseHandle(mapping_);
+		if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+		mapping_ = nullptr;
+		file_ = INVALID_HANDLE_VALUE;
+#else
+		if (data_ != nullptr) munmap(const_cast<char *>(data_), size_);
+		if (file_ >= 0) close(file_);
+		file_ = -1;
+#endif
+		data_ = nullptr;
+	}
+
+	void Fail(const char *filename)
+	{
+		Close();
+		throw CoinError(std::string("Unable to map file ") + filename, methodName_, className_);
+	}
+
+	const char *data_;
+	size_t size_;
+	std::string methodName_;
+	std::string className_;
+#ifdef _WIN32
+	HANDLE file_;
+	HANDLE mapping_;
+#else
+	int file_;
+#endif
+};
@@ -0,0 +1,78 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "ModelWriter.h"
+#include "CompressedFileOutput.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	int ModelWriter::writeMps(OsiSolverInterface ^ solver, String ^ fileName)
+	{
+		return write(solver, fileName, false);
+	}
+
+	int ModelWriter::writeLp(OsiSolverInterface ^ solver, String ^ fileName)
+	{
+		return write(solver, fileName, true);
+	}
+
+	int ModelWriter::write(OsiSolverInterface ^ solver, String ^ fileName, bool lp)
+	{
+		if (fileName->EndsWith(".gz", StringComparison::OrdinalIgnoreCase)) return writeCompressed(solver, fileName, lp);
+
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			if (lp) return Base->writeLp(*solver->Base, charFileName);
+			else return Base->writeMps(*solver->Base, charFileName);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+			GC::KeepAlive(solver);
+		}
+	}
+
+	int ModelWriter::writeCompressed(OsiSolverInterface ^ solver, String ^ fileName, bool lp)
+	{
+		CompressedFileOutput^ output = gcnew CompressedFileOutput(fileName);
+		FILE *file = output->TakeFile();
+		int result;
+		try
+		{
+			if (lp) result = Base->writeLp(*solver->Base, file);
+			else result = Base->writeMps(*solver->Base, file);
+		}
+		catch (::CoinError err)
+		{
+			// Do not leave a partial file behind
+			fclose(file);
+			try
+			{
+				output->Wait();
+			}
+			catch (IOException^)
+			{
+				// the original error is more informative
+			}
+			File::Delete(fileName);
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			GC::KeepAlive(solver);
+		}
+
+		fclose(file);
+		output->Wait();
+		return result;
+	}
+}
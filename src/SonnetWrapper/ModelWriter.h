@@ -0,0 +1,62 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "OsiSolverInterface.h"
+
+#include "ModelWriter.hpp"
+
+#include "CoinError.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// Multithreaded writer of the problem of an OsiSolverInterface in MPS or LP format, for very large problems.
+	/// The sections are formatted in chunks in parallel and written through a large buffer. File names ending
+	/// with .gz are written gzip-compressed. The files read back to the same problem with CoinMpsIO and CoinLpIO. See ModelWriter.hpp.
+	public ref class ModelWriter : WrapperBase<::ModelWriter>
+	{
+	public:
+		ModelWriter() {}
+
+		/// Set the number of threads used for formatting, or 0 to use all cores (= Default).
+		void setNumberThreads(int value)
+		{
+			Base->setNumberThreads(value);
+		}
+
+		/// Get the number of threads used for formatting, or 0 if all cores are used.
+		int getNumberThreads()
+		{
+			return Base->getNumberThreads();
+		}
+
+		/// Set whether MPS files are written in free format (= Default), or in fixed format if all names fit.
+		void setFreeFormat(bool value)
+		{
+			Base->setFreeFormat(value);
+		}
+
+		/// Get whether MPS files are written in free format.
+		bool getFreeFormat()
+		{
+			return Base->getFreeFormat();
+		}
+
+		/// Write the problem of the given solver in MPS format to the given file, compressed if the name ends with .gz.
+		/// Throws a CoinError if the file cannot be written.
+		int writeMps(OsiSolverInterface ^ solver, String ^ fileName);
+
+		/// Write the problem of the given solver in LP format to the given file, compressed if the name ends with .gz.
+		/// Throws a CoinError if the file cannot be written.
+		int writeLp(OsiSolverInterface ^ solver, String ^ fileName);
+
+	private:
+		int write(OsiSolverInterface ^ solver, String ^ fileName, bool lp);
+		int writeCompressed(OsiSolverInterface ^ solver, String ^ fileName, bool lp);
+	};
+}
@@ -0,0 +1,60 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <cstdio>
+
+class OsiSolverInterface;
+
+/** Native multithreaded writer of the problem of an OsiSolverInterface in MPS or LP format.
+
+	The sections are formatted in chunks of columns or rows in parallel, with the shortest
+	representation of each number that reads back to the same double (std::to_chars), and written
+	in order through a large buffer while the next chunks are being formatted.
+
+	The output is read by CoinMpsIO, CoinLpIO and MpsParallelReader, and matches the semantics of
+	OsiSolverInterface::writeMps and writeLp: a maximization problem is written as the minimization of
+	the negated objective, and the objective offset is written as right-hand side of the objective row.
+	Names are taken from the solver (getRowName, getColName), so they follow its name discipline.
+
+	Fixed format MPS is only written if all names fit in 8 characters, as CoinMpsIO, and otherwise free format.
+	In fixed format, numbers are rounded to fit in 12 characters.
+
+	In LP files, the objective offset is written as constant of the objective, and a ranged row as the
+	constraint with its lower bound, followed by a constraint with the same name and only the upper bound,
+	like "R1: <= 5".
+
+	This class is compiled as native code (not /clr) to be able to use std::thread.
+*/
+class ModelWriter
+{
+public:
+	ModelWriter();
+
+	/// Set the number of threads used for formatting, or 0 to use all cores (= Default).
+	void setNumberThreads(int value) { numberThreads_ = value; }
+	/// Get the number of threads used for formatting, or 0 if all cores are used.
+	int getNumberThreads() const { return numberThreads_; }
+
+	/// Set whether MPS files are written in free format (= Default), or in fixed format if possible.
+	void setFreeFormat(bool value) { freeFormat_ = value; }
+	/// Get whether MPS files are written in free format.
+	bool getFreeFormat() const { return freeFormat_; }
+
+	/** Write the problem of the given solver in MPS format to the given file.
+		Throws a CoinError if the file cannot be written. Returns 0 on success, like writeMps. */
+	int writeMps(const OsiSolverInterface &solver, const char *filename) const;
+	/// Write the problem of the given solver in MPS format to the given open file, which is not closed.
+	int writeMps(const OsiSolverInterface &solver, FILE *fp) const;
+
+	/** Write the problem of the given solver in LP format to the given file.
+		Throws a CoinError if the file cannot be written. Returns 0 on success. */
+	int writeLp(const OsiSolverInterface &solver, const char *filename) const;
+	/// Write the problem of the given solver in LP format to the given open file, which is not closed.
+	int writeLp(const OsiSolverInterface &solver, FILE *fp) const;
+
+private:
+	int numberThreads_;
+	bool freeFormat_;
+};
@@ -0,0 +1,691 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native implementation of ModelWriter. This file is compiled without /clr, and as C++17 (std::to_chars).
+
+#include "ModelWriter.hpp"
+#include "ParallelFor.hpp"
+
+#include <CoinError.hpp>
+#include <CoinPackedMatrix.hpp>
+#include <OsiSolverInterface.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+	const double MpsInfinity = 1.0e30;
+	// The average number of nonzeros or items formatted per chunk
+	const long long ItemsPerChunk = 1 << 14;
+	// More chunks than threads, to balance the load between the threads
+	const int ChunksPerThread = 4;
+	const size_t WriteBufferSize = 1 << 22;
+	const size_t FixedNameLength = 8;
+	const int FixedNumberLength = 12;
+	// As CoinLpIO
+	const size_t MaxLpNameLength = 100;
+	const int LpTermsPerLine = 10;
+
+	/// Appends the shortest representation of value that reads back to the same double
+	void appendNumber(std::string &out, double value)
+	{
+		char buffer[32];
+		std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+		out.append(buffer, result.ptr);
+	}
+
+	/// Appends value in at most FixedNumberLength characters, rounded if needed, padded with spaces if pad
+	void appendFixedNumber(std::string &out, double value, bool pad)
+	{
+		char buffer[32];
+		std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+		for (int precision = FixedNumberLength; result.ptr - buffer > FixedNumberLength && precision > 1; precision--)
+		{
+			result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, precision);
+		}
+		out.append(buffer, result.ptr);
+		if (pad && result.ptr - buffer < FixedNumberLength) out.append(FixedNumberLength - (result.ptr - buffer), ' ');
+	}
+
+	/// Writes blocks of text to a file, remembering whether any write failed
+	class Output
+	{
+	public:
+		explicit Output(FILE *fp) : fp_(fp), failed_(false) {}
+
+		void write(const std::string &text)
+		{
+			if (!failed_ && !text.empty() && fwrite(text.data(), 1, text.size(), fp_) != text.size()) failed_ = true;
+		}
+
+		void write(const char *text)
+		{
+			write(std::string(text));
+		}
+
+		bool failed() const { return failed_ || ferror(fp_) != 0; }
+
+	private:
+		FILE *fp_;
+		bool failed_;
+	};
+
+	/// Returns the number of items per chunk, such that each chunk has about ItemsPerChunk nonzeros.
+	int chunkSize(int numberItems, long long numberElements)
+	{
+		if (numberElements <= numberItems) return static_cast<int>(ItemsPerChunk);
+		return static_cast<int>(std::max(1LL, ItemsPerChunk * numberItems / numberElements));
+	}
+
+	/// Formats the items [0, count) in chunks of size items on numberThreads threads via format(first, last, text),
+	/// and writes the texts in order. The next batch of chunks is formatted while the previous batch is being written.
+	template<class Format>
+	void writeChunks(Output &output, int count, int size, int numberThreads, Format format)
+	{
+		if (count <= 0) return;
+
+		const int numberChunks = (count - 1) / size + 1;
+		const int batchSize = numberThreads * ChunksPerThread;
+		std::vector<std::string> buffers[2] = { std::vector<std::string>(batchSize), std::vector<std::string>(batchSize) };
+
+		std::thread writer;
+		try
+		{
+			int b = 0;
+			for (int batchStart = 0; batchStart < numberChunks; batchStart += batchSize, b ^= 1)
+			{
+				std::vector<std::string> &batch = buffers[b];
+				int n = std::min(batchSize, numberChunks - batchStart);
+				parallelFor(n, numberThreads, [&](int i)
+				{
+					long long first = static_cast<long long>(batchStart + i) * size;
+					long long last = std::min<long long>(count, first + size);
+					batch[i].clear();
+					format(static_cast<int>(first), static_cast<int>(last), batch[i]);
+				});
+
+				// The previous batch, in the other buffers, must be written before writing this one
+				if (writer.joinable()) writer.join();
+				writer = std::thread([&output, &batch, n]()
+				{
+					for (int i = 0; i < n; i++) output.write(batch[i]);
+				});
+			}
+		}
+		catch (...)
+		{
+			if (writer.joinable()) writer.join();
+			throw;
+		}
+
+		if (writer.joinable()) writer.join();
+	}
+
+	/// The problem to write, common to MPS and LP. As OsiSolverInterface::writeMps, a maximization
+	/// problem is written as the minimization of the negated objective.
+	struct Problem
+	{
+		Problem(const OsiSolverInterface &solver, int numberThreads)
+			: numberColumns(solver.getNumCols()), numberRows(solver.getNumRows()),
+			infinity(std::min(solver.getInfinity(), MpsInfinity)),
+			colLower(solver.getColLower()), colUpper(solver.getColUpper()),
+			rowLower(solver.getRowLower()), rowUpper(solver.getRowUpper()),
+			objective(solver.getObjCoefficients(), solver.getObjCoefficients() + numberColumns),
+			objectiveOffset(0.0), integer(numberColumns), rowNames(numberRows), columnNames(numberColumns)
+		{
+			solver.getDblParam(OsiObjOffset, objectiveOffset);
+			if (solver.getObjSense() < 0.0)
+			{
+				for (double &value : objective) value = -value;
+				objectiveOffset = -objectiveOffset;
+			}
+
+			solver.getStrParam(OsiProbName, problemName);
+			objectiveName = solver.getObjName();
+
+			// The names may be generated on demand, so also in parallel
+			int size = static_cast<int>(ItemsPerChunk);
+			parallelFor((numberRows - 1) / size + 1, numberThreads, [&](int c)
+			{
+				for (int i = c * size; i < std::min(numberRows, (c + 1) * size); i++) rowNames[i] = solver.getRowName(i);
+			});
+			parallelFor((numberColumns - 1) / size + 1, numberThreads, [&](int c)
+			{
+				for (int j = c * size; j < std::min(numberColumns, (c + 1) * size); j++)
+				{
+					columnNames[j] = solver.getColName(j);
+					integer[j] = solver.isInteger(j) ? 1 : 0;
+				}
+			});
+		}
+
+		bool isInfinite(double value) const { return std::fabs(value) >= infinity; }
+
+		bool isRanged(int i) const
+		{
+			return rowLower[i] != rowUpper[i] && !isInfinite(rowLower[i]) && !isInfinite(rowUpper[i]);
+		}
+
+		bool hasRangedRows() const
+		{
+			for (int i = 0; i < numberRows; i++)
+			{
+				if (isRanged(i)) return true;
+			}
+			return false;
+		}
+
+		bool hasIntegers() const
+		{
+			return std::find(integer.begin(), integer.end(), 1) != integer.end();
+		}
+
+		/// The right-hand side of a row, as written in the MPS RHS section or at the end of an LP constraint
+		double rhs(int i) const
+		{
+			if (!isInfinite(rowLower[i])) return rowLower[i];
+			if (!isInfinite(rowUpper[i])) return rowUpper[i];
+			return 0.0;
+		}
+
+		const int numberColumns;
+		const int numberRows;
+		const double infinity;
+		const double *colLower;
+		const double *colUpper;
+		const double *rowLower;
+		const double *rowUpper;
+		std::vector<double> objective;
+		double objectiveOffset;
+		std::vector<char> integer;
+		std::string problemName;
+		std::string objectiveName;
+		std::vector<std::string> rowNames;
+		std::vector<std::string> columnNames;
+	};
+
+	/// Formats the lines of an MPS file, in fixed or free format
+	class MpsFormat
+	{
+	public:
+		explicit MpsFormat(bool fixed) : fixed_(fixed) {}
+
+		/// Appends a name, padded to the fixed field width
+		void appendName(std::string &out, const std::string &name) const
+		{
+			out.append(name);
+			if (fixed_ && name.size() < FixedNameLength) out.append(FixedNameLength - name.size(), ' ');
+		}
+
+		/// Appends the start of a data line: the code (like UP, or empty) and the first name
+		void appendStart(std::string &out, const char *code, const std::string &name) const
+		{
+			size_t codeLength = strlen(code);
+			out.push_back(' ');
+			out.append(code);
+			if (codeLength < 2) out.append(2 - codeLength, ' ');
+			out.push_back(' ');
+			appendName(out, name);
+		}
+
+		/// Appends a name and value pair to a data line; second is true for the second pair on the line
+		void appendPair(std::string &out, const std::string &name, double value, bool second, bool last) const
+		{
+			out.append(second ? "   " : "  ");
+			appendName(out, name);
+			out.append("  ");
+			if (fixed_) appendFixedNumber(out, value, !last);
+			else appendNumber(out, value);
+		}
+
+		/// Appends a line with one value, like a bound
+		void appendLine(std::string &out, const char *code, const std::string &name1, const std::string &name2, double value) const
+		{
+			appendStart(out, code, name1);
+			appendPair(out, name2, value, false, true);
+			out.push_back('\n');
+		}
+
+	private:
+		bool fixed_;
+	};
+
+	/// Returns true if the name can be written in fixed format MPS
+	bool fitsFixed(const std::string &name)
+	{
+		return name.size() <= FixedNameLength && name.find(' ') == std::string::npos;
+	}
+
+	/// Returns true if the name is valid in an LP file, following CoinLpIO
+	bool isValidLpName(const std::string &name)
+	{
+		static const char *const ValidCharacters = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ\"!#$%&(),.;?@_'`{}~";
+
+		if (name.empty() || name.size() > MaxLpNameLength) return false;
+		if (isdigit(static_cast<unsigned char>(name[0])) || name[0] == '.') return false;
+		return strspn(name.c_str(), ValidCharacters) == name.size();
+	}
+
+	/// Returns the default name like Osi, for example R0000001 or C0000001
+	std::string defaultName(char prefix, int index)
+	{
+		char buffer[16];
+		snprintf(buffer, sizeof(buffer), "%c%07d", prefix, index);
+		return buffer;
+	}
+
+	/// Appends a term like " + 2 x" or " - x" of an LP expression
+	void appendLpTerm(std::string &out, double value, const std::string &name)
+	{
+		out.append(value < 0.0 ? " - " : " + ");
+		if (std::fabs(value) != 1.0)
+		{
+			appendNumber(out, std::fabs(value));
+			out.push_back(' ');
+		}
+		out.append(name);
+	}
+}
+
+ModelWriter::ModelWriter()
+	: numberThreads_(0), freeFormat_(true)
+{
+}
+
+int ModelWriter::writeMps(const OsiSolverInterface &solver, const char *filename) const
+{
+	FILE *fp = fopen(filename, "wb");
+	if (fp == nullptr) throw CoinError(std::string("Unable to create file ") + filename, "writeMps", "ModelWriter");
+	setvbuf(fp, nullptr, _IOFBF, WriteBufferSize);
+
+	try
+	{
+		writeMps(solver, fp);
+	}
+	catch (...)
+	{
+		fclose(fp);
+		throw;
+	}
+
+	if (fclose(fp) != 0) throw CoinError(std::string("Unable to write file ") + filename, "writeMps", "ModelWriter");
+	return 0;
+}
+
+int ModelWriter::writeMps(const OsiSolverInterface &solver, FILE *fp) const
+{
+	const int numberThreads = resolveNumberThreads(numberThreads_);
+	const Problem problem(solver, numberThreads);
+	const int numberColumns = problem.numberColumns;
+	const int numberRows = problem.numberRows;
+
+	// Fixed format only if all names fit, as CoinMpsIO
+	bool fixed = !freeFormat_ && fitsFixed(problem.objectiveName);
+	for (int i = 0; fixed && i < numberRows; i++) fixed = fitsFixed(problem.rowNames[i]);
+	for (int j = 0; fixed && j < numberColumns; j++) fixed = fitsFixed(problem.columnNames[j]);
+	const MpsFormat format(fixed);
+
+	Output output(fp);
+	std::string text;
+
+	text.append("NAME          ");
+	text.append(problem.problemName.empty() ? "BLANK" : problem.problemName);
+	if (!fixed) text.append("  FREE");
+	text.append("\nROWS\n N  ");
+	text.append(problem.objectiveName);
+	text.push_back('\n');
+	output.write(text);
+
+	writeChunks(output, numberRows, static_cast<int>(ItemsPerChunk), numberThreads, [&](int first, int last, std::string &out)
+	{
+		for (int i = first; i < last; i++)
+		{
+			// Ranged rows are written as G rows with a range
+			const char *type = "N";
+			if (problem.rowLower[i] == problem.rowUpper[i]) type = "E";
+			else if (!problem.isInfinite(problem.rowLower[i])) type = "G";
+			else if (!problem.isInfinite(problem.rowUpper[i])) type = "L";
+
+			out.push_back(' ');
+			out.append(type);
+			out.append("  ");
+			out.append(problem.rowNames[i]);
+			out.push_back('\n');
+		}
+	});
+
+	output.write("COLUMNS\n");
+
+	const CoinPackedMatrix *matrix = solver.getMatrixByCol();
+	const CoinBigIndex *starts = matrix->getVectorStarts();
+	const int *lengths = matrix->getVectorLengths();
+	const int *indices = matrix->getIndices();
+	const double *elements = matrix->getElements();
+
+	writeChunks(output, numberColumns, chunkSize(numberColumns, matrix->getNumElements()), numberThreads, [&](int first, int last, std::string &out)
+	{
+		std::vector<const std::string *> names;
+		std::vector<double> values;
+		for (int j = first; j < last; j++)
+		{
+			bool previousInteger = j > 0 && problem.integer[j - 1] != 0;
+			if (problem.integer[j] && !previousInteger) out.append("    MARKER                 'MARKER'                 'INTORG'\n");
+			if (!problem.integer[j] && previousInteger) out.append("    MARKER                 'MARKER'                 'INTEND'\n");
+
+			// The objective coefficient is written even if zero for a column without elements, such that the column exists
+			names.clear();
+			values.clear();
+			if (problem.objective[j] != 0.0 || lengths[j] == 0)
+			{
+				names.push_back(&problem.objectiveName);
+				values.push_back(problem.objective[j]);
+			}
+			for (CoinBigIndex k = starts[j]; k < starts[j] + lengths[j]; k++)
+			{
+				names.push_back(&problem.rowNames[indices[k]]);
+				values.push_back(elements[k]);
+			}
+
+			for (size_t k = 0; k < names.size(); k += 2)
+			{
+				format.appendStart(out, "", problem.columnNames[j]);
+				bool pair = k + 1 < names.size();
+				format.appendPair(out, *names[k], values[k], false, !pair);
+				if (pair) format.appendPair(out, *names[k + 1], values[k + 1], true, true);
+				out.push_back('\n');
+			}
+		}
+
+		if (last == numberColumns && numberColumns > 0 && problem.integer[numberColumns - 1])
+		{
+			out.append("    MARKER                 'MARKER'                 'INTEND'\n");
+		}
+	});
+
+	output.write("RHS\n");
+	if (problem.objectiveOffset != 0.0)
+	{
+		text.clear();
+		format.appendLine(text, "", "RHS", problem.objectiveName, problem.objectiveOffset);
+		output.write(text);
+	}
+
+	writeChunks(output, numberRows, static_cast<int>(ItemsPerChunk), numberThreads, [&](int first, int last, std::string &out)
+	{
+		int numberOnLine = 0;
+		for (int i = first; i < last; i++)
+		{
+			double value = problem.rhs(i);
+			if (value == 0.0) continue;
+
+			if (numberOnLine == 0) format.appendStart(out, "", "RHS");
+			format.appendPair(out, problem.rowNames[i], value, numberOnLine == 1, numberOnLine == 1);
+			if (++numberOnLine == 2)
+			{
+				out.push_back('\n');
+				numberOnLine = 0;
+			}
+		}
+		if (numberOnLine > 0) out.push_back('\n');
+	});
+
+	if (problem.hasRangedRows())
+	{
+		output.write("RANGES\n");
+		writeChunks(output, numberRows, static_cast<int>(ItemsPerChunk), numberThreads, [&](int first, int last, std::string &out)
+		{
+			for (int i = first; i < last; i++)
+			{
+				if (problem.isRanged(i)) format.appendLine(out, "", "RANGE", problem.rowNames[i], problem.rowUpper[i] - problem.rowLower[i]);
+			}
+		});
+	}
+
+	output.write("BOUNDS\n");
+	writeChunks(output, numberColumns, static_cast<int>(ItemsPerChunk), numberThreads, [&](int first, int last, std::string &out)
+	{
+		static const std::string Bound("BOUND");
+		for (int j = first; j < last; j++)
+		{
+			const std::string &name = problem.columnNames[j];
+			double lower = problem.colLower[j];
+			double upper = problem.colUpper[j];
+			bool infiniteLower = problem.isInfinite(lower);
+			bool infiniteUpper = problem.isInfinite(upper);
+
+			if (lower == upper)
+			{
+				format.appendLine(out, "FX", Bound, name, lower);
+				continue;
+			}
+			if (infiniteLower && infiniteUpper)
+			{
+				format.appendStart(out, "FR", Bound);
+				out.append("  ").append(name).push_back('\n');
+				continue;
+			}
+
+			// The upper bound first: a negative upper bound may set a zero lower bound to minus infinity
+			if (!infiniteUpper) format.appendLine(out, "UP", Bound, name, upper);
+			if (infiniteLower)
+			{
+				format.appendStart(out, "MI", Bound);
+				out.append("  ").append(name).push_back('\n');
+			}
+			else if (lower != 0.0 || upper < 0.0)
+			{
+				format.appendLine(out, "LO", Bound, name, lower);
+			}
+
+			// Without any bound, integer columns would get upper bound 1
+			if (infiniteUpper && problem.integer[j])
+			{
+				format.appendStart(out, "PL", Bound);
+				out.append("  ").append(name).push_back('\n');
+			}
+		}
+	});
+
+	output.write("ENDATA\n");
+
+	if (output.failed()) throw CoinError("Unable to write the MPS file", "writeMps", "ModelWriter");
+	return 0;
+}
+
+int ModelWriter::writeLp(const OsiSolverInterface &solver, const char *filename) const
+{
+	FILE *fp = fopen(filename, "wb");
+	if (fp == nullptr) throw CoinError(std::string("Unable to create file ") + filename, "writeLp", "ModelWriter");
+	setvbuf(fp, nullptr, _IOFBF, WriteBufferSize);
+
+	try
+	{
+		writeLp(solver, fp);
+	}
+	catch (...)
+	{
+		fclose(fp);
+		throw;
+	}
+
+	if (fclose(fp) != 0) throw CoinError(std::string("Unable to write file ") + filename, "writeLp", "ModelWriter");
+	return 0;
+}
+
+int ModelWriter::writeLp(const OsiSolverInterface &solver, FILE *fp) const
+{
+	const int numberThreads = resolveNumberThreads(numberThreads_);
+	Problem problem(solver, numberThreads);
+	const int numberColumns = problem.numberColumns;
+	const int numberRows = problem.numberRows;
+
+	// Without columns, there is no term to write an empty objective or row with
+	if (numberColumns == 0)
+	{
+		solver.writeLp(fp);
+		return 0;
+	}
+
+	// As CoinLpIO, use default names if any name is invalid
+	bool validNames = isValidLpName(problem.objectiveName);
+	for (int i = 0; validNames && i < numberRows; i++) validNames = isValidLpName(problem.rowNames[i]);
+	for (int j = 0; validNames && j < numberColumns; j++) validNames = isValidLpName(problem.columnNames[j]);
+	if (!validNames)
+	{
+		problem.objectiveName = "obj";
+		for (int i = 0; i < numberRows; i++) problem.rowNames[i] = defaultName('R', i);
+		for (int j = 0; j < numberColumns; j++) problem.columnNames[j] = defaultName('C', j);
+	}
+
+	Output output(fp);
+	std::string text;
+
+	text.append("\\Problem name: ");
+	text.append(problem.problemName);
+	text.append("\n\nMinimize\n");
+	text.append(problem.objectiveName);
+	text.push_back(':');
+	bool hasObjective = std::find_if(problem.objective.begin(), problem.objective.end(), [](double value) { return value != 0.0; }) != problem.objective.end();
+	if (!hasObjective) text.append(" 0 ").append(problem.columnNames[0]).push_back('\n');
+	output.write(text);
+
+	writeChunks(output, numberColumns, static_cast<int>(ItemsPerChunk), numberThreads, [&](int first, int last, std::string &out)
+	{
+		int numberOnLine = 0;
+		for (int j = first; j < last; j++)
+		{
+			if (problem.objective[j] == 0.0) continue;
+
+			appendLpTerm(out, problem.objective[j], problem.columnNames[j]);
+			if (++numberOnLine == LpTermsPerLine)
+			{
+				out.push_back('\n');
+				numberOnLine = 0;
+			}
+		}
+		if (numberOnLine > 0) out.push_back('\n');
+	});
+
+	// As in MPS files, the objective offset is the negative of the constant of the objective
+	if (problem.objectiveOffset != 0.0)
+	{
+		text.clear();
+		text.append(problem.objectiveOffset > 0.0 ? " - " : " + ");
+		appendNumber(text, std::fabs(problem.objectiveOffset));
+		text.push_back('\n');
+		output.write(text);
+	}
+
+	output.write("Subject To\n");
+
+	const CoinPackedMatrix *matrix = solver.getMatrixByRow();
+	const CoinBigIndex *starts = matrix->getVectorStarts();
+	const int *lengths = matrix->getVectorLengths();
+	const int *indices = matrix->getIndices();
+	const double *elements = matrix->getElements();
+
+	writeChunks(output, numberRows, chunkSize(numberRows, matrix->getNumElements()), numberThreads, [&](int first, int last, std::string &out)
+	{
+		for (int i = first; i < last; i++)
+		{
+			out.append(problem.rowNames[i]);
+			out.push_back(':');
+			if (lengths[i] == 0) out.append(" 0 ").append(problem.columnNames[0]);
+			for (int k = 0; k < lengths[i]; k++)
+			{
+				CoinBigIndex index = starts[i] + k;
+				appendLpTerm(out, elements[index], problem.columnNames[indices[index]]);
+				if ((k + 1) % LpTermsPerLine == 0 && k + 1 < lengths[i]) out.push_back('\n');
+			}
+
+			if (problem.rowLower[i] == problem.rowUpper[i]) out.append(" = ");
+			else if (!problem.isInfinite(problem.rowLower[i])) out.append(" >= ");
+			else if (!problem.isInfinite(problem.rowUpper[i])) out.append(" <= ");
+			else out.append(" >= -inf");
+
+			if (!problem.isInfinite(problem.rowLower[i]) || !problem.isInfinite(problem.rowUpper[i])) appendNumber(out, problem.rhs(i));
+			out.push_back('\n');
+
+			// The upper bound of a ranged row follows as a constraint with the same name and without terms
+			if (problem.isRanged(i))
+			{
+				out.append(problem.rowNames[i]);
+				out.append(": <= ");
+				appendNumber(out, problem.rowUpper[i]);
+				out.push_back('\n');
+			}
+		}
+	});
+
+	// The default bounds in LP format are 0 and infinity
+	output.write("Bounds\n");
+	writeChunks(output, numberColumns, static_cast<int>(ItemsPerChunk), numberThreads, [&](int first, int last, std::string &out)
+	{
+		for (int j = first; j < last; j++)
+		{
+			const std::string &name = problem.columnNames[j];
+			double lower = problem.colLower[j];
+			double upper = problem.colUpper[j];
+			bool infiniteLower = problem.isInfinite(lower);
+			bool infiniteUpper = problem.isInfinite(upper);
+
+			if (lower == 0.0 && infiniteUpper) continue;
+
+			out.push_back(' ');
+			if (lower == upper)
+			{
+				out.append(name).append(" = ");
+				appendNumber(out, lower);
+			}
+			else if (infiniteLower && infiniteUpper)
+			{
+				out.append(name).append(" free");
+			}
+			else if (infiniteUpper)
+			{
+				out.append(name).append(" >= ");
+				appendNumber(out, lower);
+			}
+			else
+			{
+				if (infiniteLower) out.append("-inf");
+				else appendNumber(out, lower);
+				out.append(" <= ").append(name).append(" <= ");
+				appendNumber(out, upper);
+			}
+			out.push_back('\n');
+		}
+	});
+
+	if (problem.hasIntegers())
+	{
+		output.write("Integers\n");
+		writeChunks(output, numberColumns, static_cast<int>(ItemsPerChunk), numberThreads, [&](int first, int last, std::string &out)
+		{
+			int numberOnLine = 0;
+			for (int j = first; j < last; j++)
+			{
+				if (!problem.integer[j]) continue;
+
+				out.push_back(' ');
+				out.append(problem.columnNames[j]);
+				if (++numberOnLine == LpTermsPerLine)
+				{
+					out.push_back('\n');
+					numberOnLine = 0;
+				}
+			}
+			if (numberOnLine > 0) out.push_back('\n');
+		});
+	}
+
+	output.write("End\n");
+
+	if (output.failed()) throw CoinError("Unable to write the LP file", "writeLp", "ModelWriter");
+	return 0;
+}
@@ -0,0 +1,179 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "CoinPackedMatrix.h"
+
+#include "MpsParallelReader.hpp"
+
+#include "CoinError.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// Multithreaded reader of (free format) MPS files for very large problems.
+	/// The file is memory-mapped and the sections are parsed in chunks in parallel.
+	/// The results are the same as those of CoinMpsIO. See MpsParallelReader.hpp.
+	public ref class MpsParallelReader : WrapperBase<::MpsParallelReader>
+	{
+	public:
+		MpsParallelReader() {}
+
+		/// Set infinity
+		void setInfinity(double value)
+		{
+			Base->setInfinity(value);
+		}
+
+		/// Get infinity
+		double getInfinity()
+		{
+			return Base->getInfinity();
+		}
+
+		/// Set the value below which (in absolute value) elements are dropped. Default 1.0e-14, as CoinMpsIO.
+		void setSmallElementValue(double value)
+		{
+			Base->setSmallElementValue(value);
+		}
+
+		/// Get the value below which (in absolute value) elements are dropped.
+		double getSmallElementValue()
+		{
+			return Base->getSmallElementValue();
+		}
+
+		/// Set the number of threads used for parsing, or 0 to use all cores (= Default).
+		void setNumberThreads(int value)
+		{
+			Base->setNumberThreads(value);
+		}
+
+		/// Get the number of threads used for parsing, or 0 if all cores are used.
+		int getNumberThreads()
+		{
+			return Base->getNumberThreads();
+		}
+
+		/// Read a problem in MPS format from the given filename.
+		/// Throws a CoinError if the file cannot be opened, or contains errors or unsupported sections.
+		int readMps(String^ filename);
+
+		/// Get number of columns
+		int getNumCols()
+		{
+			return Base->getNumCols();
+		}
+
+		/// Get number of rows
+		int getNumRows()
+		{
+			return Base->getNumRows();
+		}
+
+		/// Get number of nonzero elements
+		int getNumElements()
+		{
+			return Base->getNumElements();
+		}
+
+		/// Get array[getNumCols()+1] of column starts
+		array<int>^ getVectorStarts();
+
+		/// Get array[getNumElements()] of row indices, column by column
+		array<int>^ getIndices();
+
+		/// Get array[getNumElements()] of elements, column by column
+		array<double>^ getElements();
+
+		/// Get array[getNumRows()] of row lower bounds
+		array<double>^ getRowLower();
+
+		/// Get array[getNumRows()] of row upper bounds
+		array<double>^ getRowUpper();
+
+		/// Get array[getNumCols()] of objective function coefficients
+		array<double>^ getObjCoefficients();
+
+		/// Get array[getNumCols()] of column lower bounds
+		array<double>^ getColLower();
+
+		/// Get array[getNumCols()] of column upper bounds
+		array<double>^ getColUpper();
+
+		/** Get array[getNumRows()] of constraint senses.
+		<ul>
+		<li>'L': <= constraint
+		<li>'E': =  constraint
+		<li>'G': >= constraint
+		<li>'R': ranged constraint
+		<li>'N': free constraint
+		</ul>
+		*/
+		array<__wchar_t>^ getRowSense();
+
+		/// Return the objective offset, the right-hand side of the objective row.
+		double objectiveOffset()
+		{
+			return Base->objectiveOffset();
+		}
+
+		/// Return the problem name
+		String^ getProblemName()
+		{
+			return gcnew String(Base->getProblemName());
+		}
+
+		/// Return the objective name
+		String^ getObjectiveName()
+		{
+			return gcnew String(Base->getObjectiveName());
+		}
+
+		/// Return true if column is a continuous variable
+		bool isContinuous(int colNumber)
+		{
+			return Base->isContinuous(colNumber);
+		}
+
+		/// Return true if column is an integer variable
+		bool isInteger(int columnNumber)
+		{
+			return Base->isInteger(columnNumber);
+		}
+
+		/// Returns the row name for the specified index.
+		String^ rowName(int index)
+		{
+			return gcnew String(Base->rowName(index));
+		}
+
+		/// Returns the column name for the specified index.
+		String^ columnName(int index)
+		{
+			return gcnew String(Base->columnName(index));
+		}
+
+		/// Returns all row names at once, as rowName(i) for each row.
+		array<String^>^ rowNames();
+
+		/// Returns all column names at once, as columnName(j) for each column.
+		array<String^>^ columnNames();
+
+		/// Get the matrix by column. The matrix is owned by this reader.
+		CoinPackedMatrix ^ getMatrixByCol()
+		{
+			return gcnew CoinPackedMatrix(Base->getMatrixByCol());
+		}
+
+		/// Get the matrix by row. The matrix is owned by this reader.
+		CoinPackedMatrix ^ getMatrixByRow()
+		{
+			return gcnew CoinPackedMatrix(Base->getMatrixByRow());
+		}
+	};
+}
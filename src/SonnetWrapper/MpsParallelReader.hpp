@@ -0,0 +1,131 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+class CoinPackedMatrix;
+
+/** Native multithreaded reader of (free format) MPS files.
+
+	The file is memory-mapped, and the COLUMNS, RHS, RANGES and BOUNDS sections are split
+	into chunks on line boundaries that are parsed in parallel. The chunks are then merged
+	into column-ordered (CSC) arrays. The results are the same as those of CoinMpsIO:
+	the objective row is not part of the rows, values of 1e30 or more are infinite,
+	elements with an absolute value of at most the small element value are dropped, and
+	integer columns without any bound get upper bound 1.
+
+	Supported are the NAME, ROWS, COLUMNS (including integer markers), RHS, RANGES and BOUNDS sections,
+	with names without spaces. Anything else, such as quadratic sections or OBJSENSE, throws a CoinError.
+
+	This class is compiled as native code (not /clr) to be able to use std::thread.
+*/
+class MpsParallelReader
+{
+public:
+	MpsParallelReader();
+	~MpsParallelReader();
+
+	/// Set infinity
+	void setInfinity(double value) { infinity_ = value; }
+	/// Get infinity
+	double getInfinity() const { return infinity_; }
+
+	/// Set the value below which (in absolute value) elements are dropped. Default 1.0e-14, as CoinMpsIO.
+	void setSmallElementValue(double value) { smallElement_ = value; }
+	/// Get the value below which (in absolute value) elements are dropped.
+	double getSmallElementValue() const { return smallElement_; }
+
+	/// Set the number of threads used for parsing, or 0 to use all cores (= Default).
+	void setNumberThreads(int value) { numberThreads_ = value; }
+	/// Get the number of threads used for parsing, or 0 if all cores are used.
+	int getNumberThreads() const { return numberThreads_; }
+
+	/** Read a problem in MPS format from the given filename.
+		Throws a CoinError if the file cannot be opened, or contains errors or unsupported sections.
+		Returns 0 on success, like CoinMpsIO::readMps. */
+	int readMps(const char *filename);
+
+	/// Get number of columns
+	int getNumCols() const { return static_cast<int>(colLower_.size()); }
+	/// Get number of rows
+	int getNumRows() const { return static_cast<int>(rowLower_.size()); }
+	/// Get number of nonzero elements
+	int getNumElements() const { return static_cast<int>(elements_.size()); }
+
+	/// Get pointer to array[getNumCols()+1] of column starts
+	const int *getVectorStarts() const { return starts_.data(); }
+	/// Get pointer to array[getNumElements()] of row indices, column by column
+	const int *getIndices() const { return indices_.data(); }
+	/// Get pointer to array[getNumElements()] of elements, column by column
+	const double *getElements() const { return elements_.data(); }
+
+	/// Get pointer to array[getNumCols()] of column lower bounds
+	const double *getColLower() const { return colLower_.data(); }
+	/// Get pointer to array[getNumCols()] of column upper bounds
+	const double *getColUpper() const { return colUpper_.data(); }
+	/// Get pointer to array[getNumRows()] of row lower bounds
+	const double *getRowLower() const { return rowLower_.data(); }
+	/// Get pointer to array[getNumRows()] of row upper bounds
+	const double *getRowUpper() const { return rowUpper_.data(); }
+	/// Get pointer to array[getNumCols()] of objective function coefficients
+	const double *getObjCoefficients() const { return objective_.data(); }
+
+	/** Get pointer to array[getNumRows()] of constraint senses, as CoinMpsIO:
+		'L', 'E', 'G', 'R' (ranged) or 'N' (free). */
+	const char *getRowSense() const;
+
+	/// Return the objective offset, the right-hand side of the objective row.
+	double objectiveOffset() const { return objectiveOffset_; }
+
+	/// Return the problem name
+	const char *getProblemName() const { return problemName_.c_str(); }
+	/// Return the objective name
+	const char *getObjectiveName() const { return objectiveName_.c_str(); }
+
+	/// Return true if column is an integer variable
+	bool isInteger(int columnNumber) const { return integer_[columnNumber] != 0; }
+	/// Return true if column is a continuous variable
+	bool isContinuous(int columnNumber) const { return integer_[columnNumber] == 0; }
+
+	/// Returns the row name for the specified index, or 0 if the index is out of range.
+	const char *rowName(int index) const;
+	/// Returns the column name for the specified index, or 0 if the index is out of range.
+	const char *columnName(int index) const;
+
+	/// Get the matrix by column. The matrix is created on the first call, and owned by this reader.
+	const CoinPackedMatrix *getMatrixByCol() const;
+	/// Get the matrix by row. The matrix is created on the first call, and owned by this reader.
+	const CoinPackedMatrix *getMatrixByRow() const;
+
+private:
+	MpsParallelReader(const MpsParallelReader &);
+	MpsParallelReader &operator=(const MpsParallelReader &);
+
+	void clear();
+
+	double infinity_;
+	double smallElement_;
+	int numberThreads_;
+
+	std::string problemName_;
+	std::string objectiveName_;
+	double objectiveOffset_;
+	std::vector<std::string> rowNames_;
+	std::vector<std::string> columnNames_;
+	std::vector<double> rowLower_;
+	std::vector<double> rowUpper_;
+	std::vector<double> colLower_;
+	std::vector<double> colUpper_;
+	std::vector<double> objective_;
+	std::vector<char> integer_;
+	std::vector<int> starts_;
+	std::vector<int> indices_;
+	std::vector<double> elements_;
+
+	mutable std::vector<char> rowSense_;
+	mutable CoinPackedMatrix *matrixByColumn_;
+	mutable CoinPackedMatrix *matrixByRow_;
+};
@@ -0,0 +1,699 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native implementation of MpsParallelReader. This file is compiled without /clr, and as C++17 (std::from_chars).
+
+#include "MpsParallelReader.hpp"
+#include "MappedFile.hpp"
+#include "ParallelFor.hpp"
+
+#include <CoinError.hpp>
+#include <CoinPackedMatrix.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cfloat>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+	const int MaxTokens = 8;
+	const double MpsInfinity = 1.0e30;
+	// Chunks smaller than this are not worth a thread
+	const size_t MinimumChunkSize = 1 << 20;
+	// More chunks than threads, to balance the load between the threads
+	const int ChunksPerThread = 4;
+
+	typedef std::unordered_map<std::string_view, int> NameMap;
+
+	/// An error at the given position in the file
+	struct ParseError
+	{
+		const char *position;
+		std::string message;
+	};
+
+	/// Splits [begin, end) into at most numberChunks chunks that all start at the start of a line.
+	/// Returns the chunk boundaries, that is, the number of chunks plus one pointers.
+	std::vector<const char *> splitLines(const char *begin, const char *end, int numberChunks)
+	{
+		size_t size = end - begin;
+		numberChunks = static_cast<int>(std::max<size_t>(1, std::min<size_t>(numberChunks, size / MinimumChunkSize)));
+
+		std::vector<const char *> boundaries;
+		boundaries.push_back(begin);
+		for (int k = 1; k < numberChunks; k++)
+		{
+			const char *p = begin + size / numberChunks * k;
+			if (p < boundaries.back()) continue;
+
+			p = static_cast<const char *>(memchr(p, '\n', end - p));
+			if (p == nullptr || p + 1 >= end) break;
+			boundaries.push_back(p + 1);
+		}
+		boundaries.push_back(end);
+		return boundaries;
+	}
+
+	/// Calls function(line, lineEnd) for each line in [begin, end), skipping comment lines.
+	template<class Function>
+	void forEachLine(const char *begin, const char *end, Function function)
+	{
+		for (const char *line = begin; line < end;)
+		{
+			const char *lineEnd = static_cast<const char *>(memchr(line, '\n', end - line));
+			if (lineEnd == nullptr) lineEnd = end;
+			if (line < lineEnd && *line != '*') function(line, lineEnd);
+			line = lineEnd + 1;
+		}
+	}
+
+	inline bool isSpace(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\r';
+	}
+
+	/// Splits the line [line, end) into whitespace-separated tokens.
+	/// Anything after a '$' at the start of a token is a comment.
+	int tokenize(const char *line, const char *end, std::string_view *tokens)
+	{
+		int n = 0;
+		const char *p = line;
+		while (true)
+		{
+			while (p < end && isSpace(*p)) p++;
+			if (p == end) break;
+
+			const char *start = p;
+			while (p < end && !isSpace(*p)) p++;
+
+			if (*start == '$') break;
+			if (n == MaxTokens) throw ParseError{ line, "too many fields" };
+			tokens[n++] = std::string_view(start, p - start);
+		}
+		return n;
+	}
+
+	inline bool equalsIgnoreCase(std::string_view token, const char *text)
+	{
+		size_t length = strlen(text);
+		if (token.size() != length) return false;
+		for (size_t i = 0; i < length; i++)
+		{
+			if (toupper(static_cast<unsigned char>(token[i])) != text[i]) return false;
+		}
+		return true;
+	}
+
+	double parseValue(std::string_view token, double infinity)
+	{
+		const char *first = token.data();
+		const char *last = first + token.size();
+		if (first != last && *first == '+') first++;
+
+		double value = 0.0;
+		std::from_chars_result result = std::from_chars(first, last, value);
+		if (result.ec != std::errc() || result.ptr != last) throw ParseError{ token.data(), "invalid number " + std::string(token) };
+
+		if (value >= MpsInfinity) return infinity;
+		if (value <= -MpsInfinity) return -infinity;
+		return value;
+	}
+
+	/// The row index of the given row name: -1 for the objective row, -2 if not found.
+	inline int findRow(const NameMap &rows, std::string_view name)
+	{
+		NameMap::const_iterator it = rows.find(name);
+		return (it == rows.end()) ? -2 : it->second;
+	}
+
+	inline int getRow(const NameMap &rows, std::string_view name)
+	{
+		int row = findRow(rows, name);
+		if (row == -2) throw ParseError{ name.data(), "unknown row " + std::string(name) };
+		return row;
+	}
+
+	inline int getColumn(const NameMap &columns, std::string_view name)
+	{
+		NameMap::const_iterator it = columns.find(name);
+		if (it == columns.end()) throw ParseError{ name.data(), "unknown column " + std::string(name) };
+		return it->second;
+	}
+
+	/// The part of the COLUMNS section parsed by one thread
+	struct ColumnChunk
+	{
+		ColumnChunk() : lastMarker(-1) {}
+
+		/// The names of the columns in this chunk. The first column can continue the last column of the previous chunk.
+		std::vector<std::string_view> names;
+		/// The number of elements of each column
+		std::vector<int> lengths;
+		std::vector<double> objective;
+		/// 1 for integer, 0 for continuous, or -1 if determined by a marker before this chunk
+		std::vector<signed char> integer;
+		std::vector<int> indices;
+		std::vector<double> elements;
+		/// The state of the last marker in this chunk, or -1 if this chunk has no markers
+		signed char lastMarker;
+	};
+
+	void parseColumns(const char *begin, const char *end, const NameMap &rows, double infinity, double smallElement, ColumnChunk &chunk)
+	{
+		std::string_view tokens[MaxTokens];
+		forEachLine(begin, end, [&](const char *line, const char *lineEnd)
+		{
+			int n = tokenize(line, lineEnd, tokens);
+			if (n == 0) return;
+
+			if (n >= 3 && tokens[1] == "'MARKER'")
+			{
+				if (tokens[2] == "'INTORG'") chunk.lastMarker = 1;
+				else if (tokens[2] == "'INTEND'") chunk.lastMarker = 0;
+				else throw ParseError{ line, "unknown marker " + std::string(tokens[2]) };
+				return;
+			}
+
+			if (n < 3 || n % 2 == 0) throw ParseError{ line, "column name and pairs of row name and value expected" };
+
+			if (chunk.names.empty() || chunk.names.back() != tokens[0])
+			{
+				chunk.names.push_back(tokens[0]);
+				chunk.lengths.push_back(0);
+				chunk.objective.push_back(0.0);
+				chunk.integer.push_back(chunk.lastMarker);
+			}
+
+			for (int t = 1; t < n; t += 2)
+			{
+				int row = getRow(rows, tokens[t]);
+				double value = parseValue(tokens[t + 1], infinity);
+				if (row == -1)
+				{
+					chunk.objective.back() = value;
+				}
+				else if (fabs(value) > smallElement)
+				{
+					chunk.indices.push_back(row);
+					chunk.elements.push_back(value);
+					chunk.lengths.back()++;
+				}
+			}
+		});
+	}
+
+	/// A value of the RHS or RANGES section: the row (-1 for the objective) and value
+	struct RowValue
+	{
+		int row;
+		double value;
+	};
+
+	void parseRowValues(const char *begin, const char *end, const NameMap &rows, double infinity, std::vector<RowValue> &values)
+	{
+		std::string_view tokens[MaxTokens];
+		forEachLine(begin, end, [&](const char *line, const char *lineEnd)
+		{
+			int n = tokenize(line, lineEnd, tokens);
+			if (n == 0) return;
+
+			// The name of the rhs or range vector is optional
+			int t = (n % 2 == 1) ? 1 : 0;
+			if (n - t < 2) throw ParseError{ line, "pairs of row name and value expected" };
+
+			for (; t < n; t += 2)
+			{
+				RowValue value = { getRow(rows, tokens[t]), parseValue(tokens[t + 1], infinity) };
+				values.push_back(value);
+			}
+		});
+	}
+
+	enum BoundType { UP, LO, FX, FR, MI, PL, BV, UI, LI };
+
+	struct Bound
+	{
+		int column;
+		BoundType type;
+		double value;
+	};
+
+	BoundType parseBoundType(std::string_view token)
+	{
+		static const char *names[] = { "UP", "LO", "FX", "FR", "MI", "PL", "BV", "UI", "LI" };
+		const int count = sizeof(names) / sizeof(names[0]);
+		for (int i = 0; i < count; i++)
+		{
+			if (equalsIgnoreCase(token, names[i])) return static_cast<BoundType>(i);
+		}
+		throw ParseError{ token.data(), "bound type " + std::string(token) + " is not supported" };
+	}
+
+	void parseBounds(const char *begin, const char *end, const NameMap &columns, double infinity, std::vector<Bound> &bounds)
+	{
+		std::string_view tokens[MaxTokens];
+		forEachLine(begin, end, [&](const char *line, const char *lineEnd)
+		{
+			int n = tokenize(line, lineEnd, tokens);
+			if (n == 0) return;
+
+			Bound bound = { -1, parseBoundType(tokens[0]), 0.0 };
+			bool needsValue = bound.type != FR && bound.type != MI && bound.type != PL && bound.type != BV;
+
+			// The name of the bound vector is optional: find the column and the value
+			if (needsValue)
+			{
+				if (n != 3 && n != 4) throw ParseError{ line, "bound type, column name and value expected" };
+				bound.column = getColumn(columns, tokens[n - 2]);
+				bound.value = parseValue(tokens[n - 1], infinity);
+			}
+			else if (n == 2 || (n == 3 && columns.find(tokens[1]) == columns.end()))
+			{
+				bound.column = getColumn(columns, tokens[n - 1]);
+			}
+			else if (n == 3 || n == 4)
+			{
+				// BV with value, or with bound vector name
+				bound.column = (columns.find(tokens[n - 1]) != columns.end()) ? getColumn(columns, tokens[n - 1]) : getColumn(columns, tokens[n - 2]);
+			}
+			else
+			{
+				throw ParseError{ line, "bound type and column name expected" };
+			}
+
+			bounds.push_back(bound);
+		});
+	}
+
+	/// Parses the given section in chunks in parallel with parse(begin, end, result), and returns the results in order.
+	template<class T, class Parse>
+	std::vector<std::vector<T>> parseChunks(const char *begin, const char *end, int numberThreads, Parse parse)
+	{
+		std::vector<const char *> boundaries = splitLines(begin, end, numberThreads * ChunksPerThread);
+		int numberChunks = static_cast<int>(boundaries.size()) - 1;
+		std::vector<std::vector<T>> results(numberChunks);
+		parallelFor(numberChunks, numberThreads, [&](int c)
+		{
+			parse(boundaries[c], boundaries[c + 1], results[c]);
+		});
+		return results;
+	}
+
+	/// A section of the file: the lines after the section header, up to the next header
+	struct Section
+	{
+		Section() : begin(nullptr), end(nullptr) {}
+		bool present() const { return begin != nullptr; }
+
+		const char *begin;
+		const char *end;
+	};
+}
+
+MpsParallelReader::MpsParallelReader()
+	: infinity_(DBL_MAX), smallElement_(1.0e-14), numberThreads_(0), objectiveOffset_(0.0),
+	starts_(1, 0), matrixByColumn_(nullptr), matrixByRow_(nullptr)
+{
+}
+
+MpsParallelReader::~MpsParallelReader()
+{
+	clear();
+}
+
+void MpsParallelReader::clear()
+{
+	problemName_.clear();
+	objectiveName_.clear();
+	objectiveOffset_ = 0.0;
+	rowNames_.clear();
+	columnNames_.clear();
+	rowLower_.clear();
+	rowUpper_.clear();
+	colLower_.clear();
+	colUpper_.clear();
+	objective_.clear();
+	integer_.clear();
+	starts_.assign(1, 0);
+	indices_.clear();
+	elements_.clear();
+	rowSense_.clear();
+
+	delete matrixByColumn_;
+	delete matrixByRow_;
+	matrixByColumn_ = nullptr;
+	matrixByRow_ = nullptr;
+}
+
+int MpsParallelReader::readMps(const char *filename)
+{
+	clear();
+
+	int numberThreads = resolveNumberThreads(numberThreads_);
+
+	MappedFile file(filename, "readMps", "MpsParallelReader");
+	const char *data = file.data();
+	const char *end = data + file.size();
+
+	try
+	{
+		std::string_view tokens[MaxTokens];
+
+		// Find the section headers: all lines that do not start with whitespace, or are comments
+		std::vector<std::vector<const char *>> headerChunks = parseChunks<const char *>(data, end, numberThreads,
+			[](const char *chunkBegin, const char *chunkEnd, std::vector<const char *> &headers)
+		{
+			forEachLine(chunkBegin, chunkEnd, [&](const char *line, const char *lineEnd)
+			{
+				if (!isSpace(*line)) headers.push_back(line);
+			});
+		});
+
+		std::vector<const char *> headers;
+		for (const std::vector<const char *> &chunk : headerChunks) headers.insert(headers.end(), chunk.begin(), chunk.end());
+
+		Section rowsSection, columnsSection, rhsSection, rangesSection, boundsSection;
+		for (size_t h = 0; h < headers.size(); h++)
+		{
+			const char *header = headers[h];
+			const char *headerEnd = static_cast<const char *>(memchr(header, '\n', end - header));
+			if (headerEnd == nullptr) headerEnd = end;
+
+			int n = tokenize(header, headerEnd, tokens);
+			if (n == 0) continue;
+			if (tokens[0] == "ENDATA") break;
+
+			Section *section = nullptr;
+			if (tokens[0] == "NAME")
+			{
+				if (n > 1) problemName_ = std::string(tokens[1]);
+				continue;
+			}
+			else if (tokens[0] == "ROWS") section = &rowsSection;
+			else if (tokens[0] == "COLUMNS") section = &columnsSection;
+			else if (tokens[0] == "RHS") section = &rhsSection;
+			else if (tokens[0] == "RANGES") section = &rangesSection;
+			else if (tokens[0] == "BOUNDS") section = &boundsSection;
+			else throw ParseError{ header, "section " + std::string(tokens[0]) + " is not supported" };
+
+			if (section->present()) throw ParseError{ header, "duplicate section " + std::string(tokens[0]) };
+			section->begin = std::min(headerEnd + 1, end);
+			section->end = (h + 1 < headers.size()) ? headers[h + 1] : end;
+		}
+
+		if (!columnsSection.present()) throw ParseError{ end, "no COLUMNS section" };
+
+		// ROWS: sequential, since the rows are numbered in order. The first free row is the objective.
+		NameMap rows;
+		std::vector<char> rowTypes;
+		forEachLine(rowsSection.begin, rowsSection.end, [&](const char *line, const char *lineEnd)
+		{
+			int n = tokenize(line, lineEnd, tokens);
+			if (n == 0) return;
+			if (n < 2) throw ParseError{ line, "row type and name expected" };
+
+			char type = static_cast<char>(toupper(static_cast<unsigned char>(tokens[0][0])));
+			if (tokens[0].size() != 1 || strchr("NLGE", type) == nullptr) throw ParseError{ line, "unknown row type " + std::string(tokens[0]) };
+
+			bool isObjective = (type == 'N' && objectiveName_.empty());
+			if (!rows.emplace(tokens[1], isObjective ? -1 : static_cast<int>(rowTypes.size())).second)
+			{
+				throw ParseError{ line, "duplicate row " + std::string(tokens[1]) };
+			}
+
+			if (isObjective)
+			{
+				objectiveName_ = std::string(tokens[1]);
+			}
+			else
+			{
+				rowNames_.push_back(std::string(tokens[1]));
+				rowTypes.push_back(type);
+			}
+		});
+
+		// COLUMNS: parse the chunks in parallel
+		std::vector<const char *> boundaries = splitLines(columnsSection.begin, columnsSection.end, numberThreads * ChunksPerThread);
+		int numberChunks = static_cast<int>(boundaries.size()) - 1;
+		std::vector<ColumnChunk> chunks(numberChunks);
+		double infinity = infinity_;
+		double smallElement = smallElement_;
+		parallelFor(numberChunks, numberThreads, [&](int c)
+		{
+			parseColumns(boundaries[c], boundaries[c + 1], rows, infinity, smallElement, chunks[c]);
+		});
+
+		// Merge the columns of the chunks. A column can be split over two chunks.
+		size_t numberNames = 0;
+		for (const ColumnChunk &chunk : chunks) numberNames += chunk.names.size();
+
+		NameMap columns;
+		columns.reserve(numberNames);
+		std::vector<std::string_view> names;
+		names.reserve(numberNames);
+		std::vector<int> lengths;
+		std::vector<size_t> offsets(numberChunks + 1, 0);
+		signed char marker = 0;
+		for (int c = 0; c < numberChunks; c++)
+		{
+			const ColumnChunk &chunk = chunks[c];
+			offsets[c + 1] = offsets[c] + chunk.elements.size();
+			for (size_t i = 0; i < chunk.names.size(); i++)
+			{
+				if (i == 0 && !names.empty() && names.back() == chunk.names[0])
+				{
+					lengths.back() += chunk.lengths[0];
+					if (chunk.objective[0] != 0.0) objective_.back() = chunk.objective[0];
+					continue;
+				}
+
+				if (!columns.emplace(chunk.names[i], static_cast<int>(names.size())).second)
+				{
+					throw ParseError{ chunk.names[i].data(), "column " + std::string(chunk.names[i]) + " is not contiguous" };
+				}
+
+				names.push_back(chunk.names[i]);
+				lengths.push_back(chunk.lengths[i]);
+				objective_.push_back(chunk.objective[i]);
+				integer_.push_back(chunk.integer[i] < 0 ? marker : chunk.integer[i]);
+			}
+			if (chunk.lastMarker >= 0) marker = chunk.lastMarker;
+		}
+
+		int numberColumns = static_cast<int>(names.size());
+		starts_.resize(numberColumns + 1);
+		for (int j = 0; j < numberColumns; j++) starts_[j + 1] = starts_[j] + lengths[j];
+
+		// Columns are contiguous and in file order, so the elements are the concatenation of those of the chunks
+		indices_.resize(offsets[numberChunks]);
+		elements_.resize(offsets[numberChunks]);
+		parallelFor(numberChunks, numberThreads, [&](int c)
+		{
+			std::copy(chunks[c].indices.begin(), chunks[c].indices.end(), indices_.begin() + offsets[c]);
+			std::copy(chunks[c].elements.begin(), chunks[c].elements.end(), elements_.begin() + offsets[c]);
+			std::vector<int>().swap(chunks[c].indices);
+			std::vector<double>().swap(chunks[c].elements);
+		});
+
+		columnNames_.resize(numberColumns);
+		parallelFor(numberThreads, numberThreads, [&](int t)
+		{
+			int first = static_cast<int>(static_cast<long long>(numberColumns) * t / numberThreads);
+			int last = static_cast<int>(static_cast<long long>(numberColumns) * (t + 1) / numberThreads);
+			for (int j = first; j < last; j++) columnNames_[j] = std::string(names[j]);
+		});
+
+		// RHS and RANGES: parse in parallel, and apply in order
+		int numberRows = static_cast<int>(rowTypes.size());
+		std::vector<double> rhs(numberRows, 0.0);
+		std::vector<double> range(numberRows, 0.0);
+		std::vector<char> hasRange(numberRows, 0);
+		if (rhsSection.present())
+		{
+			for (const std::vector<RowValue> &chunk : parseChunks<RowValue>(rhsSection.begin, rhsSection.end, numberThreads,
+				[&](const char *chunkBegin, const char *chunkEnd, std::vector<RowValue> &values) { parseRowValues(chunkBegin, chunkEnd, rows, infinity, values); }))
+			{
+				for (const RowValue &value : chunk)
+				{
+					if (value.row < 0) objectiveOffset_ = value.value;
+					else rhs[value.row] = value.value;
+				}
+			}
+		}
+		if (rangesSection.present())
+		{
+			for (const std::vector<RowValue> &chunk : parseChunks<RowValue>(rangesSection.begin, rangesSection.end, numberThreads,
+				[&](const char *chunkBegin, const char *chunkEnd, std::vector<RowValue> &values) { parseRowValues(chunkBegin, chunkEnd, rows, infinity, values); }))
+			{
+				for (const RowValue &value : chunk)
+				{
+					if (value.row < 0) continue;
+					range[value.row] = value.value;
+					hasRange[value.row] = 1;
+				}
+			}
+		}
+
+		// BOUNDS: parse in parallel, and apply in order
+		colLower_.assign(numberColumns, 0.0);
+		colUpper_.assign(numberColumns, infinity);
+		std::vector<char> hasBounds(numberColumns, 0);
+		if (boundsSection.present())
+		{
+			for (const std::vector<Bound> &chunk : parseChunks<Bound>(boundsSection.begin, boundsSection.end, numberThreads,
+				[&](const char *chunkBegin, const char *chunkEnd, std::vector<Bound> &bounds) { parseBounds(chunkBegin, chunkEnd, columns, infinity, bounds); }))
+			{
+				for (const Bound &bound : chunk)
+				{
+					int j = bound.column;
+					hasBounds[j] = 1;
+					switch (bound.type)
+					{
+					case UP:
+						// As CoinMpsIO: a negative upper bound with a default lower bound makes the lower bound minus infinity
+						if (bound.value < 0.0 && colLower_[j] == 0.0) colLower_[j] = -infinity;
+						colUpper_[j] = bound.value;
+						break;
+					case LO:
+						colLower_[j] = bound.value;
+						break;
+					case FX:
+						colLower_[j] = bound.value;
+						colUpper_[j] = bound.value;
+						break;
+					case FR:
+						colLower_[j] = -infinity;
+						colUpper_[j] = infinity;
+						break;
+					case MI:
+						colLower_[j] = -infinity;
+						break;
+					case PL:
+						colUpper_[j] = infinity;
+						break;
+					case BV:
+						integer_[j] = 1;
+						colLower_[j] = 0.0;
+						colUpper_[j] = 1.0;
+						break;
+					case UI:
+						integer_[j] = 1;
+						if (bound.value < 0.0 && colLower_[j] == 0.0) colLower_[j] = -infinity;
+						colUpper_[j] = bound.value;
+						break;
+					case LI:
+						integer_[j] = 1;
+						colLower_[j] = bound.value;
+						break;
+					}
+				}
+			}
+		}
+
+		// As CoinMpsIO: integer columns without any bound get upper bound 1
+		for (int j = 0; j < numberColumns; j++)
+		{
+			if (integer_[j] && !hasBounds[j]) colUpper_[j] = 1.0;
+		}
+
+		rowLower_.resize(numberRows);
+		rowUpper_.resize(numberRows);
+		for (int i = 0; i < numberRows; i++)
+		{
+			switch (rowTypes[i])
+			{
+			case 'L':
+				rowUpper_[i] = rhs[i];
+				rowLower_[i] = hasRange[i] ? rhs[i] - fabs(range[i]) : -infinity;
+				break;
+			case 'G':
+				rowLower_[i] = rhs[i];
+				rowUpper_[i] = hasRange[i] ? rhs[i] + fabs(range[i]) : infinity;
+				break;
+			case 'E':
+				rowLower_[i] = rhs[i];
+				rowUpper_[i] = rhs[i];
+				if (range[i] > 0.0) rowUpper_[i] = rhs[i] + range[i];
+				else if (range[i] < 0.0) rowLower_[i] = rhs[i] + range[i];
+				break;
+			default:
+				rowLower_[i] = -infinity;
+				rowUpper_[i] = infinity;
+				break;
+			}
+		}
+	}
+	catch (ParseError &error)
+	{
+		long long line = 1 + std::count(data, std::min(error.position, end), '\n');
+		clear();
+		throw CoinError("MPS line " + std::to_string(line) + ": " + error.message, "readMps", "MpsParallelReader");
+	}
+	catch (...)
+	{
+		clear();
+		throw;
+	}
+
+	return 0;
+}
+
+const char *MpsParallelReader::getRowSense() const
+{
+	int numberRows = getNumRows();
+	if (static_cast<int>(rowSense_.size()) != numberRows)
+	{
+		rowSense_.resize(numberRows);
+		for (int i = 0; i < numberRows; i++)
+		{
+			bool hasLower = rowLower_[i] > -infinity_;
+			bool hasUpper = rowUpper_[i] < infinity_;
+			if (hasLower && hasUpper) rowSense_[i] = (rowLower_[i] == rowUpper_[i]) ? 'E' : 'R';
+			else if (hasLower) rowSense_[i] = 'G';
+			else if (hasUpper) rowSense_[i] = 'L';
+			else rowSense_[i] = 'N';
+		}
+	}
+	return rowSense_.data();
+}
+
+const char *MpsParallelReader::rowName(int index) const
+{
+	if (index < 0 || index >= getNumRows()) return nullptr;
+	return rowNames_[index].c_str();
+}
+
+const char *MpsParallelReader::columnName(int index) const
+{
+	if (index < 0 || index >= getNumCols()) return nullptr;
+	return columnNames_[index].c_str();
+}
+
+const CoinPackedMatrix *MpsParallelReader::getMatrixByCol() const
+{
+	if (matrixByColumn_ == nullptr)
+	{
+		int numberColumns = getNumCols();
+		std::vector<int> lengths(numberColumns);
+		for (int j = 0; j < numberColumns; j++) lengths[j] = starts_[j + 1] - starts_[j];
+
+		matrixByColumn_ = new CoinPackedMatrix(true, getNumRows(), numberColumns, getNumElements(),
+			elements_.data(), indices_.data(), starts_.data(), lengths.data());
+	}
+	return matrixByColumn_;
+}
+
+const CoinPackedMatrix *MpsParallelReader::getMatrixByRow() const
+{
+	if (matrixByRow_ == nullptr)
+	{
+		matrixByRow_ = new CoinPackedMatrix();
+		matrixByRow_->reverseOrderedCopyOf(*getMatrixByCol());
+	}
+	return matrixByRow_;
+}
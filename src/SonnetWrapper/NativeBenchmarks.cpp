@@ -0,0 +1,51 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <CbcModel.hpp>
+
+#include "NativeBenchmarks.h"
+#include "CoinError.h"
+
+namespace COIN
+{
+	int NativeBenchmarks::dispatchCbcEvents(CbcEventHandler ^ eventHandler, CbcEvent cbcEvent, int count)
+	{
+		if (eventHandler == nullptr) throw gcnew ArgumentNullException("eventHandler");
+
+		try
+		{
+			::CbcModel model;
+			CbcDelegateEventHandlerProxy proxy(eventHandler);
+			proxy.setModel(&model);
+
+			int noActions = 0;
+			for (int i = 0; i < count; i++)
+			{
+				if (proxy.event((::CbcEventHandler::CbcEvent)cbcEvent) == ::CbcEventHandler::noAction) noActions++;
+			}
+			return noActions;
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	void NativeBenchmarks::dispatchMessages(CoinMessageHandler ^ messageHandler, int count)
+	{
+		if (messageHandler == nullptr) throw gcnew ArgumentNullException("messageHandler");
+
+		try
+		{
+			::CoinMessageHandler *handler = messageHandler->Base;
+			for (int i = 0; i < count; i++)
+			{
+				handler->message(0, "Bench", "Message %d", 'I', 0) << i << CoinMessageEol;
+			}
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+}
@@ -0,0 +1,40 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "CbcEventHandler.h"
+#include "CoinMessageHandler.h"
+
+using namespace System;
+
+namespace COIN
+{
+	/// <summary>
+	/// Native loops that drive the proxies of SonnetWrapper the way COIN-OR does while solving,
+	/// such that the cost of a callback from native to managed code can be measured without a solve (see SonnetBenchmark).
+	/// Like NativeTests, these are not for use in models.
+	/// </summary>
+	public ref class NativeBenchmarks abstract sealed
+	{
+	public:
+		/// <summary>
+		/// Invoke the given event handler the given number of times via a CbcDelegateEventHandlerProxy,
+		/// as CbcModel does at every event. The handler gets a (default constructed) CbcModel.
+		/// </summary>
+		/// <param name="eventHandler">The event handler to invoke.</param>
+		/// <param name="cbcEvent">The event to pass.</param>
+		/// <param name="count">The number of times to invoke the handler.</param>
+		/// <returns>The number of invocations that returned CbcAction::noAction.</returns>
+		static int dispatchCbcEvents(CbcEventHandler ^ eventHandler, CbcEvent cbcEvent, int count);
+
+		/// <summary>
+		/// Write the given number of messages to the native side of the given message handler,
+		/// as the COIN-OR solvers do, such that each message is formatted natively and printed via the proxy (CoinMessageHandlerProxy::print).
+		/// The messages are information messages (number 0) of detail level 0, with the message number as argument.
+		/// </summary>
+		/// <param name="messageHandler">The message handler, created with the default constructor (with proxy).</param>
+		/// <param name="count">The number of messages.</param>
+		static void dispatchMessages(CoinMessageHandler ^ messageHandler, int count);
+	};
+}
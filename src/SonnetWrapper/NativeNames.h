@@ -0,0 +1,48 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <vector>
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// The native copies of managed names, freed on destruction (SolutionFile, ProblemPatch).
+	class NativeNames
+	{
+	public:
+		NativeNames(array<String^>^ names)
+		{
+			int count = (names != nullptr) ? names->Length : 0;
+			pointers.reserve(count);
+			for (int k = 0; k < count; k++)
+			{
+				pointers.push_back((char*)Marshal::StringToHGlobalAnsi(names[k]).ToPointer());
+			}
+		}
+
+		~NativeNames()
+		{
+			for (size_t k = 0; k < pointers.size(); k++) Marshal::FreeHGlobal((IntPtr)pointers[k]);
+		}
+
+		const char * const *data() const
+		{
+			return pointers.empty() ? nullptr : pointers.data();
+		}
+
+		int size() const
+		{
+			return (int)pointers.size();
+		}
+
+	private:
+		NativeNames(const NativeNames &);
+		NativeNames &operator=(const NativeNames &);
+
+		std::vector<char *> pointers;
+	};
+}
@@ -15,6 +15,7 @@ namespace COIN
 {
 	void OsiSolverInterface::branchAndBound()
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			// some of the Osi mess up the logLevel, so reset
@@ -33,6 +34,7 @@ namespace COIN
 
 	void OsiSolverInterface::initialSolve()
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->initialSolve();
@@ -45,6 +47,7 @@ namespace COIN
 
 	void OsiSolverInterface::resolve()
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->resolve();
@@ -55,6 +58,45 @@ namespace COIN
 		}
 	}
 
+	void OsiSolverInterface::markHotStart()
+	{
+		SONNET_TRANSITION();
+		try
+		{
+			Base->markHotStart();
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	void OsiSolverInterface::solveFromHotStart()
+	{
+		SONNET_TRANSITION();
+		try
+		{
+			Base->solveFromHotStart();
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
+	void OsiSolverInterface::unmarkHotStart()
+	{
+		SONNET_TRANSITION();
+		try
+		{
+			Base->unmarkHotStart();
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+	}
+
 	double OsiSolverInterface::getInfinity()
 	{
 		try
@@ -68,6 +110,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::writeMps(String ^fileName)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
@@ -83,6 +126,7 @@ namespace COIN
 
 	void OsiSolverInterface::writeMps(String ^fileName, String ^extension)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
@@ -100,6 +144,7 @@ namespace COIN
 
 	void OsiSolverInterface::writeMps(String ^fileName, String ^extension, double objSense)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
@@ -116,6 +161,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::writeLp(String ^fileName)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
@@ -129,6 +175,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::writeLp(String ^fileName, String ^extension)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
@@ -147,6 +194,7 @@ namespace COIN
 	void OsiSolverInterface::writeLp(String ^fileName, String ^extension, double epsilon, 
 		int numberAcross, int decimals, double objSense, bool useRowNames)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
@@ -166,12 +214,14 @@ namespace COIN
 	void OsiSolverInterface::addRow(int numberElements, array<int> ^columns, array<double> ^elements, 
 		double rowlb, double rowub)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			// this method makes a copy!
 			pin_ptr<int> columnsPinned = GetPinablePtr(columns);   // entire array is now pinned
 			pin_ptr<double> elementsPinned = GetPinablePtr(elements); // when the pin_ptr goes out of scope, the array is unpinned
 			Base->addRow(numberElements, columnsPinned, elementsPinned, rowlb, rowub);
+			SONNET_TRANSITION_BYTES(numberElements * (sizeof(int) + sizeof(double)));
 		}
 		catch (::CoinError err)
 		{
@@ -257,10 +307,12 @@ namespace COIN
 
 	void OsiSolverInterface::setRowName(int index, String ^ name)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			char * charName = (char*)Marshal::StringToHGlobalAnsi(name).ToPointer();
 			Base->setRowName(index, charName);
+			SONNET_TRANSITION_BYTES(name->Length);
 			Marshal::FreeHGlobal((IntPtr)charName);
 		}
 		catch (::CoinError err)
@@ -270,6 +322,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::setRowBounds(int index, double lower, double upper)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setRowBounds(index, lower, upper);
@@ -281,6 +334,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::setRowUpper(int index, double upper)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setRowUpper(index, upper);
@@ -292,6 +346,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::setRowLower(int index, double lower)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setRowLower(index, lower);
@@ -303,6 +358,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::setRowType(int index, char sense, double rhs, double range)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setRowType(index, sense, rhs, range);
@@ -315,10 +371,12 @@ namespace COIN
 
 	void OsiSolverInterface::setColName(int index, String ^ name)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			char * charName = (char*)Marshal::StringToHGlobalAnsi(name).ToPointer();
 			Base->setColName(index, charName);
+			SONNET_TRANSITION_BYTES(name->Length);
 			Marshal::FreeHGlobal((IntPtr)charName);
 		}
 		catch (::CoinError err)
@@ -328,6 +386,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::setColUpper(int index, double upper)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setColUpper(index, upper);
@@ -339,6 +398,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::setColLower(int index, double lower)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setColLower(index, lower);
@@ -350,6 +410,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::setColBounds(int index, double lower, double upper)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setColBounds(index, lower, upper);
@@ -361,6 +422,7 @@ namespace COIN
 	}
 	bool OsiSolverInterface::isContinuous(int index)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			return Base->isContinuous(index);
@@ -372,6 +434,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::setContinuous(int index)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setContinuous(index);
@@ -384,6 +447,7 @@ namespace COIN
 	
 	bool OsiSolverInterface::isInteger(int index)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			return Base->isInteger(index);
@@ -395,6 +459,7 @@ namespace COIN
 	}
 	void OsiSolverInterface::setInteger(int index)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setInteger(index);
@@ -407,6 +472,7 @@ namespace COIN
 
 	void OsiSolverInterface::setObjCoeff(int index, double value)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->setObjCoeff(index, value);
@@ -442,10 +508,12 @@ namespace COIN
 
 	void OsiSolverInterface::setObjective(array<double> ^coefs)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			pin_ptr<double> coefsPinned = GetPinablePtr(coefs);
 			Base->setObjective(coefsPinned);
+			SONNET_TRANSITION_BYTES(coefs->Length * sizeof(double));
 		}
 		catch (::CoinError err)
 		{
@@ -460,11 +528,13 @@ namespace COIN
 
 	CoinWarmStart ^ OsiSolverInterface::getWarmStart()
 	{
+		SONNET_TRANSITION();
 		return gcnew CoinWarmStart(Base->getWarmStart());
 	}
 
 	bool OsiSolverInterface::setWarmStart(CoinWarmStart ^ warmstart)
 	{
+		SONNET_TRANSITION();
 		return Base->setWarmStart(warmstart->Base);
 	}
 
@@ -531,12 +601,14 @@ namespace COIN
 	}
 	array<double> ^ OsiSolverInterface::getColSolution()
 	{
+		SONNET_TRANSITION();
 		int n = Base->getNumCols();
 		if (n == 0) return nullptr;
 
 		double *input = (double *) Base->getColSolution();
 		array<double> ^result = gcnew array<double>(n);
 		System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, n);
+		SONNET_TRANSITION_BYTES(n * sizeof(double));
 		return result;
 	}
 
@@ -554,6 +626,7 @@ namespace COIN
 
 	void OsiSolverInterface::setColSolution(array<double> ^colsol)
 	{
+		SONNET_TRANSITION();
 		pin_ptr<double> colsolPinned = GetPinablePtr(colsol);
 		setColSolutionUnsafe(colsolPinned);
 	}
@@ -564,12 +637,14 @@ namespace COIN
 	}
 	array<double> ^ OsiSolverInterface::getReducedCost()
 	{
+		SONNET_TRANSITION();
 		int n = Base->getNumCols();
 		if (n == 0) return nullptr;
 
 		double *input = (double *)Base->getReducedCost();
 		array<double> ^result = gcnew array<double>(n);
 		System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, n);
+		SONNET_TRANSITION_BYTES(n * sizeof(double));
 		return result;
 	}
 	const double *OsiSolverInterface::getRowPriceUnsafe()
@@ -578,12 +653,14 @@ namespace COIN
 	}
 	array<double> ^ OsiSolverInterface::getRowPrice()
 	{
+		SONNET_TRANSITION();
 		int n = Base->getNumRows();
 		if (n == 0) return nullptr;
 
 		double *input = (double *)Base->getRowPrice();
 		array<double> ^result = gcnew array<double>(n);
 		System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, n);
+		SONNET_TRANSITION_BYTES(n * sizeof(double));
 		return result;
 	}
 	void OsiSolverInterface::setRowPriceUnsafe(const double *rowprice)
@@ -600,6 +677,7 @@ namespace COIN
 
 	void OsiSolverInterface::setRowPrice(array<double> ^rowprice)
 	{
+		SONNET_TRANSITION();
 		pin_ptr<double> rowpricePinned = GetPinablePtr(rowprice);
 		setRowPriceUnsafe(rowpricePinned);
 	}
@@ -610,12 +688,14 @@ namespace COIN
 	}
 	array<double> ^ OsiSolverInterface::getRowActivity()
 	{
+		SONNET_TRANSITION();
 		int n = Base->getNumRows();
 		if (n == 0) return nullptr;
 
 		double *input = (double *)Base->getRowActivity();
 		array<double> ^result = gcnew array<double>(n);
 		System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, n);
+		SONNET_TRANSITION_BYTES(n * sizeof(double));
 		return result;
 	}
 
@@ -655,12 +735,14 @@ namespace COIN
 	void OsiSolverInterface::addCol(int numberElements, array<int> ^rows, array<double> ^elements, 
 		double collb, double colub, double obj)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			pin_ptr<int> rowsPinned = GetPinablePtr(rows);
 			pin_ptr<double> elementsPinned = GetPinablePtr(elements);
 
 			Base->addCol(numberElements, rowsPinned, elementsPinned, collb, colub, obj);
+			SONNET_TRANSITION_BYTES(numberElements * (sizeof(int) + sizeof(double)));
 		}
 		catch (::CoinError err)
 		{
@@ -695,6 +777,7 @@ namespace COIN
 		array<int> ^ index, array<double> ^value, array<double> ^collb, array<double> ^colub, 
 		array<double> ^obj, array<double> ^rowlb, array<double> ^rowub)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			pin_ptr<CoinBigIndex> startPinned = GetPinablePtr(start);
@@ -708,6 +791,8 @@ namespace COIN
 
 			Base->loadProblem(numcols, numrows, startPinned, indexPinned, valuePinned, 
 				collbPinned, colubPinned, objPinned, rowlbPinned, rowubPinned);
+			SONNET_TRANSITION_BYTES((numcols + 1) * sizeof(CoinBigIndex) + start[numcols] * (sizeof(int) + sizeof(double)) 
+				+ 3 * numcols * sizeof(double) + 2 * numrows * sizeof(double));
 		}
 		catch (::CoinError err)
 		{
@@ -721,10 +806,13 @@ namespace COIN
 		const double* obj,
 		const double* rowlb, const double* rowub)
 	{
+		SONNET_TRANSITION();
 		try
 		{
 			Base->loadProblem(numcols, numrows, start, index, value, 
 				collb, colub, obj, rowlb, rowub);
+			SONNET_TRANSITION_BYTES((numcols + 1) * sizeof(CoinBigIndex) + start[numcols] * (sizeof(int) + sizeof(double)) 
+				+ 3 * numcols * sizeof(double) + 2 * numrows * sizeof(double));
 		}
 		catch (::CoinError err)
 		{
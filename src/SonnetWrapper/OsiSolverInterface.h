@@ -5,6 +5,7 @@
 
 #include "CoinMessageHandler.h"
 #include "CoinWarmStart.h"
+#include "CoinPackedMatrix.h"
 #include "OsiSolverParameters.h"
 #include "CoinError.h"
 
@@ -32,6 +33,16 @@ namespace COIN
 		void initialSolve();
 		void resolve();
 
+		/** Create a hot start snapshot of the optimization process.
+		  Used by solveFromHotStart. The number of iterations of each hot start
+		  resolve is limited by the OsiMaxNumIterationHotStart parameter.
+		*/
+		void markHotStart();
+		/// Optimize starting from the hot start snapshot.
+		void solveFromHotStart();
+		/// Delete the hot start snapshot.
+		void unmarkHotStart();
+
 		double getInfinity();
 
 		/*! \brief Read a problem in MPS format from the given filename.
@@ -142,6 +153,20 @@ namespace COIN
 	    /// Get objective function sense (1 for min (default), -1 for max)
 		double getObjSense();
 	
+		const double *getObjCoefficientsUnsafe()
+		{
+			return Base->getObjCoefficients();
+		}
+
+		array<double> ^ getObjCoefficients()
+		{
+			int n = Base->getNumCols();
+			double *input = (double *) Base->getObjCoefficients();
+			array<double> ^result = gcnew array<double>(n);
+			System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, n);
+			return result;
+		}
+
 		const double *getColLowerUnsafe()
 		{
 			return Base->getColLower();
@@ -206,6 +231,34 @@ namespace COIN
 			setColUpperUnsafe(inputPinned);
 		}
 
+		const double *getRowLowerUnsafe()
+		{
+			return Base->getRowLower();
+		}
+
+		array<double> ^ getRowLower()
+		{
+			int n = Base->getNumRows();
+			double *input = (double *) Base->getRowLower();
+			array<double> ^result = gcnew array<double>(n);
+			System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, n);
+			return result;
+		}
+
+		const double *getRowUpperUnsafe()
+		{
+			return Base->getRowUpper();
+		}
+
+		array<double> ^ getRowUpper()
+		{
+			int n = Base->getNumRows();
+			double *input = (double *) Base->getRowUpper();
+			array<double> ^result = gcnew array<double>(n);
+			System::Runtime::InteropServices::Marshal::Copy((System::IntPtr)input, result, 0, n);
+			return result;
+		}
+
 		/// <summary>
 		/// Get a pointer to an array[getNumRows()] of row constraint senses.
 		///  'L': <= constraint
@@ -237,6 +290,26 @@ namespace COIN
 			return result->ToCharArray();
 		}
 
+		/// Get pointer to row-wise copy of matrix
+		CoinPackedMatrix^ getMatrixByRow()
+		{
+			// Careful! At this point, the returned object is a wrapper around the native child object
+			// without any further reference to the original managed parent (this). Therefore, the GC
+			// may decide that the managed parent object (this) can be disposed if there are no other references to it!
+			// However, that would also dispose the wrapped native parent object, and also the native child object
+			// And thus, the returned managed object here would be illegally referring to a native child object.
+			// To prevent this, either explicity GC.KeepAlive(this), or maintain a managed 
+			// reference to the managed parent, such that GC knows not to dispose the parent (this).
+			// This caused a crash when running in Release build in Model.NewHelper.
+			return gcnew CoinPackedMatrix(Base->getMatrixByRow());
+		}
+
+		/// Get pointer to column-wise copy of matrix
+		CoinPackedMatrix^ getMatrixByCol()
+		{
+			return gcnew CoinPackedMatrix(Base->getMatrixByCol());
+		}
+
 		const double *getColSolutionUnsafe();
 		array<double> ^ getColSolution();
 		void setColSolutionUnsafe(const double *colsol);
@@ -0,0 +1,55 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+// Minimal thread helpers shared by the native readers and writers (MpsParallelReader, ModelWriter).
+// Only to be included in files compiled without /clr, since <thread> is not supported with /clr.
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Returns the given number of threads, or the number of cores if it is 0 or less.
+inline int resolveNumberThreads(int numberThreads)
+{
+	if (numberThreads > 0) return numberThreads;
+	return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+/// Runs function(i) for i = 0..count-1 on up to numberThreads threads, including the calling thread.
+/// The first exception thrown by any function is rethrown after all threads are done.
+template<class Function>
+void parallelFor(int count, int numberThreads, Function function)
+{
+	std::atomic<int> next(0);
+	std::exception_ptr error;
+	std::mutex errorMutex;
+
+	auto work = [&]()
+	{
+		for (int i = next++; i < count; i = next++)
+		{
+			try
+			{
+				function(i);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(errorMutex);
+				if (!error) error = std::current_exception();
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	int n = std::min(numberThreads, count);
+	for (int t = 1; t < n; t++) threads.emplace_back(work);
+	work();
+	for (std::thread &thread : threads) thread.join();
+
+	if (error) std::rethrow_exception(error);
+}
@@ -0,0 +1,160 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "ProblemPatch.h"
+#include "NativeNames.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	bool ProblemPatch::isPatch(String ^ fileName)
+	{
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			return ::ProblemPatch::isPatch(charFileName);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+		}
+	}
+
+	void ProblemPatch::compute(OsiSolverInterface ^ from, OsiSolverInterface ^ to)
+	{
+		try
+		{
+			Base->compute(*from->Base, *to->Base);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			GC::KeepAlive(from);
+			GC::KeepAlive(to);
+		}
+	}
+
+	void ProblemPatch::compute(OsiSolverInterface ^ from, OsiSolverInterface ^ to, array<String^>^ fromColumnNames, array<String^>^ fromRowNames,
+		array<String^>^ toColumnNames, array<String^>^ toRowNames)
+	{
+		if (fromColumnNames->Length != from->getNumCols() || fromRowNames->Length != from->getNumRows()) throw gcnew ArgumentException("The number of names does not match the solver", "fromColumnNames");
+		if (toColumnNames->Length != to->getNumCols() || toRowNames->Length != to->getNumRows()) throw gcnew ArgumentException("The number of names does not match the solver", "toColumnNames");
+
+		try
+		{
+			NativeNames nativeFromColumnNames(fromColumnNames);
+			NativeNames nativeFromRowNames(fromRowNames);
+			NativeNames nativeToColumnNames(toColumnNames);
+			NativeNames nativeToRowNames(toRowNames);
+
+			// Empty name arrays are still valid names of a problem without columns or rows
+			static const char * const noNames[1] = { nullptr };
+			Base->compute(*from->Base, *to->Base,
+				nativeFromColumnNames.size() > 0 ? nativeFromColumnNames.data() : noNames,
+				nativeFromRowNames.size() > 0 ? nativeFromRowNames.data() : noNames,
+				nativeToColumnNames.size() > 0 ? nativeToColumnNames.data() : noNames,
+				nativeToRowNames.size() > 0 ? nativeToRowNames.data() : noNames);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			GC::KeepAlive(from);
+			GC::KeepAlive(to);
+		}
+	}
+
+	void ProblemPatch::save(String ^ fileName)
+	{
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			Base->save(charFileName);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+		}
+	}
+
+	void ProblemPatch::read(String ^ fileName)
+	{
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			Base->read(charFileName);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+		}
+	}
+
+	void ProblemPatch::apply(OsiSolverInterface ^ solver)
+	{
+		try
+		{
+			Base->apply(*solver->Base);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			GC::KeepAlive(solver);
+		}
+	}
+
+	array<int> ^ ProblemPatch::getRemovedColumns()
+	{
+		return ToArray(Base->getRemovedColumns(), Base->getNumberRemovedColumns());
+	}
+
+	array<int> ^ ProblemPatch::getRemovedRows()
+	{
+		return ToArray(Base->getRemovedRows(), Base->getNumberRemovedRows());
+	}
+
+	array<int> ^ ProblemPatch::getChangedColumns()
+	{
+		return ToArray(Base->getChangedColumns(), Base->getNumberChangedColumns());
+	}
+
+	array<int> ^ ProblemPatch::getChangedRows()
+	{
+		return ToArray(Base->getChangedRows(), Base->getNumberChangedRows());
+	}
+
+	array<int> ^ ProblemPatch::getElementRows()
+	{
+		return ToArray(Base->getElementRows(), Base->getNumberChangedElements());
+	}
+
+	array<int> ^ ProblemPatch::getAddedColumnRows()
+	{
+		return ToArray(Base->getAddedColumnRows(), Base->getNumberAddedColumnElements());
+	}
+
+	array<int> ^ ProblemPatch::ToArray(const int *values, int count)
+	{
+		array<int> ^ result = gcnew array<int>(count);
+		if (count > 0) Marshal::Copy((IntPtr)(void *)values, result, 0, count);
+		return result;
+	}
+}
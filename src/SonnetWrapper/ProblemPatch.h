@@ -0,0 +1,146 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "OsiSolverInterface.h"
+
+#include "ProblemPatch.hpp"
+
+#include "CoinError.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// Structural diff between two problems, saved as a compact binary patch file, that turns a solver with the first problem
+	/// into one with the second problem with batched updates, keeping its basis where possible. See ProblemPatch.hpp.
+	public ref class ProblemPatch : WrapperBase<::ProblemPatch>
+	{
+	public:
+		/// The current version of the patch format. Files of other versions cannot be read.
+		literal int Version = ::ProblemPatch::Version;
+
+		ProblemPatch() {}
+
+		/// Returns true iff the given file exists and starts with the patch header (of any version).
+		static bool isPatch(String ^ fileName);
+
+		/// Compute the patch that turns the problem of solver from into the problem of solver to.
+		/// Columns and rows are matched by name if both solvers have names (name discipline not 0), and otherwise by index.
+		void compute(OsiSolverInterface ^ from, OsiSolverInterface ^ to);
+
+		/// Compute the patch that turns the problem of solver from into the problem of solver to, matching the columns and rows by the given names.
+		void compute(OsiSolverInterface ^ from, OsiSolverInterface ^ to, array<String^>^ fromColumnNames, array<String^>^ fromRowNames,
+			array<String^>^ toColumnNames, array<String^>^ toRowNames);
+
+		/// Save this patch to the given file. Throws a CoinError if the file cannot be written.
+		void save(String ^ fileName);
+
+		/// Read the patch from the given file.
+		/// Throws a CoinError if the file is not a valid patch file of the current version, or the checksum does not match.
+		void read(String ^ fileName);
+
+		/// Apply this patch to the given solver, which must have the problem the patch was computed from.
+		/// Removed columns and rows are deleted, and added columns and rows are appended.
+		/// Throws a CoinError if the solver does not have the number of columns and rows of that problem.
+		void apply(OsiSolverInterface ^ solver);
+
+		/// Returns true iff the patch does not change anything but the objective sense and offset.
+		bool isEmpty()
+		{
+			return Base->isEmpty();
+		}
+
+		/// Get the number of columns of the first problem.
+		int getFromNumCols()
+		{
+			return Base->getFromNumCols();
+		}
+
+		/// Get the number of rows of the first problem.
+		int getFromNumRows()
+		{
+			return Base->getFromNumRows();
+		}
+
+		/// Get the number of columns of the second problem.
+		int getToNumCols()
+		{
+			return Base->getToNumCols();
+		}
+
+		/// Get the number of rows of the second problem.
+		int getToNumRows()
+		{
+			return Base->getToNumRows();
+		}
+
+		/// Get the indices of the removed columns in the first problem, in increasing order.
+		array<int> ^ getRemovedColumns();
+
+		/// Get the indices of the removed rows in the first problem, in increasing order.
+		array<int> ^ getRemovedRows();
+
+		/// Get the number of added columns, which are appended after the remaining columns.
+		int getNumberAddedColumns()
+		{
+			return Base->getNumberAddedColumns();
+		}
+
+		/// Get the number of added rows, which are appended after the remaining rows.
+		int getNumberAddedRows()
+		{
+			return Base->getNumberAddedRows();
+		}
+
+		/// Returns the name of the given added column, or null if the patch has no names.
+		String ^ addedColumnName(int index)
+		{
+			const char *name = Base->addedColumnName(index);
+			return name != nullptr ? gcnew String(name) : nullptr;
+		}
+
+		/// Returns the name of the given added row, or null if the patch has no names.
+		String ^ addedRowName(int index)
+		{
+			const char *name = Base->addedRowName(index);
+			return name != nullptr ? gcnew String(name) : nullptr;
+		}
+
+		/// Get the number of remaining columns with changed bounds, objective coefficient or integrality.
+		int getNumberChangedColumns()
+		{
+			return Base->getNumberChangedColumns();
+		}
+
+		/// Get the indices of the changed columns in the first problem.
+		array<int> ^ getChangedColumns();
+
+		/// Get the number of remaining rows with changed bounds.
+		int getNumberChangedRows()
+		{
+			return Base->getNumberChangedRows();
+		}
+
+		/// Get the indices of the changed rows in the first problem.
+		array<int> ^ getChangedRows();
+
+		/// Get the number of changed, added or removed coefficients of remaining rows and columns.
+		int getNumberChangedElements()
+		{
+			return Base->getNumberChangedElements();
+		}
+
+		/// Get the row indices in the first problem of the changed coefficients, one per coefficient.
+		array<int> ^ getElementRows();
+
+		/// Get the row indices in the first problem of the coefficients of the added columns in the remaining rows, one per coefficient.
+		array<int> ^ getAddedColumnRows();
+
+	private:
+		static array<int> ^ ToArray(const int *values, int count);
+	};
+}
@@ -0,0 +1,157 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <CoinTypes.hpp>
+
+#include <string>
+#include <vector>
+
+class OsiSolverInterface;
+
+/** Native structural diff between two problems, saved as a compact binary patch file, that can be applied to a
+	solver with the first problem to turn it into the second problem, keeping its basis where possible.
+
+	A patch contains the removed columns and rows, the changed bounds, objective coefficients and integrality
+	of the remaining columns, the changed row bounds, the changed coefficients (with value 0 for removed coefficients),
+	and the added columns and rows with their coefficients and names. The columns and rows of the two problems are
+	matched by name if both problems have names, and otherwise by index.
+
+	A patch is applied with batched updates (set bounds, delete, add) to the solver, which must have the same number of
+	columns and rows as the first problem. Removed columns and rows are deleted, and the added columns and rows are appended,
+	in the order of the second problem. The basis of the solver is kept for the remaining columns and rows; added columns are
+	at a bound and added rows are basic. Changing coefficients requires Clp (OsiClpSolverInterface, or an OsiCbcSolverInterface
+	with Clp as real solver), and quadratic objectives are not compared.
+
+	The file format is that of ProblemSnapshot: a fixed header with a format version and a checksum, followed by the arrays.
+	This class is compiled as native code (not /clr).
+*/
+class ProblemPatch
+{
+public:
+	/// The current version of the patch format. Files of other versions cannot be read.
+	static const unsigned int Version = 1;
+
+	/** Returns true iff the given file exists and starts with the patch header (of any version). */
+	static bool isPatch(const char *filename);
+
+	ProblemPatch();
+	~ProblemPatch();
+
+	/** Compute the patch that turns the problem of the given solver from into the problem of the given solver to.
+		The given names of the columns and rows are used, or, if these are nullptr, the names of the solver if its name
+		discipline is not 0. Columns and rows are matched by name if both problems have names, and otherwise by index. */
+	void compute(const OsiSolverInterface &from, const OsiSolverInterface &to,
+		const char *const *fromColumnNames = nullptr, const char *const *fromRowNames = nullptr,
+		const char *const *toColumnNames = nullptr, const char *const *toRowNames = nullptr);
+
+	/** Save this patch to the given file, overwriting any existing file. Throws a CoinError if the file cannot be written. */
+	void save(const char *filename) const;
+
+	/** Read the patch from the given file.
+		Throws a CoinError if the file cannot be opened, is not a patch, is of another version,
+		or if the checksum does not match (unless verifyChecksum is false). */
+	void read(const char *filename, bool verifyChecksum = true);
+
+	/** Apply this patch to the given solver.
+		Throws a CoinError, without changing the solver, if the solver does not have the number of columns and rows of the
+		first problem, or if coefficients change but the solver is not Clp. */
+	void apply(OsiSolverInterface &solver) const;
+
+	/// Returns true iff the patch does not change anything but the objective sense and offset
+	bool isEmpty() const;
+
+	/// Get the number of columns of the first problem
+	int getFromNumCols() const { return fromColumns_; }
+	/// Get the number of rows of the first problem
+	int getFromNumRows() const { return fromRows_; }
+	/// Get the number of columns of the second problem
+	int getToNumCols() const { return toColumns_; }
+	/// Get the number of rows of the second problem
+	int getToNumRows() const { return toRows_; }
+
+	/// Get the number of removed columns
+	int getNumberRemovedColumns() const { return static_cast<int>(removedColumns_.size()); }
+	/// Get pointer to array[getNumberRemovedColumns()] of the indices of the removed columns in the first problem, in increasing order
+	const int *getRemovedColumns() const { return removedColumns_.data(); }
+	/// Get the number of removed rows
+	int getNumberRemovedRows() const { return static_cast<int>(removedRows_.size()); }
+	/// Get pointer to array[getNumberRemovedRows()] of the indices of the removed rows in the first problem, in increasing order
+	const int *getRemovedRows() const { return removedRows_.data(); }
+
+	/// Get the number of added columns
+	int getNumberAddedColumns() const { return static_cast<int>(addedColLower_.size()); }
+	/// Get the number of added rows
+	int getNumberAddedRows() const { return static_cast<int>(addedRowLower_.size()); }
+	/// Returns the name of the given added column, or 0 if the index is out of range or the patch has no names.
+	const char *addedColumnName(int index) const;
+	/// Returns the name of the given added row, or 0 if the index is out of range or the patch has no names.
+	const char *addedRowName(int index) const;
+
+	/// Get the number of remaining columns with changed bounds, objective coefficient or integrality
+	int getNumberChangedColumns() const { return static_cast<int>(changedColumns_.size()); }
+	/// Get pointer to array[getNumberChangedColumns()] of the indices of the changed columns in the first problem
+	const int *getChangedColumns() const { return changedColumns_.data(); }
+	/// Get the number of remaining rows with changed bounds
+	int getNumberChangedRows() const { return static_cast<int>(changedRows_.size()); }
+	/// Get pointer to array[getNumberChangedRows()] of the indices of the changed rows in the first problem
+	const int *getChangedRows() const { return changedRows_.data(); }
+	/// Get the number of changed, added or removed coefficients of remaining rows and columns
+	int getNumberChangedElements() const { return static_cast<int>(elementRows_.size()); }
+	/// Get pointer to array[getNumberChangedElements()] of the row indices in the first problem of the changed coefficients
+	const int *getElementRows() const { return elementRows_.data(); }
+	/// Get the number of coefficients of the added columns in the remaining rows
+	int getNumberAddedColumnElements() const { return static_cast<int>(addedColIndices_.size()); }
+	/// Get pointer to array[getNumberAddedColumnElements()] of the row indices in the first problem of the coefficients of the added columns
+	const int *getAddedColumnRows() const { return addedColIndices_.data(); }
+
+private:
+	ProblemPatch(const ProblemPatch &);
+	ProblemPatch &operator=(const ProblemPatch &);
+
+	void clear();
+
+	int fromColumns_;
+	int fromRows_;
+	int toColumns_;
+	int toRows_;
+	double objectiveSense_;
+	double objectiveOffset_;
+
+	std::vector<int> removedColumns_;
+	std::vector<int> removedRows_;
+
+	// Changes of remaining columns and rows, by their index in the first problem
+	std::vector<int> changedColumns_;
+	std::vector<double> changedColLower_;
+	std::vector<double> changedColUpper_;
+	std::vector<double> changedObjective_;
+	std::vector<char> changedInteger_;
+	std::vector<int> changedRows_;
+	std::vector<double> changedRowLower_;
+	std::vector<double> changedRowUpper_;
+	std::vector<int> elementRows_;
+	std::vector<int> elementColumns_;
+	std::vector<double> elementValues_;
+
+	// Added columns, by column, with their coefficients in the remaining rows (by index in the first problem)
+	std::vector<double> addedColLower_;
+	std::vector<double> addedColUpper_;
+	std::vector<double> addedObjective_;
+	std::vector<char> addedInteger_;
+	std::vector<CoinBigIndex> addedColStarts_;
+	std::vector<int> addedColIndices_;
+	std::vector<double> addedColElements_;
+
+	// Added rows, by row, with their coefficients in all columns: the remaining columns by index in the
+	// first problem, and added column k by index getFromNumCols() + k
+	std::vector<double> addedRowLower_;
+	std::vector<double> addedRowUpper_;
+	std::vector<CoinBigIndex> addedRowStarts_;
+	std::vector<int> addedRowIndices_;
+	std::vector<double> addedRowElements_;
+
+	std::vector<std::string> addedColumnNames_;
+	std::vector<std::string> addedRowNames_;
+};
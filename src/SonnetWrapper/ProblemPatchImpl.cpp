@@ -0,0 +1,702 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native implementation of ProblemPatch. This file is compiled without /clr.
+
+#include "ProblemPatch.hpp"
+#include "BinaryFile.hpp"
+#include "MappedFile.hpp"
+
+#include <CoinError.hpp>
+#include <CoinFinite.hpp>
+#include <CoinPackedMatrix.hpp>
+#include <CoinWarmStartBasis.hpp>
+#include <OsiClpSolverInterface.hpp>
+#include <OsiCbcSolverInterface.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace BinaryFile;
+
+namespace
+{
+	const char Magic[8] = { 'S', 'N', 'T', 'P', 'A', 'T', 'C', 'H' };
+
+	enum Flags
+	{
+		HasNames = 1
+	};
+
+	/// The fixed header at the start of a patch file. All sections that follow are padded to 8 bytes.
+	struct Header
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t byteOrderMark;
+		uint32_t bigIndexSize;
+		uint32_t flags;
+		int32_t fromColumns;
+		int32_t fromRows;
+		int32_t toColumns;
+		int32_t toRows;
+		int32_t removedColumns;
+		int32_t removedRows;
+		int32_t changedColumns;
+		int32_t changedRows;
+		int32_t addedColumns;
+		int32_t addedRows;
+		int64_t changedElements;
+		int64_t addedColumnElements;
+		int64_t addedRowElements;
+		double objectiveSense;
+		double objectiveOffset;
+		uint64_t stringsSize;
+		uint64_t fileSize;
+		// The checksum of the header up to here, and of all sections. Must remain the last member.
+		uint64_t checksum;
+	};
+
+	static_assert(sizeof(Header) == 128 && offsetof(Header, checksum) % 8 == 0, "Unexpected patch header layout");
+
+	/// Returns the Clp model of the given solver, if it is OsiClp or OsiCbc with OsiClp as real solver, or nullptr otherwise.
+	ClpSimplex *getClpModel(const OsiSolverInterface &solver)
+	{
+		const OsiSolverInterface *real = &solver;
+		const OsiCbcSolverInterface *cbc = dynamic_cast<const OsiCbcSolverInterface *>(real);
+		if (cbc != nullptr) real = cbc->getRealSolverPtr();
+
+		const OsiClpSolverInterface *clp = dynamic_cast<const OsiClpSolverInterface *>(real);
+		return clp != nullptr ? clp->getModelPtr() : nullptr;
+	}
+
+	/// Sets names to the given names, or, if these are nullptr, to the names of the solver if its name discipline is not 0.
+	/// Returns false if there are no names.
+	bool getNames(const OsiSolverInterface &solver, bool rows, const char *const *given, std::vector<std::string> &names)
+	{
+		names.clear();
+		if (given == nullptr)
+		{
+			int nameDiscipline = 0;
+			solver.getIntParam(OsiNameDiscipline, nameDiscipline);
+			if (nameDiscipline == 0) return false;
+		}
+
+		int count = rows ? solver.getNumRows() : solver.getNumCols();
+		names.reserve(count);
+		for (int k = 0; k < count; k++)
+		{
+			if (given != nullptr) names.push_back(given[k] != nullptr ? given[k] : "");
+			else names.push_back(rows ? solver.getRowName(k) : solver.getColName(k));
+		}
+		return true;
+	}
+
+	/// Matches the entries of the second problem to those of the first, by name if byName, and otherwise by index.
+	/// Sets toMap[k] to the matching entry of the first problem or -1, and fromMap[j] to the matching entry of the second problem or -1.
+	/// An entry of the first problem is matched at most once, so a duplicate name in the second problem is a new entry.
+	void matchEntries(int fromCount, int toCount, bool byName, const std::vector<std::string> &fromNames, const std::vector<std::string> &toNames,
+		std::vector<int> &fromMap, std::vector<int> &toMap)
+	{
+		fromMap.assign(fromCount, -1);
+		toMap.assign(toCount, -1);
+
+		if (!byName)
+		{
+			for (int k = 0; k < fromCount && k < toCount; k++) fromMap[k] = toMap[k] = k;
+			return;
+		}
+
+		std::unordered_map<std::string_view, int> indices;
+		indices.reserve(fromCount);
+		for (int j = 0; j < fromCount; j++) indices.emplace(fromNames[j], j);
+
+		for (int k = 0; k < toCount; k++)
+		{
+			auto found = indices.find(toNames[k]);
+			if (found != indices.end() && fromMap[found->second] < 0)
+			{
+				toMap[k] = found->second;
+				fromMap[found->second] = k;
+			}
+		}
+	}
+
+	/// Returns the integrality of all columns of the given solver.
+	std::vector<char> getIntegers(const OsiSolverInterface &solver)
+	{
+		std::vector<char> result(solver.getNumCols());
+		for (int j = 0; j < solver.getNumCols(); j++) result[j] = solver.isInteger(j) ? 1 : 0;
+		return result;
+	}
+
+	template<class T>
+	Section sectionOf(const std::vector<T> &values)
+	{
+		return { values.data(), values.size() * sizeof(T) };
+	}
+
+	template<class T>
+	void readSection(SectionReader &reader, std::vector<T> &values, size_t count)
+	{
+		const T *data = reader.next<T>(count);
+		values.assign(data, data + count);
+	}
+}
+
+bool ProblemPatch::isPatch(const char *filename)
+{
+	return hasMagic(filename, Magic, sizeof(Magic));
+}
+
+ProblemPatch::ProblemPatch()
+{
+	clear();
+}
+
+ProblemPatch::~ProblemPatch()
+{
+}
+
+void ProblemPatch::clear()
+{
+	fromColumns_ = fromRows_ = toColumns_ = toRows_ = 0;
+	objectiveSense_ = 1.0;
+	objectiveOffset_ = 0.0;
+
+	removedColumns_.clear();
+	removedRows_.clear();
+	changedColumns_.clear();
+	changedColLower_.clear();
+	changedColUpper_.clear();
+	changedObjective_.clear();
+	changedInteger_.clear();
+	changedRows_.clear();
+	changedRowLower_.clear();
+	changedRowUpper_.clear();
+	elementRows_.clear();
+	elementColumns_.clear();
+	elementValues_.clear();
+	addedColLower_.clear();
+	addedColUpper_.clear();
+	addedObjective_.clear();
+	addedInteger_.clear();
+	addedColStarts_.assign(1, 0);
+	addedColIndices_.clear();
+	addedColElements_.clear();
+	addedRowLower_.clear();
+	addedRowUpper_.clear();
+	addedRowStarts_.assign(1, 0);
+	addedRowIndices_.clear();
+	addedRowElements_.clear();
+	addedColumnNames_.clear();
+	addedRowNames_.clear();
+}
+
+bool ProblemPatch::isEmpty() const
+{
+	return removedColumns_.empty() && removedRows_.empty() && changedColumns_.empty() && changedRows_.empty() &&
+		elementRows_.empty() && addedColLower_.empty() && addedRowLower_.empty();
+}
+
+const char *ProblemPatch::addedColumnName(int index) const
+{
+	if (index < 0 || index >= static_cast<int>(addedColumnNames_.size())) return 0;
+	return addedColumnNames_[index].c_str();
+}
+
+const char *ProblemPatch::addedRowName(int index) const
+{
+	if (index < 0 || index >= static_cast<int>(addedRowNames_.size())) return 0;
+	return addedRowNames_[index].c_str();
+}
+
+void ProblemPatch::compute(const OsiSolverInterface &from, const OsiSolverInterface &to,
+	const char *const *fromColumnNames, const char *const *fromRowNames, const char *const *toColumnNames, const char *const *toRowNames)
+{
+	clear();
+
+	fromColumns_ = from.getNumCols();
+	fromRows_ = from.getNumRows();
+	toColumns_ = to.getNumCols();
+	toRows_ = to.getNumRows();
+	objectiveSense_ = to.getObjSense();
+	to.getDblParam(OsiObjOffset, objectiveOffset_);
+
+	// The names of the second problem are also saved for the added columns and rows
+	std::vector<std::string> fromColumnName, fromRowName, toColumnName, toRowName;
+	bool fromHasNames = getNames(from, false, fromColumnNames, fromColumnName) && getNames(from, true, fromRowNames, fromRowName);
+	const bool toHasNames = getNames(to, false, toColumnNames, toColumnName) && getNames(to, true, toRowNames, toRowName);
+	const bool byName = fromHasNames && toHasNames;
+
+	std::vector<int> fromColumnMap, toColumnMap, fromRowMap, toRowMap;
+	matchEntries(fromColumns_, toColumns_, byName, fromColumnName, toColumnName, fromColumnMap, toColumnMap);
+	matchEntries(fromRows_, toRows_, byName, fromRowName, toRowName, fromRowMap, toRowMap);
+
+	for (int j = 0; j < fromColumns_; j++)
+	{
+		if (fromColumnMap[j] < 0) removedColumns_.push_back(j);
+	}
+	for (int i = 0; i < fromRows_; i++)
+	{
+		if (fromRowMap[i] < 0) removedRows_.push_back(i);
+	}
+
+	// Columns: the changes of matched columns, and the index of the added columns
+	const double *fromColLower = from.getColLower();
+	const double *fromColUpper = from.getColUpper();
+	const double *fromObjective = from.getObjCoefficients();
+	const double *toColLower = to.getColLower();
+	const double *toColUpper = to.getColUpper();
+	const double *toObjective = to.getObjCoefficients();
+	std::vector<char> fromInteger = getIntegers(from);
+	std::vector<char> toInteger = getIntegers(to);
+
+	std::vector<int> addedColumnIndex(toColumns_, -1);
+	int numberAddedColumns = 0;
+	for (int k = 0; k < toColumns_; k++)
+	{
+		int j = toColumnMap[k];
+		if (j < 0)
+		{
+			addedColumnIndex[k] = numberAddedColumns++;
+			addedColLower_.push_back(toColLower[k]);
+			addedColUpper_.push_back(toColUpper[k]);
+			addedObjective_.push_back(toObjective[k]);
+			addedInteger_.push_back(toInteger[k]);
+			if (toHasNames) addedColumnNames_.push_back(toColumnName[k]);
+		}
+		else if (fromColLower[j] != toColLower[k] || fromColUpper[j] != toColUpper[k] ||
+			fromObjective[j] != toObjective[k] || fromInteger[j] != toInteger[k])
+		{
+			changedColumns_.push_back(j);
+			changedColLower_.push_back(toColLower[k]);
+			changedColUpper_.push_back(toColUpper[k]);
+			changedObjective_.push_back(toObjective[k]);
+			changedInteger_.push_back(toInteger[k]);
+		}
+	}
+
+	const double *fromRowLower = from.getRowLower();
+	const double *fromRowUpper = from.getRowUpper();
+	const double *toRowLower = to.getRowLower();
+	const double *toRowUpper = to.getRowUpper();
+
+	// Rows: compare each matched row by scattering the coefficients of the first problem over its columns
+	const CoinPackedMatrix *fromMatrix = from.getMatrixByRow();
+	const CoinPackedMatrix *toMatrix = to.getMatrixByRow();
+	std::vector<double> fromValue(fromColumns_);
+	std::vector<int> mark(fromColumns_, -1);
+	std::vector<int> seen(fromColumns_, -1);
+
+	// The coefficients of the added columns in the remaining rows, as (added column, row, value), sorted later
+	std::vector<int> addedColumnOf;
+	std::vector<int> addedColumnRows;
+	std::vector<double> addedColumnValues;
+
+	for (int r = 0; r < toRows_; r++)
+	{
+		const CoinBigIndex toFirst = toMatrix->getVectorFirst(r);
+		const CoinBigIndex toLast = toMatrix->getVectorLast(r);
+		const int *toIndices = toMatrix->getIndices();
+		const double *toElements = toMatrix->getElements();
+
+		int i = toRowMap[r];
+		if (i < 0)
+		{
+			addedRowLower_.push_back(toRowLower[r]);
+			addedRowUpper_.push_back(toRowUpper[r]);
+			if (toHasNames) addedRowNames_.push_back(toRowName[r]);
+
+			for (CoinBigIndex e = toFirst; e < toLast; e++)
+			{
+				int k = toIndices[e];
+				int j = toColumnMap[k];
+				addedRowIndices_.push_back(j >= 0 ? j : fromColumns_ + addedColumnIndex[k]);
+				addedRowElements_.push_back(toElements[e]);
+			}
+			addedRowStarts_.push_back(static_cast<CoinBigIndex>(addedRowIndices_.size()));
+			continue;
+		}
+
+		if (fromRowLower[i] != toRowLower[r] || fromRowUpper[i] != toRowUpper[r])
+		{
+			changedRows_.push_back(i);
+			changedRowLower_.push_back(toRowLower[r]);
+			changedRowUpper_.push_back(toRowUpper[r]);
+		}
+
+		const CoinBigIndex fromFirst = fromMatrix->getVectorFirst(i);
+		const CoinBigIndex fromLast = fromMatrix->getVectorLast(i);
+		const int *fromIndices = fromMatrix->getIndices();
+		const double *fromElements = fromMatrix->getElements();
+		for (CoinBigIndex e = fromFirst; e < fromLast; e++)
+		{
+			fromValue[fromIndices[e]] = fromElements[e];
+			mark[fromIndices[e]] = i;
+		}
+
+		for (CoinBigIndex e = toFirst; e < toLast; e++)
+		{
+			int k = toIndices[e];
+			int j = toColumnMap[k];
+			if (j < 0)
+			{
+				addedColumnOf.push_back(addedColumnIndex[k]);
+				addedColumnRows.push_back(i);
+				addedColumnValues.push_back(toElements[e]);
+			}
+			else
+			{
+				seen[j] = i;
+				if (mark[j] != i || fromValue[j] != toElements[e])
+				{
+					elementRows_.push_back(i);
+					elementColumns_.push_back(j);
+					elementValues_.push_back(toElements[e]);
+				}
+			}
+		}
+
+		// Coefficients that are no longer there, except those of removed columns
+		for (CoinBigIndex e = fromFirst; e < fromLast; e++)
+		{
+			int j = fromIndices[e];
+			if (seen[j] != i && fromColumnMap[j] >= 0)
+			{
+				elementRows_.push_back(i);
+				elementColumns_.push_back(j);
+				elementValues_.push_back(0.0);
+			}
+		}
+	}
+
+	// Order the coefficients of the added columns by column
+	std::vector<CoinBigIndex> &starts = addedColStarts_;
+	starts.assign(numberAddedColumns + 1, 0);
+	for (int a : addedColumnOf) starts[a + 1]++;
+	for (int a = 0; a < numberAddedColumns; a++) starts[a + 1] += starts[a];
+
+	addedColIndices_.resize(addedColumnOf.size());
+	addedColElements_.resize(addedColumnOf.size());
+	std::vector<CoinBigIndex> next(starts.begin(), starts.end() - 1);
+	for (size_t e = 0; e < addedColumnOf.size(); e++)
+	{
+		CoinBigIndex position = next[addedColumnOf[e]]++;
+		addedColIndices_[position] = addedColumnRows[e];
+		addedColElements_[position] = addedColumnValues[e];
+	}
+}
+
+void ProblemPatch::save(const char *filename) const
+{
+	Header header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, Magic, sizeof(Magic));
+	header.version = Version;
+	header.byteOrderMark = ByteOrderMark;
+	header.bigIndexSize = sizeof(CoinBigIndex);
+	header.fromColumns = fromColumns_;
+	header.fromRows = fromRows_;
+	header.toColumns = toColumns_;
+	header.toRows = toRows_;
+	header.removedColumns = getNumberRemovedColumns();
+	header.removedRows = getNumberRemovedRows();
+	header.changedColumns = getNumberChangedColumns();
+	header.changedRows = getNumberChangedRows();
+	header.addedColumns = getNumberAddedColumns();
+	header.addedRows = getNumberAddedRows();
+	header.changedElements = elementRows_.size();
+	header.addedColumnElements = addedColIndices_.size();
+	header.addedRowElements = addedRowIndices_.size();
+	header.objectiveSense = objectiveSense_;
+	header.objectiveOffset = objectiveOffset_;
+
+	std::vector<Section> sections;
+	sections.push_back(sectionOf(removedColumns_));
+	sections.push_back(sectionOf(removedRows_));
+	sections.push_back(sectionOf(changedColumns_));
+	sections.push_back(sectionOf(changedColLower_));
+	sections.push_back(sectionOf(changedColUpper_));
+	sections.push_back(sectionOf(changedObjective_));
+	sections.push_back(sectionOf(changedInteger_));
+	sections.push_back(sectionOf(changedRows_));
+	sections.push_back(sectionOf(changedRowLower_));
+	sections.push_back(sectionOf(changedRowUpper_));
+	sections.push_back(sectionOf(elementRows_));
+	sections.push_back(sectionOf(elementColumns_));
+	sections.push_back(sectionOf(elementValues_));
+	sections.push_back(sectionOf(addedColLower_));
+	sections.push_back(sectionOf(addedColUpper_));
+	sections.push_back(sectionOf(addedObjective_));
+	sections.push_back(sectionOf(addedInteger_));
+	sections.push_back(sectionOf(addedColStarts_));
+	sections.push_back(sectionOf(addedColIndices_));
+	sections.push_back(sectionOf(addedColElements_));
+	sections.push_back(sectionOf(addedRowLower_));
+	sections.push_back(sectionOf(addedRowUpper_));
+	sections.push_back(sectionOf(addedRowStarts_));
+	sections.push_back(sectionOf(addedRowIndices_));
+	sections.push_back(sectionOf(addedRowElements_));
+
+	// The names of the added columns and rows, if the problems had names
+	std::string strings;
+	bool withNames = addedColumnNames_.size() == addedColLower_.size() && addedRowNames_.size() == addedRowLower_.size() &&
+		!(addedColumnNames_.empty() && addedRowNames_.empty());
+	if (withNames)
+	{
+		header.flags |= HasNames;
+		for (const std::string &name : addedColumnNames_) strings.append(name).push_back('\0');
+		for (const std::string &name : addedRowNames_) strings.append(name).push_back('\0');
+	}
+
+	header.stringsSize = strings.size();
+	sections.push_back({ strings.data(), strings.size() });
+
+	header.fileSize = fileSize(sizeof(Header), sections);
+	header.checksum = checksumOf(&header, offsetof(Header, checksum), sections);
+
+	BinaryFile::write(filename, &header, sizeof(header), sections, "save", "ProblemPatch");
+}
+
+void ProblemPatch::read(const char *filename, bool verifyChecksum)
+{
+	clear();
+
+	MappedFile file(filename, "read", "ProblemPatch");
+	const char *data = file.data();
+	const char *end = data + file.size();
+
+	if (file.size() < sizeof(Header) || memcmp(data, Magic, sizeof(Magic)) != 0)
+	{
+		throw CoinError(std::string("Not a patch file: ") + filename, "read", "ProblemPatch");
+	}
+
+	const Header &header = *reinterpret_cast<const Header *>(data);
+	if (header.version != Version)
+	{
+		throw CoinError("Patch file " + std::string(filename) + " has version " + std::to_string(header.version) +
+			", but only version " + std::to_string(Version) + " is supported", "read", "ProblemPatch");
+	}
+	if (header.byteOrderMark != ByteOrderMark || header.bigIndexSize != sizeof(CoinBigIndex))
+	{
+		throw CoinError(std::string("Patch file was created on an incompatible platform: ") + filename, "read", "ProblemPatch");
+	}
+	if (header.fileSize != file.size() || header.fromColumns < 0 || header.fromRows < 0 || header.removedColumns < 0 || header.removedRows < 0 ||
+		header.changedColumns < 0 || header.changedRows < 0 || header.addedColumns < 0 || header.addedRows < 0 ||
+		header.changedElements < 0 || header.addedColumnElements < 0 || header.addedRowElements < 0)
+	{
+		throw CoinError(std::string("Patch file is truncated or corrupt: ") + filename, "read", "ProblemPatch");
+	}
+	if (verifyChecksum)
+	{
+		Checksum checksum;
+		checksum.add(data, offsetof(Header, checksum));
+		checksum.add(data + sizeof(Header), file.size() - sizeof(Header));
+		if (checksum.value() != header.checksum) throw CoinError(std::string("Patch file checksum mismatch: ") + filename, "read", "ProblemPatch");
+	}
+
+	fromColumns_ = header.fromColumns;
+	fromRows_ = header.fromRows;
+	toColumns_ = header.toColumns;
+	toRows_ = header.toRows;
+	objectiveSense_ = header.objectiveSense;
+	objectiveOffset_ = header.objectiveOffset;
+
+	SectionReader reader(data + sizeof(Header), end, "read", "ProblemPatch");
+	readSection(reader, removedColumns_, header.removedColumns);
+	readSection(reader, removedRows_, header.removedRows);
+	readSection(reader, changedColumns_, header.changedColumns);
+	readSection(reader, changedColLower_, header.changedColumns);
+	readSection(reader, changedColUpper_, header.changedColumns);
+	readSection(reader, changedObjective_, header.changedColumns);
+	readSection(reader, changedInteger_, header.changedColumns);
+	readSection(reader, changedRows_, header.changedRows);
+	readSection(reader, changedRowLower_, header.changedRows);
+	readSection(reader, changedRowUpper_, header.changedRows);
+	readSection(reader, elementRows_, header.changedElements);
+	readSection(reader, elementColumns_, header.changedElements);
+	readSection(reader, elementValues_, header.changedElements);
+	readSection(reader, addedColLower_, header.addedColumns);
+	readSection(reader, addedColUpper_, header.addedColumns);
+	readSection(reader, addedObjective_, header.addedColumns);
+	readSection(reader, addedInteger_, header.addedColumns);
+	readSection(reader, addedColStarts_, header.addedColumns + 1);
+	readSection(reader, addedColIndices_, header.addedColumnElements);
+	readSection(reader, addedColElements_, header.addedColumnElements);
+	readSection(reader, addedRowLower_, header.addedRows);
+	readSection(reader, addedRowUpper_, header.addedRows);
+	readSection(reader, addedRowStarts_, header.addedRows + 1);
+	readSection(reader, addedRowIndices_, header.addedRowElements);
+	readSection(reader, addedRowElements_, header.addedRowElements);
+
+	// All indices are checked here, such that apply cannot fail halfway on a corrupt file
+	bool valid = addedColStarts_.back() == header.addedColumnElements && addedRowStarts_.back() == header.addedRowElements;
+	for (int j : removedColumns_) valid = valid && j >= 0 && j < fromColumns_;
+	for (int i : removedRows_) valid = valid && i >= 0 && i < fromRows_;
+	for (int j : changedColumns_) valid = valid && j >= 0 && j < fromColumns_;
+	for (int i : changedRows_) valid = valid && i >= 0 && i < fromRows_;
+	for (int i : elementRows_) valid = valid && i >= 0 && i < fromRows_;
+	for (int j : elementColumns_) valid = valid && j >= 0 && j < fromColumns_;
+	for (int i : addedColIndices_) valid = valid && i >= 0 && i < fromRows_;
+	for (int j : addedRowIndices_) valid = valid && j >= 0 && j < fromColumns_ + header.addedColumns;
+	for (int a = 0; a < header.addedColumns; a++) valid = valid && addedColStarts_[a] <= addedColStarts_[a + 1];
+	for (int b = 0; b < header.addedRows; b++) valid = valid && addedRowStarts_[b] <= addedRowStarts_[b + 1];
+	if (!valid) throw CoinError(std::string("Patch file is corrupt: ") + filename, "read", "ProblemPatch");
+
+	const char *strings = reader.next<char>(header.stringsSize);
+	const char *stringsEnd = strings + header.stringsSize;
+	if (header.flags & HasNames)
+	{
+		addedColumnNames_.reserve(header.addedColumns);
+		for (int a = 0; a < header.addedColumns; a++) addedColumnNames_.push_back(reader.nextString(strings, stringsEnd));
+		addedRowNames_.reserve(header.addedRows);
+		for (int b = 0; b < header.addedRows; b++) addedRowNames_.push_back(reader.nextString(strings, stringsEnd));
+	}
+}
+
+void ProblemPatch::apply(OsiSolverInterface &solver) const
+{
+	if (solver.getNumCols() != fromColumns_ || solver.getNumRows() != fromRows_)
+	{
+		throw CoinError("The patch is for a problem with " + std::to_string(fromColumns_) + " columns and " + std::to_string(fromRows_) +
+			" rows, but the solver has " + std::to_string(solver.getNumCols()) + " columns and " + std::to_string(solver.getNumRows()) + " rows",
+			"apply", "ProblemPatch");
+	}
+
+	ClpSimplex *clp = getClpModel(solver);
+	if (!elementRows_.empty() && clp == nullptr)
+	{
+		throw CoinError("Changing coefficients is not supported for this solver type", "apply", "ProblemPatch");
+	}
+
+	// The basis before any changes, of which the remaining columns and rows are kept
+	std::unique_ptr<CoinWarmStart> warmStart(solver.getWarmStart());
+	CoinWarmStartBasis *basis = dynamic_cast<CoinWarmStartBasis *>(warmStart.get());
+	if (basis != nullptr && (basis->getNumStructural() != fromColumns_ || basis->getNumArtificial() != fromRows_)) basis = nullptr;
+
+	// First all changes by index in the first problem, then the removals, and finally the additions
+	for (size_t e = 0; e < elementRows_.size(); e++) clp->modifyCoefficient(elementRows_[e], elementColumns_[e], elementValues_[e]);
+
+	if (!changedColumns_.empty())
+	{
+		std::vector<double> bounds(2 * changedColumns_.size());
+		std::vector<int> integers, continuous;
+		for (size_t c = 0; c < changedColumns_.size(); c++)
+		{
+			bounds[2 * c] = changedColLower_[c];
+			bounds[2 * c + 1] = changedColUpper_[c];
+			if (solver.isInteger(changedColumns_[c]) != (changedInteger_[c] != 0)) (changedInteger_[c] != 0 ? integers : continuous).push_back(changedColumns_[c]);
+		}
+
+		const int *first = changedColumns_.data();
+		const int *last = first + changedColumns_.size();
+		solver.setColSetBounds(first, last, bounds.data());
+		solver.setObjCoeffSet(first, last, changedObjective_.data());
+		if (!integers.empty()) solver.setInteger(integers.data(), static_cast<int>(integers.size()));
+		if (!continuous.empty()) solver.setContinuous(continuous.data(), static_cast<int>(continuous.size()));
+	}
+
+	if (!changedRows_.empty())
+	{
+		std::vector<double> bounds(2 * changedRows_.size());
+		for (size_t r = 0; r < changedRows_.size(); r++)
+		{
+			bounds[2 * r] = changedRowLower_[r];
+			bounds[2 * r + 1] = changedRowUpper_[r];
+		}
+		solver.setRowSetBounds(changedRows_.data(), changedRows_.data() + changedRows_.size(), bounds.data());
+	}
+
+	// The index of each remaining column and row after the removals
+	std::vector<int> columnIndex(fromColumns_ + getNumberAddedColumns());
+	int remainingColumns = 0;
+	for (int j = 0, r = 0; j < fromColumns_; j++)
+	{
+		if (r < getNumberRemovedColumns() && removedColumns_[r] == j)
+		{
+			columnIndex[j] = -1;
+			r++;
+		}
+		else columnIndex[j] = remainingColumns++;
+	}
+	for (int a = 0; a < getNumberAddedColumns(); a++) columnIndex[fromColumns_ + a] = remainingColumns + a;
+
+	std::vector<int> rowIndex(fromRows_);
+	int remainingRows = 0;
+	for (int i = 0, r = 0; i < fromRows_; i++)
+	{
+		if (r < getNumberRemovedRows() && removedRows_[r] == i)
+		{
+			rowIndex[i] = -1;
+			r++;
+		}
+		else rowIndex[i] = remainingRows++;
+	}
+
+	if (!removedColumns_.empty()) solver.deleteCols(getNumberRemovedColumns(), removedColumns_.data());
+	if (!removedRows_.empty()) solver.deleteRows(getNumberRemovedRows(), removedRows_.data());
+
+	const int numberAddedColumns = getNumberAddedColumns();
+	if (numberAddedColumns > 0)
+	{
+		std::vector<int> rows(addedColIndices_.size());
+		for (size_t e = 0; e < rows.size(); e++) rows[e] = rowIndex[addedColIndices_[e]];
+
+		solver.addCols(numberAddedColumns, addedColStarts_.data(), rows.data(), addedColElements_.data(),
+			addedColLower_.data(), addedColUpper_.data(), addedObjective_.data());
+
+		std::vector<int> integers;
+		for (int a = 0; a < numberAddedColumns; a++)
+		{
+			if (addedInteger_[a] != 0) integers.push_back(remainingColumns + a);
+		}
+		if (!integers.empty()) solver.setInteger(integers.data(), static_cast<int>(integers.size()));
+
+		for (int a = 0; a < numberAddedColumns && a < static_cast<int>(addedColumnNames_.size()); a++)
+		{
+			solver.setColName(remainingColumns + a, addedColumnNames_[a]);
+		}
+	}
+
+	const int numberAddedRows = getNumberAddedRows();
+	if (numberAddedRows > 0)
+	{
+		std::vector<int> columns(addedRowIndices_.size());
+		for (size_t e = 0; e < columns.size(); e++) columns[e] = columnIndex[addedRowIndices_[e]];
+
+		solver.addRows(numberAddedRows, addedRowStarts_.data(), columns.data(), addedRowElements_.data(),
+			addedRowLower_.data(), addedRowUpper_.data());
+
+		for (int b = 0; b < numberAddedRows && b < static_cast<int>(addedRowNames_.size()); b++)
+		{
+			solver.setRowName(remainingRows + b, addedRowNames_[b]);
+		}
+	}
+
+	solver.setObjSense(objectiveSense_);
+	solver.setDblParam(OsiObjOffset, objectiveOffset_);
+
+	if (basis == nullptr) return;
+
+	// Keep the basis of the remaining columns and rows. Added rows are basic, and added columns nonbasic,
+	// after which the number of basic variables is restored to the number of rows, if needed.
+	if (!removedColumns_.empty()) basis->deleteColumns(getNumberRemovedColumns(), removedColumns_.data());
+	if (!removedRows_.empty()) basis->deleteRows(getNumberRemovedRows(), removedRows_.data());
+	basis->resize(remainingRows + numberAddedRows, remainingColumns + numberAddedColumns);
+	for (int a = 0; a < numberAddedColumns; a++)
+	{
+		basis->setStructStatus(remainingColumns + a, nonbasicStatus(addedColLower_[a], addedColUpper_[a]));
+	}
+
+	// Too few basic variables if basic columns or nonbasic rows were removed, and too many if rows with nonbasic slacks were removed
+	repairBasis(*basis, solver.getColLower(), solver.getColUpper());
+
+	solver.setWarmStart(basis);
+}
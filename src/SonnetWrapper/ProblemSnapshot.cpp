@@ -0,0 +1,59 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "ProblemSnapshot.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	void ProblemSnapshot::save(OsiSolverInterface ^ solver, String ^ fileName, bool includeBasis)
+	{
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			::ProblemSnapshot::save(*solver->Base, charFileName, includeBasis);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+			GC::KeepAlive(solver);
+		}
+	}
+
+	bool ProblemSnapshot::load(String ^ fileName, OsiSolverInterface ^ solver, bool verifyChecksum)
+	{
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			return ::ProblemSnapshot::load(charFileName, *solver->Base, verifyChecksum);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+			GC::KeepAlive(solver);
+		}
+	}
+
+	bool ProblemSnapshot::isSnapshot(String ^ fileName)
+	{
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			return ::ProblemSnapshot::isSnapshot(charFileName);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+		}
+	}
+}
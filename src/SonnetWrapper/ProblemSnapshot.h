@@ -0,0 +1,55 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "OsiSolverInterface.h"
+
+#include "ProblemSnapshot.hpp"
+
+#include "CoinError.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// Save and load a compact binary snapshot of the problem loaded in an OsiSolverInterface:
+	/// the matrix, bounds, objective, integrality, names, the Clp quadratic objective and, optionally, the basis.
+	/// Loading memory-maps the file and passes the arrays straight to loadProblem. See ProblemSnapshot.hpp.
+	public ref class ProblemSnapshot
+	{
+	private:
+		ProblemSnapshot() {}
+
+	public:
+		/// The current version of the snapshot format. Files of other versions cannot be loaded.
+		literal int Version = ::ProblemSnapshot::Version;
+
+		/// Save the problem of the given solver, including its basis, to the given file.
+		static void save(OsiSolverInterface ^ solver, String ^ fileName)
+		{
+			save(solver, fileName, true);
+		}
+
+		/// Save the problem of the given solver to the given file. If includeBasis, the basis (CoinWarmStartBasis) of the solver is included.
+		/// Throws a CoinError if the file cannot be written.
+		static void save(OsiSolverInterface ^ solver, String ^ fileName, bool includeBasis);
+
+		/// Load the problem from the given snapshot file into the given solver, replacing its current problem.
+		/// Returns true iff the snapshot contained a basis, which is then set as warm start of the solver.
+		/// Throws a CoinError if the file is not a valid snapshot of the current version, or the checksum does not match.
+		static bool load(String ^ fileName, OsiSolverInterface ^ solver)
+		{
+			return load(fileName, solver, true);
+		}
+
+		/// Load the problem from the given snapshot file into the given solver, replacing its current problem.
+		/// Verifying the checksum reads the whole file once more; skip this only for trusted files.
+		static bool load(String ^ fileName, OsiSolverInterface ^ solver, bool verifyChecksum);
+
+		/// Returns true iff the given file exists and starts with the snapshot header (of any version).
+		static bool isSnapshot(String ^ fileName);
+	};
+}
@@ -0,0 +1,42 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+class OsiSolverInterface;
+
+/** Native save and load of a compact binary snapshot of the problem loaded in an OsiSolverInterface.
+
+	The snapshot contains the column-ordered matrix, the bounds, the objective (sense, offset and
+	coefficients), the integrality, the problem and objective names and, if the name discipline of
+	the solver is not 0, all row and column names. For Clp (OsiClpSolverInterface, or an
+	OsiCbcSolverInterface with Clp as real solver) the quadratic objective is included,
+	and optionally the warm start basis (CoinWarmStartBasis).
+
+	The arrays are stored as-is (little-endian, 8-byte aligned) after a fixed header with
+	a format version and a checksum, such that loading memory-maps the file and passes the
+	arrays straight to loadProblem, without any parsing.
+
+	This class is compiled as native code (not /clr), like MpsParallelReader.
+*/
+class ProblemSnapshot
+{
+public:
+	/// The current version of the snapshot format. Files of other versions cannot be loaded.
+	static const unsigned int Version = 1;
+
+	/** Save the problem of the given solver to the given file, overwriting any existing file.
+		If includeBasis, the warm start of the solver is included if it is a CoinWarmStartBasis of the same size as the problem.
+		Throws a CoinError if the file cannot be written, or the quadratic objective cannot be saved. */
+	static void save(const OsiSolverInterface &solver, const char *filename, bool includeBasis);
+
+	/** Load the problem from the given snapshot file into the given solver, replacing its current problem.
+		Throws a CoinError if the file cannot be opened, is not a snapshot, is of another version,
+		or if the checksum does not match (unless verifyChecksum is false). Whatever verifyChecksum, the matrix is
+		checked to be well-formed, with monotone starts and all indices within range.
+		Returns true iff the snapshot contained a basis, which is then set as warm start of the solver. */
+	static bool load(const char *filename, OsiSolverInterface &solver, bool verifyChecksum = true);
+
+	/** Returns true iff the given file exists and starts with the snapshot header (of any version). */
+	static bool isSnapshot(const char *filename);
+};
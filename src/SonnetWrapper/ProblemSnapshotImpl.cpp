@@ -0,0 +1,318 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native implementation of ProblemSnapshot. This file is compiled without /clr.
+
+#include "ProblemSnapshot.hpp"
+#include "BinaryFile.hpp"
+#include "MappedFile.hpp"
+
+#include <CoinError.hpp>
+#include <CoinPackedMatrix.hpp>
+#include <CoinWarmStartBasis.hpp>
+#include <ClpQuadraticObjective.hpp>
+#include <OsiClpSolverInterface.hpp>
+#include <OsiCbcSolverInterface.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace BinaryFile;
+
+namespace
+{
+	const char Magic[8] = { 'S', 'N', 'T', 'S', 'N', 'A', 'P', '\0' };
+
+	enum Flags
+	{
+		HasNames = 1,
+		HasQuadraticObjective = 2,
+		HasBasis = 4
+	};
+
+	/// The fixed header at the start of a snapshot file. All sections that follow are padded to 8 bytes.
+	struct Header
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t byteOrderMark;
+		uint32_t bigIndexSize;
+		uint32_t flags;
+		int32_t numberColumns;
+		int32_t numberRows;
+		int64_t numberElements;
+		int64_t numberQuadraticElements;
+		double objectiveSense;
+		double objectiveOffset;
+		uint64_t stringsSize;
+		uint64_t fileSize;
+		// The checksum of the header up to here, and of all sections. Must remain the last member.
+		uint64_t checksum;
+	};
+
+	static_assert(sizeof(Header) == 88 && offsetof(Header, checksum) % 8 == 0, "Unexpected snapshot header layout");
+
+	/// Returns the Clp model of the given solver, if it is OsiClp or OsiCbc with OsiClp as real solver, or nullptr otherwise.
+	ClpSimplex *getClpModel(const OsiSolverInterface &solver)
+	{
+		const OsiSolverInterface *real = &solver;
+		const OsiCbcSolverInterface *cbc = dynamic_cast<const OsiCbcSolverInterface *>(real);
+		if (cbc != nullptr) real = cbc->getRealSolverPtr();
+
+		const OsiClpSolverInterface *clp = dynamic_cast<const OsiClpSolverInterface *>(real);
+		return clp != nullptr ? clp->getModelPtr() : nullptr;
+	}
+
+	/// Returns true iff the given column-ordered matrix is well-formed: the starts are monotone from 0 to the number of elements,
+	/// and each index is in [0, numberMinor). The solver uses the matrix unchecked, so this is verified with or without checksum.
+	bool isValidMatrix(int numberMajor, int numberMinor, int64_t numberElements, const CoinBigIndex *starts, const int *indices)
+	{
+		if (starts[0] != 0 || starts[numberMajor] != numberElements) return false;
+		for (int j = 0; j < numberMajor; j++)
+		{
+			if (starts[j + 1] < starts[j]) return false;
+		}
+		for (int64_t k = 0; k < numberElements; k++)
+		{
+			if (indices[k] < 0 || indices[k] >= numberMinor) return false;
+		}
+		return true;
+	}
+}
+
+void ProblemSnapshot::save(const OsiSolverInterface &solver, const char *filename, bool includeBasis)
+{
+	const int numberColumns = solver.getNumCols();
+	const int numberRows = solver.getNumRows();
+
+	// The matrix must be column-ordered without gaps to store the arrays as they are
+	const CoinPackedMatrix *matrix = solver.getMatrixByCol();
+	std::unique_ptr<CoinPackedMatrix> compactMatrix;
+	if (matrix == nullptr || !matrix->isColOrdered() || matrix->hasGaps())
+	{
+		compactMatrix.reset(matrix != nullptr ? new CoinPackedMatrix(*matrix) : new CoinPackedMatrix());
+		if (!compactMatrix->isColOrdered()) compactMatrix->reverseOrdering();
+		compactMatrix->removeGaps();
+		matrix = compactMatrix.get();
+	}
+
+	Header header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, Magic, sizeof(Magic));
+	header.version = Version;
+	header.byteOrderMark = ByteOrderMark;
+	header.bigIndexSize = sizeof(CoinBigIndex);
+	header.numberColumns = numberColumns;
+	header.numberRows = numberRows;
+	header.numberElements = matrix->getNumElements();
+	header.objectiveSense = solver.getObjSense();
+	solver.getDblParam(OsiObjOffset, header.objectiveOffset);
+
+	std::vector<char> integer(numberColumns);
+	for (int j = 0; j < numberColumns; j++) integer[j] = solver.isInteger(j) ? 1 : 0;
+
+	if (matrix->getMajorDim() != numberColumns)
+	{
+		throw CoinError("The matrix does not match the number of columns", "save", "ProblemSnapshot");
+	}
+
+	// An empty matrix may have no starts at all
+	static const CoinBigIndex noStarts[1] = { 0 };
+	const CoinBigIndex *starts = matrix->getVectorStarts() != nullptr ? matrix->getVectorStarts() : noStarts;
+
+	std::vector<Section> sections;
+	sections.push_back({ starts, (numberColumns + 1) * sizeof(CoinBigIndex) });
+	sections.push_back({ matrix->getIndices(), header.numberElements * sizeof(int) });
+	sections.push_back({ matrix->getElements(), header.numberElements * sizeof(double) });
+	sections.push_back({ solver.getColLower(), numberColumns * sizeof(double) });
+	sections.push_back({ solver.getColUpper(), numberColumns * sizeof(double) });
+	sections.push_back({ solver.getObjCoefficients(), numberColumns * sizeof(double) });
+	sections.push_back({ solver.getRowLower(), numberRows * sizeof(double) });
+	sections.push_back({ solver.getRowUpper(), numberRows * sizeof(double) });
+	sections.push_back({ integer.data(), integer.size() });
+
+	// The quadratic objective is only available via the Clp model
+	std::unique_ptr<CoinPackedMatrix> compactQuadratic;
+	ClpSimplex *clp = getClpModel(solver);
+	ClpQuadraticObjective *quadraticObjective = clp != nullptr ? dynamic_cast<ClpQuadraticObjective *>(clp->objectiveAsObject()) : nullptr;
+	const CoinPackedMatrix *quadratic = quadraticObjective != nullptr ? quadraticObjective->quadraticObjective() : nullptr;
+	if (quadratic != nullptr && quadratic->getNumElements() > 0)
+	{
+		if (quadratic->getMajorDim() != numberColumns || !quadratic->isColOrdered())
+		{
+			throw CoinError("The quadratic objective does not match the number of columns", "save", "ProblemSnapshot");
+		}
+
+		if (quadratic->hasGaps())
+		{
+			compactQuadratic.reset(new CoinPackedMatrix(*quadratic));
+			compactQuadratic->removeGaps();
+			quadratic = compactQuadratic.get();
+		}
+
+		header.flags |= HasQuadraticObjective;
+		header.numberQuadraticElements = quadratic->getNumElements();
+		sections.push_back({ quadratic->getVectorStarts(), (numberColumns + 1) * sizeof(CoinBigIndex) });
+		sections.push_back({ quadratic->getIndices(), header.numberQuadraticElements * sizeof(int) });
+		sections.push_back({ quadratic->getElements(), header.numberQuadraticElements * sizeof(double) });
+	}
+
+	std::unique_ptr<CoinWarmStart> warmStart;
+	if (includeBasis)
+	{
+		warmStart.reset(solver.getWarmStart());
+		const CoinWarmStartBasis *basis = dynamic_cast<const CoinWarmStartBasis *>(warmStart.get());
+		if (basis != nullptr && basis->getNumStructural() == numberColumns && basis->getNumArtificial() == numberRows)
+		{
+			header.flags |= HasBasis;
+			sections.push_back({ basis->getStructuralStatus(), basisStatusSize(numberColumns) });
+			sections.push_back({ basis->getArtificialStatus(), basisStatusSize(numberRows) });
+		}
+	}
+
+	// The problem and objective name, and, as for writeMps, only the names if there is a name discipline
+	std::string strings;
+	std::string problemName;
+	solver.getStrParam(OsiProbName, problemName);
+	strings.append(problemName).push_back('\0');
+	strings.append(solver.getObjName()).push_back('\0');
+
+	int nameDiscipline = 0;
+	solver.getIntParam(OsiNameDiscipline, nameDiscipline);
+	if (nameDiscipline != 0)
+	{
+		header.flags |= HasNames;
+		for (int i = 0; i < numberRows; i++) strings.append(solver.getRowName(i)).push_back('\0');
+		for (int j = 0; j < numberColumns; j++) strings.append(solver.getColName(j)).push_back('\0');
+	}
+
+	header.stringsSize = strings.size();
+	sections.push_back({ strings.data(), strings.size() });
+
+	header.fileSize = fileSize(sizeof(Header), sections);
+	header.checksum = checksumOf(&header, offsetof(Header, checksum), sections);
+
+	BinaryFile::write(filename, &header, sizeof(header), sections, "save", "ProblemSnapshot");
+}
+
+bool ProblemSnapshot::load(const char *filename, OsiSolverInterface &solver, bool verifyChecksum)
+{
+	MappedFile file(filename, "load", "ProblemSnapshot");
+	const char *data = file.data();
+	const char *end = data + file.size();
+
+	if (file.size() < sizeof(Header) || memcmp(data, Magic, sizeof(Magic)) != 0)
+	{
+		throw CoinError(std::string("Not a snapshot file: ") + filename, "load", "ProblemSnapshot");
+	}
+
+	// The mapping is page-aligned, so the header and sections can be used in place
+	const Header &header = *reinterpret_cast<const Header *>(data);
+	if (header.version != Version)
+	{
+		throw CoinError("Snapshot file " + std::string(filename) + " has version " + std::to_string(header.version) +
+			", but only version " + std::to_string(Version) + " is supported", "load", "ProblemSnapshot");
+	}
+	if (header.byteOrderMark != ByteOrderMark || header.bigIndexSize != sizeof(CoinBigIndex))
+	{
+		throw CoinError(std::string("Snapshot file was created on an incompatible platform: ") + filename, "load", "ProblemSnapshot");
+	}
+	if (header.fileSize != file.size() || header.numberColumns < 0 || header.numberRows < 0)
+	{
+		throw CoinError(std::string("Snapshot file is truncated or corrupt: ") + filename, "load", "ProblemSnapshot");
+	}
+	if (verifyChecksum)
+	{
+		Checksum checksum;
+		checksum.add(data, offsetof(Header, checksum));
+		checksum.add(data + sizeof(Header), file.size() - sizeof(Header));
+		if (checksum.value() != header.checksum) throw CoinError(std::string("Snapshot file checksum mismatch: ") + filename, "load", "ProblemSnapshot");
+	}
+
+	const int numberColumns = header.numberColumns;
+	const int numberRows = header.numberRows;
+
+	SectionReader reader(data + sizeof(Header), end, "load", "ProblemSnapshot");
+	const CoinBigIndex *starts = reader.next<CoinBigIndex>(numberColumns + 1);
+	const int *indices = reader.next<int>(header.numberElements);
+	const double *elements = reader.next<double>(header.numberElements);
+	const double *colLower = reader.next<double>(numberColumns);
+	const double *colUpper = reader.next<double>(numberColumns);
+	const double *objective = reader.next<double>(numberColumns);
+	const double *rowLower = reader.next<double>(numberRows);
+	const double *rowUpper = reader.next<double>(numberRows);
+	const char *integer = reader.next<char>(numberColumns);
+
+	if (!isValidMatrix(numberColumns, numberRows, header.numberElements, starts, indices))
+	{
+		throw CoinError(std::string("Snapshot file is corrupt: ") + filename, "load", "ProblemSnapshot");
+	}
+
+	solver.loadProblem(numberColumns, numberRows, starts, indices, elements, colLower, colUpper, objective, rowLower, rowUpper);
+	solver.setObjSense(header.objectiveSense);
+	solver.setDblParam(OsiObjOffset, header.objectiveOffset);
+
+	std::vector<int> integerColumns;
+	for (int j = 0; j < numberColumns; j++)
+	{
+		if (integer[j] != 0) integerColumns.push_back(j);
+	}
+	if (!integerColumns.empty()) solver.setInteger(integerColumns.data(), static_cast<int>(integerColumns.size()));
+
+	if (header.flags & HasQuadraticObjective)
+	{
+		const CoinBigIndex *quadraticStarts = reader.next<CoinBigIndex>(numberColumns + 1);
+		const int *quadraticIndices = reader.next<int>(header.numberQuadraticElements);
+		const double *quadraticElements = reader.next<double>(header.numberQuadraticElements);
+		if (!isValidMatrix(numberColumns, numberColumns, header.numberQuadraticElements, quadraticStarts, quadraticIndices))
+		{
+			throw CoinError(std::string("Snapshot file is corrupt: ") + filename, "load", "ProblemSnapshot");
+		}
+
+		ClpSimplex *clp = getClpModel(solver);
+		if (clp == nullptr) throw CoinError("Quadratic objective not supported for this solver type", "load", "ProblemSnapshot");
+		clp->loadQuadraticObjective(numberColumns, quadraticStarts, quadraticIndices, quadraticElements);
+	}
+
+	const char *structuralStatus = nullptr;
+	const char *artificialStatus = nullptr;
+	if (header.flags & HasBasis)
+	{
+		structuralStatus = reader.next<char>(basisStatusSize(numberColumns));
+		artificialStatus = reader.next<char>(basisStatusSize(numberRows));
+	}
+
+	const char *strings = reader.next<char>(header.stringsSize);
+	const char *stringsEnd = strings + header.stringsSize;
+	solver.setStrParam(OsiProbName, reader.nextString(strings, stringsEnd));
+	solver.setObjName(reader.nextString(strings, stringsEnd));
+
+	if (header.flags & HasNames)
+	{
+		OsiSolverInterface::OsiNameVec rowNames(numberRows);
+		for (int i = 0; i < numberRows; i++) rowNames[i] = reader.nextString(strings, stringsEnd);
+		OsiSolverInterface::OsiNameVec columnNames(numberColumns);
+		for (int j = 0; j < numberColumns; j++) columnNames[j] = reader.nextString(strings, stringsEnd);
+
+		// As for Solver.Generate, the names are only kept if the name discipline of the solver is not 0
+		solver.setRowNames(rowNames, 0, numberRows, 0);
+		solver.setColNames(columnNames, 0, numberColumns, 0);
+	}
+
+	if (structuralStatus != nullptr)
+	{
+		CoinWarmStartBasis basis(numberColumns, numberRows, structuralStatus, artificialStatus);
+		return solver.setWarmStart(&basis);
+	}
+
+	return false;
+}
+
+bool ProblemSnapshot::isSnapshot(const char *filename)
+{
+	return hasMagic(filename, Magic, sizeof(Magic));
+}
@@ -0,0 +1,138 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "SolutionFile.h"
+#include "NativeNames.h"
+
+#include <CoinWarmStartBasis.hpp>
+
+#include <vector>
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	void SolutionFile::save(OsiSolverInterface ^ solver, String ^ fileName)
+	{
+		save(solver, fileName, nullptr, nullptr);
+	}
+
+	void SolutionFile::save(OsiSolverInterface ^ solver, String ^ fileName, array<String^>^ columnNames, array<String^>^ rowNames)
+	{
+		if (columnNames != nullptr && columnNames->Length != solver->getNumCols()) throw gcnew ArgumentException("The number of column names does not match the solver", "columnNames");
+		if (rowNames != nullptr && rowNames->Length != solver->getNumRows()) throw gcnew ArgumentException("The number of row names does not match the solver", "rowNames");
+
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			NativeNames nativeColumnNames(columnNames);
+			NativeNames nativeRowNames(rowNames);
+			bool hasNames = columnNames != nullptr && rowNames != nullptr;
+
+			// Empty name arrays are still valid names of a problem without columns or rows
+			static const char * const noNames[1] = { nullptr };
+			::SolutionFile::save(*solver->Base, charFileName,
+				hasNames ? (nativeColumnNames.size() > 0 ? nativeColumnNames.data() : noNames) : nullptr,
+				hasNames ? (nativeRowNames.size() > 0 ? nativeRowNames.data() : noNames) : nullptr);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+			GC::KeepAlive(solver);
+		}
+	}
+
+	bool SolutionFile::isSolutionFile(String ^ fileName)
+	{
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			return ::SolutionFile::isSolutionFile(charFileName);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+		}
+	}
+
+	void SolutionFile::read(String ^ fileName, OsiSolverInterface ^ solver)
+	{
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			Base->read(charFileName, *solver->Base);
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+			GC::KeepAlive(solver);
+		}
+	}
+
+	void SolutionFile::read(String ^ fileName, OsiSolverInterface ^ solver, array<String^>^ columnNames, array<String^>^ rowNames)
+	{
+		int numberColumns = solver->getNumCols();
+		int numberRows = solver->getNumRows();
+		if (columnNames != nullptr && columnNames->Length != numberColumns) throw gcnew ArgumentException("The number of column names does not match the solver", "columnNames");
+		if (rowNames != nullptr && rowNames->Length != numberRows) throw gcnew ArgumentException("The number of row names does not match the solver", "rowNames");
+
+		char * charFileName = (char*)Marshal::StringToHGlobalAnsi(fileName).ToPointer();
+		try
+		{
+			NativeNames nativeColumnNames(columnNames);
+			NativeNames nativeRowNames(rowNames);
+			bool hasNames = columnNames != nullptr && rowNames != nullptr;
+
+			static const char * const noNames[1] = { nullptr };
+			Base->read(charFileName, numberColumns, numberRows,
+				hasNames ? (nativeColumnNames.size() > 0 ? nativeColumnNames.data() : noNames) : nullptr,
+				hasNames ? (nativeRowNames.size() > 0 ? nativeRowNames.data() : noNames) : nullptr,
+				true, solver->Base->getColLower(), solver->Base->getColUpper());
+		}
+		catch (::CoinError err)
+		{
+			throw gcnew CoinError(err);
+		}
+		finally
+		{
+			Marshal::FreeHGlobal((IntPtr)charFileName);
+			GC::KeepAlive(solver);
+		}
+	}
+
+	array<double> ^ SolutionFile::getColSolution()
+	{
+		return ToArray(Base->getColSolution(), Base->getNumCols());
+	}
+
+	array<double> ^ SolutionFile::getRowPrice()
+	{
+		return ToArray(Base->getRowPrice(), Base->getNumRows());
+	}
+
+	CoinWarmStart ^ SolutionFile::getBasis()
+	{
+		const ::CoinWarmStartBasis *basis = Base->getBasis();
+		if (basis == nullptr) return nullptr;
+
+		CoinWarmStart ^ result = gcnew CoinWarmStart(basis->clone());
+		result->deleteBase = true;
+		return result;
+	}
+
+	array<double> ^ SolutionFile::ToArray(const double *values, int count)
+	{
+		array<double> ^ result = gcnew array<double>(count);
+		if (count > 0) Marshal::Copy((IntPtr)(void *)values, result, 0, count);
+		return result;
+	}
+}
@@ -0,0 +1,84 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "OsiSolverInterface.h"
+#include "CoinWarmStart.h"
+
+#include "SolutionFile.hpp"
+
+#include "CoinError.h"
+#include "Helpers.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace COIN
+{
+	/// Save and read a solution in a compact binary file: the column values, row prices, objective value and basis.
+	/// If the file has names, a solution can be read for a slightly changed problem, with the columns and rows matched by name.
+	/// Reading memory-maps the file. See SolutionFile.hpp.
+	public ref class SolutionFile : WrapperBase<::SolutionFile>
+	{
+	public:
+		/// The current version of the solution file format. Files of other versions cannot be read.
+		literal int Version = ::SolutionFile::Version;
+
+		SolutionFile() {}
+
+		/// Save the current solution and basis of the given solver to the given file, with the names of the solver if its name discipline is not 0.
+		/// Throws a CoinError if the file cannot be written.
+		static void save(OsiSolverInterface ^ solver, String ^ fileName);
+
+		/// Save the current solution and basis of the given solver to the given file, with the given names of the columns and rows.
+		/// Throws a CoinError if the file cannot be written.
+		static void save(OsiSolverInterface ^ solver, String ^ fileName, array<String^>^ columnNames, array<String^>^ rowNames);
+
+		/// Returns true iff the given file exists and starts with the solution file header (of any version).
+		static bool isSolutionFile(String ^ fileName);
+
+		/// Read the given solution file for the problem of the given solver, matched by the names of the solver if its name discipline is not 0,
+		/// and otherwise by index. Throws a CoinError if the file is not a valid solution file of the current version, or the checksum does not match.
+		void read(String ^ fileName, OsiSolverInterface ^ solver);
+
+		/// Read the given solution file for the problem of the given solver, matched by the given names of the columns and rows.
+		void read(String ^ fileName, OsiSolverInterface ^ solver, array<String^>^ columnNames, array<String^>^ rowNames);
+
+		/// Get the column values for the problem that was read. Columns that were not in the file have value 0.
+		array<double> ^ getColSolution();
+
+		/// Get the row prices for the problem that was read. Rows that were not in the file have price 0.
+		array<double> ^ getRowPrice();
+
+		/// Get the objective value that was saved.
+		double getObjValue()
+		{
+			return Base->getObjValue();
+		}
+
+		/// Returns true iff the file that was read has a basis.
+		bool hasBasis()
+		{
+			return Base->getBasis() != nullptr;
+		}
+
+		/// Get a copy of the basis (CoinWarmStartBasis) for the problem that was read, or null if the file has no basis.
+		CoinWarmStart ^ getBasis();
+
+		/// Get the number of columns of the problem that were found in the file.
+		int getNumberMatchedColumns()
+		{
+			return Base->getNumberMatchedColumns();
+		}
+
+		/// Get the number of rows of the problem that were found in the file.
+		int getNumberMatchedRows()
+		{
+			return Base->getNumberMatchedRows();
+		}
+
+	private:
+		static array<double> ^ ToArray(const double *values, int count);
+	};
+}
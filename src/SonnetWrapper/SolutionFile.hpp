@@ -0,0 +1,92 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+class OsiSolverInterface;
+class CoinWarmStartBasis;
+
+/** Native save and read of a solution in a compact binary file: the values of the columns, the prices
+	(duals) of the rows, the objective value and, if available, the basis, with the statuses packed at
+	2 bits per entry as in CoinWarmStartBasis.
+
+	If the file includes the column and row names, a solution can be read for a problem that changed
+	slightly since it was saved: the columns and rows are matched by name. Columns that are not in the
+	file get value 0 and status at lower bound, and rows that are not in the file get price 0 and a basic slack.
+	Then, as for ProblemPatch, the number of basic variables is restored to the number of rows if needed.
+	Without names, columns and rows are matched by index.
+
+	Reading memory-maps the file and maps all entries in a single pass, like ProblemSnapshot.
+	This class is compiled as native code (not /clr).
+*/
+class SolutionFile
+{
+public:
+	/// The current version of the solution file format. Files of other versions cannot be read.
+	static const unsigned int Version = 1;
+
+	/** Save the given solution of a problem with the given number of columns and rows to the given file.
+		The rowPrice, basis, columnNames and rowNames may be nullptr; the names are only saved if both are given.
+		Throws a CoinError if the file cannot be written, or the basis does not match the problem size. */
+	static void save(const char *filename, int numberColumns, int numberRows, const double *colSolution, const double *rowPrice,
+		const CoinWarmStartBasis *basis, double objectiveValue, const char *const *columnNames, const char *const *rowNames);
+
+	/** Save the current solution, row prices, objective value and basis (if its warm start is a CoinWarmStartBasis)
+		of the given solver to the given file. The given names are saved, or, if these are nullptr,
+		the names of the solver if its name discipline is not 0. */
+	static void save(const OsiSolverInterface &solver, const char *filename,
+		const char *const *columnNames = nullptr, const char *const *rowNames = nullptr);
+
+	/** Returns true iff the given file exists and starts with the solution file header (of any version). */
+	static bool isSolutionFile(const char *filename);
+
+	SolutionFile();
+	~SolutionFile();
+
+	/** Read the given solution file for a problem with the given number of columns and rows.
+		If the file has names and columnNames and rowNames are given, columns and rows are matched by name, and otherwise by index.
+		The column bounds, if given, determine the status of columns that are made nonbasic to repair the basis.
+		Throws a CoinError if the file cannot be opened, is not a solution file, is of another version,
+		or if the checksum does not match (unless verifyChecksum is false). */
+	void read(const char *filename, int numberColumns, int numberRows,
+		const char *const *columnNames, const char *const *rowNames, bool verifyChecksum = true,
+		const double *colLower = nullptr, const double *colUpper = nullptr);
+
+	/** Read the given solution file for the problem of the given solver, matched by
+		the names of the solver if its name discipline is not 0, and otherwise by index. */
+	void read(const char *filename, const OsiSolverInterface &solver, bool verifyChecksum = true);
+
+	/// Get the number of columns of the problem the solution was read for
+	int getNumCols() const { return static_cast<int>(colSolution_.size()); }
+	/// Get the number of rows of the problem the solution was read for
+	int getNumRows() const { return static_cast<int>(rowPrice_.size()); }
+
+	/// Get array[getNumCols()] of column values
+	const double *getColSolution() const { return colSolution_.data(); }
+	/// Get array[getNumRows()] of row prices
+	const double *getRowPrice() const { return rowPrice_.data(); }
+	/// Get the objective value that was saved
+	double getObjValue() const { return objectiveValue_; }
+
+	/// Get the basis for the problem, or nullptr if the file has no basis. The basis is owned by this object.
+	const CoinWarmStartBasis *getBasis() const { return basis_.get(); }
+
+	/// Get the number of columns of the problem that were found in the file
+	int getNumberMatchedColumns() const { return matchedColumns_; }
+	/// Get the number of rows of the problem that were found in the file
+	int getNumberMatchedRows() const { return matchedRows_; }
+
+private:
+	SolutionFile(const SolutionFile &);
+	SolutionFile &operator=(const SolutionFile &);
+
+	std::vector<double> colSolution_;
+	std::vector<double> rowPrice_;
+	std::unique_ptr<CoinWarmStartBasis> basis_;
+	double objectiveValue_;
+	int matchedColumns_;
+	int matchedRows_;
+};
@@ -0,0 +1,314 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native implementation of SolutionFile. This file is compiled without /clr, and as C++17 (std::string_view).
+
+#include "SolutionFile.hpp"
+#include "BinaryFile.hpp"
+#include "MappedFile.hpp"
+
+#include <CoinError.hpp>
+#include <CoinWarmStartBasis.hpp>
+#include <OsiSolverInterface.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace BinaryFile;
+
+namespace
+{
+	const char Magic[8] = { 'S', 'N', 'T', 'S', 'O', 'L', 'N', '\0' };
+
+	enum Flags
+	{
+		HasNames = 1,
+		HasBasis = 2
+	};
+
+	/// The fixed header at the start of a solution file. All sections that follow are padded to 8 bytes.
+	struct Header
+	{
+		char magic[8];
+		uint32_t version;
+		uint32_t byteOrderMark;
+		uint32_t flags;
+		int32_t numberColumns;
+		int32_t numberRows;
+		uint32_t reserved;
+		double objectiveValue;
+		uint64_t stringsSize;
+		uint64_t fileSize;
+		// The checksum of the header up to here, and of all sections. Must remain the last member.
+		uint64_t checksum;
+	};
+
+	static_assert(sizeof(Header) == 64 && offsetof(Header, checksum) % 8 == 0, "Unexpected solution file header layout");
+
+	/// Returns the names of the solver if its name discipline is not 0, or an empty vector otherwise.
+	std::vector<std::string> getNames(const OsiSolverInterface &solver, bool rows)
+	{
+		std::vector<std::string> result;
+		int nameDiscipline = 0;
+		solver.getIntParam(OsiNameDiscipline, nameDiscipline);
+		if (nameDiscipline == 0) return result;
+
+		int count = rows ? solver.getNumRows() : solver.getNumCols();
+		result.reserve(count);
+		for (int k = 0; k < count; k++) result.push_back(rows ? solver.getRowName(k) : solver.getColName(k));
+		return result;
+	}
+
+	std::vector<const char *> pointersOf(const std::vector<std::string> &names)
+	{
+		std::vector<const char *> result(names.size());
+		for (size_t k = 0; k < names.size(); k++) result[k] = names[k].c_str();
+		return result;
+	}
+
+	/// Maps the entries of the file to those of the problem. Returns the number of matched entries.
+	/// Without names (or with names of the file at position), entry k of the file maps to entry k of the problem.
+	int mapEntries(int fileCount, int count, const char *const *names, const char *&position, const char *end,
+		const SectionReader &reader, std::vector<int> &map)
+	{
+		map.assign(fileCount, -1);
+		int matched = 0;
+
+		if (names == nullptr || position == nullptr)
+		{
+			for (int k = 0; k < fileCount && k < count; k++, matched++) map[k] = k;
+			return matched;
+		}
+
+		std::unordered_map<std::string_view, int> indices;
+		indices.reserve(count);
+		for (int k = 0; k < count; k++) indices.emplace(names[k], k);
+
+		for (int k = 0; k < fileCount; k++)
+		{
+			const char *stringEnd = static_cast<const char *>(memchr(position, '\0', end - position));
+			if (stringEnd == nullptr) reader.nextString(position, end); // throws
+
+			auto found = indices.find(std::string_view(position, stringEnd - position));
+			if (found != indices.end())
+			{
+				map[k] = found->second;
+				matched++;
+			}
+			position = stringEnd + 1;
+		}
+		return matched;
+	}
+}
+
+void SolutionFile::save(const char *filename, int numberColumns, int numberRows, const double *colSolution, const double *rowPrice,
+	const CoinWarmStartBasis *basis, double objectiveValue, const char *const *columnNames, const char *const *rowNames)
+{
+	Header header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, Magic, sizeof(Magic));
+	header.version = Version;
+	header.byteOrderMark = ByteOrderMark;
+	header.numberColumns = numberColumns;
+	header.numberRows = numberRows;
+	header.objectiveValue = objectiveValue;
+
+	// Missing values are saved as zeros
+	std::vector<double> zeros;
+	if (colSolution == nullptr || rowPrice == nullptr) zeros.assign(std::max(numberColumns, numberRows), 0.0);
+
+	std::vector<Section> sections;
+	sections.push_back({ colSolution != nullptr ? colSolution : zeros.data(), numberColumns * sizeof(double) });
+	sections.push_back({ rowPrice != nullptr ? rowPrice : zeros.data(), numberRows * sizeof(double) });
+
+	if (basis != nullptr)
+	{
+		if (basis->getNumStructural() != numberColumns || basis->getNumArtificial() != numberRows)
+		{
+			throw CoinError("The basis does not match the number of columns and rows", "save", "SolutionFile");
+		}
+
+		header.flags |= HasBasis;
+		sections.push_back({ basis->getStructuralStatus(), basisStatusSize(numberColumns) });
+		sections.push_back({ basis->getArtificialStatus(), basisStatusSize(numberRows) });
+	}
+
+	std::string strings;
+	if (columnNames != nullptr && rowNames != nullptr)
+	{
+		header.flags |= HasNames;
+		for (int j = 0; j < numberColumns; j++) strings.append(columnNames[j] != nullptr ? columnNames[j] : "").push_back('\0');
+		for (int i = 0; i < numberRows; i++) strings.append(rowNames[i] != nullptr ? rowNames[i] : "").push_back('\0');
+	}
+
+	header.stringsSize = strings.size();
+	sections.push_back({ strings.data(), strings.size() });
+
+	header.fileSize = fileSize(sizeof(Header), sections);
+	header.checksum = checksumOf(&header, offsetof(Header, checksum), sections);
+
+	BinaryFile::write(filename, &header, sizeof(header), sections, "save", "SolutionFile");
+}
+
+void SolutionFile::save(const OsiSolverInterface &solver, const char *filename, const char *const *columnNames, const char *const *rowNames)
+{
+	std::vector<std::string> solverColumnNames;
+	std::vector<std::string> solverRowNames;
+	std::vector<const char *> columnPointers;
+	std::vector<const char *> rowPointers;
+	if (columnNames == nullptr || rowNames == nullptr)
+	{
+		solverColumnNames = getNames(solver, false);
+		solverRowNames = getNames(solver, true);
+		columnPointers = pointersOf(solverColumnNames);
+		rowPointers = pointersOf(solverRowNames);
+
+		bool hasNames = !solverColumnNames.empty() || !solverRowNames.empty();
+		columnNames = hasNames ? columnPointers.data() : nullptr;
+		rowNames = hasNames ? rowPointers.data() : nullptr;
+	}
+
+	std::unique_ptr<CoinWarmStart> warmStart(solver.getWarmStart());
+	const CoinWarmStartBasis *basis = dynamic_cast<const CoinWarmStartBasis *>(warmStart.get());
+	if (basis != nullptr && (basis->getNumStructural() != solver.getNumCols() || basis->getNumArtificial() != solver.getNumRows())) basis = nullptr;
+
+	save(filename, solver.getNumCols(), solver.getNumRows(), solver.getColSolution(), solver.getRowPrice(),
+		basis, solver.getObjValue(), columnNames, rowNames);
+}
+
+bool SolutionFile::isSolutionFile(const char *filename)
+{
+	return hasMagic(filename, Magic, sizeof(Magic));
+}
+
+SolutionFile::SolutionFile()
+	: objectiveValue_(0.0), matchedColumns_(0), matchedRows_(0)
+{
+}
+
+SolutionFile::~SolutionFile()
+{
+}
+
+void SolutionFile::read(const char *filename, int numberColumns, int numberRows,
+	const char *const *columnNames, const char *const *rowNames, bool verifyChecksum, const double *colLower, const double *colUpper)
+{
+	MappedFile file(filename, "read", "SolutionFile");
+	const char *data = file.data();
+	const char *end = data + file.size();
+
+	if (file.size() < sizeof(Header) || memcmp(data, Magic, sizeof(Magic)) != 0)
+	{
+		throw CoinError(std::string("Not a solution file: ") + filename, "read", "SolutionFile");
+	}
+
+	// The mapping is page-aligned, so the header and sections can be used in place
+	const Header &header = *reinterpret_cast<const Header *>(data);
+	if (header.version != Version)
+	{
+		throw CoinError("Solution file " + std::string(filename) + " has version " + std::to_string(header.version) +
+			", but only version " + std::to_string(Version) + " is supported", "read", "SolutionFile");
+	}
+	if (header.byteOrderMark != ByteOrderMark)
+	{
+		throw CoinError(std::string("Solution file was created on an incompatible platform: ") + filename, "read", "SolutionFile");
+	}
+	if (header.fileSize != file.size() || header.numberColumns < 0 || header.numberRows < 0)
+	{
+		throw CoinError(std::string("Solution file is truncated or corrupt: ") + filename, "read", "SolutionFile");
+	}
+	if (verifyChecksum)
+	{
+		Checksum checksum;
+		checksum.add(data, offsetof(Header, checksum));
+		checksum.add(data + sizeof(Header), file.size() - sizeof(Header));
+		if (checksum.value() != header.checksum) throw CoinError(std::string("Solution file checksum mismatch: ") + filename, "read", "SolutionFile");
+	}
+
+	const int fileColumns = header.numberColumns;
+	const int fileRows = header.numberRows;
+
+	SectionReader reader(data + sizeof(Header), end, "read", "SolutionFile");
+	const double *colSolution = reader.next<double>(fileColumns);
+	const double *rowPrice = reader.next<double>(fileRows);
+	const char *structuralStatus = nullptr;
+	const char *artificialStatus = nullptr;
+	if (header.flags & HasBasis)
+	{
+		structuralStatus = reader.next<char>(basisStatusSize(fileColumns));
+		artificialStatus = reader.next<char>(basisStatusSize(fileRows));
+	}
+	const char *strings = reader.next<char>(header.stringsSize);
+	const char *stringsEnd = strings + header.stringsSize;
+
+	// Match by name only if both the file and the problem have names
+	bool byName = (header.flags & HasNames) && columnNames != nullptr && rowNames != nullptr;
+	const char *position = byName ? strings : nullptr;
+
+	std::vector<int> columnMap;
+	std::vector<int> rowMap;
+	matchedColumns_ = mapEntries(fileColumns, numberColumns, byName ? columnNames : nullptr, position, stringsEnd, reader, columnMap);
+	matchedRows_ = mapEntries(fileRows, numberRows, byName ? rowNames : nullptr, position, stringsEnd, reader, rowMap);
+
+	objectiveValue_ = header.objectiveValue;
+	colSolution_.assign(numberColumns, 0.0);
+	rowPrice_.assign(numberRows, 0.0);
+	for (int j = 0; j < fileColumns; j++)
+	{
+		if (columnMap[j] >= 0) colSolution_[columnMap[j]] = colSolution[j];
+	}
+	for (int i = 0; i < fileRows; i++)
+	{
+		if (rowMap[i] >= 0) rowPrice_[rowMap[i]] = rowPrice[i];
+	}
+
+	basis_.reset();
+	if (structuralStatus != nullptr)
+	{
+		bool identity = !byName && fileColumns == numberColumns && fileRows == numberRows;
+		if (identity)
+		{
+			// The packed statuses can be used as they are
+			basis_.reset(new CoinWarmStartBasis(numberColumns, numberRows, structuralStatus, artificialStatus));
+		}
+		else
+		{
+			basis_.reset(new CoinWarmStartBasis());
+			basis_->setSize(numberColumns, numberRows);
+			for (int j = 0; j < numberColumns; j++) basis_->setStructStatus(j, CoinWarmStartBasis::atLowerBound);
+			for (int i = 0; i < numberRows; i++) basis_->setArtifStatus(i, CoinWarmStartBasis::basic);
+
+			for (int j = 0; j < fileColumns; j++)
+			{
+				if (columnMap[j] >= 0) basis_->setStructStatus(columnMap[j], getStatus(structuralStatus, j));
+			}
+			for (int i = 0; i < fileRows; i++)
+			{
+				if (rowMap[i] >= 0) basis_->setArtifStatus(rowMap[i], getStatus(artificialStatus, i));
+			}
+
+			// Columns or rows that were not matched can leave too few or too many basic variables, as after a patch
+			repairBasis(*basis_, colLower, colUpper);
+		}
+	}
+}
+
+void SolutionFile::read(const char *filename, const OsiSolverInterface &solver, bool verifyChecksum)
+{
+	std::vector<std::string> columnNames = getNames(solver, false);
+	std::vector<std::string> rowNames = getNames(solver, true);
+	std::vector<const char *> columnPointers = pointersOf(columnNames);
+	std::vector<const char *> rowPointers = pointersOf(rowNames);
+
+	// With name discipline 1 (lazy), names may be missing, so then match by index
+	bool hasNames = static_cast<int>(columnNames.size()) == solver.getNumCols() && static_cast<int>(rowNames.size()) == solver.getNumRows();
+	read(filename, solver.getNumCols(), solver.getNumRows(),
+		hasNames ? columnPointers.data() : nullptr, hasNames ? rowPointers.data() : nullptr, verifyChecksum, solver.getColLower(), solver.getColUpper());
+}
@@ -0,0 +1,27 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include "TransitionCounters.h"
+
+#include <vector>
+
+using namespace System;
+
+namespace COIN
+{
+	array<TransitionCounter>^ TransitionCounters::getCounters()
+	{
+		std::vector<::TransitionCounters::Counter> counters;
+		int n = ::TransitionCounters::getCounters(counters);
+
+		array<TransitionCounter>^ result = gcnew array<TransitionCounter>(n);
+		for (int i = 0; i < n; i++)
+		{
+			result[i].Name = gcnew String(counters[i].name.c_str());
+			result[i].Calls = counters[i].calls;
+			result[i].Bytes = counters[i].bytes;
+			result[i].Seconds = counters[i].nanoseconds * 1e-9;
+		}
+		return result;
+	}
+}
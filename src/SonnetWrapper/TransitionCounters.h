@@ -0,0 +1,61 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include "TransitionCounters.hpp"
+
+// Define SONNET_TRANSITION_COUNTERS (C/C++ > Preprocessor) to count the calls, bytes marshalled and time
+// of the instrumented wrapper methods and proxies. Otherwise the instrumentation compiles to nothing.
+#ifdef SONNET_TRANSITION_COUNTERS
+/// Count the call of the enclosing method, until the end of the scope.
+#define SONNET_TRANSITION() ::TransitionScope transitionScope_(__FUNCTION__)
+/// Add the given number of bytes marshalled to the call counted by SONNET_TRANSITION in the same scope.
+#define SONNET_TRANSITION_BYTES(bytes) transitionScope_.addBytes(bytes)
+#else
+#define SONNET_TRANSITION() ((void)0)
+#define SONNET_TRANSITION_BYTES(bytes) ((void)0)
+#endif
+
+using namespace System;
+
+namespace COIN
+{
+	/// The counts of the transitions between managed and native code of a wrapper method.
+	public value struct TransitionCounter
+	{
+		/// The name of the wrapper method, like COIN::OsiSolverInterface::setColLower.
+		String^ Name;
+		long long Calls;
+		long long Bytes;
+		double Seconds;
+	};
+
+	/// The counters of the transitions between managed and native code, by wrapper method, merged over all threads.
+	/// Only counted if SonnetWrapper is built with SONNET_TRANSITION_COUNTERS defined, see IsEnabled.
+	public ref class TransitionCounters abstract sealed
+	{
+	public:
+		/// Returns true iff SonnetWrapper was built with SONNET_TRANSITION_COUNTERS defined.
+		static property bool IsEnabled
+		{
+			bool get()
+			{
+#ifdef SONNET_TRANSITION_COUNTERS
+				return true;
+#else
+				return false;
+#endif
+			}
+		}
+
+		/// Get the counters of all threads, merged by method, ordered by name.
+		static array<TransitionCounter>^ getCounters();
+
+		/// Set all counters to zero.
+		static void reset()
+		{
+			::TransitionCounters::reset();
+		}
+	};
+}
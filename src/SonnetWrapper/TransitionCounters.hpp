@@ -0,0 +1,70 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+/** Counters of the transitions between managed and native code, by wrapper method: the number of calls,
+	the number of bytes marshalled, and the time spent. Each thread counts in its own table, so counting does not
+	contend between threads. getCounters merges the tables of all threads, including the threads that ended.
+
+	The wrapper methods only count if SONNET_TRANSITION_COUNTERS is defined (see TransitionCounters.h);
+	otherwise nothing is recorded, and the instrumentation compiles to nothing.
+
+	This class is compiled as native code (not /clr) to be able to use thread_local, std::mutex and std::chrono.
+*/
+class TransitionCounters
+{
+public:
+	/// The merged counts of a wrapper method
+	struct Counter
+	{
+		std::string name;
+		long long calls;
+		long long bytes;
+		long long nanoseconds;
+	};
+
+	/// Add a call of the given method to the counters of this thread. The name must be a string literal, like __FUNCTION__.
+	static void record(const char *name, long long bytes, long long nanoseconds);
+
+	/// Merge the counters of all threads by method name, and append them to the given vector. Returns the number of methods.
+	static int getCounters(std::vector<Counter> &counters);
+
+	/// Set all counters of all threads to zero.
+	static void reset();
+
+	/// The current time of a steady clock, in nanoseconds
+	static long long now();
+};
+
+/// Counts a call of the enclosing wrapper method from construction until destruction, see SONNET_TRANSITION.
+class TransitionScope
+{
+public:
+	explicit TransitionScope(const char *name)
+		: name(name), bytes(0), start(TransitionCounters::now())
+	{
+	}
+
+	~TransitionScope()
+	{
+		TransitionCounters::record(name, bytes, TransitionCounters::now() - start);
+	}
+
+	/// Add the given number of bytes marshalled by the call
+	void addBytes(long long value)
+	{
+		bytes += value;
+	}
+
+private:
+	TransitionScope(const TransitionScope &);
+	TransitionScope &operator=(const TransitionScope &);
+
+	const char *name;
+	long long bytes;
+	long long start;
+};
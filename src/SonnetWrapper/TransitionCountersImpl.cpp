@@ -0,0 +1,165 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native implementation of TransitionCounters, compiled without /clr (see TransitionCounters.hpp)
+
+#include "TransitionCounters.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+	struct Entry
+	{
+		long long calls = 0;
+		long long bytes = 0;
+		long long nanoseconds = 0;
+
+		void add(const Entry &rhs)
+		{
+			calls += rhs.calls;
+			bytes += rhs.bytes;
+			nanoseconds += rhs.nanoseconds;
+		}
+	};
+
+	struct StringLess
+	{
+		bool operator()(const char *a, const char *b) const { return strcmp(a, b) < 0; }
+	};
+
+	typedef std::map<const char *, Entry, StringLess> MergedEntries;
+
+	class ThreadTable;
+
+	/// All tables of the live threads, and the merged entries of the threads that ended
+	class Registry
+	{
+	public:
+		static Registry &instance()
+		{
+			// Never destroyed, since thread tables may unregister during the shutdown of the process
+			static Registry *registry = new Registry();
+			return *registry;
+		}
+
+		void add(ThreadTable *table)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			tables.push_back(table);
+		}
+
+		void remove(ThreadTable *table);
+		void merge(MergedEntries &merged);
+		void reset();
+
+	private:
+		std::mutex mutex;
+		std::vector<ThreadTable *> tables;
+		MergedEntries ended;
+	};
+
+	/// The counters of one thread, keyed by the address of the name literal. The mutex is only contended while merging.
+	class ThreadTable
+	{
+	public:
+		ThreadTable()
+		{
+			Registry::instance().add(this);
+		}
+
+		~ThreadTable()
+		{
+			Registry::instance().remove(this);
+		}
+
+		void record(const char *name, long long bytes, long long nanoseconds)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			Entry &entry = entries[name];
+			entry.calls++;
+			entry.bytes += bytes;
+			entry.nanoseconds += nanoseconds;
+		}
+
+		void mergeInto(MergedEntries &merged)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			for (const auto &pair : entries) merged[pair.first].add(pair.second);
+		}
+
+		void reset()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			entries.clear();
+		}
+
+	private:
+		std::mutex mutex;
+		std::unordered_map<const char *, Entry> entries;
+	};
+
+	void Registry::remove(ThreadTable *table)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		table->mergeInto(ended);
+		tables.erase(std::remove(tables.begin(), tables.end(), table), tables.end());
+	}
+
+	void Registry::merge(MergedEntries &merged)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (const auto &pair : ended) merged[pair.first].add(pair.second);
+		for (ThreadTable *table : tables) table->mergeInto(merged);
+	}
+
+	void Registry::reset()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		ended.clear();
+		for (ThreadTable *table : tables) table->reset();
+	}
+
+	ThreadTable &threadTable()
+	{
+		thread_local ThreadTable table;
+		return table;
+	}
+}
+
+void TransitionCounters::record(const char *name, long long bytes, long long nanoseconds)
+{
+	threadTable().record(name, bytes, nanoseconds);
+}
+
+int TransitionCounters::getCounters(std::vector<Counter> &counters)
+{
+	MergedEntries merged;
+	Registry::instance().merge(merged);
+
+	for (const auto &pair : merged)
+	{
+		Counter counter;
+		counter.name = pair.first;
+		counter.calls = pair.second.calls;
+		counter.bytes = pair.second.bytes;
+		counter.nanoseconds = pair.second.nanoseconds;
+		counters.push_back(counter);
+	}
+	return static_cast<int>(merged.size());
+}
+
+void TransitionCounters::reset()
+{
+	Registry::instance().reset();
+}
+
+long long TransitionCounters::now()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,71 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// A single benchmark: the Run action is timed, while Setup and Cleanup are executed around every run, but are not timed.
+    /// State between the actions is shared via captured variables.
+    /// </summary>
+    public class BenchmarkCase
+    {
+        /// <summary>
+        /// Create a new benchmark case.
+        /// </summary>
+        /// <param name="name">The unique name of the case, like "mps/brandy/Generate".</param>
+        /// <param name="run">The action to time.</param>
+        /// <param name="setup">The action to execute before every run, or null.</param>
+        /// <param name="cleanup">The action to execute after every run, or null.</param>
+        public BenchmarkCase(string name, Action run, Action setup = null, Action cleanup = null)
+        {
+            if (string.IsNullOrEmpty(name)) throw new ArgumentException("A benchmark case needs a name", nameof(name));
+            if (run == null) throw new ArgumentNullException(nameof(run));
+
+            Name = name;
+            Run = run;
+            Setup = setup;
+            Cleanup = cleanup;
+            Properties = new Dictionary<string, double>();
+        }
+
+        /// <summary>
+        /// Gets the unique name of the case.
+        /// </summary>
+        public string Name { get; private set; }
+
+        /// <summary>
+        /// Gets the action to time.
+        /// </summary>
+        public Action Run { get; private set; }
+
+        /// <summary>
+        /// Gets the action to execute before every run, or null.
+        /// </summary>
+        public Action Setup { get; private set; }
+
+        /// <summary>
+        /// Gets the action to execute after every run, or null.
+        /// </summary>
+        public Action Cleanup { get; private set; }
+
+        /// <summary>
+        /// Gets the properties of the case, like the number of nonzeros, which are copied to the result.
+        /// The actions can set properties; they are copied after the last iteration.
+        /// </summary>
+        public Dictionary<string, double> Properties { get; private set; }
+
+        /// <summary>
+        /// Gets whether the current iteration is a warmup iteration, whose measurements are discarded.
+        /// The actions can use this to only record their own measurements of the measured iterations.
+        /// </summary>
+        public bool IsWarmup { get; internal set; }
+
+        public override string ToString()
+        {
+            return Name;
+        }
+    }
+}
@@ -0,0 +1,252 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// The comparison of one metric of one benchmark case between a baseline and a current run.
+    /// </summary>
+    public class MetricComparison
+    {
+        public string Name { get; set; }
+        /// <summary>
+        /// Gets or sets the metric: "time", "allocated", "native" or "peak".
+        /// </summary>
+        public string Metric { get; set; }
+        public double BaselineMedian { get; set; }
+        public double CurrentMedian { get; set; }
+        /// <summary>
+        /// Gets or sets the p-value of the one-sided Mann-Whitney test in the direction of the change of the median
+        /// (for an increase, that the current values are larger than the baseline values), or NaN for a metric with a single value per case.
+        /// </summary>
+        public double PValue { get; set; }
+        public bool IsRegression { get; set; }
+        public bool IsImprovement { get; set; }
+
+        /// <summary>
+        /// Gets the relative change of the median, like 0.1 for 10% slower.
+        /// </summary>
+        public double Change { get { return BaselineMedian != 0.0 ? CurrentMedian / BaselineMedian - 1.0 : 0.0; } }
+    }
+
+    /// <summary>
+    /// Compares the results of a benchmark run with a baseline, to detect performance regressions mechanically.
+    /// A metric of a case regresses if its median increased by more than the threshold, and the increase is significant
+    /// according to the Mann-Whitney U test on the measured iterations. The peak working set has one value per case,
+    /// so there only the threshold is applied. Tiny absolute differences are ignored, since these are mostly noise.
+    /// </summary>
+    public class BenchmarkComparison
+    {
+        /// <summary>
+        /// Differences of the median time below this number of seconds are ignored.
+        /// </summary>
+        private const double MinimumSeconds = 50e-6;
+        /// <summary>
+        /// Differences of the median allocated bytes below this number of bytes are ignored.
+        /// </summary>
+        private const double MinimumAllocatedBytes = 1024.0;
+        /// <summary>
+        /// Differences of the native memory and peak working set below this number of bytes are ignored (page granularity).
+        /// </summary>
+        private const double MinimumMemoryBytes = 64.0 * 1024.0;
+
+        /// <summary>
+        /// Create a new comparison with the given thresholds.
+        /// </summary>
+        /// <param name="timeThreshold">The relative increase of the median time that is a regression, like 0.1 for 10%.</param>
+        /// <param name="memoryThreshold">The relative increase of the allocated bytes, native memory or peak working set that is a regression.</param>
+        /// <param name="alpha">The significance level of the Mann-Whitney test.</param>
+        public BenchmarkComparison(double timeThreshold, double memoryThreshold, double alpha)
+        {
+            if (timeThreshold < 0.0) throw new ArgumentOutOfRangeException(nameof(timeThreshold));
+            if (memoryThreshold < 0.0) throw new ArgumentOutOfRangeException(nameof(memoryThreshold));
+            if (alpha <= 0.0 || alpha >= 1.0) throw new ArgumentOutOfRangeException(nameof(alpha));
+
+            TimeThreshold = timeThreshold;
+            MemoryThreshold = memoryThreshold;
+            Alpha = alpha;
+            Comparisons = new List<MetricComparison>();
+            MissingCases = new List<string>();
+            NewCases = new List<string>();
+            Warnings = new List<string>();
+        }
+
+        public double TimeThreshold { get; private set; }
+        public double MemoryThreshold { get; private set; }
+        public double Alpha { get; private set; }
+
+        /// <summary>
+        /// Gets the comparisons of all metrics of the cases that are both in the baseline and in the current run.
+        /// </summary>
+        public List<MetricComparison> Comparisons { get; private set; }
+        /// <summary>
+        /// Gets the names of the cases of the baseline that are not in the current run.
+        /// </summary>
+        public List<string> MissingCases { get; private set; }
+        /// <summary>
+        /// Gets the names of the cases of the current run that are not in the baseline.
+        /// </summary>
+        public List<string> NewCases { get; private set; }
+        /// <summary>
+        /// Gets the warnings about the comparability of the runs, like a different machine.
+        /// </summary>
+        public List<string> Warnings { get; private set; }
+
+        public IEnumerable<MetricComparison> Regressions { get { return Comparisons.Where(c => c.IsRegression); } }
+        public IEnumerable<MetricComparison> Improvements { get { return Comparisons.Where(c => c.IsImprovement); } }
+        public bool HasRegressions { get { return Comparisons.Any(c => c.IsRegression); } }
+
+        /// <summary>
+        /// Compare the current report with the baseline report.
+        /// </summary>
+        /// <param name="baseline">The baseline report.</param>
+        /// <param name="current">The current report.</param>
+        public void Compare(BenchmarkReport baseline, BenchmarkReport current)
+        {
+            if (baseline == null) throw new ArgumentNullException(nameof(baseline));
+            if (current == null) throw new ArgumentNullException(nameof(current));
+
+            CheckEnvironment(baseline, current);
+
+            Dictionary<string, BenchmarkResult> baselineResults = baseline.Results.ToDictionary(r => r.Name);
+            HashSet<string> currentNames = new HashSet<string>(current.Results.Select(r => r.Name));
+            MissingCases.AddRange(baseline.Results.Select(r => r.Name).Where(name => !currentNames.Contains(name)));
+
+            foreach (BenchmarkResult result in current.Results)
+            {
+                if (!baselineResults.TryGetValue(result.Name, out BenchmarkResult baselineResult))
+                {
+                    NewCases.Add(result.Name);
+                    continue;
+                }
+
+                CompareSamples(result.Name, "time", baselineResult.Seconds, result.Seconds, TimeThreshold, MinimumSeconds);
+                CompareSamples(result.Name, "allocated", ToDouble(baselineResult.AllocatedBytes), ToDouble(result.AllocatedBytes), MemoryThreshold, MinimumAllocatedBytes);
+                CompareSamples(result.Name, "native", ToDouble(baselineResult.NativeBytes), ToDouble(result.NativeBytes), MemoryThreshold, MinimumMemoryBytes);
+                CompareValues(result.Name, "peak", baselineResult.PeakWorkingSetBytes, result.PeakWorkingSetBytes, MemoryThreshold, MinimumMemoryBytes);
+            }
+
+            CompareValues("(run)", "peak", baseline.PeakWorkingSetBytes, current.PeakWorkingSetBytes, MemoryThreshold, MinimumMemoryBytes);
+        }
+
+        private void CheckEnvironment(BenchmarkReport baseline, BenchmarkReport current)
+        {
+            if (baseline.MachineName != current.MachineName || baseline.ProcessorCount != current.ProcessorCount ||
+                baseline.OSDescription != current.OSDescription || baseline.ProcessArchitecture != current.ProcessArchitecture)
+            {
+                Warnings.Add(string.Format("The baseline was measured on {0} ({1}, {2}, {3} processors), the current run on {4} ({5}, {6}, {7} processors); times may not be comparable.",
+                    baseline.MachineName, baseline.OSDescription, baseline.ProcessArchitecture, baseline.ProcessorCount,
+                    current.MachineName, current.OSDescription, current.ProcessArchitecture, current.ProcessorCount));
+            }
+
+            if (baseline.FrameworkDescription != current.FrameworkDescription)
+            {
+                Warnings.Add(string.Format("The baseline was measured with {0}, the current run with {1}.", baseline.FrameworkDescription, current.FrameworkDescription));
+            }
+
+            // With too few iterations, no difference can be significant: the smallest p-value of the exact test is 1 / C(m + n, m)
+            int m = baseline.Results.Count > 0 ? baseline.Results.Min(r => r.Seconds.Length) : 0;
+            int n = current.Results.Count > 0 ? current.Results.Min(r => r.Seconds.Length) : 0;
+            if (m > 0 && n > 0 && Statistics.MannWhitneyGreater(Enumerable.Range(0, m).Select(i => (double)i).ToArray(),
+                Enumerable.Range(m, n).Select(i => (double)i).ToArray()) >= Alpha)
+            {
+                Warnings.Add(string.Format("With {0} baseline and {1} current iterations, no difference is significant at alpha {2}; use more iterations.", m, n, Alpha));
+            }
+        }
+
+        private void CompareSamples(string name, string metric, double[] baselineValues, double[] currentValues, double threshold, double minimumDifference)
+        {
+            if (baselineValues == null || currentValues == null || baselineValues.Length == 0 || currentValues.Length == 0) return;
+
+            MetricComparison comparison = new MetricComparison()
+            {
+                Name = name,
+                Metric = metric,
+                BaselineMedian = Statistics.Median(baselineValues),
+                CurrentMedian = Statistics.Median(currentValues),
+            };
+
+            double difference = comparison.CurrentMedian - comparison.BaselineMedian;
+            comparison.PValue = difference >= 0.0 ? Statistics.MannWhitneyGreater(baselineValues, currentValues) :
+                Statistics.MannWhitneyGreater(currentValues, baselineValues);
+            if (Math.Abs(difference) >= minimumDifference && Math.Abs(difference) > threshold * Math.Abs(comparison.BaselineMedian))
+            {
+                comparison.IsRegression = difference > 0.0 && comparison.PValue < Alpha;
+                comparison.IsImprovement = difference < 0.0 && comparison.PValue < Alpha;
+            }
+
+            Comparisons.Add(comparison);
+        }
+
+        private void CompareValues(string name, string metric, double baselineValue, double currentValue, double threshold, double minimumDifference)
+        {
+            if (baselineValue <= 0.0 || currentValue <= 0.0) return;
+
+            MetricComparison comparison = new MetricComparison()
+            {
+                Name = name,
+                Metric = metric,
+                BaselineMedian = baselineValue,
+                CurrentMedian = currentValue,
+                PValue = double.NaN,
+            };
+
+            double difference = currentValue - baselineValue;
+            if (Math.Abs(difference) >= minimumDifference && Math.Abs(difference) > threshold * baselineValue)
+            {
+                comparison.IsRegression = difference > 0.0;
+                comparison.IsImprovement = difference < 0.0;
+            }
+
+            Comparisons.Add(comparison);
+        }
+
+        private static double[] ToDouble(long[] values)
+        {
+            return values == null ? null : values.Select(v => (double)v).ToArray();
+        }
+
+        /// <summary>
+        /// Write the warnings, the regressions and improvements, and the cases that could not be compared.
+        /// </summary>
+        /// <param name="writer">The writer to write to.</param>
+        public void WriteSummary(TextWriter writer)
+        {
+            foreach (string warning in Warnings) writer.WriteLine("Warning: " + warning);
+            if (Warnings.Count > 0) writer.WriteLine();
+
+            List<MetricComparison> flagged = Comparisons.Where(c => c.IsRegression || c.IsImprovement).ToList();
+            if (flagged.Count > 0)
+            {
+                int width = Math.Max(20, flagged.Max(c => c.Name.Length));
+                writer.WriteLine("{0} {1,-10} {2,14} {3,14} {4,9} {5,9}  {6}", "Name".PadRight(width), "Metric", "Baseline", "Current", "Change %", "p-value", "");
+                foreach (MetricComparison comparison in flagged.OrderBy(c => c.IsImprovement))
+                {
+                    writer.WriteLine("{0} {1,-10} {2,14} {3,14} {4,9:F1} {5,9}  {6}", comparison.Name.PadRight(width), comparison.Metric,
+                        Format(comparison.Metric, comparison.BaselineMedian), Format(comparison.Metric, comparison.CurrentMedian),
+                        100.0 * comparison.Change, double.IsNaN(comparison.PValue) ? "-" : comparison.PValue.ToString("G2"),
+                        comparison.IsRegression ? "REGRESSION" : "improvement");
+                }
+                writer.WriteLine();
+            }
+
+            if (MissingCases.Count > 0) writer.WriteLine("Not in the current run: " + string.Join(", ", MissingCases));
+            if (NewCases.Count > 0) writer.WriteLine("Not in the baseline: " + string.Join(", ", NewCases));
+
+            writer.WriteLine("Compared {0} metrics of {1} cases (time threshold {2:P0}, memory threshold {3:P0}, alpha {4}): {5} regressions, {6} improvements.",
+                Comparisons.Count, Comparisons.Select(c => c.Name).Distinct().Count(), TimeThreshold, MemoryThreshold, Alpha,
+                Regressions.Count(), Improvements.Count());
+        }
+
+        private static string Format(string metric, double value)
+        {
+            if (metric == "time") return (1000.0 * value).ToString("F3") + " ms";
+            return (value / 1024.0).ToString("F1") + " KB";
+        }
+    }
+}
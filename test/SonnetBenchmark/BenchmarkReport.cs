@@ -0,0 +1,237 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text.Json;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// The measurements of a single benchmark case.
+    /// All per-iteration values are stored, such that runs can be compared statistically.
+    /// </summary>
+    public class BenchmarkResult
+    {
+        /// <summary>
+        /// Gets or sets the name of the case, like "mps/brandy/Generate".
+        /// </summary>
+        public string Name { get; set; }
+
+        /// <summary>
+        /// Gets or sets the number of warmup iterations, which are not included in the samples.
+        /// </summary>
+        public int WarmupIterations { get; set; }
+
+        /// <summary>
+        /// Gets or sets the wall-clock time of each measured iteration, in seconds.
+        /// </summary>
+        public double[] Seconds { get; set; }
+
+        /// <summary>
+        /// Gets or sets the managed bytes allocated (by all threads) during each measured iteration.
+        /// </summary>
+        public long[] AllocatedBytes { get; set; }
+
+        /// <summary>
+        /// Gets or sets the growth of the native memory (private bytes not committed by the GC) during each measured iteration.
+        /// This includes the memory of the COIN-OR solvers, and of the managed wrappers, until they are cleaned up.
+        /// </summary>
+        public long[] NativeBytes { get; set; }
+
+        /// <summary>
+        /// Gets or sets the maximum working set of the process right after a measured iteration.
+        /// </summary>
+        public long PeakWorkingSetBytes { get; set; }
+
+        /// <summary>
+        /// Gets or sets the number of gen 0, 1 and 2 garbage collections during all measured iterations.
+        /// </summary>
+        public int[] Collections { get; set; }
+
+        /// <summary>
+        /// Gets or sets the properties of the case, like the number of nonzeros.
+        /// </summary>
+        public Dictionary<string, double> Properties { get; set; }
+
+        /// <summary>
+        /// Gets the median time of the measured iterations, in seconds.
+        /// </summary>
+        public double MedianSeconds { get { return Statistics.Median(Seconds); } }
+
+        /// <summary>
+        /// Gets the minimum time of the measured iterations, in seconds.
+        /// </summary>
+        public double MinSeconds { get { return Seconds.Length > 0 ? Seconds.Min() : double.NaN; } }
+
+        /// <summary>
+        /// Gets the mean time of the measured iterations, in seconds.
+        /// </summary>
+        public double MeanSeconds { get { return Statistics.Mean(Seconds); } }
+
+        /// <summary>
+        /// Gets the standard deviation of the time of the measured iterations, in seconds.
+        /// </summary>
+        public double StdDevSeconds { get { return Statistics.StandardDeviation(Seconds); } }
+
+        /// <summary>
+        /// Gets the median number of managed bytes allocated per iteration.
+        /// </summary>
+        public double MedianAllocatedBytes { get { return Statistics.Median(AllocatedBytes.Select(b => (double)b).ToArray()); } }
+
+        /// <summary>
+        /// Gets the median native memory growth per iteration, in bytes.
+        /// </summary>
+        public double MedianNativeBytes { get { return Statistics.Median(NativeBytes.Select(b => (double)b).ToArray()); } }
+    }
+
+    /// <summary>
+    /// The results of a benchmark run, with the environment in which they were measured.
+    /// Written and read as JSON.
+    /// </summary>
+    public class BenchmarkReport
+    {
+        /// <summary>
+        /// The version of the report format.
+        /// </summary>
+        public const int CurrentFormatVersion = 1;
+
+        private static readonly JsonSerializerOptions jsonOptions = new JsonSerializerOptions()
+        {
+            WriteIndented = true,
+            PropertyNamingPolicy = JsonNamingPolicy.CamelCase,
+            NumberHandling = System.Text.Json.Serialization.JsonNumberHandling.AllowNamedFloatingPointLiterals,
+        };
+
+        public BenchmarkReport()
+        {
+            FormatVersion = CurrentFormatVersion;
+            Results = new List<BenchmarkResult>();
+        }
+
+        public int FormatVersion { get; set; }
+        public DateTime Timestamp { get; set; }
+        public string MachineName { get; set; }
+        public string OSDescription { get; set; }
+        public string FrameworkDescription { get; set; }
+        public string ProcessArchitecture { get; set; }
+        public int ProcessorCount { get; set; }
+        public string SonnetVersion { get; set; }
+        public string CommandLine { get; set; }
+
+        /// <summary>
+        /// Gets or sets the peak working set of the process at the end of the run.
+        /// </summary>
+        public long PeakWorkingSetBytes { get; set; }
+
+        public List<BenchmarkResult> Results { get; set; }
+
+        /// <summary>
+        /// Create a new report with the current environment filled in.
+        /// </summary>
+        /// <param name="args">The command line arguments of the run.</param>
+        /// <returns>The new report.</returns>
+        public static BenchmarkReport New(string[] args)
+        {
+            BenchmarkReport report = new BenchmarkReport();
+            report.Timestamp = DateTime.UtcNow;
+            report.MachineName = Environment.MachineName;
+            report.OSDescription = System.Runtime.InteropServices.RuntimeInformation.OSDescription;
+            report.FrameworkDescription = System.Runtime.InteropServices.RuntimeInformation.FrameworkDescription;
+            report.ProcessArchitecture = System.Runtime.InteropServices.RuntimeInformation.ProcessArchitecture.ToString();
+            report.ProcessorCount = Environment.ProcessorCount;
+            report.SonnetVersion = Sonnet.Solver.Version.ToString();
+            report.CommandLine = string.Join(" ", args);
+            return report;
+        }
+
+        /// <summary>
+        /// Write this report as JSON to the given file.
+        /// </summary>
+        /// <param name="fileName">The name of the file to write.</param>
+        public void Write(string fileName)
+        {
+            File.WriteAllText(fileName, JsonSerializer.Serialize(this, jsonOptions));
+        }
+
+        /// <summary>
+        /// Read a report from the given JSON file.
+        /// </summary>
+        /// <param name="fileName">The name of the file to read.</param>
+        /// <returns>The report read.</returns>
+        public static BenchmarkReport Read(string fileName)
+        {
+            BenchmarkReport report = JsonSerializer.Deserialize<BenchmarkReport>(File.ReadAllText(fileName), jsonOptions);
+            if (report == null || report.FormatVersion != CurrentFormatVersion)
+            {
+                throw new InvalidDataException(string.Format("The file {0} is not a benchmark report of format version {1}", fileName, CurrentFormatVersion));
+            }
+
+            return report;
+        }
+
+        /// <summary>
+        /// Merge the reports of repeated runs on the same machine into one report, in which the measured iterations of
+        /// each case are pooled, such that a baseline also covers the variation between runs.
+        /// </summary>
+        /// <param name="reports">The reports to merge, of the same machine.</param>
+        /// <returns>The merged report, with the environment of the first report.</returns>
+        public static BenchmarkReport Merge(IList<BenchmarkReport> reports)
+        {
+            if (reports.Count == 0) throw new ArgumentException("No reports to merge");
+            BenchmarkReport first = reports[0];
+            if (reports.Any(r => r.ProcessorCount != first.ProcessorCount || r.ProcessArchitecture != first.ProcessArchitecture || r.MachineName != first.MachineName))
+            {
+                throw new InvalidDataException("Cannot merge the reports of different machines");
+            }
+
+            BenchmarkReport merged = new BenchmarkReport();
+            merged.Timestamp = reports.Max(r => r.Timestamp);
+            merged.MachineName = first.MachineName;
+            merged.OSDescription = first.OSDescription;
+            merged.FrameworkDescription = first.FrameworkDescription;
+            merged.ProcessArchitecture = first.ProcessArchitecture;
+            merged.ProcessorCount = first.ProcessorCount;
+            merged.SonnetVersion = first.SonnetVersion;
+            merged.CommandLine = string.Join("; ", reports.Select(r => r.CommandLine));
+            merged.PeakWorkingSetBytes = reports.Max(r => r.PeakWorkingSetBytes);
+
+            // In the order of the first run in which each case appears
+            foreach (IGrouping<string, BenchmarkResult> results in reports.SelectMany(r => r.Results).GroupBy(r => r.Name))
+            {
+                BenchmarkResult result = results.First();
+                merged.Results.Add(new BenchmarkResult()
+                {
+                    Name = result.Name,
+                    WarmupIterations = result.WarmupIterations,
+                    Seconds = results.SelectMany(r => r.Seconds).ToArray(),
+                    AllocatedBytes = results.SelectMany(r => r.AllocatedBytes).ToArray(),
+                    NativeBytes = results.SelectMany(r => r.NativeBytes).ToArray(),
+                    PeakWorkingSetBytes = results.Max(r => r.PeakWorkingSetBytes),
+                    Collections = Enumerable.Range(0, result.Collections.Length).Select(g => results.Sum(r => r.Collections[g])).ToArray(),
+                    Properties = result.Properties,
+                });
+            }
+
+            return merged;
+        }
+
+        /// <summary>
+        /// Write a summary table of the results to the console.
+        /// </summary>
+        public void WriteSummary(TextWriter writer)
+        {
+            int width = Math.Max(20, Results.Count > 0 ? Results.Max(r => r.Name.Length) : 0);
+            writer.WriteLine("{0} {1,12} {2,12} {3,10} {4,14} {5,12}", "Name".PadRight(width), "Median (ms)", "Min (ms)", "StdDev %", "Alloc (KB)", "Native (KB)");
+            foreach (BenchmarkResult result in Results)
+            {
+                double relativeStdDev = result.MeanSeconds > 0.0 ? 100.0 * result.StdDevSeconds / result.MeanSeconds : 0.0;
+                writer.WriteLine("{0} {1,12:F3} {2,12:F3} {3,10:F1} {4,14:F1} {5,12:F1}", result.Name.PadRight(width),
+                    1000.0 * result.MedianSeconds, 1000.0 * result.MinSeconds, relativeStdDev,
+                    result.MedianAllocatedBytes / 1024.0, result.MedianNativeBytes / 1024.0);
+            }
+        }
+    }
+}
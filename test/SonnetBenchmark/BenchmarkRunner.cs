@@ -0,0 +1,126 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// Runs benchmark cases: each case is run a number of warmup iterations, followed by the measured iterations.
+    /// Every iteration executes the Setup, Run and Cleanup actions of the case, but only Run is measured.
+    /// Before each run, the garbage collector is forced, such that the memory measurements of a run are not
+    /// influenced by garbage of previous runs.
+    /// </summary>
+    public class BenchmarkRunner
+    {
+        private readonly Process process = Process.GetCurrentProcess();
+
+        /// <summary>
+        /// Create a new benchmark runner.
+        /// </summary>
+        /// <param name="warmupIterations">The number of iterations before measuring.</param>
+        /// <param name="iterations">The number of measured iterations.</param>
+        public BenchmarkRunner(int warmupIterations, int iterations)
+        {
+            if (warmupIterations < 0) throw new ArgumentOutOfRangeException(nameof(warmupIterations));
+            if (iterations < 1) throw new ArgumentOutOfRangeException(nameof(iterations));
+
+            WarmupIterations = warmupIterations;
+            Iterations = iterations;
+        }
+
+        /// <summary>
+        /// Gets the number of iterations before measuring.
+        /// </summary>
+        public int WarmupIterations { get; private set; }
+
+        /// <summary>
+        /// Gets the number of measured iterations.
+        /// </summary>
+        public int Iterations { get; private set; }
+
+        /// <summary>
+        /// Run the given case and return its measurements.
+        /// </summary>
+        /// <param name="benchmarkCase">The case to run.</param>
+        /// <returns>The measurements of the case.</returns>
+        public BenchmarkResult Run(BenchmarkCase benchmarkCase)
+        {
+            int[] collections = new int[3];
+            benchmarkCase.IsWarmup = true;
+            for (int i = 0; i < WarmupIterations; i++)
+            {
+                RunOnce(benchmarkCase, new int[3], out _, out _, out _, out _);
+            }
+
+            benchmarkCase.IsWarmup = false;
+
+            double[] seconds = new double[Iterations];
+            long[] allocatedBytes = new long[Iterations];
+            long[] nativeBytes = new long[Iterations];
+            long peakWorkingSet = 0;
+            for (int i = 0; i < Iterations; i++)
+            {
+                RunOnce(benchmarkCase, collections, out seconds[i], out allocatedBytes[i], out nativeBytes[i], out long workingSet);
+                peakWorkingSet = Math.Max(peakWorkingSet, workingSet);
+            }
+
+            return new BenchmarkResult()
+            {
+                Name = benchmarkCase.Name,
+                WarmupIterations = WarmupIterations,
+                Seconds = seconds,
+                AllocatedBytes = allocatedBytes,
+                NativeBytes = nativeBytes,
+                PeakWorkingSetBytes = peakWorkingSet,
+                Collections = collections,
+                Properties = new Dictionary<string, double>(benchmarkCase.Properties),
+            };
+        }
+
+        private void RunOnce(BenchmarkCase benchmarkCase, int[] collections, out double seconds, out long allocatedBytes, out long nativeBytes, out long workingSet)
+        {
+            if (benchmarkCase.Setup != null) benchmarkCase.Setup();
+
+            FullCollect();
+            long nativeStart = NativeBytes();
+            long allocatedStart = GC.GetTotalAllocatedBytes(true);
+            for (int generation = 0; generation < collections.Length; generation++) collections[generation] -= GC.CollectionCount(generation);
+
+            Stopwatch stopwatch = Stopwatch.StartNew();
+            benchmarkCase.Run();
+            stopwatch.Stop();
+
+            for (int generation = 0; generation < collections.Length; generation++) collections[generation] += GC.CollectionCount(generation);
+            allocatedBytes = GC.GetTotalAllocatedBytes(true) - allocatedStart;
+            seconds = stopwatch.Elapsed.TotalSeconds;
+
+            // Measure the memory before cleaning up, such that the objects created by the run are included
+            process.Refresh();
+            workingSet = process.WorkingSet64;
+            FullCollect();
+            nativeBytes = NativeBytes() - nativeStart;
+
+            if (benchmarkCase.Cleanup != null) benchmarkCase.Cleanup();
+        }
+
+        /// <summary>
+        /// Returns the private bytes of the process that are not committed by the garbage collector.
+        /// Only accurate right after a collection.
+        /// </summary>
+        private long NativeBytes()
+        {
+            process.Refresh();
+            return process.PrivateMemorySize64 - GC.GetGCMemoryInfo().TotalCommittedBytes;
+        }
+
+        private static void FullCollect()
+        {
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+            GC.Collect();
+        }
+    }
+}
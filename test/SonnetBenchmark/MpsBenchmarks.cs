@@ -0,0 +1,181 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
+using COIN;
+#endif
+using Sonnet;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// Benchmarks of the stages of solving the MPS instances that are bundled in the test directory:
+    /// import, Generate, LP solve, MIP solve with Clp and with Cbc, Resolve after bound changes, and the solution assignment.
+    /// </summary>
+    public static class MpsBenchmarks
+    {
+        /// <summary>
+        /// A bundled MPS instance.
+        /// </summary>
+        private class Instance
+        {
+            public Instance(string fileName, bool isMIP, bool clpBranchAndBound)
+            {
+                FileName = fileName;
+                IsMIP = isMIP;
+                ClpBranchAndBound = clpBranchAndBound;
+            }
+
+            public string FileName { get; private set; }
+            public string Name { get { return System.IO.Path.GetFileNameWithoutExtension(FileName); } }
+            public bool IsMIP { get; private set; }
+            /// <summary>
+            /// True iff the simple branch and bound of OsiClpSolverInterface solves the instance in reasonable time.
+            /// </summary>
+            public bool ClpBranchAndBound { get; private set; }
+        }
+
+        private static readonly Instance[] instances = new Instance[]
+        {
+            new Instance("brandy.mps", false, false),
+            new Instance("egout.mps", true, true),
+            new Instance("mas74.mps", true, false),
+            new Instance("MIP-124725.mps", true, true),
+        };
+
+        /// <summary>
+        /// The number of variables whose bounds are tightened before the Resolve stage.
+        /// </summary>
+        private const int NumberOfBoundChanges = 10;
+
+        /// <summary>
+        /// Returns the benchmark cases of all stages for all bundled instances.
+        /// </summary>
+        /// <param name="maximumNodes">The node limit of the MIP solves with Cbc, to keep mas74 tractable.</param>
+        /// <returns>The benchmark cases.</returns>
+        public static IEnumerable<BenchmarkCase> GetCases(int maximumNodes)
+        {
+            foreach (Instance instance in instances)
+            {
+                string prefix = "mps/" + instance.Name + "/";
+                string fileName = instance.FileName;
+
+                Model model = null;
+                Variable[] variables = null;
+                Solver solver = null;
+
+                yield return new BenchmarkCase(prefix + "Import",
+                    run: () => model = Model.New(fileName),
+                    cleanup: () => model = null);
+
+                yield return new BenchmarkCase(prefix + "Generate",
+                    setup: () => solver = NewSolver(Model.New(fileName), typeof(OsiClpSolverInterface), maximumNodes),
+                    run: () => solver.Generate(),
+                    cleanup: () => DisposeSolver(ref solver));
+
+                yield return new BenchmarkCase(prefix + "SolveLP",
+                    setup: () =>
+                    {
+                        solver = NewSolver(Model.New(fileName), typeof(OsiClpSolverInterface), maximumNodes);
+                        solver.Generate();
+                    },
+                    run: () => solver.Minimise(true),
+                    cleanup: () => DisposeSolver(ref solver));
+
+                if (instance.IsMIP)
+                {
+                    if (instance.ClpBranchAndBound)
+                    {
+                        yield return new BenchmarkCase(prefix + "SolveMIP-Clp",
+                            setup: () =>
+                            {
+                                solver = NewSolver(Model.New(fileName), typeof(OsiClpSolverInterface), maximumNodes);
+                                solver.Generate();
+                            },
+                            run: () => solver.Minimise(),
+                            cleanup: () => DisposeSolver(ref solver));
+                    }
+
+                    yield return new BenchmarkCase(prefix + "SolveMIP-Cbc",
+                        setup: () =>
+                        {
+                            solver = NewSolver(Model.New(fileName), typeof(OsiCbcSolverInterface), maximumNodes);
+                            solver.Generate();
+                        },
+                        run: () => solver.Minimise(),
+                        cleanup: () => DisposeSolver(ref solver));
+                }
+
+                yield return new BenchmarkCase(prefix + "Resolve",
+                    setup: () =>
+                    {
+                        solver = NewSolver(Model.New(fileName, out variables), typeof(OsiClpSolverInterface), maximumNodes);
+                        solver.Minimise(true);
+                        TightenBounds(variables);
+                    },
+                    run: () => solver.Resolve(true),
+                    cleanup: () =>
+                    {
+                        variables = null;
+                        DisposeSolver(ref solver);
+                    });
+
+                yield return new BenchmarkCase(prefix + "AssignSolution",
+                    setup: () =>
+                    {
+                        solver = NewSolver(Model.New(fileName), typeof(OsiClpSolverInterface), maximumNodes);
+                        solver.Minimise(true);
+                    },
+                    run: () => solver.AssignSolution(false),
+                    cleanup: () => DisposeSolver(ref solver));
+            }
+        }
+
+        /// <summary>
+        /// Create a new solver for the given model without solver output, and with the given node limit for Cbc.
+        /// </summary>
+        internal static Solver NewSolver(Model model, Type solverType, int maximumNodes)
+        {
+            Solver solver = new Solver(model, solverType);
+            solver.OsiSolver.messageHandler().setLogLevel(0);
+
+            if (solver.OsiSolver is OsiCbcSolverInterface cbcSolver)
+            {
+                List<string> args = new List<string>() { "-log", "0", "-maxNodes", maximumNodes.ToString() };
+                // Single threaded, such that the node limit gives reproducible results
+                if (CbcSolver.SupportsThreads) args.AddRange(new string[] { "-threads", "0" });
+                cbcSolver.SetCbcSolverArgs(args.ToArray());
+            }
+
+            return solver;
+        }
+
+        private static void DisposeSolver(ref Solver solver)
+        {
+            if (solver != null) solver.Dispose();
+            solver = null;
+        }
+
+        /// <summary>
+        /// Halve the distance between the lower bound and the LP solution value of the first variables
+        /// that are strictly above their lower bound, such that the Resolve needs dual simplex iterations.
+        /// </summary>
+        private static void TightenBounds(Variable[] variables)
+        {
+            int changes = 0;
+            foreach (Variable variable in variables)
+            {
+                if (changes == NumberOfBoundChanges) break;
+                if (variable.Value > variable.Lower + 1e-6 && !double.IsInfinity(variable.Lower))
+                {
+                    variable.Upper = 0.5 * (variable.Lower + variable.Value);
+                    changes++;
+                }
+            }
+        }
+    }
+}
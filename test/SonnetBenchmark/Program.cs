@@ -0,0 +1,383 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using Sonnet;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// The command line options of the benchmark.
+    /// </summary>
+    public class BenchmarkOptions
+    {
+        public BenchmarkOptions()
+        {
+            Suites = new List<string>();
+            WarmupIterations = 2;
+            Iterations = 10;
+            MaximumNodes = 1000;
+            MaximumNonzeros = 1000000;
+            MaximumThreads = 2 * Environment.ProcessorCount;
+            OutputFileName = "SonnetBenchmark.json";
+            TimeThreshold = 0.10;
+            MemoryThreshold = 0.10;
+            Alpha = 0.05;
+        }
+
+        /// <summary>
+        /// Gets options for the fixed benchmark set of the regression gate: the bundled MPS instances,
+        /// and the synthetic models up to 10^5 nonzeros, with enough iterations for the Mann-Whitney test.
+        /// </summary>
+        public static BenchmarkOptions NewGate()
+        {
+            BenchmarkOptions options = new BenchmarkOptions();
+            options.Suites.Add("mps");
+            options.Suites.Add("scaling");
+            options.MaximumNonzeros = 100000;
+            options.WarmupIterations = 3;
+            options.Iterations = 15;
+            return options;
+        }
+
+        /// <summary>
+        /// The suites to run, or all suites if empty.
+        /// </summary>
+        public List<string> Suites { get; private set; }
+        /// <summary>
+        /// Only run the cases whose name contains this text, or any of its comma-separated texts, if not null.
+        /// </summary>
+        public string Filter { get; set; }
+        public int WarmupIterations { get; set; }
+        public int Iterations { get; set; }
+        /// <summary>
+        /// The node limit of the MIP solves with Cbc.
+        /// </summary>
+        public int MaximumNodes { get; set; }
+        /// <summary>
+        /// The number of nonzeros of the largest synthetic models.
+        /// </summary>
+        public int MaximumNonzeros { get; set; }
+        /// <summary>
+        /// The maximum number of threads of the throughput cases.
+        /// </summary>
+        public int MaximumThreads { get; set; }
+        public string OutputFileName { get; set; }
+        /// <summary>
+        /// Only list the names of the cases, without running them.
+        /// </summary>
+        public bool List { get; set; }
+        /// <summary>
+        /// The JSON file of the baseline to compare with, or null.
+        /// </summary>
+        public string BaselineFileName { get; set; }
+        /// <summary>
+        /// Only compare this existing JSON file with the baseline, without running, if not null.
+        /// </summary>
+        public string CompareFileName { get; set; }
+        /// <summary>
+        /// Only merge these existing JSON files of repeated runs into the output file, without running, if not null.
+        /// </summary>
+        public List<string> MergeFileNames { get; set; }
+        /// <summary>
+        /// The relative increase of the median time that is a regression.
+        /// </summary>
+        public double TimeThreshold { get; set; }
+        /// <summary>
+        /// The relative increase of the allocated bytes, native memory or peak working set that is a regression.
+        /// </summary>
+        public double MemoryThreshold { get; set; }
+        /// <summary>
+        /// The significance level of the Mann-Whitney test.
+        /// </summary>
+        public double Alpha { get; set; }
+    }
+
+    /// <summary>
+    /// Sonnet benchmark: runs suites of benchmark cases and writes the measurements as JSON.
+    /// The measurements can be compared with a baseline, and the exit code is 1 if there are regressions.
+    /// Build and run in Release, without a debugger attached.
+    /// </summary>
+    public static class Program
+    {
+        /// <summary>
+        /// The benchmark suites by name.
+        /// </summary>
+        private static readonly Dictionary<string, Func<BenchmarkOptions, IEnumerable<BenchmarkCase>>> suites =
+            new Dictionary<string, Func<BenchmarkOptions, IEnumerable<BenchmarkCase>>>()
+            {
+                { "mps", options => MpsBenchmarks.GetCases(options.MaximumNodes) },
+                { "scaling", options => ScalingBenchmarks.GetCases(options.MaximumNonzeros) },
+#if (!SONNET_NATIVE)
+                { "wrapper", options => WrapperBenchmarks.GetCases() },
+#endif
+                { "throughput", options => ThroughputBenchmarks.GetCases(options.MaximumThreads, options.MaximumNodes) },
+            };
+
+        public static int Main(string[] args)
+        {
+            System.Globalization.CultureInfo.CurrentCulture = System.Globalization.CultureInfo.InvariantCulture;
+
+            BenchmarkOptions options;
+            try
+            {
+                options = Parse(args);
+            }
+            catch (ArgumentException e)
+            {
+                Console.Error.WriteLine(e.Message);
+                WriteUsage();
+                return 2;
+            }
+
+            if (options == null)
+            {
+                WriteUsage();
+                return 0;
+            }
+
+            if (options.CompareFileName == null && options.MergeFileNames == null) return Run(options, args);
+
+            try
+            {
+                if (options.MergeFileNames != null) return Merge(options);
+                return Compare(options, BenchmarkReport.Read(options.CompareFileName));
+            }
+            catch (Exception e) when (e is System.IO.IOException || e is System.IO.InvalidDataException || e is System.Text.Json.JsonException)
+            {
+                Console.Error.WriteLine(e.Message);
+                return 2;
+            }
+        }
+
+        private static int Run(BenchmarkOptions options, string[] args)
+        {
+            // Only warnings and errors, such that logging doesn't influence the measurements
+            SonnetLog.Default.LogLevel = 1;
+
+            IEnumerable<string> suiteNames = options.Suites.Count > 0 ? options.Suites : suites.Keys;
+            List<BenchmarkCase> cases = suiteNames
+                .SelectMany(suiteName => suites[suiteName](options))
+                .Where(c => options.Filter == null || options.Filter.Split(',').Any(f => c.Name.IndexOf(f.Trim(), StringComparison.OrdinalIgnoreCase) >= 0))
+                .ToList();
+
+            if (options.BaselineFileName != null && !System.IO.File.Exists(options.BaselineFileName))
+            {
+                Console.Error.WriteLine("The baseline " + options.BaselineFileName + " does not exist. Create it by running with --output " + options.BaselineFileName);
+                return 2;
+            }
+
+            if (options.List)
+            {
+                foreach (BenchmarkCase benchmarkCase in cases) Console.WriteLine(benchmarkCase.Name);
+                return 0;
+            }
+
+#if DEBUG
+            Console.WriteLine("Warning: this is a Debug build; timings are not representative.");
+#endif
+            if (System.Diagnostics.Debugger.IsAttached) Console.WriteLine("Warning: a debugger is attached; timings are not representative.");
+
+            BenchmarkReport report = BenchmarkReport.New(args);
+            BenchmarkRunner runner = new BenchmarkRunner(options.WarmupIterations, options.Iterations);
+            foreach (BenchmarkCase benchmarkCase in cases)
+            {
+                Console.WriteLine("Running " + benchmarkCase.Name);
+                report.Results.Add(runner.Run(benchmarkCase));
+            }
+
+            report.PeakWorkingSetBytes = System.Diagnostics.Process.GetCurrentProcess().PeakWorkingSet64;
+            ScalingBenchmarks.AddPerNonzero(report);
+#if (!SONNET_NATIVE)
+            WrapperBenchmarks.AddPerOperation(report);
+#endif
+            report.Write(options.OutputFileName);
+
+            Console.WriteLine();
+            report.WriteSummary(Console.Out);
+            Console.WriteLine();
+#if (!SONNET_NATIVE)
+            WrapperBenchmarks.WriteTable(report, Console.Out);
+#endif
+            ScalingBenchmarks.WriteCurves(report, Console.Out);
+            ThroughputBenchmarks.WriteTable(report, Console.Out);
+            Console.WriteLine();
+            Console.WriteLine("Results written to " + options.OutputFileName);
+
+            if (options.BaselineFileName != null)
+            {
+                Console.WriteLine();
+                return Compare(options, report);
+            }
+            return 0;
+        }
+
+        /// <summary>
+        /// Compare the given report with the baseline, and return 1 if there are regressions, and 0 otherwise.
+        /// </summary>
+        private static int Compare(BenchmarkOptions options, BenchmarkReport report)
+        {
+            BenchmarkReport baseline = BenchmarkReport.Read(options.BaselineFileName);
+            BenchmarkComparison comparison = new BenchmarkComparison(options.TimeThreshold, options.MemoryThreshold, options.Alpha);
+            comparison.Compare(baseline, report);
+
+            Console.WriteLine("Comparison with the baseline " + options.BaselineFileName + " of " + baseline.Timestamp.ToString("u"));
+            if (baseline.ProcessorCount != report.ProcessorCount)
+            {
+                Console.WriteLine("Warning: the baseline was measured with {0} processors, but this run with {1}; timings are not comparable.", baseline.ProcessorCount, report.ProcessorCount);
+            }
+            comparison.WriteSummary(Console.Out);
+            return comparison.HasRegressions ? 1 : 0;
+        }
+
+        /// <summary>
+        /// Merge the reports of repeated runs into the output file, for example to record a baseline.
+        /// </summary>
+        private static int Merge(BenchmarkOptions options)
+        {
+            BenchmarkReport report = BenchmarkReport.Merge(options.MergeFileNames.Select(BenchmarkReport.Read).ToList());
+            report.Write(options.OutputFileName);
+            Console.WriteLine("Merged {0} runs into {1}", options.MergeFileNames.Count, options.OutputFileName);
+            return 0;
+        }
+
+        /// <summary>
+        /// Parse the command line, or return null if the usage was asked for.
+        /// </summary>
+        private static BenchmarkOptions Parse(string[] args)
+        {
+            // The gate sets the defaults, such that the other options can still change them
+            BenchmarkOptions options = args.Contains("--gate") ? BenchmarkOptions.NewGate() : new BenchmarkOptions();
+            for (int i = 0; i < args.Length; i++)
+            {
+                string arg = args[i];
+                switch (arg)
+                {
+                    case "compare":
+                        if (i != 0) throw new ArgumentException("compare must be the first argument");
+                        options.BaselineFileName = NextArg(args, ref i);
+                        options.CompareFileName = NextArg(args, ref i);
+                        break;
+                    case "merge":
+                        if (i != 0) throw new ArgumentException("merge must be the first argument");
+                        options.OutputFileName = NextArg(args, ref i);
+                        options.MergeFileNames = args.Skip(i + 1).ToList();
+                        if (options.MergeFileNames.Count == 0) throw new ArgumentException("Missing the files to merge");
+                        i = args.Length;
+                        break;
+                    case "--gate":
+                        break;
+                    case "-h":
+                    case "--help":
+                        return null;
+                    case "--list":
+                        options.List = true;
+                        break;
+                    case "--suite":
+                        string suite = NextArg(args, ref i);
+                        if (!suites.ContainsKey(suite)) throw new ArgumentException("Unknown suite: " + suite);
+                        options.Suites.Add(suite);
+                        break;
+                    case "--filter":
+                        options.Filter = NextArg(args, ref i);
+                        break;
+                    case "--warmup":
+                        options.WarmupIterations = NextInt(args, ref i, 0);
+                        break;
+                    case "--iterations":
+                        options.Iterations = NextInt(args, ref i, 1);
+                        break;
+                    case "--max-nodes":
+                        options.MaximumNodes = NextInt(args, ref i, 0);
+                        break;
+                    case "--max-nonzeros":
+                        options.MaximumNonzeros = NextInt(args, ref i, 1000);
+                        break;
+                    case "--max-threads":
+                        options.MaximumThreads = NextInt(args, ref i, 1);
+                        break;
+                    case "--output":
+                        options.OutputFileName = NextArg(args, ref i);
+                        break;
+                    case "--baseline":
+                        options.BaselineFileName = NextArg(args, ref i);
+                        break;
+                    case "--threshold":
+                        options.TimeThreshold = NextPercentage(args, ref i);
+                        break;
+                    case "--memory-threshold":
+                        options.MemoryThreshold = NextPercentage(args, ref i);
+                        break;
+                    case "--alpha":
+                        options.Alpha = NextDouble(args, ref i, 0.0, 1.0);
+                        break;
+                    default:
+                        throw new ArgumentException("Unknown argument: " + arg);
+                }
+            }
+
+            return options;
+        }
+
+        private static string NextArg(string[] args, ref int i)
+        {
+            if (i + 1 >= args.Length) throw new ArgumentException("Missing value for " + args[i]);
+            return args[++i];
+        }
+
+        private static int NextInt(string[] args, ref int i, int minimum)
+        {
+            string option = args[i];
+            if (!int.TryParse(NextArg(args, ref i), out int value) || value < minimum)
+            {
+                throw new ArgumentException(string.Format("The value of {0} must be an integer of at least {1}", option, minimum));
+            }
+
+            return value;
+        }
+
+        private static double NextDouble(string[] args, ref int i, double lower, double upper)
+        {
+            string option = args[i];
+            if (!double.TryParse(NextArg(args, ref i), System.Globalization.NumberStyles.Float, System.Globalization.CultureInfo.InvariantCulture, out double value) ||
+                !(value > lower && value < upper))
+            {
+                throw new ArgumentException(string.Format("The value of {0} must be a number between {1} and {2}", option, lower, upper));
+            }
+
+            return value;
+        }
+
+        /// <summary>
+        /// Returns the next argument, a percentage, as a fraction.
+        /// </summary>
+        private static double NextPercentage(string[] args, ref int i)
+        {
+            return 0.01 * NextDouble(args, ref i, 0.0, 1000.0);
+        }
+
+        private static void WriteUsage()
+        {
+            Console.WriteLine("Usage: SonnetBenchmark [options]");
+            Console.WriteLine("       SonnetBenchmark compare <baseline.json> <current.json> [--threshold <%>] [--memory-threshold <%>] [--alpha <a>]");
+            Console.WriteLine("       SonnetBenchmark merge <output.json> <run1.json> <run2.json> ...   Pool the iterations of repeated runs");
+            Console.WriteLine("  --suite <name>       Run the given suite (can be repeated). Default: all suites: " + string.Join(", ", suites.Keys));
+            Console.WriteLine("  --filter <text>      Only run the cases whose name contains the text (or any of the comma-separated texts)");
+            Console.WriteLine("  --warmup <n>         Number of warmup iterations per case. Default: 2");
+            Console.WriteLine("  --iterations <n>     Number of measured iterations per case. Default: 10");
+            Console.WriteLine("  --max-nodes <n>      Node limit of the MIP solves with Cbc. Default: 1000");
+            Console.WriteLine("  --max-nonzeros <n>   Size of the largest synthetic models. Default: 1000000 (up to 10000000)");
+            Console.WriteLine("  --max-threads <n>    Maximum number of threads of the throughput suite. Default: 2 x processors (" + 2 * Environment.ProcessorCount + ")");
+            Console.WriteLine("  --output <file>      The JSON file to write. Default: SonnetBenchmark.json");
+            Console.WriteLine("  --list               Only list the names of the cases");
+            Console.WriteLine("  --gate               Run the fixed set of the regression gate: mps and scaling up to 100000 nonzeros,");
+            Console.WriteLine("                       with 3 warmup and 15 measured iterations");
+            Console.WriteLine("  --baseline <file>    Compare the results with this baseline JSON file. The exit code is 1 if there are regressions");
+            Console.WriteLine("  --threshold <%>      Increase of the median time that is a regression, if significant. Default: 10");
+            Console.WriteLine("  --memory-threshold <%>  Increase of the allocated bytes, native memory or peak working set that is a regression. Default: 10");
+            Console.WriteLine("  --alpha <a>          Significance level of the one-sided Mann-Whitney U test. Default: 0.05");
+        }
+    }
+}
@@ -0,0 +1,351 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
+using COIN;
+#endif
+using Sonnet;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// Benchmarks of how the modelling layer scales with the number of nonzeros, for synthetic transportation,
+    /// assignment (as Example5) and multi-dimensional knapsack models of 10^3 nonzeros up to a maximum.
+    /// The stages of building a model are timed separately: creating the variables, building the expressions,
+    /// adding the constraints via ForAll, Generate, and AssignSolution.
+    /// The time and bytes per nonzero of each stage should be (about) constant; growth with the size shows super-linear behaviour.
+    /// </summary>
+    public static class ScalingBenchmarks
+    {
+        private const string Suite = "scaling/";
+        private const string NonzerosProperty = "nonzeros";
+
+        private static readonly string[] stages = { "NewVariables", "Expressions", "ForAll", "Generate", "AssignSolution" };
+
+        /// <summary>
+        /// A synthetic model of about the given number of nonzeros, built in stages.
+        /// The data are random, but the same for every build of the same size.
+        /// </summary>
+        private abstract class ScalingModel
+        {
+            public abstract string Family { get; }
+            public abstract int NumberOfNonzeros { get; }
+
+            public Variable[] Variables { get; protected set; }
+            public Expression Objective { get; protected set; }
+            public Model Model { get; protected set; }
+            public Solver Solver { get; set; }
+
+            /// <summary>
+            /// Create the data and the variables.
+            /// </summary>
+            public abstract void NewVariables();
+            /// <summary>
+            /// Build the expressions of the objective and of the constraints, with the usual operators.
+            /// </summary>
+            public abstract void BuildExpressions();
+            /// <summary>
+            /// Create the model, and add the constraints via ForAll.
+            /// </summary>
+            public abstract void AddConstraints();
+
+            public void Dispose()
+            {
+                if (Solver != null) Solver.Dispose();
+                Solver = null;
+                Model = null;
+                Variables = null;
+                Objective = null;
+            }
+        }
+
+        /// <summary>
+        /// Transportation from m sources with a supply to n sinks with a demand.
+        /// </summary>
+        private class TransportationModel : ScalingModel
+        {
+            private int m;
+            private int n;
+            private double[] supply;
+            private double[] demand;
+            private double[] cost;
+            private Expression[] supplyRows;
+            private Expression[] demandRows;
+
+            public TransportationModel(int nonzeros)
+            {
+                m = n = Math.Max(1, (int)Math.Round(Math.Sqrt(nonzeros / 2.0)));
+            }
+
+            public override string Family { get { return "transportation"; } }
+            public override int NumberOfNonzeros { get { return 2 * m * n; } }
+
+            public override void NewVariables()
+            {
+                Random random = new Random(1);
+                demand = Enumerable.Range(0, n).Select(j => (double)random.Next(20, 100)).ToArray();
+                double totalSupply = 1.2 * demand.Sum();
+                supply = Enumerable.Range(0, m).Select(i => Math.Ceiling(totalSupply / m)).ToArray();
+                cost = Enumerable.Range(0, m * n).Select(k => (double)random.Next(1, 100)).ToArray();
+
+                Variables = new Variable[m * n];
+                for (int i = 0; i < m; i++)
+                {
+                    for (int j = 0; j < n; j++) Variables[i * n + j] = new Variable("x_" + i + "_" + j);
+                }
+            }
+
+            public override void BuildExpressions()
+            {
+                Variable[] x = Variables;
+                Objective = Enumerable.Range(0, m * n).Sum(k => cost[k] * x[k]);
+                supplyRows = Enumerable.Range(0, m).Select(i => Enumerable.Range(0, n).Sum(j => x[i * n + j])).ToArray();
+                demandRows = Enumerable.Range(0, n).Select(j => Enumerable.Range(0, m).Sum(i => x[i * n + j])).ToArray();
+            }
+
+            public override void AddConstraints()
+            {
+                Model = new Model();
+                Model.Objective = Objective;
+                Model.Add(Enumerable.Range(0, m).ForAll("supply", i => supplyRows[i] <= supply[i]));
+                Model.Add(Enumerable.Range(0, n).ForAll("demand", j => demandRows[j] >= demand[j]));
+            }
+        }
+
+        /// <summary>
+        /// Assignment of machines of different types to producers, as Example5: each type has a number of machines,
+        /// and the capacity of the machines assigned to a producer must cover its demand.
+        /// </summary>
+        private class AssignmentModel : ScalingModel
+        {
+            private int machines;
+            private int producers;
+            private double[] count;
+            private double[] demand;
+            private double[] cost;
+            private double[] capacity;
+            private Expression[] machineRows;
+            private Expression[] producerRows;
+
+            public AssignmentModel(int nonzeros)
+            {
+                machines = producers = Math.Max(1, (int)Math.Round(Math.Sqrt(nonzeros / 2.0)));
+            }
+
+            public override string Family { get { return "assignment"; } }
+            public override int NumberOfNonzeros { get { return 2 * machines * producers; } }
+
+            public override void NewVariables()
+            {
+                Random random = new Random(2);
+                count = Enumerable.Range(0, machines).Select(i => 6.0).ToArray();
+                cost = Enumerable.Range(0, machines * producers).Select(k => (double)random.Next(10, 50)).ToArray();
+                capacity = Enumerable.Range(0, machines * producers).Select(k => (double)random.Next(200, 650)).ToArray();
+                demand = Enumerable.Range(0, producers).Select(j => (double)random.Next(900, 1900)).ToArray();
+
+                Variables = new Variable[machines * producers];
+                for (int i = 0; i < machines; i++)
+                {
+                    for (int j = 0; j < producers; j++) Variables[i * producers + j] = new Variable("assign_" + i + "_" + j, 0.0, count[i], VariableType.Integer);
+                }
+            }
+
+            public override void BuildExpressions()
+            {
+                Variable[] x = Variables;
+                Objective = Enumerable.Range(0, machines * producers).Sum(k => cost[k] * x[k]);
+                machineRows = Enumerable.Range(0, machines).Select(i => Enumerable.Range(0, producers).Sum(j => x[i * producers + j])).ToArray();
+                producerRows = Enumerable.Range(0, producers).Select(j => Enumerable.Range(0, machines).Sum(i => capacity[i * producers + j] * x[i * producers + j])).ToArray();
+            }
+
+            public override void AddConstraints()
+            {
+                Model = new Model();
+                Model.Objective = Objective;
+                Model.Add(Enumerable.Range(0, machines).ForAll("machine", i => machineRows[i] <= count[i]));
+                Model.Add(Enumerable.Range(0, producers).ForAll("producer", j => producerRows[j] >= demand[j]));
+            }
+        }
+
+        /// <summary>
+        /// Multi-dimensional knapsack: binary items with a value and a weight in each of a few dimensions.
+        /// </summary>
+        private class KnapsackModel : ScalingModel
+        {
+            private const int MaximumDimensions = 10;
+
+            private int dimensions;
+            private int items;
+            private double[] value;
+            private double[][] weight;
+            private double[] limit;
+            private Expression[] rows;
+
+            public KnapsackModel(int nonzeros)
+            {
+                dimensions = Math.Max(1, Math.Min(MaximumDimensions, nonzeros / 100));
+                items = Math.Max(1, nonzeros / dimensions);
+            }
+
+            public override string Family { get { return "knapsack"; } }
+            public override int NumberOfNonzeros { get { return dimensions * items; } }
+
+            public override void NewVariables()
+            {
+                Random random = new Random(3);
+                value = Enumerable.Range(0, items).Select(j => (double)random.Next(1, 1000)).ToArray();
+                weight = Enumerable.Range(0, dimensions).Select(r => Enumerable.Range(0, items).Select(j => (double)random.Next(1, 100)).ToArray()).ToArray();
+                limit = weight.Select(w => 0.5 * w.Sum()).ToArray();
+
+                Variables = new Variable[items];
+                for (int j = 0; j < items; j++) Variables[j] = new Variable("take_" + j, 0.0, 1.0, VariableType.Integer);
+            }
+
+            public override void BuildExpressions()
+            {
+                Variable[] x = Variables;
+                Objective = Enumerable.Range(0, items).Sum(j => value[j] * x[j]);
+                rows = Enumerable.Range(0, dimensions).Select(r => Enumerable.Range(0, items).Sum(j => weight[r][j] * x[j])).ToArray();
+            }
+
+            public override void AddConstraints()
+            {
+                Model = new Model();
+                Model.Objective = Objective;
+                Model.ObjectiveSense = ObjectiveSense.Maximise;
+                Model.Add(Enumerable.Range(0, dimensions).ForAll("weight", r => rows[r] <= limit[r]));
+            }
+        }
+
+        /// <summary>
+        /// Returns the benchmark cases of all stages, for all model families, for 10^3 nonzeros up to the given maximum in powers of ten.
+        /// </summary>
+        /// <param name="maximumNonzeros">The maximum number of nonzeros, for example 10^7.</param>
+        /// <returns>The benchmark cases.</returns>
+        public static IEnumerable<BenchmarkCase> GetCases(int maximumNonzeros)
+        {
+            Func<int, ScalingModel>[] families =
+            {
+                nonzeros => new TransportationModel(nonzeros),
+                nonzeros => new AssignmentModel(nonzeros),
+                nonzeros => new KnapsackModel(nonzeros),
+            };
+
+            foreach (Func<int, ScalingModel> family in families)
+            {
+                for (int nonzeros = 1000; nonzeros <= maximumNonzeros && nonzeros > 0; nonzeros *= 10)
+                {
+                    for (int stage = 0; stage < stages.Length; stage++)
+                    {
+                        yield return NewCase(family, nonzeros, stage);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Create the case of the given stage: the setup executes all earlier stages.
+        /// </summary>
+        private static BenchmarkCase NewCase(Func<int, ScalingModel> family, int nonzeros, int stage)
+        {
+            ScalingModel scalingModel = family(nonzeros);
+            ScalingModel current = null;
+
+            Action setup = () =>
+            {
+                current = family(nonzeros);
+                if (stage > 0) current.NewVariables();
+                if (stage > 1) current.BuildExpressions();
+                if (stage > 2) current.AddConstraints();
+                if (stage > 3)
+                {
+                    current.Solver = new Solver(current.Model, typeof(OsiClpSolverInterface));
+                    current.Solver.OsiSolver.messageHandler().setLogLevel(0);
+                    current.Solver.Generate();
+                }
+                if (stage > 4)
+                {
+                    // The values don't matter for the assignment, so don't spend the time to solve
+                    current.Solver.OsiSolver.setIntParam(OsiIntParam.OsiMaxNumIteration, 0);
+                    current.Solver.Solve(true);
+                }
+            };
+
+            Action run;
+            switch (stage)
+            {
+                case 0: run = () => current.NewVariables(); break;
+                case 1: run = () => current.BuildExpressions(); break;
+                case 2: run = () => current.AddConstraints(); break;
+                case 3:
+                    run = () =>
+                    {
+                        current.Solver = new Solver(current.Model, typeof(OsiClpSolverInterface));
+                        current.Solver.Generate();
+                    };
+                    break;
+                default: run = () => current.Solver.AssignSolution(false); break;
+            }
+
+            string name = string.Format("{0}{1}/{2:0e0}/{3}", Suite, scalingModel.Family, (double)nonzeros, stages[stage]);
+            BenchmarkCase benchmarkCase = new BenchmarkCase(name, run, setup, () => current.Dispose());
+            benchmarkCase.Properties[NonzerosProperty] = scalingModel.NumberOfNonzeros;
+            return benchmarkCase;
+        }
+
+        /// <summary>
+        /// Add the median time (ns) and the median allocated bytes per nonzero as properties of the scaling results.
+        /// </summary>
+        /// <param name="report">The report with the results.</param>
+        public static void AddPerNonzero(BenchmarkReport report)
+        {
+            foreach (BenchmarkResult result in report.Results)
+            {
+                if (!result.Name.StartsWith(Suite) || !result.Properties.TryGetValue(NonzerosProperty, out double nonzeros)) continue;
+
+                result.Properties["nanosecondsPerNonzero"] = 1e9 * result.MedianSeconds / nonzeros;
+                result.Properties["bytesPerNonzero"] = result.MedianAllocatedBytes / nonzeros;
+            }
+        }
+
+        /// <summary>
+        /// Write the time and bytes per nonzero of each family and stage against the size.
+        /// The exponent is the slope between two sizes on log-log scale: 1 for linear scaling, 2 for quadratic.
+        /// </summary>
+        /// <param name="report">The report with the results.</param>
+        /// <param name="writer">The writer to write the curves to.</param>
+        public static void WriteCurves(BenchmarkReport report, TextWriter writer)
+        {
+            var curves = report.Results
+                .Where(r => r.Name.StartsWith(Suite) && r.Properties.ContainsKey(NonzerosProperty))
+                .GroupBy(r => r.Name.Substring(0, r.Name.IndexOf('/', Suite.Length)) + r.Name.Substring(r.Name.LastIndexOf('/')));
+
+            foreach (var curve in curves)
+            {
+                writer.WriteLine(curve.Key);
+                writer.WriteLine("  {0,12} {1,14} {2,14} {3,10}", "Nonzeros", "ns/nonzero", "bytes/nonzero", "Exponent");
+
+                BenchmarkResult previous = null;
+                foreach (BenchmarkResult result in curve.OrderBy(r => r.Properties[NonzerosProperty]))
+                {
+                    double nonzeros = result.Properties[NonzerosProperty];
+                    string exponent = "";
+                    if (previous != null && previous.MedianSeconds > 0.0 && result.MedianSeconds > 0.0)
+                    {
+                        double ratio = nonzeros / previous.Properties[NonzerosProperty];
+                        exponent = (Math.Log(result.MedianSeconds / previous.MedianSeconds) / Math.Log(ratio)).ToString("F2");
+                    }
+
+                    writer.WriteLine("  {0,12} {1,14:F1} {2,14:F1} {3,10}", nonzeros, 1e9 * result.MedianSeconds / nonzeros, result.MedianAllocatedBytes / nonzeros, exponent);
+                    previous = result;
+                }
+            }
+        }
+    }
+}
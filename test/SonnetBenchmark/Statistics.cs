@@ -0,0 +1,174 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Linq;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// Descriptive statistics of benchmark samples, and the Mann-Whitney U test to compare two sets of samples.
+    /// </summary>
+    public static class Statistics
+    {
+        /// <summary>
+        /// Returns the median of the given values, or NaN if there are none.
+        /// </summary>
+        public static double Median(double[] values)
+        {
+            if (values == null || values.Length == 0) return double.NaN;
+
+            double[] sorted = values.OrderBy(v => v).ToArray();
+            int middle = sorted.Length / 2;
+            if (sorted.Length % 2 == 1) return sorted[middle];
+            return 0.5 * (sorted[middle - 1] + sorted[middle]);
+        }
+
+        /// <summary>
+        /// Returns the given percentile (0 to 100) of the values, interpolated linearly between the closest ranks,
+        /// or NaN if there are none.
+        /// </summary>
+        public static double Percentile(double[] values, double percentile)
+        {
+            if (values == null || values.Length == 0) return double.NaN;
+            if (percentile < 0.0 || percentile > 100.0) throw new ArgumentOutOfRangeException(nameof(percentile));
+
+            double[] sorted = values.OrderBy(v => v).ToArray();
+            double position = percentile / 100.0 * (sorted.Length - 1);
+            int lower = (int)Math.Floor(position);
+            int upper = Math.Min(lower + 1, sorted.Length - 1);
+            return sorted[lower] + (position - lower) * (sorted[upper] - sorted[lower]);
+        }
+
+        /// <summary>
+        /// Returns the mean of the given values, or NaN if there are none.
+        /// </summary>
+        public static double Mean(double[] values)
+        {
+            if (values == null || values.Length == 0) return double.NaN;
+            return values.Average();
+        }
+
+        /// <summary>
+        /// Returns the sample standard deviation of the given values, or 0 if there are less than two values.
+        /// </summary>
+        public static double StandardDeviation(double[] values)
+        {
+            if (values == null || values.Length < 2) return 0.0;
+
+            double mean = values.Average();
+            double sum = values.Sum(v => (v - mean) * (v - mean));
+            return Math.Sqrt(sum / (values.Length - 1));
+        }
+
+        /// <summary>
+        /// Returns the one-sided p-value of the Mann-Whitney U test of the hypothesis that the values of y tend to be
+        /// larger than the values of x. No assumption is made about the distributions, which suits the skewed
+        /// distributions of timings.
+        /// Without ties and for up to 20 values per sample, the exact distribution of U is used, otherwise the normal
+        /// approximation with continuity and tie correction.
+        /// </summary>
+        /// <param name="x">The first sample, like the baseline.</param>
+        /// <param name="y">The second sample, like the current measurements.</param>
+        /// <returns>The p-value, or 1 if either sample is empty or all values are equal.</returns>
+        public static double MannWhitneyGreater(double[] x, double[] y)
+        {
+            if (x == null || y == null || x.Length == 0 || y.Length == 0) return 1.0;
+
+            int m = x.Length;
+            int n = y.Length;
+            int total = m + n;
+
+            // Rank the combined values, with the average rank for ties
+            var combined = x.Select(v => (Value: v, IsY: false)).Concat(y.Select(v => (Value: v, IsY: true)))
+                .OrderBy(t => t.Value).ToArray();
+            double rankSumY = 0.0;
+            double tieSum = 0.0;
+            for (int i = 0; i < total;)
+            {
+                int j = i;
+                while (j + 1 < total && combined[j + 1].Value == combined[i].Value) j++;
+
+                double rank = 0.5 * (i + j) + 1.0;
+                for (int k = i; k <= j; k++)
+                {
+                    if (combined[k].IsY) rankSumY += rank;
+                }
+
+                double t = j - i + 1;
+                tieSum += t * t * t - t;
+                i = j + 1;
+            }
+
+            // The number of pairs (x, y) with x < y, counting ties as half
+            double u = rankSumY - 0.5 * n * (n + 1);
+
+            if (tieSum == 0.0 && m <= 20 && n <= 20) return ExactUpperTail(m, n, (int)Math.Round(u));
+
+            double mean = 0.5 * m * n;
+            double variance = m * n / 12.0 * ((total + 1) - tieSum / ((double)total * (total - 1)));
+            if (variance <= 0.0) return 1.0;
+
+            double z = (u - mean - 0.5) / Math.Sqrt(variance);
+            return 0.5 * Erfc(z / Math.Sqrt(2.0));
+        }
+
+        /// <summary>
+        /// Returns P(U >= u) for samples of sizes m and n without ties, by counting the arrangements with the recurrence
+        /// c(m, n, u) = c(m - 1, n, u - n) + c(m, n - 1, u).
+        /// </summary>
+        private static double ExactUpperTail(int m, int n, int u)
+        {
+            int maximum = m * n;
+            if (u <= 0) return 1.0;
+            if (u > maximum) return 0.0;
+
+            // counts[i, j][k]: the number of arrangements of i x's and j y's with U = k
+            double[,][] counts = new double[m + 1, n + 1][];
+            for (int i = 0; i <= m; i++)
+            {
+                for (int j = 0; j <= n; j++)
+                {
+                    double[] c = new double[i * j + 1];
+                    if (i == 0 || j == 0)
+                    {
+                        c[0] = 1.0;
+                    }
+                    else
+                    {
+                        // The largest value is a y (which exceeds all i x's), or an x
+                        double[] withY = counts[i, j - 1];
+                        double[] withX = counts[i - 1, j];
+                        for (int k = 0; k < withY.Length; k++) c[k + i] += withY[k];
+                        for (int k = 0; k < withX.Length; k++) c[k] += withX[k];
+                    }
+                    counts[i, j] = c;
+                }
+            }
+
+            double[] distribution = counts[m, n];
+            double tail = 0.0;
+            double all = 0.0;
+            for (int k = 0; k <= maximum; k++)
+            {
+                all += distribution[k];
+                if (k >= u) tail += distribution[k];
+            }
+            return tail / all;
+        }
+
+        /// <summary>
+        /// Returns the complementary error function, with a fractional error below 1.2e-7.
+        /// (Chebyshev approximation of Numerical Recipes.)
+        /// </summary>
+        private static double Erfc(double x)
+        {
+            double z = Math.Abs(x);
+            double t = 1.0 / (1.0 + 0.5 * z);
+            double r = t * Math.Exp(-z * z - 1.26551223 + t * (1.00002368 + t * (0.37409196 + t * (0.09678418 +
+                t * (-0.18628806 + t * (0.27886807 + t * (-1.13520398 + t * (1.48851587 +
+                t * (-0.82215223 + t * 0.17087277)))))))));
+            return x >= 0.0 ? r : 2.0 - r;
+        }
+    }
+}
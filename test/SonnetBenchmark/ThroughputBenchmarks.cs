@@ -0,0 +1,419 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Threading;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
+using COIN;
+#endif
+using Sonnet;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// Throughput benchmarks of solving many small models concurrently, as a service with a pool of worker threads does:
+    /// every thread repeatedly builds, generates and solves its own model. Where Sonnet_StressTests.SonnetStressTest2 only
+    /// checks that this doesn't crash, these cases measure the operations per second and the p50/p99 latency per operation,
+    /// from 1 thread up to twice the number of processors, for an LP (Clp) and a MIP (Cbc) workload.
+    /// Three more workloads isolate the shared state that can limit the scaling: the static id counters of the model
+    /// entities (NewEntities, also checked for duplicate ids), SonnetLog.Default (Log), and the managed message handlers
+    /// called from the native solvers (Messages). The lock contentions of the process are counted per run.
+    /// Every thread does a fixed number of operations, so the work per run grows with the number of threads.
+    /// </summary>
+    public static class ThroughputBenchmarks
+    {
+        private const string Suite = "throughput/";
+        private const string ThreadsProperty = "threads";
+
+        /// <summary>
+        /// The number of variables and of constraints created per operation of the NewEntities workload.
+        /// </summary>
+        private const int EntitiesPerOperation = 1000;
+
+        /// <summary>
+        /// The number of messages logged per operation of the Log workload.
+        /// </summary>
+        private const int MessagesPerOperation = 100;
+
+        /// <summary>
+        /// A managed message handler that counts the messages of a solver, as an application handler would process them.
+        /// Every message is a transition from the native solver to managed code.
+        /// </summary>
+        private class CountingMessageHandler : CoinMessageHandler
+        {
+            public int Count { get; private set; }
+
+            public override int print()
+            {
+                if (messageBuffer().Length > 0) Count++;
+                return 0;
+            }
+        }
+
+        /// <summary>
+        /// Runs a number of operations on each of a number of new threads, which start at the same time,
+        /// and records the latency of every operation.
+        /// </summary>
+        private class ThroughputRun
+        {
+            private readonly int threads;
+            private readonly int operations;
+            private readonly Action<int, int> operation;
+            private readonly ManualResetEventSlim start = new ManualResetEventSlim(false);
+            private Exception error;
+
+            /// <param name="threads">The number of threads.</param>
+            /// <param name="operations">The number of operations per thread.</param>
+            /// <param name="operation">The operation, called with the index of the thread and of the operation.</param>
+            public ThroughputRun(int threads, int operations, Action<int, int> operation)
+            {
+                this.threads = threads;
+                this.operations = operations;
+                this.operation = operation;
+                Latencies = new double[threads][];
+                for (int t = 0; t < threads; t++) Latencies[t] = new double[operations];
+            }
+
+            /// <summary>
+            /// Gets the latency of every operation of every thread, in seconds.
+            /// </summary>
+            public double[][] Latencies { get; private set; }
+            /// <summary>
+            /// Gets the time from the start of the threads until all threads finished, in seconds.
+            /// </summary>
+            public double Seconds { get; private set; }
+            /// <summary>
+            /// Gets the number of times there was contention when acquiring a lock (Monitor), in the whole process.
+            /// </summary>
+            public long LockContentions { get; private set; }
+
+            public void Run()
+            {
+                Thread[] workers = new Thread[threads];
+                for (int t = 0; t < threads; t++)
+                {
+                    int thread = t;
+                    workers[t] = new Thread(() => Work(thread));
+                    workers[t].Name = "SonnetBenchmark-throughput-" + (t + 1);
+                    workers[t].Start();
+                }
+
+                long contentions = Monitor.LockContentionCount;
+                System.Diagnostics.Stopwatch stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                start.Set();
+                foreach (Thread worker in workers) worker.Join();
+                Seconds = stopwatch.Elapsed.TotalSeconds;
+                LockContentions = Monitor.LockContentionCount - contentions;
+
+                if (error != null) throw new InvalidOperationException("A throughput benchmark thread failed: " + error.Message, error);
+            }
+
+            private void Work(int thread)
+            {
+                try
+                {
+                    start.Wait();
+                    double[] latencies = Latencies[thread];
+                    for (int i = 0; i < operations; i++)
+                    {
+                        long begin = System.Diagnostics.Stopwatch.GetTimestamp();
+                        operation(thread, i);
+                        latencies[i] = (double)(System.Diagnostics.Stopwatch.GetTimestamp() - begin) / System.Diagnostics.Stopwatch.Frequency;
+                    }
+                }
+                catch (Exception e)
+                {
+                    Interlocked.CompareExchange(ref error, e, null);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Returns the thread counts to measure: the powers of two below the number of processors,
+        /// the number of processors, and then up to the maximum.
+        /// </summary>
+        /// <param name="maximumThreads">The maximum number of threads.</param>
+        /// <returns>The increasing thread counts.</returns>
+        public static int[] GetThreadCounts(int maximumThreads)
+        {
+            SortedSet<int> counts = new SortedSet<int>();
+            for (int n = 1; n < Environment.ProcessorCount && n <= maximumThreads; n *= 2) counts.Add(n);
+            for (int n = Environment.ProcessorCount; n <= maximumThreads; n *= 2) counts.Add(n);
+            counts.Add(maximumThreads);
+            return counts.ToArray();
+        }
+
+        /// <summary>
+        /// Returns the benchmark cases of all workloads for all thread counts.
+        /// </summary>
+        /// <param name="maximumThreads">The maximum number of threads.</param>
+        /// <param name="maximumNodes">The node limit of the MIP solves with Cbc.</param>
+        /// <returns>The benchmark cases.</returns>
+        public static IEnumerable<BenchmarkCase> GetCases(int maximumThreads, int maximumNodes)
+        {
+            int[] threadCounts = GetThreadCounts(maximumThreads);
+
+            foreach (int threads in threadCounts)
+            {
+                yield return NewCase("LP", threads, 40, (thread, i) => SolveTransportation(thread * 1000 + i, null));
+            }
+
+            foreach (int threads in threadCounts)
+            {
+                yield return NewCase("MIP", threads, 8, (thread, i) => SolveKnapsack(thread * 1000 + i, maximumNodes));
+            }
+
+            foreach (int threads in threadCounts)
+            {
+                const int operations = 20;
+                int[][] variableIds = null;
+                int[][] constraintIds = null;
+                BenchmarkCase benchmarkCase = null;
+                benchmarkCase = NewCase("NewEntities", threads, operations,
+                    (thread, i) => NewEntities(variableIds[thread], constraintIds[thread], i * EntitiesPerOperation),
+                    setup: () =>
+                    {
+                        variableIds = NewArrays(threads, operations * EntitiesPerOperation);
+                        constraintIds = NewArrays(threads, operations * EntitiesPerOperation);
+                    },
+                    cleanup: () =>
+                    {
+                        if (!benchmarkCase.IsWarmup)
+                        {
+                            int duplicates = CountDuplicates(variableIds) + CountDuplicates(constraintIds);
+                            benchmarkCase.Properties.TryGetValue("duplicateIds", out double maximum);
+                            benchmarkCase.Properties["duplicateIds"] = Math.Max(maximum, duplicates);
+                        }
+                        variableIds = null;
+                        constraintIds = null;
+                    });
+                yield return benchmarkCase;
+            }
+
+            foreach (int threads in threadCounts)
+            {
+                TextWriter console = null;
+                SonnetLog log = SonnetLog.Default;
+                yield return NewCase("Log", threads, 20,
+                    (thread, i) =>
+                    {
+                        for (int k = 0; k < MessagesPerOperation; k++) log.InfoFormat("Thread {0}: message {1}", thread, i * MessagesPerOperation + k);
+                    },
+                    setup: () =>
+                    {
+                        // The messages are written to the Console by the background thread of SonnetLog: discard them
+                        console = Console.Out;
+                        Console.SetOut(TextWriter.Null);
+                        log.LogLevel = 2;
+                    },
+                    cleanup: () =>
+                    {
+                        log.LogLevel = 1;
+                        log.Flush();
+                        Console.SetOut(console);
+                    });
+            }
+
+            foreach (int threads in threadCounts)
+            {
+                CountingMessageHandler[] handlers = null;
+                BenchmarkCase benchmarkCase = null;
+                benchmarkCase = NewCase("Messages", threads, 40, (thread, i) => SolveTransportation(thread * 1000 + i, handlers[thread]),
+                    setup: () => handlers = Enumerable.Range(0, threads).Select(t => new CountingMessageHandler()).ToArray(),
+                    cleanup: () =>
+                    {
+                        if (!benchmarkCase.IsWarmup) benchmarkCase.Properties["messagesPerOperation"] = handlers.Sum(h => h.Count) / (40.0 * threads);
+                        foreach (CountingMessageHandler handler in handlers) handler.Dispose();
+                        handlers = null;
+                    });
+                yield return benchmarkCase;
+            }
+        }
+
+        /// <summary>
+        /// Create a case that runs the operation on the given number of threads, and sets the properties of the
+        /// measured iterations: the median operations per second, the latency percentiles over all operations,
+        /// and the median number of lock contentions per run.
+        /// </summary>
+        private static BenchmarkCase NewCase(string workload, int threads, int operationsPerThread, Action<int, int> operation,
+            Action setup = null, Action cleanup = null)
+        {
+            List<double> latencies = new List<double>();
+            List<double> throughputs = new List<double>();
+            List<double> contentions = new List<double>();
+            ThroughputRun run = null;
+
+            BenchmarkCase benchmarkCase = null;
+            benchmarkCase = new BenchmarkCase(Suite + workload + "/" + threads,
+                setup: () =>
+                {
+                    if (setup != null) setup();
+                    run = new ThroughputRun(threads, operationsPerThread, operation);
+                },
+                run: () => run.Run(),
+                cleanup: () =>
+                {
+                    if (!benchmarkCase.IsWarmup)
+                    {
+                        latencies.AddRange(run.Latencies.SelectMany(l => l));
+                        throughputs.Add(threads * operationsPerThread / run.Seconds);
+                        contentions.Add(run.LockContentions);
+
+                        double[] values = latencies.ToArray();
+                        benchmarkCase.Properties["operationsPerSecond"] = Statistics.Median(throughputs.ToArray());
+                        benchmarkCase.Properties["latencyP50Milliseconds"] = 1000.0 * Statistics.Percentile(values, 50.0);
+                        benchmarkCase.Properties["latencyP99Milliseconds"] = 1000.0 * Statistics.Percentile(values, 99.0);
+                        benchmarkCase.Properties["lockContentions"] = Statistics.Median(contentions.ToArray());
+                    }
+                    run = null;
+                    if (cleanup != null) cleanup();
+                });
+            benchmarkCase.Properties[ThreadsProperty] = threads;
+            benchmarkCase.Properties["operations"] = threads * operationsPerThread;
+            return benchmarkCase;
+        }
+
+        /// <summary>
+        /// Build and solve a transportation LP of 10 sources and 10 sinks with Clp.
+        /// </summary>
+        /// <param name="seed">The seed of the random data.</param>
+        /// <param name="handler">The message handler to pass to the solver, at log level 1, or null for no messages.</param>
+        /// <returns>The optimal objective value.</returns>
+        private static double SolveTransportation(int seed, CoinMessageHandler handler)
+        {
+            const int n = 10;
+            Random random = new Random(seed);
+            double[] demand = Enumerable.Range(0, n).Select(j => (double)random.Next(20, 100)).ToArray();
+            double supply = Math.Ceiling(1.2 * demand.Sum() / n);
+
+            Variable[] x = new Variable[n * n];
+            for (int k = 0; k < x.Length; k++) x[k] = new Variable();
+
+            Model model = new Model();
+            model.Objective = Enumerable.Range(0, n * n).Sum(k => random.Next(1, 100) * x[k]);
+            model.Add(Enumerable.Range(0, n).ForAll("supply", i => Enumerable.Range(0, n).Sum(j => x[i * n + j]) <= supply));
+            model.Add(Enumerable.Range(0, n).ForAll("demand", j => Enumerable.Range(0, n).Sum(i => x[i * n + j]) >= demand[j]));
+
+            using (Solver solver = new Solver(model, typeof(OsiClpSolverInterface)))
+            {
+                if (handler != null)
+                {
+                    handler.setLogLevel(1);
+                    solver.OsiSolver.passInMessageHandler(handler);
+                }
+                else
+                {
+                    solver.OsiSolver.messageHandler().setLogLevel(0);
+                }
+
+                solver.Minimise();
+                return model.Objective.Value;
+            }
+        }
+
+        /// <summary>
+        /// Build and solve a multi-dimensional knapsack MIP of 40 binary items and 5 capacities with Cbc.
+        /// </summary>
+        /// <param name="seed">The seed of the random data.</param>
+        /// <param name="maximumNodes">The node limit of Cbc.</param>
+        /// <returns>The objective value of the best solution found.</returns>
+        private static double SolveKnapsack(int seed, int maximumNodes)
+        {
+            const int n = 40;
+            const int m = 5;
+            Random random = new Random(seed);
+
+            Variable[] x = new Variable[n];
+            for (int j = 0; j < n; j++) x[j] = new Variable(0.0, 1.0, VariableType.Integer);
+
+            double[][] weights = new double[m][];
+            for (int i = 0; i < m; i++) weights[i] = Enumerable.Range(0, n).Select(j => (double)random.Next(10, 100)).ToArray();
+            // Values correlated with the weights make the instances harder
+            double[] values = Enumerable.Range(0, n).Select(j => weights.Average(w => w[j]) + random.Next(0, 10)).ToArray();
+
+            Model model = new Model();
+            model.Objective = Enumerable.Range(0, n).Sum(j => values[j] * x[j]);
+            model.ObjectiveSense = ObjectiveSense.Maximise;
+            model.Add(Enumerable.Range(0, m).ForAll("capacity", i => Enumerable.Range(0, n).Sum(j => weights[i][j] * x[j]) <= 0.5 * weights[i].Sum()));
+
+            using (Solver solver = MpsBenchmarks.NewSolver(model, typeof(OsiCbcSolverInterface), maximumNodes))
+            {
+                solver.Solve();
+                return model.Objective.Value;
+            }
+        }
+
+        /// <summary>
+        /// Create variables and constraints, and record their ids from the given index on.
+        /// </summary>
+        private static void NewEntities(int[] variableIds, int[] constraintIds, int index)
+        {
+            for (int k = 0; k < EntitiesPerOperation; k++)
+            {
+                Variable variable = new Variable();
+                Constraint constraint = variable <= 1.0;
+                variableIds[index + k] = variable.ID;
+                constraintIds[index + k] = constraint.ID;
+            }
+        }
+
+        private static int[][] NewArrays(int count, int length)
+        {
+            int[][] arrays = new int[count][];
+            for (int i = 0; i < count; i++) arrays[i] = new int[length];
+            return arrays;
+        }
+
+        /// <summary>
+        /// Returns the number of ids that were handed out more than once.
+        /// Sonnet compares model entities by id, so duplicate ids would silently merge variables in expressions.
+        /// </summary>
+        private static int CountDuplicates(int[][] ids)
+        {
+            int count = 0;
+            HashSet<int> seen = new HashSet<int>();
+            foreach (int id in ids.SelectMany(a => a))
+            {
+                if (!seen.Add(id)) count++;
+            }
+            return count;
+        }
+
+        /// <summary>
+        /// Write the operations per second, the speedup and efficiency relative to a single thread, the latency
+        /// percentiles and the lock contentions against the number of threads, per workload.
+        /// </summary>
+        /// <param name="report">The report with the results.</param>
+        /// <param name="writer">The writer to write the table to.</param>
+        public static void WriteTable(BenchmarkReport report, TextWriter writer)
+        {
+            List<BenchmarkResult> results = report.Results
+                .Where(r => r.Name.StartsWith(Suite) && r.Properties.ContainsKey(ThreadsProperty) && r.Properties.ContainsKey("operationsPerSecond"))
+                .ToList();
+            if (results.Count == 0) return;
+
+            writer.WriteLine("{0,-12} {1,8} {2,12} {3,8} {4,11} {5,10} {6,10} {7,12} {8,8}",
+                "Workload", "Threads", "ops/s", "Speedup", "Efficiency", "p50 (ms)", "p99 (ms)", "Contentions", "Dup ids");
+            foreach (IGrouping<string, BenchmarkResult> workload in results.GroupBy(r => r.Name.Substring(Suite.Length, r.Name.LastIndexOf('/') - Suite.Length)))
+            {
+                BenchmarkResult single = workload.FirstOrDefault(r => r.Properties[ThreadsProperty] == 1.0);
+                foreach (BenchmarkResult result in workload.OrderBy(r => r.Properties[ThreadsProperty]))
+                {
+                    double threads = result.Properties[ThreadsProperty];
+                    double throughput = result.Properties["operationsPerSecond"];
+                    double speedup = single != null ? throughput / single.Properties["operationsPerSecond"] : double.NaN;
+                    writer.WriteLine("{0,-12} {1,8} {2,12:F1} {3,8:F2} {4,10:F0}% {5,10:F3} {6,10:F3} {7,12:F0} {8,8}",
+                        workload.Key, threads, throughput, speedup, 100.0 * speedup / threads,
+                        result.Properties["latencyP50Milliseconds"], result.Properties["latencyP99Milliseconds"], result.Properties["lockContentions"],
+                        result.Properties.TryGetValue("duplicateIds", out double duplicates) ? duplicates.ToString() : "-");
+                }
+            }
+            writer.WriteLine();
+        }
+    }
+}
@@ -0,0 +1,230 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// The wrapper suite measures SonnetWrapper itself, so it is not available with SonnetBackend=Native.
+#if (!SONNET_NATIVE)
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using COIN;
+
+namespace SonnetBenchmark
+{
+    /// <summary>
+    /// Microbenchmarks of the marshalling primitives of SonnetWrapper: the array getters and the pinned array setters,
+    /// setting names (via StringToHGlobalAnsi), CoinPackedMatrix.getVector, and the dispatch of native events and
+    /// messages to managed code (CbcDelegateEventHandlerProxy::event and CoinMessageHandlerProxy::print, driven by NativeBenchmarks).
+    /// Every run repeats the operation a number of times, and the results are reported per operation.
+    /// </summary>
+    public static class WrapperBenchmarks
+    {
+        private const string Suite = "wrapper/";
+        private const string OperationsProperty = "operations";
+
+        /// <summary>
+        /// The number of columns (and rows) of the problems for the array operations.
+        /// </summary>
+        private static readonly int[] sizes = { 10, 1000, 100000 };
+
+        /// <summary>
+        /// The number of operations per run of the callback cases.
+        /// </summary>
+        private const int Dispatches = 100000;
+
+        /// <summary>
+        /// A managed message handler that does nothing, to measure only the dispatch.
+        /// </summary>
+        private class NullMessageHandler : CoinMessageHandler
+        {
+            public override int print()
+            {
+                return 0;
+            }
+        }
+
+        /// <summary>
+        /// A managed message handler that gets the message text, as the message handler of SonnetLog does.
+        /// </summary>
+        private class TextMessageHandler : CoinMessageHandler
+        {
+            public int Length { get; private set; }
+
+            public override int print()
+            {
+                Length += messageBuffer().Length;
+                return 0;
+            }
+        }
+
+        /// <summary>
+        /// Returns the benchmark cases of the marshalling primitives.
+        /// </summary>
+        /// <returns>The benchmark cases.</returns>
+        public static IEnumerable<BenchmarkCase> GetCases()
+        {
+            foreach (int size in sizes)
+            {
+                int n = size;
+                // About the same number of doubles marshalled per run for all sizes
+                int calls = Math.Max(10, 1000000 / n);
+
+                OsiClpSolverInterface solver = null;
+                double[] values = null;
+                string[] names = null;
+                CoinPackedMatrix matrix = null;
+                Action setup = () => solver = NewSolver(n);
+                Action cleanup = () =>
+                {
+                    solver.Dispose();
+                    solver = null;
+                };
+
+                yield return NewCase("getColSolution", n, calls, setup, () =>
+                {
+                    for (int i = 0; i < calls; i++) values = solver.getColSolution();
+                }, cleanup);
+
+                yield return NewCase("getRowActivity", n, calls, setup, () =>
+                {
+                    for (int i = 0; i < calls; i++) values = solver.getRowActivity();
+                }, cleanup);
+
+                yield return NewCase("getColLower", n, calls, setup, () =>
+                {
+                    for (int i = 0; i < calls; i++) values = solver.getColLower();
+                }, cleanup);
+
+                yield return NewCase("setColLower(array)", n, calls,
+                    () =>
+                    {
+                        solver = NewSolver(n);
+                        values = new double[n];
+                    },
+                    () =>
+                    {
+                        for (int i = 0; i < calls; i++) solver.setColLower(values);
+                    }, cleanup);
+
+                yield return NewCase("setColName", n, n,
+                    () =>
+                    {
+                        solver = NewSolver(n);
+                        names = Enumerable.Range(0, n).Select(j => "x_" + j).ToArray();
+                    },
+                    () =>
+                    {
+                        for (int j = 0; j < n; j++) solver.setColName(j, names[j]);
+                    }, cleanup);
+
+                yield return NewCase("getVector", n, n,
+                    () =>
+                    {
+                        solver = NewSolver(n);
+                        matrix = solver.getMatrixByCol();
+                    },
+                    () =>
+                    {
+                        for (int j = 0; j < n; j++) matrix.getVector(j);
+                    },
+                    () =>
+                    {
+                        matrix = null;
+                        cleanup();
+                    });
+            }
+
+            CbcEventHandler eventHandler = (model, cbcEvent) => CbcAction.noAction;
+            yield return NewCase("CbcEvent", 0, Dispatches, null,
+                () => NativeBenchmarks.dispatchCbcEvents(eventHandler, CbcEvent.node, Dispatches), null);
+
+            CoinMessageHandler messageHandler = null;
+            yield return NewCase("MessagePrint", 0, Dispatches,
+                () => messageHandler = new NullMessageHandler(),
+                () => NativeBenchmarks.dispatchMessages(messageHandler, Dispatches),
+                () => messageHandler.Dispose());
+
+            yield return NewCase("MessagePrint+messageBuffer", 0, Dispatches,
+                () => messageHandler = new TextMessageHandler(),
+                () => NativeBenchmarks.dispatchMessages(messageHandler, Dispatches),
+                () => messageHandler.Dispose());
+        }
+
+        private static BenchmarkCase NewCase(string operation, int size, int operations, Action setup, Action run, Action cleanup)
+        {
+            string name = Suite + operation + (size > 0 ? "/" + size : "");
+            BenchmarkCase benchmarkCase = new BenchmarkCase(name, run, setup, cleanup);
+            benchmarkCase.Properties[OperationsProperty] = operations;
+            if (size > 0) benchmarkCase.Properties["size"] = size;
+            return benchmarkCase;
+        }
+
+        /// <summary>
+        /// Create a solved problem of n columns and n rows, with two nonzeros per column.
+        /// </summary>
+        private static OsiClpSolverInterface NewSolver(int n)
+        {
+            int[] start = new int[n + 1];
+            int[] index = new int[2 * n];
+            double[] value = new double[2 * n];
+            for (int j = 0; j < n; j++)
+            {
+                start[j] = 2 * j;
+                index[2 * j] = j;
+                index[2 * j + 1] = (j + 1) % n;
+                value[2 * j] = 1.0;
+                value[2 * j + 1] = 1.0;
+            }
+            start[n] = 2 * n;
+
+            double[] colLower = new double[n];
+            double[] colUpper = Enumerable.Repeat(10.0, n).ToArray();
+            double[] objective = Enumerable.Repeat(1.0, n).ToArray();
+            double[] rowLower = Enumerable.Repeat(1.0, n).ToArray();
+            double[] rowUpper = Enumerable.Repeat(100.0, n).ToArray();
+
+            OsiClpSolverInterface solver = new OsiClpSolverInterface();
+            solver.messageHandler().setLogLevel(0);
+            solver.loadProblem(n, n, start, index, value, colLower, colUpper, objective, rowLower, rowUpper);
+            solver.initialSolve();
+            return solver;
+        }
+
+        /// <summary>
+        /// Add the median time (ns) and the median allocated bytes per operation as properties of the wrapper results.
+        /// </summary>
+        /// <param name="report">The report with the results.</param>
+        public static void AddPerOperation(BenchmarkReport report)
+        {
+            foreach (BenchmarkResult result in report.Results)
+            {
+                if (!result.Name.StartsWith(Suite) || !result.Properties.TryGetValue(OperationsProperty, out double operations)) continue;
+
+                result.Properties["nanosecondsPerOperation"] = 1e9 * result.MedianSeconds / operations;
+                result.Properties["bytesPerOperation"] = result.MedianAllocatedBytes / operations;
+            }
+        }
+
+        /// <summary>
+        /// Write the time (ns) and allocated bytes per operation of the wrapper results.
+        /// </summary>
+        /// <param name="report">The report with the results.</param>
+        /// <param name="writer">The writer to write the table to.</param>
+        public static void WriteTable(BenchmarkReport report, TextWriter writer)
+        {
+            List<BenchmarkResult> results = report.Results.Where(r => r.Name.StartsWith(Suite) && r.Properties.ContainsKey(OperationsProperty)).ToList();
+            if (results.Count == 0) return;
+
+            int width = Math.Max(20, results.Max(r => r.Name.Length));
+            writer.WriteLine("{0} {1,14} {2,12} {3,10}", "Name".PadRight(width), "ns/op", "bytes/op", "Gen0 GCs");
+            foreach (BenchmarkResult result in results)
+            {
+                double operations = result.Properties[OperationsProperty];
+                writer.WriteLine("{0} {1,14:F1} {2,12:F1} {3,10}", result.Name.PadRight(width),
+                    1e9 * result.MedianSeconds / operations, result.MedianAllocatedBytes / operations, result.Collections[0]);
+            }
+            writer.WriteLine();
+        }
+    }
+}
+#endif
@@ -0,0 +1,62 @@
+#!/bin/sh
+# Run the fixed benchmark set of the regression gate (SonnetBenchmark --gate) and compare the results with the
+# checked-in baseline of this platform: test/SonnetBenchmark/baselines/<os>-<arch>.json.
+# Runs locally, without any services.
+#
+# Usage: regression-gate.sh <directory of SonnetBenchmark.dll> [--update] [other SonnetBenchmark options]
+#   --update  Write the results as the new baseline of this platform (to be committed), instead of comparing.
+#             The gate is run GATE_RUNS times (default 5), each in a new process, and the runs are merged, such that
+#             the baseline also covers the variation between runs. This requires a host with at least two processors.
+#
+# The exit code is 0 if there are no regressions, 1 if there are, and 2 on errors.
+
+if [ $# -lt 1 ] || [ ! -f "$1/SonnetBenchmark.dll" ]; then
+  echo "ERROR: SonnetBenchmark.dll not found. Usage: $0 <directory of SonnetBenchmark.dll> [--update] [options]" >&2
+  exit 2
+fi
+
+bindir=$(cd "$1" && pwd)
+shift
+baselinedir=$(cd "$(dirname "$0")" && pwd)/baselines
+os=$(uname -s | tr 'A-Z' 'a-z')
+case "$os" in
+  mingw*|msys*|cygwin*) os=windows ;;
+esac
+platform=$os-$(uname -m)
+baseline=$baselinedir/$platform.json
+
+update=0
+if [ "$1" = "--update" ]; then
+  update=1
+  shift
+fi
+
+# The MPS files are next to SonnetBenchmark.dll
+cd "$bindir" || exit 2
+
+if [ $update -eq 1 ]; then
+  processors=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo "${NUMBER_OF_PROCESSORS:-1}")
+  if [ "$processors" -lt 2 ]; then
+    echo "ERROR: A baseline must be measured on a host with at least two processors, but this host has $processors." >&2
+    exit 2
+  fi
+  runs=${GATE_RUNS:-5}
+  mkdir -p "$baselinedir" || exit 2
+  files=""
+  run=1
+  while [ $run -le "$runs" ]; do
+    echo "Baseline run $run of $runs"
+    dotnet SonnetBenchmark.dll --gate --output "SonnetBenchmark-baseline-$run.json" "$@" || exit 2
+    files="$files SonnetBenchmark-baseline-$run.json"
+    run=$((run + 1))
+  done
+  dotnet SonnetBenchmark.dll merge "$baseline" $files
+  exit $?
+fi
+
+if [ ! -f "$baseline" ]; then
+  echo "ERROR: No baseline for $platform: $baseline. Create it with: $0 $bindir --update" >&2
+  exit 2
+fi
+
+dotnet SonnetBenchmark.dll --gate --output SonnetBenchmark-gate.json --baseline "$baseline" "$@"
@@ -0,0 +1,329 @@
+// Copyright (C) Jan-Willem Goossens 
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+// Native tests of the C ABI of SonnetNative, without .NET. Run from the test folder (for brandy.mps and egout.mps),
+// or pass the folder of the mps files as the first argument.
+
+#include <SonnetNative.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(condition) \
+	do { if (!(condition)) { std::printf("%s:%d: CHECK failed: %s (last error: %s)\n", __FILE__, __LINE__, #condition, SonnetNative_lastError()); failures++; } } while (0)
+
+static bool equalsDouble(double a, double b)
+{
+	return std::fabs(a - b) <= 1e-4 * (1.0 + std::fabs(b));
+}
+
+static std::string folder;
+
+static std::string path(const char *fileName)
+{
+	return folder.empty() ? std::string(fileName) : folder + "/" + fileName;
+}
+
+// max 3x + 2y st x + y <= 4, x + 3y <= 6, 0 <= x <= 3, y >= 0. Optimal x = 3, y = 1, objective 11.
+static void loadSmallLp(SonnetOsi *solver)
+{
+	const int starts[] = { 0, 2, 4 };
+	const int indices[] = { 0, 1, 0, 1 };
+	const double values[] = { 1.0, 1.0, 1.0, 3.0 };
+	const double columnLower[] = { 0.0, 0.0 };
+	const double columnUpper[] = { 3.0, SonnetOsi_getInfinity(solver) };
+	const double objective[] = { 3.0, 2.0 };
+	const double rowLower[] = { -SonnetOsi_getInfinity(solver), -SonnetOsi_getInfinity(solver) };
+	const double rowUpper[] = { 4.0, 6.0 };
+
+	CHECK(SonnetOsi_loadProblem(solver, 2, 2, starts, indices, values, columnLower, columnUpper, objective, rowLower, rowUpper) == SONNET_OK);
+	CHECK(SonnetOsi_setObjSense(solver, -1.0) == SONNET_OK);
+}
+
+static void testVersion()
+{
+	CHECK(SonnetNative_version() == SONNET_NATIVE_VERSION);
+	CHECK(SonnetNative_lastError() != nullptr);
+}
+
+static void testSmallLp()
+{
+	SonnetOsi *solver = SonnetOsi_newClp();
+	CHECK(solver != nullptr);
+	CHECK(SonnetOsi_setLogLevel(solver, 0) == SONNET_OK);
+	loadSmallLp(solver);
+
+	CHECK(SonnetOsi_getNumCols(solver) == 2);
+	CHECK(SonnetOsi_getNumRows(solver) == 2);
+	CHECK(SonnetOsi_getNumElements(solver) == 4);
+
+	CHECK(SonnetOsi_initialSolve(solver) == SONNET_OK);
+	CHECK(SonnetOsi_isProvenOptimal(solver) == 1);
+	CHECK(equalsDouble(SonnetOsi_getObjValue(solver), 11.0));
+
+	// The getters return the size, and copy at most length values
+	CHECK(SonnetOsi_getColSolution(solver, nullptr, 0) == 2);
+	double solution[2] = { 0.0, 0.0 };
+	CHECK(SonnetOsi_getColSolution(solver, solution, 2) == 2);
+	CHECK(equalsDouble(solution[0], 3.0) && equalsDouble(solution[1], 1.0));
+
+	double activity[2];
+	CHECK(SonnetOsi_getRowActivity(solver, activity, 2) == 2);
+	CHECK(equalsDouble(activity[0], 4.0) && equalsDouble(activity[1], 6.0));
+
+	char sense[2];
+	CHECK(SonnetOsi_getRowSense(solver, sense, 2) == 2);
+	CHECK(sense[0] == 'L' && sense[1] == 'L');
+
+	// The matrix is returned without gaps, column-ordered
+	int numberElements = SonnetOsi_getMatrixByCol(solver, nullptr, 0, nullptr, nullptr, 0);
+	CHECK(numberElements == 4);
+	std::vector<int> starts(3), indices(numberElements);
+	std::vector<double> values(numberElements);
+	CHECK(SonnetOsi_getMatrixByCol(solver, starts.data(), 3, indices.data(), values.data(), numberElements) == 4);
+	CHECK(starts[0] == 0 && starts[1] == 2 && starts[2] == 4);
+	CHECK(values[3] == 3.0 && indices[3] == 1);
+
+	// Bulk bounds, and resolve: x <= 1 gives y = 5/3, objective 3 + 10/3
+	const int columns[] = { 0 };
+	const double lower[] = { 0.0 };
+	const double upper[] = { 1.0 };
+	CHECK(SonnetOsi_setColSetBounds(solver, 1, columns, lower, upper) == SONNET_OK);
+	CHECK(SonnetOsi_resolve(solver) == SONNET_OK);
+	CHECK(SonnetOsi_isProvenOptimal(solver) == 1);
+	CHECK(equalsDouble(SonnetOsi_getObjValue(solver), 3.0 + 10.0 / 3.0));
+
+	// Warm start via the basis status
+	std::vector<int> columnStatus(2), rowStatus(2);
+	CHECK(SonnetOsi_getBasisStatus(solver, columnStatus.data(), rowStatus.data()) == SONNET_OK);
+	CHECK(SonnetOsi_setBasisStatus(solver, columnStatus.data(), rowStatus.data()) == 0);
+	CHECK(SonnetOsi_resolve(solver) == SONNET_OK);
+	CHECK(SonnetOsi_getIterationCount(solver) == 0);
+
+	SonnetOsi_delete(solver);
+}
+
+struct MessageCount
+{
+	int messages;
+	int lastExternalNumber;
+};
+
+static int countMessage(void *context, int externalNumber, int, const char *, const char *text)
+{
+	MessageCount *count = static_cast<MessageCount *>(context);
+	count->messages++;
+	count->lastExternalNumber = externalNumber;
+	return text != nullptr ? 0 : 1;
+}
+
+// The functions used by Sonnet itself when built on SonnetNative (SonnetBackend=Native)
+static void testSonnetFunctions()
+{
+	SonnetOsi *solver = SonnetOsi_newClp();
+	CHECK(SonnetOsi_setLogLevel(solver, 0) == SONNET_OK);
+	loadSmallLp(solver);
+	CHECK(SonnetOsi_initialSolve(solver) == SONNET_OK);
+
+	// The pointers of the solver itself, without copying
+	const double *solution = SonnetOsi_getColSolutionPtr(solver);
+	CHECK(solution != nullptr && equalsDouble(solution[0], 3.0) && equalsDouble(solution[1], 1.0));
+	CHECK(SonnetOsi_getColUpperPtr(solver)[0] == 3.0);
+	CHECK(SonnetOsi_isInteger(solver, 1) == 0);
+	CHECK(SonnetOsi_isInteger(solver, 2) == SONNET_ERROR);
+
+	// Ranging of the objective coefficient of x
+	SonnetClp *model = SonnetOsi_getClpModelPtr(solver);
+	CHECK(model != nullptr);
+	const int which[] = { 0 };
+	double costIncrease[1], costDecrease[1];
+	int sequenceIncrease[1], sequenceDecrease[1];
+	CHECK(SonnetClp_dualRanging(model, 1, which, costIncrease, sequenceIncrease, costDecrease, sequenceDecrease) == 0);
+
+	// x + 2y <= 4 gives y = 1/2, objective 10. The saved bounds and the warm start of before are accepted after the change.
+	SonnetWarmStart *warmStart = SonnetOsi_getWarmStart(solver);
+	CHECK(warmStart != nullptr);
+	CHECK(SonnetOsi_saveBaseModel(solver) == SONNET_OK);
+	CHECK(SonnetClp_modifyCoefficient(model, 0, 1, 2.0) == SONNET_OK);
+	CHECK(SonnetOsi_resolve(solver) == SONNET_OK);
+	CHECK(equalsDouble(SonnetOsi_getObjValue(solver), 10.0));
+	CHECK(SonnetOsi_restoreBaseModel(solver, 2) == SONNET_OK);
+	CHECK(SonnetOsi_setWarmStart(solver, warmStart) == 1);
+	SonnetWarmStart_delete(warmStart);
+
+	// Messages of Sonnet itself are printed by the handler of the solver, at its log level
+	MessageCount count = { 0, -1 };
+	SonnetMessageHandler *handler = SonnetMessageHandler_new(countMessage, &count);
+	CHECK(SonnetMessageHandler_setLogLevel(handler, 1) == SONNET_OK);
+	CHECK(SonnetMessageHandler_message(handler, 3000, 1, "SNNT", "warning") == SONNET_OK);
+	CHECK(SonnetMessageHandler_message(handler, 0, 3, "SNNT", "debug") == SONNET_OK);
+	CHECK(count.messages == 1 && count.lastExternalNumber == 3000);
+	SonnetMessageHandler_delete(handler);
+
+	SonnetOsi_delete(solver);
+}
+
+static void testNames()
+{
+	SonnetOsi *solver = SonnetOsi_newClp();
+	loadSmallLp(solver);
+	// Keep the names
+	CHECK(SonnetOsi_setIntParam(solver, 2 /* OsiNameDiscipline */, 2) == 1);
+
+	const char columnNames[] = "x\0y";
+	CHECK(SonnetOsi_setColNames(solver, 0, 2, columnNames) == SONNET_OK);
+	CHECK(SonnetOsi_setObjName(solver, "profit") == SONNET_OK);
+
+	int size = SonnetOsi_getColNames(solver, nullptr, 0);
+	CHECK(size == 4);
+	std::vector<char> buffer(size);
+	CHECK(SonnetOsi_getColNames(solver, buffer.data(), size) == size);
+	CHECK(std::strcmp(buffer.data(), "x") == 0 && std::strcmp(buffer.data() + 2, "y") == 0);
+
+	char name[16];
+	CHECK(SonnetOsi_getObjName(solver, name, sizeof(name)) == 7);
+	CHECK(std::strcmp(name, "profit") == 0);
+
+	SonnetOsi_delete(solver);
+}
+
+static void testErrors()
+{
+	SonnetOsi *solver = SonnetOsi_newClp();
+	loadSmallLp(solver);
+
+	// Exceptions do not pass the ABI, but set the last error
+	const double values[] = { 1.0 };
+	CHECK(SonnetOsi_setColLower(solver, 2, 1, values) == SONNET_ERROR);
+	CHECK(std::strlen(SonnetNative_lastError()) > 0);
+	CHECK(SonnetOsi_passInMessageHandler(solver, nullptr) == SONNET_ERROR);
+
+	// A missing file is not an exception but a number of errors
+	CHECK(SonnetOsi_setLogLevel(solver, 0) == SONNET_OK);
+	CHECK(SonnetOsi_readMps(solver, path("doesnotexist").c_str(), "mps") != 0);
+
+	SonnetOsi_delete(solver);
+}
+
+static void testBrandy()
+{
+	MessageCount count = { 0, -1 };
+	SonnetMessageHandler *handler = SonnetMessageHandler_new(countMessage, &count);
+	CHECK(handler != nullptr);
+	CHECK(SonnetMessageHandler_setLogLevel(handler, 1) == SONNET_OK);
+	CHECK(SonnetMessageHandler_logLevel(handler) == 1);
+
+	SonnetOsi *solver = SonnetOsi_newClp();
+	CHECK(SonnetOsi_passInMessageHandler(solver, handler) == SONNET_OK);
+	CHECK(SonnetOsi_readMps(solver, path("brandy.mps").c_str(), "mps") == 0);
+
+	CHECK(SonnetOsi_initialSolve(solver) == SONNET_OK);
+	CHECK(SonnetOsi_isProvenOptimal(solver) == 1);
+	CHECK(equalsDouble(SonnetOsi_getObjValue(solver), 1518.50989649));
+	CHECK(count.messages > 0);
+
+	// The same problem solved by ClpSimplex directly
+	SonnetClp *model = SonnetClp_new();
+	CHECK(SonnetClp_setLogLevel(model, 0) == SONNET_OK);
+	CHECK(SonnetClp_readMps(model, path("brandy.mps").c_str(), 1, 0) == 0);
+	CHECK(SonnetClp_getNumCols(model) == SonnetOsi_getNumCols(solver));
+	CHECK(SonnetClp_dual(model, 0) >= 0);
+	CHECK(SonnetClp_status(model) == 0);
+	CHECK(equalsDouble(SonnetClp_objectiveValue(model), 1518.50989649));
+	SonnetClp_delete(model);
+
+	SonnetOsi_delete(solver);
+	SonnetMessageHandler_delete(handler);
+}
+
+static int countEvent(void *context, SonnetCbc *model, int)
+{
+	int *events = static_cast<int *>(context);
+	(*events)++;
+	return model != nullptr ? -1 : 0; // noAction
+}
+
+static void testEgout()
+{
+	SonnetMpsIO *io = SonnetMpsIO_new();
+	CHECK(SonnetMpsIO_readMps(io, path("egout.mps").c_str(), "mps") == 0);
+	int numberColumns = SonnetMpsIO_getNumCols(io);
+	std::vector<unsigned char> integers(numberColumns);
+	CHECK(SonnetMpsIO_getIntegerColumns(io, integers.data(), numberColumns) == numberColumns);
+	int numberIntegers = 0;
+	for (unsigned char isInteger : integers) numberIntegers += isInteger;
+	CHECK(numberIntegers > 0);
+	std::vector<char> names(SonnetMpsIO_getColNames(io, nullptr, 0));
+	CHECK(SonnetMpsIO_getColNames(io, names.data(), static_cast<int>(names.size())) == static_cast<int>(names.size()));
+	SonnetMpsIO_delete(io);
+
+	SonnetOsi *solver = SonnetOsi_newCbc();
+	CHECK(SonnetOsi_setLogLevel(solver, 0) == SONNET_OK);
+	CHECK(SonnetOsi_readMps(solver, path("egout.mps").c_str(), "mps") == 0);
+	CHECK(SonnetOsi_getNumCols(solver) == numberColumns);
+	CHECK(SonnetOsi_getNumIntegers(solver) == numberIntegers);
+
+	int events = 0;
+	SonnetEventHandler *handler = SonnetEventHandler_new(countEvent, &events);
+	SonnetCbc *model = SonnetOsi_getCbcModelPtr(solver);
+	CHECK(model != nullptr);
+	CHECK(SonnetCbc_setLogLevel(model, 0) == SONNET_OK);
+	CHECK(SonnetCbc_passInEventHandler(model, handler) == SONNET_OK);
+
+	CHECK(SonnetCbc_branchAndBound(model) == SONNET_OK);
+	CHECK(SonnetCbc_isProvenOptimal(model) == 1);
+	CHECK(equalsDouble(SonnetCbc_getObjValue(model), 568.1007));
+	CHECK(SonnetCbc_bestSolution(model, nullptr, 0) == numberColumns);
+	CHECK(events > 0);
+
+	// The best solution as a MIP start of a new branch and bound, from the reference solver
+	std::vector<double> best(numberColumns);
+	CHECK(SonnetCbc_bestSolution(model, best.data(), numberColumns) == numberColumns);
+	CHECK(SonnetOsi_saveCbcReferenceSolver(solver) == SONNET_OK);
+	solver = SonnetOsi_resetCbcToReferenceSolver(solver);
+	CHECK(solver != nullptr);
+	model = SonnetOsi_getCbcModelPtr(solver);
+	CHECK(SonnetCbc_setLogLevel(model, 0) == SONNET_OK);
+	CHECK(SonnetCbc_setBestSolution(model, best.data(), numberColumns, 568.1007, 1) == SONNET_OK);
+	CHECK(SonnetCbc_clearDefaultStrategy(model) == 1);
+	CHECK(SonnetCbc_branchAndBound(model) == SONNET_OK);
+	CHECK(equalsDouble(SonnetCbc_getObjValue(model), 568.1007));
+
+	// Solved by CbcMain, as the Sonnet Solver for OsiCbc
+	SonnetCbc *copy = SonnetCbc_new(SonnetOsi_getRealSolverPtr(solver));
+	CHECK(copy != nullptr);
+	const char *argv[] = { "Sonnet", "-log", "0", "-solve", "-quit" };
+	CHECK(SonnetCbc_main(copy, 5, argv, 60.0) >= 0);
+	CHECK(equalsDouble(SonnetOsi_getObjValue(SonnetCbc_solver(copy)), 568.1007));
+	SonnetCbc_delete(copy);
+
+	SonnetOsi_delete(solver);
+	SonnetEventHandler_delete(handler);
+}
+
+int main(int argc, char **argv)
+{
+	if (argc > 1) folder = argv[1];
+
+	testVersion();
+	testSmallLp();
+	testSonnetFunctions();
+	testNames();
+	testErrors();
+	testBrandy();
+	testEgout();
+
+	if (failures > 0)
+	{
+		std::printf("SonnetNativeTest: %d checks failed\n", failures);
+		return 1;
+	}
+
+	std::printf("SonnetNativeTest: all tests passed\n");
+	return 0;
+}
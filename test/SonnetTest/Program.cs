@@ -7,6 +7,11 @@ using System.Linq;
 using System.Reflection;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 using Sonnet;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
+using COIN;
+#endif
 
 namespace SonnetTest
 {
@@ -30,6 +35,13 @@ namespace SonnetTest
         /// <param name="args"></param>
         public static void Main(string[] args)
         {
+            // The test executable is also used as worker process by the tests of the SolverWorkerPool
+            if (SolverWorker.IsWorker(args))
+            {
+                SolverWorker.Run();
+                return;
+            }
+
             System.GC.Collect(); // Force Gc.Collect to ensure that indeed all memory is properly freed.
             System.GC.WaitForPendingFinalizers();
             double startMemoryGb = Utils.AvailableMemoryGb;
@@ -63,8 +75,7 @@ namespace SonnetTest
                         if (p.Length == 0)
                         {
                             Console.WriteLine($"Starting test {method.Name} ()");
-                            method.Invoke(testInstance, null);
-                            Console.WriteLine($"Finished test {method.Name}: Passed");
+                            Invoke(method, testInstance, null, method.Name);
                         }
                         else if (p.Length == 1)
                         {
@@ -81,8 +92,7 @@ namespace SonnetTest
                                 foreach (var data in datas)
                                 {
                                     Console.WriteLine($"Starting test {method.Name} ({string.Join(",", data)})");
-                                    method.Invoke(testInstance, data);
-                                    Console.WriteLine($"Finished test {method.Name} ({string.Join(",", data)}): Passed");
+                                    Invoke(method, testInstance, data, $"{method.Name} ({string.Join(",", data)})");
                                 }
                             }
                             Console.WriteLine($"Finished test {method.Name}: Passed");
@@ -100,6 +110,22 @@ namespace SonnetTest
             Console.WriteLine($"Available Memory at the start of testing: {startMemoryGb} (GB)");
             Console.WriteLine($"Available Memory at the end of testing: {endMemoryGb} (GB)");
         }
+
+        /// <summary>
+        /// Runs the test method, and reports it as skipped instead of failed if it is inconclusive, e.g., not supported by the SonnetBackend.
+        /// </summary>
+        private static void Invoke(MethodInfo method, object testInstance, object[] data, string testName)
+        {
+            try
+            {
+                method.Invoke(testInstance, data);
+                Console.WriteLine($"Finished test {testName}: Passed");
+            }
+            catch (TargetInvocationException exception) when (exception.InnerException is AssertInconclusiveException)
+            {
+                Console.WriteLine($"Finished test {testName}: Skipped. {exception.InnerException.Message}");
+            }
+        }
     }
     public static class Utils
     {
@@ -110,8 +136,8 @@ namespace SonnetTest
                 //return Solver.GetOsiSolverTypes().Select(t => new object[] { t }).ToArray();
                 return new[]
                 {
-                    new object[] { typeof(COIN.OsiCbcSolverInterface) },
-                    new object[] { typeof(COIN.OsiClpSolverInterface) }
+                    new object[] { typeof(OsiCbcSolverInterface) },
+                    new object[] { typeof(OsiClpSolverInterface) }
                 };
             }
         }
@@ -4,7 +4,11 @@
 using System;
 using System.Collections.Generic;
 using System.Linq;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
 using COIN;
+#endif
 using Sonnet;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 
@@ -34,7 +38,7 @@ namespace SonnetTest
         {
             Console.WriteLine("SonnetTest1");
 
-            Ensure.Is<COIN.OsiSolverInterface>(solverType, nameof(solverType));
+            Ensure.Is<OsiSolverInterface>(solverType, nameof(solverType));
 
             Model model = new Model();
             Solver solver = new Solver(model, solverType);
@@ -1846,17 +1850,17 @@ namespace SonnetTest
             Solver solver;
             int value;
 
-            solver = new Solver(model, typeof(COIN.OsiClpSolverInterface));
+            solver = new Solver(model, typeof(OsiClpSolverInterface));
             solver.OsiSolver.setIntParam(OsiIntParam.OsiMaxNumIteration, 1234);
             solver.OsiSolver.getIntParam(OsiIntParam.OsiMaxNumIteration, out value);
             Assert.IsTrue(value == 1234);
 
-            solver = new Solver(model, typeof(COIN.OsiCbcSolverInterface));// new: we DONT copy parameters
+            solver = new Solver(model, typeof(OsiCbcSolverInterface));// new: we DONT copy parameters
             solver.OsiSolver.setIntParam(OsiIntParam.OsiMaxNumIteration, 1234);
             solver.OsiSolver.getIntParam(OsiIntParam.OsiMaxNumIteration, out value);
             Assert.IsTrue(value == 1234);
 
-            solver = new Solver(model, typeof(COIN.OsiClpSolverInterface)); // new: we DONT copy parameters
+            solver = new Solver(model, typeof(OsiClpSolverInterface)); // new: we DONT copy parameters
             solver.OsiSolver.setIntParam(OsiIntParam.OsiMaxNumIteration, 1234);
             solver.OsiSolver.getIntParam(OsiIntParam.OsiMaxNumIteration, out value);
             Assert.IsTrue(value == 1234);
@@ -2282,14 +2286,14 @@ namespace SonnetTest
             //first,use coin wrapper directly
             {
                 object rawSolver = Activator.CreateInstance(solverType);
-                COIN.OsiSolverInterface solver = (COIN.OsiSolverInterface)rawSolver;
+                OsiSolverInterface solver = (OsiSolverInterface)rawSolver;
                 solver.readMps(filename);
 
                 solver.initialSolve();
                 var warmStart = solver.getWarmStart();
 
                 //now, restart but with limited iter max.
-                solver = (COIN.OsiSolverInterface)Activator.CreateInstance(solverType);
+                solver = (OsiSolverInterface)Activator.CreateInstance(solverType);
                 solver.readMps(filename);
 
                 int maxNumIteration;
@@ -2610,6 +2614,1386 @@ namespace SonnetTest
             Assert.IsNotNull(model, $"Model file {mpsfile} failed to load.");
         }
 
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod, TestCategory("Probe")]
+        public void SonnetTest41(Type solverType)
+        {
+            Console.WriteLine("SonnetTest41 - Test probing bound changes from hot start");
+
+            Model model = new Model();
+            Variable x = new Variable("x");
+            Variable y = new Variable("y");
+            Constraint con0 = x + 2 * y <= 4;
+            Constraint con1 = 3 * x + y <= 6;
+            model.Add("con0", con0);
+            model.Add("con1", con1);
+            model.Objective = x + y;
+
+            Solver solver = new Solver(model, solverType);
+
+            // probing requires a solved, optimal LP
+            bool failed = false;
+            try
+            {
+                solver.Probe(new BoundChange[] { BoundChange.Fix(x, 0.0) });
+            }
+            catch (SonnetException)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+
+            solver.Maximise();
+
+            Assert.IsTrue(solver.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 2.8));
+
+            solver.HotStartIterationLimit = 100;
+            Assert.IsTrue(solver.HotStartIterationLimit == 100);
+
+            var probes = new List<BoundChange[]>();
+            probes.Add(new BoundChange[] { BoundChange.Fix(x, 0.0) });
+            probes.Add(new BoundChange[] { BoundChange.Fix(y, 0.0) });
+            probes.Add(new BoundChange[] { new BoundChange(con0, 0.0, 2.0) });
+            probes.Add(new BoundChange[] { BoundChange.Fix(x, 0.0), BoundChange.Fix(y, 0.0) });
+            probes.Add(new BoundChange[] { new BoundChange(x, 3.0, 4.0) });
+
+            ProbeResult[] results = solver.Probe(probes);
+            foreach (ProbeResult result in results) Console.WriteLine(result);
+
+            Assert.IsTrue(results.Length == 5);
+            Assert.IsTrue(results[0].IsProvenOptimal && Utils.EqualsDouble(results[0].ObjectiveValue, 2.0));
+            Assert.IsTrue(results[1].IsProvenOptimal && Utils.EqualsDouble(results[1].ObjectiveValue, 2.0));
+            Assert.IsTrue(results[2].IsProvenOptimal && Utils.EqualsDouble(results[2].ObjectiveValue, 2.0));
+            Assert.IsTrue(results[3].IsProvenOptimal && Utils.EqualsDouble(results[3].ObjectiveValue, 0.0));
+            Assert.IsFalse(results[4].IsProvenOptimal);
+
+            // probing does not change the solution of the variables and constraints, nor the bounds
+            Assert.IsTrue(Utils.EqualsDouble(x.Value, 1.6));
+            Assert.IsTrue(Utils.EqualsDouble(y.Value, 1.2));
+            Assert.IsTrue(Utils.EqualsDouble(con1.Value, 6.0));
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 2.8));
+
+            solver.Resolve();
+            Assert.IsTrue(solver.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 2.8));
+            Assert.IsTrue(Utils.EqualsDouble(x.Value, 1.6));
+
+            // not after a MIP solve, since the solver then has no LP solution to start from
+            x.Type = VariableType.Integer;
+            solver.Maximise();
+            Assert.IsTrue(solver.IsProvenOptimal);
+            failed = false;
+            try
+            {
+                solver.Probe(new BoundChange[] { BoundChange.Fix(y, 0.0) });
+            }
+            catch (SonnetException)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+
+            // but again after solving the relaxation
+            solver.Maximise(true);
+            Assert.IsTrue(solver.Probe(new BoundChange[] { BoundChange.Fix(y, 0.0) }).IsProvenOptimal);
+
+            // and not for an infeasible LP
+            x.Type = VariableType.Continuous;
+            x.Lower = 5.0;
+            solver.Maximise();
+            Assert.IsFalse(solver.IsProvenOptimal);
+            failed = false;
+            try
+            {
+                solver.Probe(new BoundChange[] { BoundChange.Fix(y, 0.0) });
+            }
+            catch (SonnetException)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+        }
+
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod, TestCategory("Ranging")]
+        public void SonnetTest42(Type solverType)
+        {
+            Console.WriteLine("SonnetTest42 - Test objective and rhs ranging");
+
+            Model model = new Model();
+            Variable x = new Variable("x");
+            Variable y = new Variable("y");
+            Constraint con0 = x + 2 * y <= 4;
+            Constraint con1 = 3 * x + y <= 6;
+            model.Add("con0", con0);
+            model.Add("con1", con1);
+            model.Objective = x + y;
+
+            Solver solver = new Solver(model, solverType);
+            solver.Maximise();
+
+            Assert.IsTrue(solver.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 2.8));
+
+            // the basis remains optimal while the slope of the objective is between the slopes of the constraints
+            Dictionary<Variable, SensitivityRange> objectiveRanges = solver.GetObjectiveRanges();
+            Assert.IsTrue(objectiveRanges.Count == 2);
+            Console.WriteLine("x: " + objectiveRanges[x]);
+            Console.WriteLine("y: " + objectiveRanges[y]);
+            Assert.IsTrue(Utils.EqualsDouble(objectiveRanges[x].Value, 1.0));
+            Assert.IsTrue(Utils.EqualsDouble(objectiveRanges[x].Lower, 0.5));
+            Assert.IsTrue(Utils.EqualsDouble(objectiveRanges[x].Upper, 3.0));
+            Assert.IsTrue(Utils.EqualsDouble(objectiveRanges[y].Lower, 1.0 / 3.0));
+            Assert.IsTrue(Utils.EqualsDouble(objectiveRanges[y].Upper, 2.0));
+
+            SensitivityRange[] selectedRanges = solver.GetObjectiveRanges(new Variable[] { y });
+            Assert.IsTrue(selectedRanges.Length == 1);
+            Assert.IsTrue(Utils.EqualsDouble(selectedRanges[0].Upper, 2.0));
+
+            Dictionary<Constraint, SensitivityRange> rhsRanges = solver.GetRhsRanges();
+            Assert.IsTrue(rhsRanges.Count == 2);
+            Console.WriteLine("con0: " + rhsRanges[con0]);
+            Console.WriteLine("con1: " + rhsRanges[con1]);
+            Assert.IsTrue(Utils.EqualsDouble(rhsRanges[con0].Value, 4.0));
+            Assert.IsTrue(Utils.EqualsDouble(rhsRanges[con0].Lower, 2.0));
+            Assert.IsTrue(Utils.EqualsDouble(rhsRanges[con0].Upper, 12.0));
+            Assert.IsTrue(Utils.EqualsDouble(rhsRanges[con1].Lower, 2.0));
+            Assert.IsTrue(Utils.EqualsDouble(rhsRanges[con1].Upper, 12.0));
+
+            // ranging does not change the solution
+            Assert.IsTrue(Utils.EqualsDouble(x.Value, 1.6));
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 2.8));
+        }
+
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod]
+        public void SonnetTest43(Type solverType)
+        {
+            Console.WriteLine("SonnetTest43 - Test lazy solution assignment");
+
+            string filename = "brandy.mps";
+            Model modelEager = Model.New(filename, out Variable[] variablesEager);
+            Solver solverEager = new Solver(modelEager, solverType);
+            solverEager.Minimise();
+
+            Model modelLazy = Model.New(filename, out Variable[] variablesLazy);
+            Solver solverLazy = new Solver(modelLazy, solverType);
+            solverLazy.LazySolutionAssignment = true;
+            solverLazy.Minimise();
+
+            Assert.IsTrue(solverLazy.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(modelEager.Objective.Value, modelLazy.Objective.Value));
+
+            Assert.IsTrue(variablesEager.Length == variablesLazy.Length);
+            for (int j = 0; j < variablesEager.Length; j++)
+            {
+                Assert.IsTrue(Utils.EqualsDouble(variablesEager[j].Value, variablesLazy[j].Value));
+                Assert.IsTrue(Utils.EqualsDouble(variablesEager[j].ReducedCost, variablesLazy[j].ReducedCost));
+            }
+
+            Constraint[] constraintsEager = modelEager.Constraints.ToArray();
+            Constraint[] constraintsLazy = modelLazy.Constraints.ToArray();
+            Assert.IsTrue(constraintsEager.Length == constraintsLazy.Length);
+            for (int i = 0; i < constraintsEager.Length; i++)
+            {
+                Assert.IsTrue(Utils.EqualsDouble(constraintsEager[i].Value, constraintsLazy[i].Value));
+                Assert.IsTrue(Utils.EqualsDouble(constraintsEager[i].Price, constraintsLazy[i].Price));
+            }
+
+            // after a resolve, the values are not stale
+            Model model = new Model();
+            Variable x = new Variable("x");
+            Variable y = new Variable("y");
+            Constraint con = x + 2 * y <= 4;
+            model.Add("con", con);
+            model.Objective = x + y;
+
+            Solver solver = new Solver(model, solverType);
+            solver.LazySolutionAssignment = true;
+            solver.Maximise();
+            Assert.IsTrue(Utils.EqualsDouble(x.Value, 4.0));
+            Assert.IsTrue(Utils.EqualsDouble(con.Value, 4.0));
+
+            x.Upper = 1.0;
+            solver.Resolve();
+            Assert.IsTrue(Utils.EqualsDouble(x.Value, 1.0));
+            Assert.IsTrue(Utils.EqualsDouble(y.Value, 1.5));
+            Assert.IsTrue(Utils.EqualsDouble(con.Value, 4.0));
+
+            // setting a value overrides the solution until the next solve
+            y.Value = 0.0;
+            Assert.IsTrue(Utils.EqualsDouble(y.Value, 0.0));
+            solver.Resolve();
+            Assert.IsTrue(Utils.EqualsDouble(y.Value, 1.5));
+
+            // the solution is kept when the solver is disposed
+            solver.Dispose();
+            Assert.IsTrue(Utils.EqualsDouble(x.Value, 1.0));
+            Assert.IsTrue(Utils.EqualsDouble(con.Value, 4.0));
+        }
+
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod, TestCategory("Parametrics")]
+        public void SonnetTest44(Type solverType)
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("Parametrics requires the ClpSimplex of SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest44 - Test parametric rhs");
+
+            Model model = new Model();
+            Variable x = new Variable("x");
+            Variable y = new Variable("y");
+            Constraint budget = x + 2 * y <= 4;
+            Constraint con1 = 3 * x + y <= 6;
+            model.Add("budget", budget);
+            model.Add("con1", con1);
+            model.Objective = x + y;
+
+            Solver solver = new Solver(model, solverType);
+            solver.NameDiscipline = 2;
+            solver.Maximise();
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 2.8));
+
+            // the budget becomes 4 + theta. At theta = 8 (budget 12), the budget is no longer binding and the objective is 6.
+            var rhsChanges = new Dictionary<Constraint, double>() { { budget, 1.0 } };
+            ParametricResult result = solver.Parametrics(0.0, 10.0, rhsChanges);
+            Console.WriteLine(result);
+
+            Assert.IsTrue(result.IsEndingThetaReached);
+            Assert.IsTrue(Utils.EqualsDouble(result.EndingTheta, 10.0));
+            Assert.IsTrue(result.Breakpoints.Count > 0);
+            Assert.IsTrue(result.Breakpoints.Any(b => Utils.EqualsDouble(b.Theta, 8.0) && Utils.EqualsDouble(b.ObjectiveValue, 6.0)));
+
+            // the model and solution are not changed
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 2.8));
+            Assert.IsTrue(Utils.EqualsDouble(x.Value, 1.6));
+
+            // and the solution at the solver is restored, such that ranging starts from the original solution
+            Assert.IsTrue(solver.OsiSolver.isProvenOptimal());
+            Assert.IsTrue(Utils.EqualsDouble(solver.OsiSolver.getObjValue(), 2.8));
+            Assert.IsTrue(Utils.EqualsDouble(solver.OsiSolver.getColSolution()[0], 1.6));
+            Assert.IsTrue(Utils.EqualsDouble(solver.GetRhsRanges()[budget].Upper, 12.0));
+            solver.Resolve();
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 2.8));
+#endif
+        }
+
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod, TestCategory("Worker")]
+        public void SonnetTest45(Type solverType)
+        {
+            Console.WriteLine("SonnetTest45 - Test solve in worker process");
+
+            // The test executable is its own worker (see Program.Main)
+            string workerFileName = System.IO.Path.ChangeExtension(typeof(Program).Assembly.Location, ".exe");
+            if (!System.IO.File.Exists(workerFileName)) Assert.Inconclusive("Worker executable not found: " + workerFileName);
+
+            Model model = new Model();
+            Variable x = new Variable("x", VariableType.Integer);
+            Variable y = new Variable("y", VariableType.Integer);
+            Constraint con1 = 6 * x + 4 * y <= 24;
+            Constraint con2 = x + 2 * y <= 6;
+            model.Add("con1", con1);
+            model.Add("con2", con2);
+            model.Objective = 5 * x + 4 * y;
+
+            using (SolverWorkerPool pool = new SolverWorkerPool(2, workerFileName, SolverWorker.Argument))
+            {
+                Solver solver = new Solver(model, solverType);
+                solver.WorkerPool = pool;
+                solver.Maximise();
+                Assert.IsTrue(solver.IsProvenOptimal);
+                Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 20.0));
+                Assert.IsTrue(Utils.EqualsDouble(x.Value, 4.0));
+                Assert.IsTrue(Utils.EqualsDouble(y.Value, 0.0));
+
+                // The relaxation has duals, and the worker process is reused
+                solver.Resolve(true);
+                Assert.IsTrue(solver.IsProvenOptimal);
+                Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 21.0));
+                Assert.IsTrue(Utils.EqualsDouble(x.Value, 3.0));
+                Assert.IsTrue(Utils.EqualsDouble(y.Value, 1.5));
+                double price1 = con1.Price;
+                double price2 = con2.Price;
+                Assert.IsTrue(Utils.EqualsDouble(Math.Abs(price1), 0.75));
+                Assert.IsTrue(Utils.EqualsDouble(Math.Abs(price2), 0.5));
+
+                // Same as solving locally
+                solver.WorkerPool = null;
+                solver.Resolve(true);
+                Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 21.0));
+                Assert.IsTrue(Utils.EqualsDouble(con1.Price, price1));
+                Assert.IsTrue(Utils.EqualsDouble(con2.Price, price2));
+
+                // The native solvers in the worker log to its standard output, which must not corrupt the solution
+                solver.WorkerPool = pool;
+                solver.OsiSolver.messageHandler().setLogLevel(1);
+                solver.Maximise();
+                Assert.IsTrue(solver.IsProvenOptimal);
+                Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 20.0));
+                solver.Resolve(true);
+                Assert.IsTrue(solver.IsProvenOptimal);
+                Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 21.0));
+                solver.OsiSolver.messageHandler().setLogLevel(0);
+
+                // The parameters and hints of the solver are used in the worker
+                solver.OsiSolver.setIntParam(OsiIntParam.OsiMaxNumIteration, 0);
+                solver.OsiSolver.setHintParam(OsiHintParam.OsiDoPresolveInInitial, false, OsiHintStrength.OsiHintDo);
+                solver.Resolve(true);
+                Assert.IsFalse(solver.IsProvenOptimal);
+                Assert.IsTrue(solver.IsIterationLimitReached);
+                solver.OsiSolver.setIntParam(OsiIntParam.OsiMaxNumIteration, int.MaxValue);
+                solver.Resolve(true);
+                Assert.IsTrue(solver.IsProvenOptimal);
+                Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 21.0));
+            }
+        }
+
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod, TestCategory("Import")]
+        public void SonnetTest46(Type solverType)
+        {
+            Console.WriteLine("SonnetTest46 - Test single-pass mps import");
+
+            string mps = "NAME          TEST46\n" +
+                "* comment line\n" +
+                "ROWS\n" +
+                " N  COST\n" +
+                " L  LIM1\n" +
+                " G  LIM2\n" +
+                " E  MYEQN\n" +
+                " E  MYRNG\n" +
+                " N  FREE\n" +
+                "COLUMNS\n" +
+                "    X1        COST         1.0   LIM1         1.0\n" +
+                "    X1        LIM2         1.0   MYRNG        1.0\n" +
+                "    MARKER    'MARKER'     'INTORG'\n" +
+                "    X2        COST         2.0   LIM1         1.0\n" +
+                "    X2        MYEQN       -1.0   FREE         1.0\n" +
+                "    X3        COST         2.0   MYRNG        1.0\n" +
+                "    MARKER    'MARKER'     'INTEND'\n" +
+                "    X4        COST        -1.0   LIM2         1.0\n" +
+                "    X4        MYEQN        1.0\n" +
+                "RHS\n" +
+                "    RHS       LIM1         4.0   LIM2         1.0\n" +
+                "    RHS       MYEQN        7.0   MYRNG        2.0\n" +
+                "RANGES\n" +
+                "    RNG       MYRNG       -1.5\n" +
+                "BOUNDS\n" +
+                " UP BND       X1           4.0\n" +
+                " MI BND       X2\n" +
+                " UP BND       X2           1.0\n" +
+                " UP BND       X4          -1.0\n" +
+                "ENDATA\n";
+            System.IO.File.WriteAllText("test46.mps", mps);
+
+            Variable[] variables;
+            Model model = Model.New("test46.mps", out variables);
+            Assert.IsTrue(model.Name == "test46");
+            Assert.IsTrue(model.Objective.Name == "COST");
+            Assert.IsTrue(variables.Length == 4);
+            Assert.IsTrue(model.NumberOfConstraints == 5);
+
+            Variable x1 = variables[0], x2 = variables[1], x3 = variables[2], x4 = variables[3];
+            Assert.IsTrue(x1.Name == "X1" && x1.Type == VariableType.Continuous && x1.Lower == 0.0 && x1.Upper == 4.0);
+            Assert.IsTrue(x2.Type == VariableType.Integer && x2.Lower == -model.Infinity && x2.Upper == 1.0);
+            // integer without any bound gets upper bound 1, like CoinMpsIO
+            Assert.IsTrue(x3.Type == VariableType.Integer && x3.Lower == 0.0 && x3.Upper == 1.0);
+            // a negative upper bound with default lower bound makes the lower bound minus infinity
+            Assert.IsTrue(x4.Type == VariableType.Continuous && x4.Lower == -model.Infinity && x4.Upper == -1.0);
+
+            Constraint myrng = model.GetConstraint("MYRNG");
+            Assert.IsTrue(myrng is RangeConstraint);
+            Assert.IsTrue(Utils.EqualsDouble(myrng.Lower, 0.5));
+            Assert.IsTrue(Utils.EqualsDouble(myrng.Upper, 2.0));
+            Assert.IsFalse(model.GetConstraint("FREE").Enabled);
+
+            Solver solver = new Solver(model, solverType);
+            solver.Minimise();
+            Assert.IsTrue(solver.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, -13.0));
+            Assert.IsTrue(Utils.EqualsDouble(x1.Value, 2.0));
+            Assert.IsTrue(Utils.EqualsDouble(x2.Value, -8.0));
+
+            // The same model via the lp format gives the same solution
+            solver.Export("test46.lp");
+            Model modelLp = Model.New("test46.lp");
+            Solver solverLp = new Solver(modelLp, solverType);
+            solverLp.Minimise();
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, modelLp.Objective.Value));
+        }
+
+        [TestMethod, TestCategory("Import")]
+        public void SonnetTest47()
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("The multithreaded MpsParallelReader requires SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest47 - Test multithreaded native mps reader against CoinMpsIO");
+
+            string[] fileNames = { "brandy.mps", "egout.mps", "expect-feasible.mps", "mas74.mps", "MIP-124725.mps" };
+            foreach (string fileName in fileNames)
+            {
+                CoinMpsIO reference = new CoinMpsIO();
+                Assert.IsTrue(reference.readMps(fileName) == 0);
+                COIN.CoinPackedMatrix matrix = reference.getMatrixByCol();
+                int[] referenceStarts = matrix.getVectorStarts();
+                int[] referenceLengths = matrix.getVectorLengths();
+                int[] referenceIndices = matrix.getIndices();
+                double[] referenceElements = matrix.getElements();
+
+                foreach (int numberThreads in new int[] { 1, 4 })
+                {
+                    COIN.MpsParallelReader reader = new COIN.MpsParallelReader();
+                    reader.setNumberThreads(numberThreads);
+                    Assert.IsTrue(reader.readMps(fileName) == 0);
+
+                    Assert.IsTrue(reader.getProblemName() == reference.getProblemName());
+                    Assert.IsTrue(reader.getNumRows() == reference.getNumRows());
+                    Assert.IsTrue(reader.getNumCols() == reference.getNumCols());
+                    Assert.IsTrue(reader.getNumElements() == reference.getNumElements());
+                    CollectionAssert.AreEqual(reference.getRowLower(), reader.getRowLower());
+                    CollectionAssert.AreEqual(reference.getRowUpper(), reader.getRowUpper());
+                    CollectionAssert.AreEqual(reference.getRowSense(), reader.getRowSense());
+                    CollectionAssert.AreEqual(reference.getColLower(), reader.getColLower());
+                    CollectionAssert.AreEqual(reference.getColUpper(), reader.getColUpper());
+                    CollectionAssert.AreEqual(reference.getObjCoefficients(), reader.getObjCoefficients());
+
+                    for (int i = 0; i < reader.getNumRows(); i++) Assert.IsTrue(reader.rowName(i) == reference.rowName(i));
+
+                    int[] starts = reader.getVectorStarts();
+                    int[] indices = reader.getIndices();
+                    double[] elements = reader.getElements();
+                    for (int j = 0; j < reader.getNumCols(); j++)
+                    {
+                        Assert.IsTrue(reader.columnName(j) == reference.columnName(j));
+                        Assert.IsTrue(reader.isInteger(j) == reference.isInteger(j));
+                        Assert.IsTrue(starts[j + 1] - starts[j] == referenceLengths[j]);
+                        for (int k = 0; k < referenceLengths[j]; k++)
+                        {
+                            Assert.IsTrue(indices[starts[j] + k] == referenceIndices[referenceStarts[j] + k]);
+                            Assert.IsTrue(elements[starts[j] + k] == referenceElements[referenceStarts[j] + k]);
+                        }
+                    }
+                }
+
+                GC.KeepAlive(reference);
+            }
+
+            // A model imported via the native reader is the same as via the single-pass reader
+            Model model = Model.New("egout.mps", out Variable[] variables);
+            Model modelParallel = Model.New("egout.mps", "mps", out Variable[] variablesParallel, 0);
+            Assert.IsTrue(variablesParallel.Length == variables.Length);
+            Assert.IsTrue(modelParallel.NumberOfConstraints == model.NumberOfConstraints);
+            Assert.IsTrue(Utils.EqualsString(model.ToString(), modelParallel.ToString()));
+#endif
+        }
+
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod, TestCategory("Import")]
+        public void SonnetTest48(Type solverType)
+        {
+            Console.WriteLine("SonnetTest48 - Test import of gzip-compressed mps and lp files");
+
+            Compress("egout.mps", "test48.mps.gz");
+
+            Model model = Model.New("egout.mps");
+            Model modelGz = Model.New("test48.mps.gz");
+            Assert.IsTrue(modelGz.Name == "test48");
+            modelGz.Name = model.Name;
+            Assert.IsTrue(Utils.EqualsString(model.ToString(), modelGz.ToString()));
+
+            CoinMpsIO reference = new CoinMpsIO();
+            reference.readMps("egout.mps");
+            CoinMpsIO mpsIO = new CoinMpsIO();
+            Assert.IsTrue(mpsIO.readMps("test48.mps.gz") == 0);
+            Assert.IsTrue(mpsIO.getNumRows() == reference.getNumRows());
+            Assert.IsTrue(mpsIO.getNumCols() == reference.getNumCols());
+            Assert.IsTrue(mpsIO.getNumElements() == reference.getNumElements());
+            CollectionAssert.AreEqual(reference.getColUpper(), mpsIO.getColUpper());
+            CollectionAssert.AreEqual(reference.getRowLower(), mpsIO.getRowLower());
+
+            // A file can be read again after a compressed file
+            Assert.IsTrue(mpsIO.readMps("egout.mps") == 0);
+            Assert.IsTrue(mpsIO.getNumElements() == reference.getNumElements());
+
+            Solver solver = new Solver(model, solverType);
+            solver.Export("test48.lp");
+            Compress("test48.lp", "test48.lp.gz");
+
+            Model modelLp = Model.New("test48.lp");
+            Model modelLpGz = Model.New("test48.lp.gz");
+            modelLpGz.Name = modelLp.Name;
+            Assert.IsTrue(Utils.EqualsString(modelLp.ToString(), modelLpGz.ToString()));
+        }
+
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod, TestCategory("Import")]
+        public void SonnetTest49(Type solverType)
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("Snapshots require the ProblemSnapshot of SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest49 - Test export and import of binary problem snapshots");
+
+            Model model = Model.New("egout.mps");
+            Solver solver = new Solver(model, solverType);
+            solver.NameDiscipline = 2;
+            solver.Generate();
+            solver.Export("test49.snapshot");
+
+            Assert.IsTrue(ProblemSnapshot.isSnapshot("test49.snapshot"));
+            Assert.IsFalse(ProblemSnapshot.isSnapshot("egout.mps"));
+
+            Model modelSnapshot = Model.New("test49.snapshot");
+            Assert.IsTrue(modelSnapshot.Name == "test49");
+            modelSnapshot.Name = model.Name;
+            Assert.IsTrue(Utils.EqualsString(model.ToString(), modelSnapshot.ToString()));
+
+            // The snapshot after solving includes the optimal basis, so no iterations are needed after loading
+            solver.Minimise(true);
+            double objectiveValue = model.Objective.Value;
+            solver.Export("test49.snapshot");
+
+            OsiClpSolverInterface osiSolver = new OsiClpSolverInterface();
+            Assert.IsTrue(ProblemSnapshot.load("test49.snapshot", osiSolver));
+            Assert.IsTrue(osiSolver.getNumCols() == solver.OsiSolver.getNumCols());
+            Assert.IsTrue(osiSolver.getNumElements() == solver.OsiSolver.getNumElements());
+            osiSolver.resolve();
+            Assert.IsTrue(osiSolver.isProvenOptimal());
+            Assert.IsTrue(osiSolver.getIterationCount() == 0);
+            Assert.IsTrue(Utils.EqualsDouble(osiSolver.getObjValue(), objectiveValue));
+
+            // A corrupt snapshot is detected by the checksum
+            byte[] bytes = System.IO.File.ReadAllBytes("test49.snapshot");
+            bytes[bytes.Length / 2] ^= 0xff;
+            System.IO.File.WriteAllBytes("test49-corrupt.snapshot", bytes);
+
+            bool failed = false;
+            try
+            {
+                ProblemSnapshot.load("test49-corrupt.snapshot", new OsiClpSolverInterface());
+            }
+            catch (CoinError)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+
+            // Without checksum, an invalid matrix is still detected: the first row index (after the header of 88 bytes
+            // and the padded column starts) is out of range
+            bytes = System.IO.File.ReadAllBytes("test49.snapshot");
+            int indicesOffset = 88 + (((osiSolver.getNumCols() + 1) * sizeof(int) + 7) / 8) * 8;
+            BitConverter.GetBytes(int.MaxValue).CopyTo(bytes, indicesOffset);
+            System.IO.File.WriteAllBytes("test49-corrupt.snapshot", bytes);
+
+            failed = false;
+            try
+            {
+                ProblemSnapshot.load("test49-corrupt.snapshot", new OsiClpSolverInterface(), false);
+            }
+            catch (CoinError)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+#endif
+        }
+
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod, TestCategory("Export")]
+        public void SonnetTest50(Type solverType)
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("The parallel ModelWriter and compressed export require SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest50 - Test export to (compressed) mps and lp files by the parallel ModelWriter");
+
+            Model model = Model.New("egout.mps");
+            Solver solver = new Solver(model, solverType);
+            solver.NameDiscipline = 2;
+            solver.Generate();
+            solver.Export("test50.mps");
+            solver.Export("test50.mps.gz");
+            solver.Export("test50.lp");
+            Assert.IsTrue(CompressedFile.IsCompressed("test50.mps.gz"));
+
+            Model modelMps = Model.New("test50.mps");
+            modelMps.Name = model.Name;
+            Assert.IsTrue(Utils.EqualsString(model.ToString(), modelMps.ToString()));
+
+            Model modelMpsGz = Model.New("test50.mps.gz");
+            modelMpsGz.Name = model.Name;
+            Assert.IsTrue(Utils.EqualsString(model.ToString(), modelMpsGz.ToString()));
+
+            // The lp file may list the variables in another order, so compare the optimal value
+            solver.Minimise();
+            double objectiveValue = model.Objective.Value;
+
+            Model modelLp = Model.New("test50.lp");
+            Solver solverLp = new Solver(modelLp, solverType);
+            solverLp.Minimise();
+            Assert.IsTrue(Utils.EqualsDouble(modelLp.Objective.Value, objectiveValue));
+
+            // Fixed format, single threaded, read back by CoinMpsIO
+            ModelWriter writer = new ModelWriter();
+            writer.setFreeFormat(false);
+            writer.setNumberThreads(1);
+            writer.writeMps(solver.OsiSolver, "test50-fixed.mps");
+
+            CoinMpsIO m = new CoinMpsIO();
+            Assert.IsTrue(m.readMps("test50-fixed.mps") == 0);
+            Assert.IsTrue(m.getNumCols() == solver.OsiSolver.getNumCols());
+            Assert.IsTrue(m.getNumRows() == solver.OsiSolver.getNumRows());
+            Assert.IsTrue(m.getNumElements() == solver.OsiSolver.getNumElements());
+
+            // Ranged rows and the objective offset are written by the ModelWriter itself, with full precision
+            Model rangeModel = new Model();
+            Variable x = new Variable("x");
+            Variable y = new Variable("y");
+            RangeConstraint range = new RangeConstraint(0.1, x + y, 1.0 / 3.0);
+            rangeModel.Add("range", range);
+            rangeModel.Add("con", x - y >= -1.0);
+            rangeModel.Objective = x + 2 * y;
+            Solver rangeSolver = new Solver(rangeModel, solverType);
+            rangeSolver.NameDiscipline = 2;
+            rangeSolver.Generate();
+            rangeSolver.OsiSolver.setDblParam(OsiDblParam.OsiObjOffset, 2.0 / 3.0);
+            writer.writeLp(rangeSolver.OsiSolver, "test50-range.lp");
+
+            LpReader lpReader = new LpReader();
+            lpReader.readLp("test50-range.lp");
+            Assert.IsTrue(lpReader.getNumRows() == 2);
+            Assert.IsTrue(lpReader.getRowSense()[0] == 'R');
+            Assert.IsTrue(lpReader.getRowLower()[0] == 0.1);
+            Assert.IsTrue(lpReader.getRowUpper()[0] == 1.0 / 3.0);
+            Assert.IsTrue(lpReader.objectiveOffset() == -2.0 / 3.0);
+#endif
+        }
+
+        [TestMethod, TestCategory("Import")]
+        public void SonnetTest51()
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("Bulk name extraction requires the CoinMpsIO, CoinLpIO and ClpSimplex of SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest51 - Test bulk name extraction and lazy default names");
+
+            CoinMpsIO mpsIO = new CoinMpsIO();
+            Assert.IsTrue(mpsIO.readMps("egout.mps") == 0);
+            string[] columnNames = mpsIO.columnNames();
+            string[] rowNames = mpsIO.rowNames();
+            Assert.IsTrue(columnNames.Length == mpsIO.getNumCols());
+            Assert.IsTrue(rowNames.Length == mpsIO.getNumRows());
+            for (int j = 0; j < columnNames.Length; j++) Assert.IsTrue(columnNames[j] == mpsIO.columnName(j));
+            for (int i = 0; i < rowNames.Length; i++) Assert.IsTrue(rowNames[i] == mpsIO.rowName(i));
+
+            ClpSimplex clp = new ClpSimplex();
+            Assert.IsTrue(clp.readMps("egout.mps", true, false) == 0);
+            Assert.IsTrue(clp.columnNames().SequenceEqual(columnNames));
+            Assert.IsTrue(clp.rowNames().SequenceEqual(rowNames));
+
+            MpsParallelReader reader = new MpsParallelReader();
+            reader.readMps("egout.mps");
+            Assert.IsTrue(reader.columnNames().SequenceEqual(columnNames));
+            Assert.IsTrue(reader.rowNames().SequenceEqual(rowNames));
+
+            Model model = Model.New("egout.mps");
+            Solver solver = new Solver(model, typeof(OsiClpSolverInterface));
+            solver.Export("test51.lp");
+            CoinLpIO lpIO = new CoinLpIO();
+            lpIO.readLp("test51.lp");
+            string[] lpColumnNames = lpIO.getColNames();
+            string[] lpRowNames = lpIO.getRowNames();
+            Assert.IsTrue(lpRowNames.Length == lpIO.getNumRows());
+            for (int j = 0; j < lpColumnNames.Length; j++) Assert.IsTrue(lpColumnNames[j] == lpIO.columnName(j));
+            for (int i = 0; i < lpRowNames.Length; i++) Assert.IsTrue(lpRowNames[i] == lpIO.rowName(i));
+
+            // Default names are created when first used, and can be replaced as usual
+            Variable x = new Variable();
+            Constraint con = x <= 1.0;
+            Assert.IsTrue(x.Name == "Var_" + x.ID);
+            Assert.IsTrue(con.Name == "Con_" + con.ID);
+            x.Name = "x";
+            Assert.IsTrue(x.Name == "x");
+#endif
+        }
+
+        [TestMethod, TestCategory("Export")]
+        public void SonnetTest52()
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("Solution files require the SolutionFile of SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest52 - Test binary solution files for warm starts and MIP starts");
+
+            Model model = Model.New("egout.mps");
+            Solver solver = new Solver(model, typeof(OsiClpSolverInterface));
+            solver.Solve();
+            Assert.IsTrue(solver.IsProvenOptimal);
+            double objectiveValue = model.Objective.Value;
+
+            solver.SaveSolution("test52.sol");
+            Assert.IsTrue(SolutionFile.isSolutionFile("test52.sol"));
+            Assert.IsTrue(!SolutionFile.isSolutionFile("egout.mps"));
+
+            SolutionFile solutionFile = new SolutionFile();
+            solutionFile.read("test52.sol", solver.OsiSolver);
+            Assert.IsTrue(solutionFile.hasBasis());
+            Assert.IsTrue(solutionFile.getNumberMatchedColumns() == solver.OsiSolver.getNumCols());
+            Assert.IsTrue(solutionFile.getNumberMatchedRows() == solver.OsiSolver.getNumRows());
+            Assert.IsTrue(solutionFile.getColSolution().SequenceEqual(solver.OsiSolver.getColSolution()));
+
+            // The saved basis is optimal for the same model
+            Model model2 = Model.New("egout.mps");
+            Solver solver2 = new Solver(model2, typeof(OsiClpSolverInterface));
+            solver2.SetWarmStart(solver2.ReadWarmStart("test52.sol"));
+            Assert.IsTrue(solver2.OsiSolver.getRowPrice().SequenceEqual(solver.OsiSolver.getRowPrice())); // the duals are part of the warm start
+            solver2.Solve();
+            Assert.IsTrue(solver2.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model2.Objective.Value, objectiveValue));
+            Assert.IsTrue(solver2.OsiSolver.getIterationCount() < 5); // allow for a few iterations, but basically, 0 should be enough
+
+            // A model with an extra variable and constraint is matched by name
+            Model model3 = Model.New("egout.mps");
+            Variable y = new Variable("y", 0.0, 10.0);
+            model3.Add("extra", y <= 10.0);
+            Solver solver3 = new Solver(model3, typeof(OsiClpSolverInterface));
+            solver3.SetWarmStart(solver3.ReadWarmStart("test52.sol"));
+            solver3.Solve();
+            Assert.IsTrue(solver3.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model3.Objective.Value, objectiveValue));
+
+            // If no constraint is matched, all slacks are basic besides the basic variables of the file: the basis is repaired
+            Model model6 = Model.New("egout.mps");
+            foreach (Constraint constraint in model6.Constraints) constraint.Name = "renamed_" + constraint.Name;
+            Solver solver6 = new Solver(model6, typeof(OsiClpSolverInterface));
+            solver6.SetWarmStart(solver6.ReadWarmStart("test52.sol"));
+            solver6.Solve();
+            Assert.IsTrue(solver6.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model6.Objective.Value, objectiveValue));
+
+            // The same solution file as MIP start
+            Model model4 = Model.New("egout.mps");
+            Solver solver4 = new Solver(model4, typeof(OsiCbcSolverInterface));
+            solver4.Solve();
+            Assert.IsTrue(solver4.IsProvenOptimal);
+            double mipObjectiveValue = model4.Objective.Value;
+            solver4.SaveSolution("test52-mip.sol");
+
+            Model model5 = Model.New("egout.mps");
+            Solver solver5 = new Solver(model5, typeof(OsiCbcSolverInterface));
+            solver5.SetMIPStart("test52-mip.sol", true);
+            solver5.Solve();
+            Assert.IsTrue(solver5.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model5.Objective.Value, mipObjectiveValue));
+#endif
+        }
+
+        [TestMethod, TestCategory("Import")]
+        public void SonnetTest53()
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("The single-pass LpReader requires SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest53 - Test the native single-pass LpReader against CoinLpIO");
+
+            Model model = Model.New("egout.mps");
+            Solver solver = new Solver(model, typeof(OsiClpSolverInterface));
+            solver.Export("test53.lp");
+
+            LpReader reader = new LpReader();
+            reader.setInfinity(MathUtils.Infinity);
+            Assert.IsTrue(reader.readLp("test53.lp") == 0);
+            CoinLpIO lpIO = new CoinLpIO();
+            lpIO.setInfinity(MathUtils.Infinity);
+            lpIO.readLp("test53.lp");
+
+            Assert.IsTrue(reader.getNumCols() == lpIO.getNumCols());
+            Assert.IsTrue(reader.getNumRows() == lpIO.getNumRows());
+            Assert.IsTrue(reader.getNumElements() == lpIO.getNumElements());
+            Assert.IsTrue(reader.columnNames().SequenceEqual(lpIO.getColNames()));
+            Assert.IsTrue(reader.rowNames().SequenceEqual(lpIO.getRowNames()));
+            Assert.IsTrue(reader.getObjCoefficients().SequenceEqual(lpIO.getObjCoefficients()));
+            Assert.IsTrue(reader.getColLower().SequenceEqual(lpIO.getColLower()));
+            Assert.IsTrue(reader.getColUpper().SequenceEqual(lpIO.getColUpper()));
+            Assert.IsTrue(reader.getRowLower().SequenceEqual(lpIO.getRowLower()));
+            Assert.IsTrue(reader.getRowUpper().SequenceEqual(lpIO.getRowUpper()));
+            Assert.IsTrue(reader.getRowSense().SequenceEqual(lpIO.getRowSense()));
+            for (int j = 0; j < reader.getNumCols(); j++) Assert.IsTrue(reader.isInteger(j) == lpIO.isInteger(j));
+
+            // Compare the columns as sets of elements, since CoinLpIO does not sort the rows of a column
+            CoinPackedMatrix matrix = lpIO.getMatrixByCol();
+            int[] starts = reader.getVectorStarts(), indices = reader.getIndices(), lpStarts = matrix.getVectorStarts(), lpLengths = matrix.getVectorLengths(), lpIndices = matrix.getIndices();
+            double[] elements = reader.getElements(), lpElements = matrix.getElements();
+            for (int j = 0; j < reader.getNumCols(); j++)
+            {
+                var column = Enumerable.Range(starts[j], starts[j + 1] - starts[j]).Select(k => (indices[k], elements[k])).OrderBy(e => e.Item1);
+                var lpColumn = Enumerable.Range(lpStarts[j], lpLengths[j]).Select(k => (lpIndices[k], lpElements[k])).OrderBy(e => e.Item1);
+                Assert.IsTrue(column.SequenceEqual(lpColumn));
+            }
+
+            // Model.New reads lp files with the LpReader, and gives the same problem
+            Model lpModel = Model.New("test53.lp");
+            Solver lpSolver = new Solver(lpModel, typeof(OsiClpSolverInterface));
+            solver.Solve();
+            lpSolver.Solve();
+            Assert.IsTrue(lpSolver.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(lpModel.Objective.Value, model.Objective.Value));
+
+            // Maximization, constants, sums of the same column, and names attached to numbers
+            System.IO.File.WriteAllText("test53-max.lp", "Maximize\n profit: 3x + 2 y + 1 + x\nSubject To\n c1: x + y + y <= 4\n x - 1 >= 0\nBounds\n y <= 1\nEnd\n");
+            reader.readLp("test53-max.lp");
+            Assert.IsTrue(reader.wasMaximization());
+            Assert.IsTrue(reader.getObjName() == "profit");
+            Assert.IsTrue(reader.getObjCoefficients().SequenceEqual(new double[] { -4.0, -2.0 }));
+            Assert.IsTrue(reader.objectiveOffset() == -1.0);
+            Assert.IsTrue(reader.getRowElements().SequenceEqual(new double[] { 1.0, 2.0, 1.0 }));
+            Assert.IsTrue(reader.rowName(1) == "cons1");
+            Assert.IsTrue(reader.getRowLower()[1] == 1.0);
+
+            Model maxModel = Model.New("test53-max.lp");
+            Solver maxSolver = new Solver(maxModel, typeof(OsiClpSolverInterface));
+            maxSolver.Solve();
+            Assert.IsTrue(Utils.EqualsDouble(maxModel.Objective.Value, -16.0));
+
+            // Unsupported features throw a CoinError, such that Model.New can fall back to CoinLpIO
+            System.IO.File.WriteAllText("test53-range.lp", "Minimize\n obj: x + y\nSubject To\n c1: x + y >= 2\n c1: <= 4\nEnd\n");
+            bool failed = false;
+            try
+            {
+                reader.readLp("test53-range.lp");
+            }
+            catch (CoinError)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+#endif
+        }
+
+        [TestMethod, TestCategory("Import")]
+        public void SonnetTest54()
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("Patches require the ProblemPatch of SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest54 - Test exporting and applying problem patches");
+
+            Variable x = new Variable("x", 0.0, 10.0);
+            Variable y = new Variable("y", 0.0, 10.0);
+            Variable z = new Variable("z", 0.0, 10.0);
+            Model model = new Model();
+            model.Add("c1", x + y <= 4);
+            model.Add("c2", x + z >= 1);
+            model.Add("c3", y + z <= 5);
+            model.Add("c5", x + y + z <= 20);
+            model.Objective = new Objective("obj", -1 * x - 2 * y + z);
+            Solver solver = new Solver(model, typeof(OsiClpSolverInterface));
+            solver.Solve();
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, -7.0));
+
+            // The changed model: without z, c2 and c5, a changed c1, and a new variable w with a new constraint c4
+            Variable x2 = new Variable("x", 0.0, 10.0);
+            Variable y2 = new Variable("y", 0.0, 10.0);
+            Variable w2 = new Variable("w", 0.0, 3.0);
+            Model model2 = new Model();
+            model2.Add("c1", x2 + 2 * y2 <= 6);
+            model2.Add("c3", y2 <= 5);
+            model2.Add("c4", x2 + w2 <= 5);
+            model2.Objective = new Objective("obj", -1 * x2 - 2 * y2 - 3 * w2);
+            Solver solver2 = new Solver(model2, typeof(OsiClpSolverInterface));
+            solver2.Solve();
+
+            solver2.ExportPatch(solver, "test54.patch");
+            Assert.IsTrue(ProblemPatch.isPatch("test54.patch"));
+
+            ProblemPatch patch = new ProblemPatch();
+            patch.read("test54.patch");
+            Assert.IsTrue(patch.getRemovedColumns().SequenceEqual(new int[] { 2 }));
+            Assert.IsTrue(patch.getRemovedRows().SequenceEqual(new int[] { 1, 3 }));
+            Assert.IsTrue(patch.getNumberAddedColumns() == 1 && patch.addedColumnName(0) == "w");
+            Assert.IsTrue(patch.getNumberAddedRows() == 1 && patch.addedRowName(0) == "c4");
+
+            // A patch can only be applied to the only solver of a model
+            Solver other = new Solver(model, typeof(OsiClpSolverInterface));
+            bool failed = false;
+            try
+            {
+                solver.ApplyPatch("test54.patch");
+            }
+            catch (NotSupportedException)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+            other.Dispose();
+
+            // Applying the patch changes the problem of the solver and the model, but keeps the previous solution until solved again
+            double xValue = x.Value;
+            Constraint c1 = model.GetConstraint("c1");
+            solver.ApplyPatch("test54.patch");
+            Assert.IsTrue(solver.OsiSolver.getNumCols() == 3 && solver.OsiSolver.getNumRows() == 3);
+            Assert.IsTrue(model.NumberOfConstraints == 3);
+            Assert.IsTrue(model.GetConstraint("c2") is null && model.GetConstraint("c5") is null && !(model.GetConstraint("c4") is null));
+            Assert.IsTrue(object.ReferenceEquals(model.GetConstraint("c1"), c1) && c1.Upper == 6.0);
+            Assert.IsTrue(model.Objective.GetCoefficient(y) == -2.0 && model.Objective.GetCoefficient(z) == 0.0);
+            Assert.IsTrue(Utils.EqualsDouble(x.Value, xValue));
+            solver.Resolve();
+            Assert.IsTrue(solver.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, model2.Objective.Value));
+            Assert.IsTrue(Utils.EqualsDouble(x.Value, x2.Value));
+            Assert.IsTrue(Utils.EqualsDouble(y.Value, y2.Value));
+
+            // A patch can only be applied to a solver with the previous problem
+            failed = false;
+            try
+            {
+                solver.ApplyPatch("test54.patch");
+            }
+            catch (SonnetException)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+
+            // A new solver of the patched model has the patched problem
+            solver.Dispose();
+            Solver solver3 = new Solver(model, typeof(OsiClpSolverInterface));
+            solver3.Solve();
+            Assert.IsTrue(solver3.IsProvenOptimal);
+            Assert.IsTrue(solver3.OsiSolver.getNumCols() == 3 && solver3.OsiSolver.getNumRows() == 3);
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, model2.Objective.Value));
+#endif
+        }
+
+        [TestMethod, TestCategory("Export")]
+        public void SonnetTest55()
+        {
+            Console.WriteLine("SonnetTest55 - Test exporting a model to mps and lp files without a solver");
+
+            Variable x = new Variable("x", 0.0, 10.0, VariableType.Integer);
+            Variable y = new Variable("y", -MathUtils.Infinity, MathUtils.Infinity);
+            Variable z = new Variable("z", 1.0, 1.0);
+            Variable w = new Variable("w", -5.0, -1.0);
+            Model model = new Model("test55");
+            model.Add("c1", x + 2 * y + x + 1 <= 4 + z);
+            model.Add("c2", new RangeConstraint(-2.0, y + w, 8.0));
+            model.Add("c3", x - 2.5 * w >= 3);
+            // The constant of a range constraint is moved to both bounds: -1 <= y <= 3, of which the lower bound is binding
+            model.Add("c4", new RangeConstraint(1.0, y + 2, 5.0));
+            model.Objective = new Objective("obj", 3 * x - y + x);
+            model.ObjectiveSense = ObjectiveSense.Maximise;
+
+            model.Export("test55.mps");
+            model.Export("test55.lp");
+            model.Export("test55.mps.gz");
+
+            Solver solver = new Solver(model, typeof(OsiCbcSolverInterface));
+            solver.Solve();
+            Assert.IsTrue(solver.IsProvenOptimal);
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 13.0));
+
+            // As Solver.Export, a maximisation problem is written as the minimisation of the negated objective
+            foreach (string fileName in new string[] { "test55.mps", "test55.lp", "test55.mps.gz" })
+            {
+                Model exported = Model.New(fileName);
+                Assert.IsTrue(exported.NumberOfConstraints == 4);
+                Solver exportedSolver = new Solver(exported, typeof(OsiCbcSolverInterface));
+                exportedSolver.Solve();
+                Assert.IsTrue(exportedSolver.IsProvenOptimal);
+                Assert.IsTrue(Utils.EqualsDouble(exported.Objective.Value, -model.Objective.Value));
+            }
+
+            // Quadratic objectives are not supported
+            model.Objective = new Objective("obj", x * y);
+            bool failed = false;
+            try
+            {
+                model.Export("test55-quadratic.mps");
+            }
+            catch (NotSupportedException)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+
+            // A name that is not ASCII is not exported to mps (instead of as '?'), but lp then uses default names
+            model.Objective = new Objective("obj", 3 * x - y + x);
+            model.Add("c5", new Variable("x\u00e9") <= 1.0);
+            System.IO.File.Delete("test55-ascii.mps");
+            failed = false;
+            try
+            {
+                model.Export("test55-ascii.mps");
+            }
+            catch (SonnetException)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+            Assert.IsFalse(System.IO.File.Exists("test55-ascii.mps"));
+            model.Export("test55-ascii.lp");
+            Assert.IsTrue(Model.New("test55-ascii.lp").NumberOfConstraints == 5);
+        }
+
+        [TestMethod, TestCategory("Log")]
+        public void SonnetTest56()
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("SonnetLog.Buffered requires the BufferedMessageHandler of SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest56 - Test the native buffered message handler");
+
+            Variable x = new Variable("x");
+            Variable y = new Variable("y");
+            Model model = new Model("test56");
+            model.Add("c1", x + 2 * y <= 4);
+            model.Add("c2", 3 * x + y <= 6);
+            model.Objective = new Objective("obj", x + y);
+            model.ObjectiveSense = ObjectiveSense.Maximise;
+
+            Solver solver = new Solver(model, typeof(OsiClpSolverInterface));
+            solver.Generate();
+
+            BufferedMessageHandler handler = new BufferedMessageHandler(100);
+            Assert.IsTrue(handler.getCapacity() == 128);
+            handler.setLogLevel(1);
+            solver.OsiSolver.passInMessageHandler(handler.Handler);
+            solver.Solve();
+            Assert.IsTrue(solver.IsProvenOptimal);
+
+            System.Text.StringBuilder text = new System.Text.StringBuilder();
+            int taken = handler.take(text, int.MaxValue);
+            Assert.IsTrue(taken > 0);
+            Assert.IsTrue(text.ToString().Split('\n').Length == taken + 1);
+            Assert.IsTrue(handler.getNumberBuffered() == 0);
+            Assert.IsTrue(handler.take(text, int.MaxValue) == 0);
+
+            // With only detail level 0 accepted, the solver messages are filtered before buffering
+            handler.setMaximumDetail(0);
+            solver.Resolve();
+            Assert.IsTrue(handler.take(text, int.MaxValue) == 0);
+            Assert.IsTrue(handler.getNumberFiltered() > 0);
+
+            handler.setMaximumDetail(-1);
+            handler.setMessageEnabled(0, false);
+            Assert.IsFalse(handler.isMessageEnabled(0));
+            Assert.IsTrue(handler.isMessageEnabled(1));
+
+            bool failed = false;
+            try
+            {
+                handler.setMessageEnabled(BufferedMessageHandler.MaxExternalNumber + 1, false);
+            }
+            catch (CoinError)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+
+            // SonnetLog writes the buffered messages to the Console in batches
+            SonnetLog log = SonnetLog.Default;
+            System.IO.TextWriter console = Console.Out;
+            System.IO.StringWriter output = new System.IO.StringWriter();
+            Console.SetOut(output);
+            try
+            {
+                log.Buffered = true;
+                Assert.IsNotNull(log.BufferedHandler);
+                log.Warn("SonnetTest56 first message");
+                log.Warn("SonnetTest56 second message");
+                log.Flush();
+            }
+            finally
+            {
+                log.Buffered = false;
+                Console.SetOut(console);
+            }
+            Assert.IsTrue(output.ToString().Contains("SonnetTest56 first message"));
+#endif
+        }
+
+        [TestMethod, TestCategory("Progress")]
+        public void SonnetTest57()
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("Progress sampling requires the ClpProgressSampler of SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest57 - Test sampling the simplex progress with a native ClpEventHandler");
+
+            Model model = new Model("test57");
+            Variable[] x = Variable.New(40);
+            for (int j = 0; j < 30; j++)
+            {
+                Expression expr = new Expression();
+                for (int i = 0; i < x.Length; i++) expr.Add((i * j) % 7 + 1, x[i]);
+                model.Add("c" + j, expr <= 100 + j);
+            }
+            model.Objective = new Objective("obj", x.Sum());
+            model.ObjectiveSense = ObjectiveSense.Maximise;
+
+            Solver solver = new Solver(model, typeof(OsiClpSolverInterface));
+            Assert.IsTrue(solver.ProgressSamples.Length == 0);
+
+            solver.ProgressInterval = 1;
+            solver.Solve();
+            Assert.IsTrue(solver.IsProvenOptimal);
+
+            ClpProgressSample[] samples = solver.ProgressSamples;
+            Assert.IsTrue(samples.Length >= 2);
+            for (int k = 1; k < samples.Length; k++)
+            {
+                Assert.IsTrue(samples[k].Iteration >= samples[k - 1].Iteration);
+                Assert.IsTrue(samples[k].Seconds >= samples[k - 1].Seconds);
+            }
+
+            // The last sample is of the optimal solution
+            ClpProgressSample last = samples[samples.Length - 1];
+            Assert.IsTrue(last.Iteration == solver.IterationCount);
+            Assert.IsTrue(last.NumberPrimalInfeasibilities == 0 && last.NumberDualInfeasibilities == 0);
+            Assert.IsTrue(Utils.EqualsDouble(last.ObjectiveValue, model.Objective.Value));
+
+            // A small buffer is thinned out, but still covers the whole solve
+            ClpProgressSampler sampler = new ClpProgressSampler(1, 4);
+            Solver solver2 = new Solver(model, typeof(OsiClpSolverInterface));
+            solver2.Generate();
+            ClpSimplex clpSimplex = ((OsiClpSolverInterface)solver2.OsiSolver).getModelPtr();
+            clpSimplex.passInEventHandler(sampler);
+            solver2.Solve();
+            Assert.IsTrue(sampler.getNumberSamples() > 0 && sampler.getNumberSamples() <= 4);
+            if (samples.Length - 1 > 4) Assert.IsTrue(sampler.getCurrentInterval() > 1);
+            clpSimplex.removeEventHandler();
+
+            // A sampler passed in replaces the previous sampler, instead of passing the events on to it
+            ClpProgressSampler sampler3 = new ClpProgressSampler(1);
+            Solver solver3 = new Solver(model, typeof(OsiClpSolverInterface));
+            solver3.Generate();
+            ClpSimplex clpSimplex3 = ((OsiClpSolverInterface)solver3.OsiSolver).getModelPtr();
+            sampler.reset();
+            clpSimplex3.passInEventHandler(sampler);
+            clpSimplex3.passInEventHandler(sampler3);
+            solver3.Solve();
+            Assert.IsTrue(sampler3.getNumberSamples() > 0);
+            Assert.IsTrue(sampler.getNumberSamples() == 0);
+
+            // Removing restores the event handler before the first sampler, and does nothing without a sampler
+            clpSimplex3.removeEventHandler();
+            clpSimplex3.removeEventHandler();
+
+            solver.ProgressInterval = 0;
+            solver.Resolve();
+            Assert.IsTrue(solver.ProgressSamples.Length == 0);
+
+            bool failed = false;
+            try
+            {
+                new ClpProgressSampler(0);
+            }
+            catch (CoinError)
+            {
+                failed = true;
+            }
+            Assert.IsTrue(failed);
+#endif
+        }
+
+        [TestMethod, TestCategory("Log")]
+        public void SonnetTest58()
+        {
+            Console.WriteLine("SonnetTest58 - Test the level checks and the synchronous and asynchronous writing of SonnetLog");
+
+            SonnetLog log = SonnetLog.Default;
+            int logLevel = log.LogLevel;
+            System.IO.TextWriter console = Console.Out;
+            System.IO.StringWriter output = new System.IO.StringWriter();
+            Console.SetOut(output);
+            try
+            {
+                // Disabled messages are still returned, but not written
+                log.LogLevel = 1;
+                Assert.IsFalse(log.IsDebugEnabled);
+                Assert.IsFalse(log.IsInfoEnabled);
+                Assert.IsTrue(log.DebugFormat("SonnetTest58 debug {0}", 1) == "SonnetTest58 debug 1");
+                Assert.IsTrue(log.InfoFormat("SonnetTest58 info {0} {1}", 1, 2) == "SonnetTest58 info 1 2");
+                Assert.IsTrue(log.WarnFormat("SonnetTest58 warning {0}", 3) == "SonnetTest58 warning 3");
+
+                log.LogLevel = 3;
+                Assert.IsTrue(log.IsDebugEnabled);
+                Assert.IsTrue(log.DebugFormat("SonnetTest58 debug {0}", 4) == "SonnetTest58 debug 4");
+
+                // Synchronous by default, asynchronous on request
+                Assert.IsFalse(log.Asynchronous);
+                log.Info("SonnetTest58 synchronous");
+                Assert.IsTrue(output.ToString().Contains("SonnetTest58 synchronous"));
+
+                // The level is that of the message handler, also if changed by a solver that uses it
+                using (OsiClpSolverInterface osiClp = new OsiClpSolverInterface())
+                {
+                    log.PassToSolver(osiClp);
+                    osiClp.messageHandler().setLogLevel(1);
+                    Assert.IsTrue(log.LogLevel == 1);
+                    Assert.IsFalse(log.IsInfoEnabled);
+                    log.Info("SonnetTest58 info after solver level");
+                    osiClp.messageHandler().setLogLevel(3);
+                    Assert.IsTrue(log.IsDebugEnabled);
+                }
+
+                // Each thread writes through its own handler, without locking
+                System.Threading.Tasks.Parallel.For(0, 4, t =>
+                {
+                    for (int i = 0; i < 100; i++) log.InfoFormat("SonnetTest58 thread {0} message {1}", t, i);
+                });
+                for (int t = 0; t < 4; t++) Assert.IsTrue(output.ToString().Contains($"SonnetTest58 thread {t} message 99"));
+
+                log.Asynchronous = true;
+                log.Info("SonnetTest58 asynchronous");
+                log.Flush();
+                Assert.IsTrue(output.ToString().Contains("SonnetTest58 asynchronous"));
+                Assert.IsTrue(log.NumberDropped == 0);
+                log.Asynchronous = false;
+            }
+            finally
+            {
+                log.LogLevel = logLevel;
+                Console.SetOut(console);
+            }
+
+            string text = output.ToString();
+            Assert.IsFalse(text.Contains("SonnetTest58 debug 1"));
+            Assert.IsFalse(text.Contains("SonnetTest58 info"));
+            Assert.IsTrue(text.Contains("SonnetTest58 warning 3"));
+            Assert.IsTrue(text.Contains("SonnetTest58 debug 4"));
+            Assert.IsTrue(text.Contains("SonnetTest58 synchronous"));
+        }
+
+        [TestMethod, TestCategory("Transitions")]
+        public void SonnetTest59()
+        {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("The transition counters require SonnetWrapper.");
+#else
+            Console.WriteLine("SonnetTest59 - Test the report of the managed/native transition counters");
+
+            Solver.ResetTransitionCounters();
+
+            Variable x = new Variable("x");
+            Variable y = new Variable("y");
+            Model model = new Model("test59");
+            model.Add("c1", x + 2 * y <= 4);
+            model.Objective = new Objective("obj", x + y);
+            model.ObjectiveSense = ObjectiveSense.Maximise;
+
+            Solver solver = new Solver(model, typeof(OsiClpSolverInterface));
+            solver.Solve();
+            x.Upper = 1.0;
+            solver.Resolve();
+            Assert.IsTrue(solver.IsProvenOptimal);
+
+            string report = Solver.ToTransitionReportString();
+            Console.WriteLine(report);
+            if (TransitionCounters.IsEnabled)
+            {
+                TransitionCounter[] counters = TransitionCounters.getCounters();
+                Assert.IsTrue(counters.Any(c => c.Name.Contains("loadProblem") && c.Calls == 1 && c.Bytes > 0));
+                Assert.IsTrue(counters.Any(c => c.Name.Contains("setColUpper") && c.Calls >= 1));
+                Assert.IsTrue(report.Contains("loadProblem"));
+
+                Solver.ResetTransitionCounters();
+                Assert.IsTrue(TransitionCounters.getCounters().All(c => c.Calls == 0));
+            }
+            else
+            {
+                Assert.IsTrue(TransitionCounters.getCounters().Length == 0);
+                Assert.IsTrue(report.Contains("Not counted"));
+            }
+#endif
+        }
+
+        [TestMethod]
+        public void SonnetTest60()
+        {
+            Console.WriteLine("SonnetTest60 - Test that variables and constraints created on multiple threads get unique ids");
+
+            const int threads = 4;
+            const int count = 20000;
+            int[][] variableIds = new int[threads][];
+            int[][] constraintIds = new int[threads][];
+            System.Threading.Tasks.Parallel.For(0, threads, new System.Threading.Tasks.ParallelOptions() { MaxDegreeOfParallelism = threads }, t =>
+            {
+                variableIds[t] = new int[count];
+                constraintIds[t] = new int[count];
+                for (int i = 0; i < count; i++)
+                {
+                    Variable x = new Variable();
+                    Constraint con = x <= 1.0;
+                    variableIds[t][i] = x.ID;
+                    constraintIds[t][i] = con.ID;
+                }
+            });
+
+            Assert.IsTrue(variableIds.SelectMany(ids => ids).Distinct().Count() == threads * count);
+            Assert.IsTrue(constraintIds.SelectMany(ids => ids).Distinct().Count() == threads * count);
+        }
+
+        [DynamicData(nameof(Utils.TestSolverTypes), typeof(Utils))]
+        [TestMethod, TestCategory("Probe"), TestCategory("Ranging")]
+        public void SonnetTest61(Type solverType)
+        {
+            Console.WriteLine("SonnetTest61 - Test ranging after probing, which restores the LP solution at the solver");
+
+            Model model = new Model();
+            Variable x = new Variable("x");
+            Variable y = new Variable("y");
+            Constraint con0 = x + 2 * y <= 4;
+            Constraint con1 = 3 * x + y <= 6;
+            model.Add("con0", con0);
+            model.Add("con1", con1);
+            model.Objective = x + y;
+
+            Solver solver = new Solver(model, solverType);
+            solver.Maximise();
+            Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 2.8));
+
+            // the last probe is infeasible
+            ProbeResult[] results = solver.Probe(new List<BoundChange[]>()
+            {
+                new BoundChange[] { BoundChange.Fix(x, 0.0) },
+                new BoundChange[] { new BoundChange(x, 3.0, 4.0) }
+            });
+            Assert.IsTrue(results[0].IsProvenOptimal);
+            Assert.IsFalse(results[1].IsProvenOptimal);
+
+            // the solution at the solver is the original one
+            Assert.IsTrue(solver.IsProvenOptimal);
+            Assert.IsTrue(solver.OsiSolver.isProvenOptimal());
+            Assert.IsTrue(Utils.EqualsDouble(solver.OsiSolver.getObjValue(), 2.8));
+            Assert.IsTrue(Utils.EqualsDouble(solver.OsiSolver.getColSolution()[0], 1.6));
+
+            // such that ranging gives the ranges of the original solution
+            Dictionary<Variable, SensitivityRange> objectiveRanges = solver.GetObjectiveRanges();
+            Assert.IsTrue(Utils.EqualsDouble(objectiveRanges[x].Lower, 0.5));
+            Assert.IsTrue(Utils.EqualsDouble(objectiveRanges[x].Upper, 3.0));
+            Dictionary<Constraint, SensitivityRange> rhsRanges = solver.GetRhsRanges();
+            Assert.IsTrue(Utils.EqualsDouble(rhsRanges[con0].Lower, 2.0));
+            Assert.IsTrue(Utils.EqualsDouble(rhsRanges[con0].Upper, 12.0));
+
+            // and probing again starts from the original solution
+            Assert.IsTrue(Utils.EqualsDouble(solver.Probe(new BoundChange[] { BoundChange.Fix(y, 0.0) }).ObjectiveValue, 2.0));
+        }
+
+        private static void Compress(string fileName, string compressedFileName)
+        {
+            using (System.IO.FileStream source = System.IO.File.OpenRead(fileName))
+            using (System.IO.FileStream target = System.IO.File.Create(compressedFileName))
+            using (System.IO.Compression.GZipStream gzip = new System.IO.Compression.GZipStream(target, System.IO.Compression.CompressionMode.Compress))
+            {
+                source.CopyTo(gzip);
+            }
+        }
+
     }
 }
 
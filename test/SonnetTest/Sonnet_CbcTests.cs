@@ -4,7 +4,11 @@
 using System;
 using System.Collections.Generic;
 using System.Linq;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
 using COIN;
+#endif
 using Sonnet;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 
@@ -16,6 +20,9 @@ namespace SonnetTest
         [TestMethod, TestCategory("Cbc")]
         public void SonnetCbcTest1()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("CbcStrategyNull and addCutGenerator require the CbcModel of SonnetWrapper.");
+#else
             Console.WriteLine("SonnetCbcTest1 - Cbc test set CbcStrategyNull and addCutGenerator");
 
             Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always";
@@ -34,11 +41,15 @@ namespace SonnetTest
 
             Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 124725));
             //Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 104713.12807881772));
+#endif
         }
 
         [TestMethod, TestCategory("Cbc")]
         public void SonnetCbcTest2()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("CbcStrategyDefault requires the CbcModel of SonnetWrapper.");
+#else
             Console.WriteLine("SonnetCbcTest2 - Cbc set CbcStrategyDefault");
 
             Model model = Model.New("MIP-124725.mps"); // added file to project, "Copy Always"
@@ -63,6 +74,7 @@ namespace SonnetTest
 
             solver.Solve(true);
             Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 104713.12807881772));
+#endif
         }
 
         [TestMethod, TestCategory("Cbc"), TestCategory("Logging")]
@@ -154,6 +166,9 @@ namespace SonnetTest
         [TestMethod, TestCategory("Cbc")]
         public void SonnetCbcTest5()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("AddCbcSolverArgs requires the OsiCbcSolverInterface of SonnetWrapper.");
+#else
             Console.WriteLine("SonnetCbcTest5 - Test CbcModel Event Handler");
 
             SonnetLog.Default.LogLevel = 4;
@@ -186,11 +201,15 @@ namespace SonnetTest
             // Allow also better solutions, but not worse. The problem is minimization.
             // If you machine is significantly slower, the solution will be worse and this test will fail--but can be ignored.
             Assert.IsTrue(model.Objective.Value >= 11801.18 && model.Objective.Value <= 14168.34, $"Best minimization solution of mas74 until now is ${model.Objective.Value} but should be between 11801.18 (opt) and 14168.34");
+#endif
         }
 
         [TestMethod, TestCategory("Cbc")]
         public void SonnetCbcTest6()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("AddCbcSolverArgs, setObjValue and setCutoff require the OsiCbcSolverInterface and CbcModel of SonnetWrapper.");
+#else
             Console.WriteLine("SonnetCbcTest6 - Test CbcModel setObjValue and setCutoff for Minimization");
 
             // This test check the improvement of solving when a good solution obj value is given in advance.
@@ -240,11 +259,15 @@ namespace SonnetTest
             Assert.IsTrue(nodes1 == nodes1b, $"Number of nodes should be equal to original but {nodes1} != {nodes1b}.");
 
             // Not advised to use osiCbc.Model.setCutoff  Unreliable results especially for Maximisation
+#endif
         }
 
         [TestMethod, TestCategory("Cbc")]
         public void SonnetCbcTest7()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("AddCbcSolverArgs, setObjValue and setCutoff require the OsiCbcSolverInterface and CbcModel of SonnetWrapper.");
+#else
             Console.WriteLine("SonnetCbcTest7 - Test CbcModel setObjValue for Maximization");
             SonnetLog.Default.LogLevel = 4;
             // This test check the improvement of solving when a good solution obj value is given in advance.
@@ -300,11 +323,15 @@ namespace SonnetTest
 
             // Not advised to use osiCbc.Model.setCutoff  Unreliable results especially for Maximisation
 
+#endif
         }
 
         [TestMethod, TestCategory("Cbc")]
         public void SonnetCbcTest8()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("AddCbcSolverArgs requires the OsiCbcSolverInterface of SonnetWrapper.");
+#else
             Console.WriteLine("SonnetCbcTest8 - Test solver.SetMIPStart");
             SonnetLog.Default.LogLevel = 4;
 
@@ -346,6 +373,7 @@ namespace SonnetTest
             Assert.IsTrue(Utils.EqualsDouble(model.Objective.Value, 124725));
 
             Assert.IsTrue(nodes1 < nodes2, $"Providing a feasible solution must result in improved performance, but number of nodes went from {nodes1} to {nodes2}.");
+#endif
         }
 
         private static int SonnetCbcTest9MaxThreadId = 0;
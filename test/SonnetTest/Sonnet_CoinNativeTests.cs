@@ -4,7 +4,11 @@
 using System;
 using System.Collections.Generic;
 using System.Linq;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
 using COIN;
+#endif
 using Sonnet;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 
@@ -50,6 +54,7 @@ namespace SonnetTest
 #endif
 
     }
+    // The native tests of SonnetWrapper. For SonnetBackend=Native, see SonnetNativeTest instead.
     /// <summary>
     /// Runs the Cbc native gams test.
     /// Asserts that the return value is zero
@@ -57,8 +62,12 @@ namespace SonnetTest
     [TestMethod, TestCategory("CoinNative")]
         public void SonnetCoinNativeTest1()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("The native COIN-OR tests are part of SonnetWrapper. For SonnetBackend=Native, run SonnetNativeTest (ctest) instead.");
+#else
             Console.WriteLine("SonnetCoinNativeTest1: GamsTest");
             Assert.IsTrue(NativeTests.RunGamsTest() == 0);
+#endif
         }
 
         /// <summary>
@@ -68,9 +77,13 @@ namespace SonnetTest
         [TestMethod, TestCategory("CoinNative")]
         public void SonnetCoinNativeTest2()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("The native COIN-OR tests are part of SonnetWrapper. For SonnetBackend=Native, run SonnetNativeTest (ctest) instead.");
+#else
             Console.WriteLine("SonnetCoinNativeTest2: Cbc's osiUnitTest.exe -mpsDir=" + SampleDir);
             Assert.IsTrue(System.IO.Directory.Exists(SampleDir), "SampleDir not found at " + SampleDir);
             Assert.IsTrue(NativeTests.RunOsiCbcUnitTest(SampleDir) == 0);
+#endif
         }
 
         /// <summary>
@@ -80,6 +93,9 @@ namespace SonnetTest
         [TestMethod, TestCategory("CoinNative")]
         public void SonnetCoinNativeTest3()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("The native COIN-OR tests are part of SonnetWrapper. For SonnetBackend=Native, run SonnetNativeTest (ctest) instead.");
+#else
 #if DEBUG
             // in Debug, skip the miplib tests, since AIR03 takes far too long in DEBUG.
             Console.WriteLine("SonnetCoinNativeTest3 (DBG): cbc.exe -dirSample " + SampleDir + " -unitTest");
@@ -90,6 +106,7 @@ namespace SonnetTest
             Assert.IsTrue(System.IO.Directory.Exists(SampleDir), "SampleDir not found at " + SampleDir);
             Assert.IsTrue(System.IO.Directory.Exists(MipLibDir), "MipLibDir not found at " + MipLibDir);
             Assert.IsTrue(NativeTests.RunCbc(SampleDir, MipLibDir) == 0);
+#endif
 #endif
         }
 
@@ -100,9 +117,13 @@ namespace SonnetTest
         [TestMethod, TestCategory("CoinNative")]
         public void SonnetCoinNativeTest4()
         {
+#if (SONNET_NATIVE)
+            Assert.Inconclusive("The native COIN-OR tests are part of SonnetWrapper. For SonnetBackend=Native, run SonnetNativeTest (ctest) instead.");
+#else
             Console.WriteLine("SonnetCoinNativeTest4: Clp's osiUnitTest.exe -mpsDir=" + SampleDir);
             Assert.IsTrue(System.IO.Directory.Exists(SampleDir), "SampleDir not found at " + SampleDir);
             Assert.IsTrue(NativeTests.RunOsiClpUnitTest(SampleDir) == 0);
+#endif
         }
 
         // Skipping CInterfaceTest
@@ -4,6 +4,11 @@
 using System;
 using Microsoft.VisualStudio.TestTools.UnitTesting;
 using Sonnet;
+#if (SONNET_NATIVE)
+using COIN.Native;
+#else
+using COIN;
+#endif
 
 namespace SonnetTest
 {
@@ -132,7 +137,7 @@ namespace SonnetTest
             Variable x2 = new Variable("x2", VariableType.Integer);
 
             Model model = new Model();
-            Solver solver = new Solver(model, typeof(COIN.OsiCbcSolverInterface));
+            Solver solver = new Solver(model, typeof(OsiCbcSolverInterface));
             Objective obj = new Objective(0.5 * x1 * x1 + x2 * x2 - x1 * x2 - 2 * x1 - 6 * x2);
 
             Constraint con1 = x1 + x2 <= 2;
@@ -144,7 +149,7 @@ namespace SonnetTest
             model.Add(con3);
             model.Objective = obj;
             model.ObjectiveSense = ObjectiveSense.Minimise;
-            if (solver.OsiSolver is COIN.OsiCbcSolverInterface) ((COIN.OsiCbcSolverInterface)solver.OsiSolver).SetCbcSolverArgs("-branchAndBound");
+            if (solver.OsiSolver is OsiCbcSolverInterface) ((OsiCbcSolverInterface)solver.OsiSolver).SetCbcSolverArgs("-branchAndBound");
 
             solver.Export("testmiqp.mps");
 